@@ -129,6 +129,23 @@ public:
     MONGO_COMPILER_COLD_FUNCTION Status(Extra&& extra, Reason&& reason)
         : Status{std::forward<Extra>(extra), std::string{std::forward<Reason>(reason)}} {}
 
+    /**
+     * Returns a reference to an immortal error Status that is constructed exactly once per
+     * (code, `makeReason` functor type) pair and shared by all subsequent calls from the same
+     * instantiation. Copies of the returned Status only adjust the shared ErrorInfo reference
+     * count, so hot paths that repeatedly raise the same error (e.g. write conflicts) avoid
+     * allocating a fresh ErrorInfo on every occurrence.
+     *
+     * `makeReason` is only invoked on the first call, and must produce the same reason every
+     * time. Pass a distinct lambda per call site: the closure type is what keys the cache.
+     */
+    template <ErrorCodes::Error code, typename ReasonFn>
+    static const Status& interned(ReasonFn makeReason) {
+        MONGO_STATIC_ASSERT(code != ErrorCodes::OK);
+        static const StaticImmortal<Status> status{Status(code, std::string{makeReason()})};
+        return *status;
+    }
+
     /**
      * Returns a new Status with the same data as this, but with the reason string replaced with
      * newReason.  The new reason is not visible to any other Statuses that share the same ErrorInfo
@@ -323,4 +340,12 @@ private:
     boost::intrusive_ptr<const ErrorInfo> _error;
 };
 
+// A `Status` is a single refcounted pointer: an OK Status owns no allocation, copying one is a
+// reference count adjustment, and moves are pointer swaps. Success paths that return or pass a
+// `Status` by value are therefore allocation-free. Guard those properties, since code relies on
+// them for performance.
+MONGO_STATIC_ASSERT(sizeof(Status) == sizeof(void*));
+MONGO_STATIC_ASSERT(std::is_nothrow_move_constructible_v<Status>);
+MONGO_STATIC_ASSERT(std::is_nothrow_move_assignable_v<Status>);
+
 }  // namespace mongo
@@ -165,6 +165,25 @@ TEST(Status, WithContext) {
     ASSERT_EQ(orig.reason(), "error");
 }
 
+TEST(Status, Interned) {
+    auto getInterned = [] {
+        return Status::interned<ErrorCodes::WriteConflict>([] { return "interned error"; });
+    };
+
+    const Status& first = getInterned();
+    ASSERT_EQ(first.code(), ErrorCodes::WriteConflict);
+    ASSERT_EQ(first.reason(), "interned error");
+
+    // Repeated calls from the same instantiation share a single ErrorInfo.
+    const Status& second = getInterned();
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(&first.reason(), &second.reason());
+
+    // Copies share the interned ErrorInfo rather than allocating their own.
+    const Status copy = getInterned();
+    ASSERT_EQ(&copy.reason(), &first.reason());
+}
+
 TEST(Status, CloningCopy) {
     Status orig(ErrorCodes::MaxError, "error");
     Status dest(orig);
@@ -181,6 +181,12 @@ private:
     boost::optional<T> _t;
 };
 
+// The success path of `StatusWith` is allocation-free: it holds an OK `Status` (a null pointer)
+// and constructs the value in place, and moving it moves only the pointer and the value. Guard
+// the move-related properties so hot returns of `StatusWith` stay cheap.
+MONGO_STATIC_ASSERT(std::is_nothrow_move_constructible_v<StatusWith<int>>);
+MONGO_STATIC_ASSERT(std::is_nothrow_move_assignable_v<StatusWith<int>>);
+
 template <typename T>
 std::string stringifyForAssert(const StatusWith<T>& sw) {
     if (sw.isOK()) {
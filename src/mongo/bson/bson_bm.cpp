@@ -229,6 +229,45 @@ void BM_validate(benchmark::State& state) {
     state.SetBytesProcessed(totalSize);
 }
 
+void BM_validateLongFieldNames(benchmark::State& state) {
+    // Documents dominated by long field names stress the cstring scanning part of validation.
+    BSONArrayBuilder builder;
+    auto len = state.range(0);
+    size_t totalSize = 0;
+    for (auto j = 0; j < len; j++) {
+        BSONObjBuilder subObj(builder.subobjStart());
+        for (int field = 0; field < 8; field++)
+            subObj.append(fmt::format("{:x<56s}{:08x}", "longFieldName", field), field);
+    }
+    BSONObj array = builder.done();
+    invariant(validateBSON(array.objdata(), array.objsize()).isOK());
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(validateBSON(array.objdata(), array.objsize()));
+        totalSize += array.objsize();
+    }
+    state.SetBytesProcessed(totalSize);
+}
+
+void BM_validateNested(benchmark::State& state) {
+    // Deeply nested documents with short field names are the worst case for vectorized scanning,
+    // as nearly every field name terminates within the first few bytes.
+    BSONObj obj = BSON("leaf" << 1);
+    auto depth = state.range(0);
+    size_t totalSize = 0;
+    for (auto j = 0; j < depth; j++)
+        obj = BSON("o" << obj << "n" << j);
+    invariant(validateBSON(obj.objdata(), obj.objsize()).isOK());
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(validateBSON(obj.objdata(), obj.objsize()));
+        totalSize += obj.objsize();
+    }
+    state.SetBytesProcessed(totalSize);
+}
+
 void BM_validate_contents(benchmark::State& state) {
     BSONArrayBuilder builder;
     auto len = state.range(0);
@@ -260,6 +299,8 @@ BENCHMARK(BM_arrayStlIterateWithSize)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BSONnFields)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_bsonIteratorSortedConstruction)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_validate)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_validateLongFieldNames)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_validateNested)->Ranges({{{1}, {30}}});
 BENCHMARK(BM_validate_contents)->Ranges({{{1}, {1'000}}});
 
 }  // namespace mongo
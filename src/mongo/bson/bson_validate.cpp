@@ -55,12 +55,21 @@
 #include "mongo/bson/util/bsoncolumn_util.h"
 #include "mongo/crypto/encryption_fields_util.h"
 #include "mongo/crypto/fle_field_schema_gen.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decimal_counter.h"
 #include "mongo/util/str.h"
 #include "mongo/util/str_escape.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MONGO_BSON_VALIDATE_USE_SSE 1
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#endif
+
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
 
 
@@ -528,9 +537,32 @@ private:
         }
 
         size_t strlen() const {
-            // This is actually by far the hottest code in all of BSON validation.
+            // This is actually by far the hottest code in all of BSON validation. Scan for the
+            // terminating NUL a vector register at a time where the architecture allows it. Only
+            // full in-bounds loads are issued: the scalar loop below handles the tail of the
+            // buffer, so we never read past 'end'.
             dassert(ptr < end);
             size_t len = 0;
+#if defined(MONGO_BSON_VALIDATE_USE_SSE)
+#if defined(__AVX2__)
+            while (ptr + len + 32 <= end) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + len));
+                uint32_t mask = static_cast<uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_setzero_si256())));
+                if (mask)
+                    return len + countTrailingZerosNonZero32(mask);
+                len += 32;
+            }
+#endif
+            while (ptr + len + 16 <= end) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + len));
+                uint32_t mask = static_cast<uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128())));
+                if (mask)
+                    return len + countTrailingZerosNonZero32(mask);
+                len += 16;
+            }
+#endif
             while (ptr[len])
                 ++len;
             return len;
@@ -962,6 +962,60 @@ private:
     }
 };
 
+/**
+ * Alternative to BSONObjBuilder which carves the document out of a SharedBufferFragmentBuilder
+ * arena instead of making a malloc'd allocation per document. Hot paths that serialize many
+ * documents per operation (update effects, oplog entries) can own one arena and amortize a single
+ * allocation across all of them.
+ *
+ * The finished document either aliases the arena via obj(), sharing ownership of the underlying
+ * ref-counted block, or can be copied out once with done().getOwned() when it must not pin the
+ * arena's memory.
+ */
+class PooledFragmentBSONObjBuilder
+    : public BSONObjBuilderBase<PooledFragmentBSONObjBuilder, PooledFragmentBuilder> {
+private:
+    using Super = BSONObjBuilderBase<PooledFragmentBSONObjBuilder, PooledFragmentBuilder>;
+    friend Super;
+
+public:
+    explicit PooledFragmentBSONObjBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
+        : Super(kDefaultSize, fragmentBuilder) {}
+
+    PooledFragmentBSONObjBuilder(PooledFragmentBSONObjBuilder&&) = default;
+    PooledFragmentBSONObjBuilder(const PooledFragmentBSONObjBuilder&) = delete;
+    PooledFragmentBSONObjBuilder& operator=(const PooledFragmentBSONObjBuilder&) = delete;
+
+    ~PooledFragmentBSONObjBuilder() {
+        Super::_destruct();
+    }
+
+    /**
+     * destructive
+     * The returned BSONObj shares ownership of the arena block backing this document, keeping it
+     * alive for as long as the object (or anything it was handed off to) is in scope.
+     */
+    template <typename BSONTraits = BSONObj::DefaultSizeTrait>
+    BSONObj obj() {
+        massert(9994400, "builder does not own memory", owned());
+        doneFast();
+        SharedBufferFragment fragment = _b.done();
+        BSONObj out(fragment.get(), BSONTraits{});
+        out.shareOwnershipWith(fragment.ownershipBuffer());
+        return out;
+    }
+
+private:
+    // Compile-time "virtual" which must be provided to satisfy the base class.
+    void doDone() {
+        // Intentionally left empty.
+    }
+
+    void doResetToEmpty() {
+        // Intentionally left empty.
+    }
+};
+
 /**
  * Base class for building BSON arrays. Similar to BSONObjBuilderBase.
  */
@@ -42,6 +42,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/oid.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/compiler.h"
 #include "mongo/platform/random.h"
 #include "mongo/util/hex.h"
 #include "mongo/util/str.h"
@@ -56,6 +57,22 @@ const std::size_t kInstanceUniqueOffset = kTimestampOffset + OID::kTimestampSize
 const std::size_t kIncrementOffset = kInstanceUniqueOffset + OID::kInstanceUniqueSize;
 OID::InstanceUnique _instanceUnique;
 
+// Bumped whenever the instance-wide OID state is regenerated (e.g. after a fork) so that
+// increment blocks cached by threads of the old instance are discarded rather than replayed.
+AtomicWord<uint64_t> _instanceGeneration{0};
+
+// Number of increment values a thread reserves from the shared counter at a time. Refilling in
+// blocks keeps the counter's cache line out of the per-id hot path; the blocks are disjoint
+// ranges of the same 64-bit sequence, so the truncated 24-bit values have the same uniqueness
+// properties as per-id fetches.
+constexpr uint64_t kIncrementBlockSize = 1024;
+
+struct IncrementBlock {
+    uint64_t next = 0;
+    uint64_t end = 0;
+    uint64_t generation = 0;
+};
+
 bool isHexit(char c) {
     return ((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'f')) || ((c >= 'A') && (c <= 'F'));
 }
@@ -70,7 +87,14 @@ MONGO_INITIALIZER_GENERAL(OIDGeneration, (), ("default"))
 }
 
 OID::Increment OID::Increment::next() {
-    uint64_t nextCtr = counter->fetchAndAdd(1);
+    thread_local IncrementBlock block;
+    const auto generation = _instanceGeneration.loadRelaxed();
+    if (MONGO_unlikely(block.next == block.end || block.generation != generation)) {
+        block.next = static_cast<uint64_t>(counter->fetchAndAdd(kIncrementBlockSize));
+        block.end = block.next + kIncrementBlockSize;
+        block.generation = generation;
+    }
+    uint64_t nextCtr = block.next++;
     OID::Increment incr;
 
     incr.bytes[0] = uint8_t(nextCtr >> 16);
@@ -129,6 +153,8 @@ size_t OID::Hasher::operator()(const OID& oid) const {
 void OID::regenMachineId() {
     SecureRandom entropy;
     _instanceUnique = InstanceUnique::generate(entropy);
+    counter->store(entropy.nextInt64());
+    _instanceGeneration.fetchAndAdd(1);
 }
 
 unsigned OID::getMachineId() {
@@ -27,7 +27,9 @@
  *    it in the license file.
  */
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/util/builder.h"
+#include "mongo/util/shared_buffer_fragment.h"
 #include <benchmark/benchmark.h>
 
 namespace mongo {
@@ -61,4 +63,37 @@ BENCHMARK_TEMPLATE(BM_growBuffer, StackBufBuilder)
     ->Ranges({{0, 1}, {1, 256}})
     ->Iterations(BufferMaxSize / 256);
 
+// Builds a batch of small documents with one malloc'd buffer per document.
+void BM_buildDocumentsMalloc(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < state.range(0); ++i) {
+            BSONObjBuilder bob;
+            bob.append("_id", i);
+            bob.append("field", "value");
+            benchmark::DoNotOptimize(bob.obj());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Builds the same batch out of a per-batch bump arena, amortizing one allocation over all
+// documents as the per-operation arena in hot write paths does.
+void BM_buildDocumentsPooled(benchmark::State& state) {
+    SharedBufferFragmentBuilder fragmentBuilder(
+        SharedBufferFragmentBuilder::kDefaultMaxBlockSize);
+    for (auto _ : state) {
+        for (int i = 0; i < state.range(0); ++i) {
+            PooledFragmentBSONObjBuilder bob(fragmentBuilder);
+            bob.append("_id", i);
+            bob.append("field", "value");
+            benchmark::DoNotOptimize(bob.obj());
+        }
+        fragmentBuilder.freeUnused();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_buildDocumentsMalloc)->Ranges({{1, 10'000}});
+BENCHMARK(BM_buildDocumentsPooled)->Ranges({{1, 10'000}});
+
 }  // namespace mongo
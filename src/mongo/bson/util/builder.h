@@ -652,6 +652,9 @@ public:
     PooledFragmentBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
         : BasicBufBuilder(fragmentBuilder.start(0)) {}
 
+    PooledFragmentBuilder(size_t initsize, SharedBufferFragmentBuilder& fragmentBuilder)
+        : BasicBufBuilder(fragmentBuilder.start(initsize)) {}
+
     SharedBufferFragment done() {
         return _buf.finish(len());
     }
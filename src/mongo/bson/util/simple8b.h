@@ -378,6 +378,17 @@ inline size_t visitAll(const char* buffer,
         buffer, size, prevNonRLE, visit, [&visit]() { visit(0); }, visitMissing);
 }
 
+/**
+ * Decodes all values over multiple Simple8b blocks into the contiguous buffer 'out', which must
+ * have room for at least count(buffer, size) values. Missing values are written as 'missing'.
+ * Decoding into a flat array allows callers to run vectorizable kernels (e.g. predicate
+ * evaluation over decompressed metrics) instead of consuming values one at a time. 'prevNonRLE'
+ * should be initialized to 'kSingleSkip' for the first buffer and passed along between calls.
+ * Returns the number of values written.
+ */
+template <typename T>
+inline size_t decodeInto(const char* buffer, size_t size, uint64_t& prevNonRLE, T* out, T missing);
+
 /**
  * Returns the total number of values over multiple Simple8b blocks including missing values.
  */
@@ -1243,6 +1243,21 @@ inline size_t visitAll(const char* buffer,
     return numVisited;
 }
 
+template <typename T>
+inline size_t decodeInto(const char* buffer, size_t size, uint64_t& prevNonRLE, T* out, T missing) {
+    // Emitting through the per-selector visit kernels into a bump pointer produces tight
+    // store loops that the compiler can vectorize, unlike value-at-a-time iteration.
+    T* pos = out;
+    visitAll<T>(
+        buffer,
+        size,
+        prevNonRLE,
+        [&pos](T v) { *pos++ = v; },
+        [&pos]() { *pos++ = 0; },
+        [&pos, missing]() { *pos++ = missing; });
+    return pos - out;
+}
+
 inline size_t count(const char* buffer, size_t size) {
     invariant(size % 8 == 0);
     const char* end = buffer + size;
@@ -31,7 +31,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <random>
+#include <vector>
 
 #include <boost/cstdint.hpp>
 
@@ -191,6 +193,70 @@ void BM_decode(benchmark::State& state) {
     state.SetBytesProcessed(totalBytes);
 }
 
+// Builds a buffer exercising one encoding shape: 0 = small changing values, 1 = large values,
+// 2 = RLE, 3 = extended selector 7.
+BufBuilder generateForShape(int64_t shape) {
+    BufBuilder _buffer;
+    auto writeFn = [&_buffer](uint64_t simple8bBlock) {
+        _buffer.appendNum(simple8bBlock);
+    };
+    Simple8bBuilder<uint64_t> s8bBuilder;
+
+    for (auto j = 0; j < 1000; j++) {
+        uint64_t value;
+        switch (shape) {
+            case 0:
+                value = j % 2;
+                break;
+            case 1:
+                value = j % 2 ? 0xE0 : 0xFF;
+                break;
+            case 2:
+                value = 0;
+                break;
+            default:
+                value = j % 2 ? 0b1000000000000 : 0b11000000000000;
+                break;
+        }
+        s8bBuilder.append(value, writeFn);
+    }
+
+    s8bBuilder.flush(writeFn);
+    return _buffer;
+}
+
+void BM_decodeIterator(benchmark::State& state) {
+    BufBuilder buffer = generateForShape(state.range(0));
+    auto size = buffer.len();
+    auto buf = buffer.release();
+    Simple8b<uint64_t> s8b(buf.get(), size);
+
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(std::distance(s8b.begin(), s8b.end()));
+        totalBytes += size;
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_decodeBatch(benchmark::State& state) {
+    BufBuilder buffer = generateForShape(state.range(0));
+    auto size = buffer.len();
+    auto buf = buffer.release();
+    std::vector<int64_t> out(simple8b::count(buf.get(), size));
+
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        uint64_t prev = simple8b::kSingleSkip;
+        benchmark::DoNotOptimize(simple8b::decodeInto<int64_t>(
+            buf.get(), size, prev, out.data(), std::numeric_limits<int64_t>::min()));
+        totalBytes += size;
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
 void BM_sum(benchmark::State& state) {
     BufBuilder buffer = generateIntegers();
     auto size = buffer.len();
@@ -288,6 +354,8 @@ BENCHMARK(BM_changingSmallValues)->Arg(100);
 BENCHMARK(BM_changingLargeValues)->Arg(100);
 BENCHMARK(BM_selectorSeven)->Arg(100);
 BENCHMARK(BM_decode);
+BENCHMARK(BM_decodeIterator)->DenseRange(0, 3);
+BENCHMARK(BM_decodeBatch)->DenseRange(0, 3);
 BENCHMARK(BM_sum);
 BENCHMARK(BM_sumUnoptimized);
 BENCHMARK(BM_prefixSum);
@@ -175,6 +175,25 @@ void testSimple8b(const std::vector<boost::optional<T>>& expectedValues,
         else
             ASSERT_EQ(boost::none, decodedValues[i]);
     }
+
+    // Test decodeInto
+    constexpr auto missing = std::numeric_limits<make_signed_t<T>>::max();
+    std::vector<make_signed_t<T>> flat(expectedValues.size());
+
+    prev = 0xE;
+    size_t decodeCount = simple8b::decodeInto<make_signed_t<T>>(
+        reinterpret_cast<const char*>(expectedBinary.data()),
+        expectedBinary.size(),
+        prev,
+        flat.data(),
+        missing);
+    ASSERT_EQ(expectedValues.size(), decodeCount);
+    for (size_t i = 0; i < expectedValues.size(); ++i) {
+        if (expectedValues[i])
+            ASSERT_EQ(Simple8bTypeUtil::decodeInt(*(expectedValues[i])), flat[i]);
+        else
+            ASSERT_EQ(missing, flat[i]);
+    }
 }
 
 template <typename T>
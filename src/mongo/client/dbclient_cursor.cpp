@@ -230,7 +230,14 @@ BSONObj DBClientCursor::commandDataReceived(const Message& reply) {
         _wasError = true;
     }
 
-    return commandReply->getCommandReply().getOwned();
+    // Share ownership with the network message instead of copying the command reply out of it.
+    // Documents that later share ownership with the returned object, such as the elements of a
+    // cursor batch, are then backed by the message buffer all the way to the consumer without
+    // being copied. The price is that holding onto any of them pins the whole message, which is
+    // acceptable here since a cursor reply consists almost entirely of its batch.
+    BSONObj replyObj = commandReply->getCommandReply();
+    replyObj.shareOwnershipWith(reply.sharedBuffer());
+    return replyObj;
 }
 
 void DBClientCursor::dataReceived(const Message& reply, bool& retry, string& host) {
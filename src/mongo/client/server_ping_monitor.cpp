@@ -216,7 +216,11 @@ void SingleServerPingMonitor::_doServerPing() {
                     anchor->_rttListener->onServerPingFailedEvent(anchor->_hostAndPort,
                                                                   result.response.status);
                 } else {
-                    auto rtt = Microseconds(timer.micros());
+                    // Prefer the network interface's own measurement of the command duration when
+                    // available: the local timer additionally counts executor queueing and
+                    // callback dispatch time, which inflates the RTT whenever the executor is
+                    // busy and skews server selection against otherwise healthy hosts.
+                    auto rtt = result.response.elapsed.value_or(Microseconds(timer.micros()));
                     anchor->_rttListener->onServerPingSucceededEvent(rtt, anchor->_hostAndPort);
                 }
             }
@@ -1841,12 +1841,14 @@ FLEEdgeCountInfo getEdgeCountInfoForPadding(const FLEStateCollectionReader& read
         FLEAnchorPaddingDerivedGenerator::generateAnchorPaddingValueToken(anchorPaddingRootToken);
     // There are no non-anchor padding edges, so we can skip the binaryHops search.
     auto tracker = FLEStatusSection::get().makeEmuBinaryTracker();
-    auto apos = ESCCollectionAnchorPadding::anchorBinaryHops(reader, tagToken, valueToken, tracker);
+    EmuBinaryAnchorCache anchorCache;
+    auto apos = ESCCollectionAnchorPadding::anchorBinaryHops(
+        reader, tagToken, valueToken, tracker, &anchorCache);
     EmuBinaryResult positions{
         apos.value_or(1) > 0 ? boost::none : boost::make_optional<uint64_t>(0), apos};
 
     return ESCCollectionAnchorPadding::getEdgeCountInfoForPaddingCleanupCommon(
-        reader, tagToken, valueToken, positions);
+        reader, tagToken, valueToken, positions, &anchorCache);
 }
 
 FLEEdgeCountInfo getEdgeCountInfoForCleanup(const FLEStateCollectionReader& reader,
@@ -1854,9 +1856,10 @@ FLEEdgeCountInfo getEdgeCountInfoForCleanup(const FLEStateCollectionReader& read
     auto escToken = EDCServerPayloadInfo::getESCToken(tag);
     auto tagToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedTagToken(escToken);
     auto valueToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedValueToken(escToken);
-    auto positions = ESCCollection::emuBinaryV2(reader, tagToken, valueToken);
+    EmuBinaryAnchorCache anchorCache;
+    auto positions = ESCCollection::emuBinaryV2(reader, tagToken, valueToken, &anchorCache);
     return ESCCollection::getEdgeCountInfoForPaddingCleanupCommon(
-        reader, tagToken, valueToken, positions);
+        reader, tagToken, valueToken, positions, &anchorCache);
 }
 
 /**
@@ -1870,7 +1873,8 @@ FLEEdgeCountInfo getEdgeCountInfoForCompact(const FLEStateCollectionReader& read
     auto tagToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedTagToken(escToken);
     auto valueToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedValueToken(escToken);
 
-    auto positions = ESCCollection::emuBinaryV2(reader, tagToken, valueToken);
+    EmuBinaryAnchorCache anchorCache;
+    auto positions = ESCCollection::emuBinaryV2(reader, tagToken, valueToken, &anchorCache);
 
     // Handle case where cpos is none. This means that no new non-anchors have been inserted
     // since since the last compact/cleanup.
@@ -1893,8 +1897,9 @@ FLEEdgeCountInfo getEdgeCountInfoForCompact(const FLEStateCollectionReader& read
     uint64_t nextAnchorPos = 0;
 
     if (positions.apos == boost::none) {
-        auto nullAnchorPositions = ESCCollection::readAndDecodeAnchor(
-            reader, valueToken, ESCCollection::generateNullAnchorId(tagToken));
+        // emuBinary already read and decoded the null anchor; reuse its positions rather than
+        // fetching and decrypting the document again.
+        const auto& nullAnchorPositions = anchorCache.nullAnchor;
 
         uassert(7293601, "ESC null anchor document not found", nullAnchorPositions);
 
@@ -1919,7 +1924,8 @@ FLEEdgeCountInfo getEdgeCountInfo(const FLEStateCollectionReader& reader,
     auto tagToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedTagToken(escToken);
     auto valueToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedValueToken(escToken);
 
-    auto positions = ESCCollection::emuBinaryV2(reader, tagToken, valueToken);
+    EmuBinaryAnchorCache anchorCache;
+    auto positions = ESCCollection::emuBinaryV2(reader, tagToken, valueToken, &anchorCache);
 
     if (positions.cpos.has_value()) {
         // Either no ESC documents exist yet (cpos == 0), OR new non-anchors
@@ -1932,14 +1938,11 @@ FLEEdgeCountInfo getEdgeCountInfo(const FLEStateCollectionReader& reader,
                 "An ESC anchor document is expected but none is found",
                 !positions.apos.has_value() || positions.apos.value() > 0);
 
-        PrfBlock anchorId;
-        if (!positions.apos.has_value()) {
-            anchorId = ESCCollection::generateNullAnchorId(tagToken);
-        } else {
-            anchorId = ESCCollection::generateAnchorId(tagToken, positions.apos.value());
-        }
-
-        auto anchorPositions = ESCCollection::readAndDecodeAnchor(reader, valueToken, anchorId);
+        // emuBinary already read and decoded the anchor holding the latest cpos: the null anchor
+        // when apos is none, otherwise the anchor at apos. Reuse the decoded positions rather
+        // than fetching and decrypting the document again.
+        const auto& anchorPositions =
+            positions.apos.has_value() ? anchorCache.searchedAnchor : anchorCache.nullAnchor;
         uassert(7291903, "ESC anchor document not found", anchorPositions);
 
         count = anchorPositions->cpos + 1;
@@ -2443,11 +2446,15 @@ FLEEdgeCountInfo ESCCollectionCommon<TagToken, ValueToken>::getEdgeCountInfoForP
     const FLEStateCollectionReader& reader,
     const TagToken& tagToken,
     const ValueToken& valueToken,
-    const EmuBinaryResult& positions) {
+    const EmuBinaryResult& positions,
+    const EmuBinaryAnchorCache* anchorCache) {
     // step (D)
     // nullAnchorPositions is r
-    auto nullAnchorPositions =
-        readAndDecodeAnchor(reader, valueToken, generateNullAnchorId(tagToken));
+    // The anchor search already read the null anchor, so reuse its decoded positions when the
+    // caller provided them.
+    auto nullAnchorPositions = anchorCache
+        ? anchorCache->nullAnchor
+        : readAndDecodeAnchor(reader, valueToken, generateNullAnchorId(tagToken));
 
     // This holds what value of a_1 should be used when inserting/updating the null anchor.
     auto latestCpos = 0;
@@ -2487,6 +2494,10 @@ FLEEdgeCountInfo ESCCollectionCommon<TagToken, ValueToken>::getEdgeCountInfoForP
         // before the ECOC temp collection could be dropped, and cleanup started immediately
         // after.
         latestCpos = positions.cpos.value_or_eval([&]() {
+            if (anchorCache && anchorCache->searchedAnchor) {
+                // binaryHops already read and decoded the anchor at apos.
+                return anchorCache->searchedAnchor->cpos;
+            }
             auto anchorPositions = readAndDecodeAnchor(
                 reader, valueToken, generateAnchorId(tagToken, positions.apos.value()));
             uassert(7295009, "ESC anchor is expected but not found", anchorPositions);
@@ -2770,11 +2781,12 @@ boost::optional<uint64_t> binarySearchCommon(const FLEStateCollectionReader& rea
 
 EmuBinaryResult ESCCollection::emuBinaryV2(const FLEStateCollectionReader& reader,
                                            const ESCTwiceDerivedTagToken& tagToken,
-                                           const ESCTwiceDerivedValueToken& valueToken) {
+                                           const ESCTwiceDerivedValueToken& valueToken,
+                                           EmuBinaryAnchorCache* anchorCache) {
     auto tracker = FLEStatusSection::get().makeEmuBinaryTracker();
 
-    auto x = anchorBinaryHops(reader, tagToken, valueToken, tracker);
-    auto i = binaryHops(reader, tagToken, valueToken, x, tracker);
+    auto x = anchorBinaryHops(reader, tagToken, valueToken, tracker, anchorCache);
+    auto i = binaryHops(reader, tagToken, valueToken, x, tracker, anchorCache);
     return EmuBinaryResult{i, x};
 }
 
@@ -2783,7 +2795,8 @@ boost::optional<uint64_t> ESCCollectionCommon<TagToken, ValueToken>::anchorBinar
     const FLEStateCollectionReader& reader,
     const TagToken& tagToken,
     const ValueToken& valueToken,
-    FLEStatusSection::EmuBinaryTracker& tracker) {
+    FLEStatusSection::EmuBinaryTracker& tracker,
+    EmuBinaryAnchorCache* anchorCache) {
 
     uint64_t lambda;
     boost::optional<uint64_t> x;
@@ -2798,6 +2811,10 @@ boost::optional<uint64_t> ESCCollectionCommon<TagToken, ValueToken>::anchorBinar
         uassertStatusOK(swAnchor.getStatus());
         lambda = swAnchor.getValue().position;
         x = boost::none;
+        if (anchorCache) {
+            anchorCache->nullAnchor =
+                ESCCountsPair{swAnchor.getValue().count, swAnchor.getValue().position};
+        }
     }
     // 3. case: null anchor does not exist
     else {
@@ -2825,7 +2842,8 @@ boost::optional<uint64_t> ESCCollection::binaryHops(const FLEStateCollectionRead
                                                     const ESCTwiceDerivedTagToken& tagToken,
                                                     const ESCTwiceDerivedValueToken& valueToken,
                                                     boost::optional<uint64_t> x,
-                                                    FLEStatusSection::EmuBinaryTracker& tracker) {
+                                                    FLEStatusSection::EmuBinaryTracker& tracker,
+                                                    EmuBinaryAnchorCache* anchorCache) {
     uint64_t lambda;
     boost::optional<uint64_t> i;
 
@@ -2835,6 +2853,12 @@ boost::optional<uint64_t> ESCCollection::binaryHops(const FLEStateCollectionRead
     if (x.has_value() && *x == 0) {
         i = 0;
         lambda = 0;
+    } else if (anchorCache && !x.has_value()) {
+        // The anchor search already read and decoded the null anchor; reuse its positions rather
+        // than fetching and decrypting the document again.
+        uassert(7291501, "ESC anchor document not found", anchorCache->nullAnchor);
+        lambda = anchorCache->nullAnchor->cpos;
+        i = boost::none;
     } else {
         auto id = x.has_value() ? generateAnchorId(tagToken, *x) : generateNullAnchorId(tagToken);
         auto doc = reader.getById(id);
@@ -2844,6 +2868,10 @@ boost::optional<uint64_t> ESCCollection::binaryHops(const FLEStateCollectionRead
         uassertStatusOK(swAnchor.getStatus());
         lambda = swAnchor.getValue().count;
         i = boost::none;
+        if (anchorCache && x.has_value()) {
+            anchorCache->searchedAnchor =
+                ESCCountsPair{swAnchor.getValue().count, swAnchor.getValue().position};
+        }
     }
 
     // 2-4. initialize rho based on ESC
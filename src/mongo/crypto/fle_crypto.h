@@ -458,11 +458,15 @@ public:
 
     /**
      * Calculate AnchorBinaryHops as described in OST.
+     *
+     * If 'anchorCache' is non-null, the decoded null anchor positions are recorded in it so that
+     * callers do not have to read and decrypt the null anchor document again.
      */
     static boost::optional<uint64_t> anchorBinaryHops(const FLEStateCollectionReader& reader,
                                                       const TagToken& tagToken,
                                                       const ValueToken& valueToken,
-                                                      FLEStatusSection::EmuBinaryTracker& tracker);
+                                                      FLEStatusSection::EmuBinaryTracker& tracker,
+                                                      EmuBinaryAnchorCache* anchorCache = nullptr);
 
     /**
      * Decrypts an anchor document (either null or non-null).
@@ -486,12 +490,16 @@ public:
     /**
      * Performs all the ESC reads required by the QE cleanup algorithm, for anchor cleanup or
      * padding cleanup.
+     *
+     * If 'anchorCache' is non-null, anchors already decoded by the emulated binary search are
+     * reused rather than read and decrypted from the ESC again.
      */
     static FLEEdgeCountInfo getEdgeCountInfoForPaddingCleanupCommon(
         const FLEStateCollectionReader& reader,
         const TagToken& tagToken,
         const ValueToken& valueToken,
-        const EmuBinaryResult& positions);
+        const EmuBinaryResult& positions,
+        const EmuBinaryAnchorCache* anchorCache = nullptr);
 };
 
 /**
@@ -597,12 +605,14 @@ public:
      */
     static EmuBinaryResult emuBinaryV2(const FLEStateCollectionReader& reader,
                                        const ESCTwiceDerivedTagToken& tagToken,
-                                       const ESCTwiceDerivedValueToken& valueToken);
+                                       const ESCTwiceDerivedValueToken& valueToken,
+                                       EmuBinaryAnchorCache* anchorCache = nullptr);
     static boost::optional<uint64_t> binaryHops(const FLEStateCollectionReader& reader,
                                                 const ESCTwiceDerivedTagToken& tagToken,
                                                 const ESCTwiceDerivedValueToken& valueToken,
                                                 boost::optional<uint64_t> x,
-                                                FLEStatusSection::EmuBinaryTracker& tracker);
+                                                FLEStatusSection::EmuBinaryTracker& tracker,
+                                                EmuBinaryAnchorCache* anchorCache = nullptr);
 
     /**
      * Get the set of counts from ESC for a set of tags. Returns counts for these fields suitable
@@ -281,6 +281,20 @@ struct EmuBinaryResult {
     boost::optional<uint64_t> apos;
 };
 
+/**
+ * Anchor positions decoded while running the emulated binary search. Callers that need the same
+ * anchors afterwards can reuse these instead of reading and decrypting the documents from the
+ * ESC a second time.
+ */
+struct EmuBinaryAnchorCache {
+    // Positions from the null anchor. Engaged iff the null anchor document exists, since the
+    // search always begins by looking it up.
+    boost::optional<ESCCountsPair> nullAnchor;
+
+    // Positions from the non-null anchor at the returned apos, if the search read it.
+    boost::optional<ESCCountsPair> searchedAnchor;
+};
+
 /**
  * The information retrieved from ESC for a given ESC token or anchor padding token. Count may
  * reflect a count suitable for insert or query.
@@ -38,6 +38,7 @@
 #include "mongo/db/admission/throughput_probing.h"
 #include "mongo/db/admission/ticketholder_manager.h"
 #include "mongo/db/feature_flag.h"
+#include "mongo/util/concurrency/deadline_ticketholder.h"  // IWYU pragma: keep
 #include "mongo/util/concurrency/priority_ticketholder.h"
 #include "mongo/util/concurrency/semaphore_ticketholder.h"  // IWYU pragma: keep
 
@@ -79,7 +80,32 @@ void initializeExecutionControl(ServiceContext* svcCtx) {
     };
 
     std::unique_ptr<TicketHolderManager> ticketHolderManager;
-    if (feature_flags::gFeatureFlagDeprioritizeLowPriorityOperations.isEnabled(
+    if (feature_flags::gFeatureFlagDeadlineOrderedTicketAdmission.isEnabled(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+#ifdef __linux__
+        LOGV2_DEBUG(9987405, 1, "Using deadline-ordered ticketing scheduler");
+
+        auto fifoBypassThreshold = gDeadlineAdmissionFifoBypassThreshold.load();
+        ticketHolderManager = makeTicketHolderManager(
+            std::make_unique<DeadlineTicketHolder>(
+                svcCtx, readTransactions, fifoBypassThreshold, usingThroughputProbing),
+            std::make_unique<DeadlineTicketHolder>(
+                svcCtx, writeTransactions, fifoBypassThreshold, usingThroughputProbing));
+#else
+        LOGV2_DEBUG(9987406, 1, "Using semaphore-based ticketing scheduler");
+        // The DeadlineTicketHolder is built on the TicketPool, which has only been implemented
+        // for Linux. On other platforms we fall back to the existing semaphore implementation
+        // even if the feature flag is enabled.
+        //
+        // TODO SERVER-72616: Remove the ifdefs once TicketPool is implemented with atomic
+        // wait.
+        ticketHolderManager =
+            makeTicketHolderManager(std::make_unique<SemaphoreTicketHolder>(
+                                        svcCtx, readTransactions, usingThroughputProbing),
+                                    std::make_unique<SemaphoreTicketHolder>(
+                                        svcCtx, writeTransactions, usingThroughputProbing));
+#endif
+    } else if (feature_flags::gFeatureFlagDeprioritizeLowPriorityOperations.isEnabled(
             serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
 #ifdef __linux__
         LOGV2_DEBUG(6902900, 1, "Using Priority Queue-based ticketing scheduler");
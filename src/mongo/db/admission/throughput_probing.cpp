@@ -36,12 +36,13 @@
 #include <boost/optional/optional.hpp>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/base/string_data.h"
 #include "mongo/db/admission/throughput_probing_gen.h"
 #include "mongo/db/dump_lock_manager.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
-#include "mongo/util/assert_util_core.h"
+#include "mongo/util/assert_util.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/stacktrace.h"
 #include "mongo/util/testing_proctor.h"
@@ -118,6 +119,7 @@ ThroughputProbing::ThroughputProbing(ServiceContext* svcCtx,
     auto client = svcCtx->getService()->makeClient("ThroughputProbingInit");
     auto opCtx = client->makeOperationContext();
     _resetConcurrency(opCtx.get());
+    _reportedStableConcurrency.store(_stableConcurrency);
 }
 
 void ThroughputProbing::start() {
@@ -125,6 +127,21 @@ void ThroughputProbing::start() {
 }
 
 void ThroughputProbing::appendStats(BSONObjBuilder& builder) const {
+    auto stateName = [](ProbingState state) -> StringData {
+        switch (state) {
+            case ProbingState::kStable:
+                return "stable"_sd;
+            case ProbingState::kUp:
+                return "up"_sd;
+            case ProbingState::kDown:
+                return "down"_sd;
+        }
+        MONGO_UNREACHABLE;
+    };
+
+    builder.append("state", stateName(static_cast<ProbingState>(_reportedState.load())));
+    builder.append("stableConcurrency", _reportedStableConcurrency.load());
+    builder.append("stableThroughputOpsPerSec", _reportedStableThroughput.load());
     _stats.serialize(builder);
 }
 
@@ -170,6 +187,13 @@ void ThroughputProbing::_run(Client* client) {
         _prevNumFinishedProcessing = _readTicketHolder->numFinishedProcessing() +
             _writeTicketHolder->numFinishedProcessing();
         _timer.reset();
+
+        // Publish the controller state for serverStatus now that this iteration's adjustment has
+        // been made. The internal throughput reading is per microsecond, so scale to per second
+        // for reporting.
+        _reportedState.store(static_cast<int32_t>(_state));
+        _reportedStableConcurrency.store(_stableConcurrency);
+        _reportedStableThroughput.store(_stableThroughput * 1000 * 1000);
     } catch (const DBException& e) {
         LOGV2_WARNING(9999993, "Throughput Probing: shutting down", "error"_attr = e.toStatus());
     }
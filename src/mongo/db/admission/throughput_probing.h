@@ -101,6 +101,12 @@ private:
 
     int64_t _prevNumFinishedProcessing = -1;
 
+    // Mirrors of the controller's internal state, refreshed at the end of each probing iteration
+    // so that serverStatus readers do not race with the probing job.
+    AtomicWord<int32_t> _reportedState{static_cast<int32_t>(ProbingState::kStable)};
+    AtomicWord<double> _reportedStableConcurrency{0};
+    AtomicWord<double> _reportedStableThroughput{0};
+
     struct Stats {
         void serialize(BSONObjBuilder& builder) const;
 
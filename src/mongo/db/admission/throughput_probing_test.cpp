@@ -148,6 +148,10 @@ protected:
             return !concurrencyIncreased() && !concurrencyDecreased();
         }
 
+        std::string state() const {
+            return _stats["state"].String();
+        }
+
         std::string toString() const {
             return str::stream() << "Stats: " << _stats << ", previous stats: " << _prevStats;
         }
@@ -198,6 +202,7 @@ TEST_F(ThroughputProbingTest, ProbeUpSucceeds) {
     _run();
     ASSERT_GT(_readTicketHolder.outof(), size);
     ASSERT_GT(_writeTicketHolder.outof(), size);
+    ASSERT_EQ(_statsTester.state(), "up") << _statsTester.toString();
 
     // Throughput inreases.
     size = _readTicketHolder.outof();
@@ -212,6 +217,7 @@ TEST_F(ThroughputProbingTest, ProbeUpSucceeds) {
     ASSERT_LT(_writeTicketHolder.outof(), size);
     ASSERT_GT(_writeTicketHolder.outof(), initialSize);
     ASSERT(_statsTester.concurrencyIncreased()) << _statsTester.toString();
+    ASSERT_EQ(_statsTester.state(), "stable") << _statsTester.toString();
 }
 
 TEST_F(ThroughputProbingTest, ProbeUpFails) {
@@ -249,6 +255,7 @@ TEST_F(ThroughputProbingTest, ProbeDownSucceeds) {
     _run();
     ASSERT_LT(_readTicketHolder.outof(), size);
     ASSERT_LT(_writeTicketHolder.outof(), size);
+    ASSERT_EQ(_statsTester.state(), "down") << _statsTester.toString();
 
     // Throughput increases.
     size = _readTicketHolder.outof();
@@ -36,6 +36,7 @@
 #include "mongo/db/commands/test_commands_enabled.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/deadline_ticketholder.h"
 #include "mongo/util/concurrency/priority_ticketholder.h"
 #include "mongo/util/concurrency/ticketholder.h"
 #include "mongo/util/decorable.h"
@@ -184,6 +185,43 @@ Status TicketHolderManager::updateLowPriorityAdmissionBypassThreshold(
     return Status::OK();
 }
 
+Status TicketHolderManager::updateDeadlineAdmissionFifoBypassThreshold(
+    const int32_t& newBypassThreshold) {
+    if (auto client = Client::getCurrent()) {
+        // TODO SERVER-72616: Remove the ifdef once TicketPool is implemented in a cross-platform
+        // manner.
+#ifdef __linux__
+        auto ticketHolderManager = TicketHolderManager::get(client->getServiceContext());
+        auto reader = dynamic_cast<DeadlineTicketHolder*>(
+            ticketHolderManager->getTicketHolder(LockMode::MODE_IS));
+        auto writer = dynamic_cast<DeadlineTicketHolder*>(
+            ticketHolderManager->getTicketHolder(LockMode::MODE_IX));
+
+        if (reader && writer) {
+            reader->updateFifoBypassThreshold(newBypassThreshold);
+            writer->updateFifoBypassThreshold(newBypassThreshold);
+            return Status::OK();
+        }
+
+        // The 'deadlineAdmissionFifoBypassThreshold' only impacts DeadlineTicketHolders.
+        LOGV2_WARNING(9987402,
+                      "Attempting to update deadlineAdmissionFifoBypassThreshold when the "
+                      "TicketHolders are not initialized to be DeadlineTicketHolders");
+        return Status(ErrorCodes::IllegalOperation,
+                      "Attempting to update deadlineAdmissionFifoBypassThreshold when the "
+                      "TicketHolders are not initialized to be DeadlineTicketHolders");
+#else
+        LOGV2_WARNING(9987403,
+                      "Attempting to update deadlineAdmissionFifoBypassThreshold when the feature "
+                      "is only supported on Linux");
+        return Status(ErrorCodes::IllegalOperation,
+                      "Attempting to update deadlineAdmissionFifoBypassThreshold when the feature "
+                      "is only supported on Linux");
+#endif
+    }
+    return Status::OK();
+}
+
 TicketHolderManager* TicketHolderManager::get(ServiceContext* svcCtx) {
     return ticketHolderManagerDecoration(svcCtx).get();
 }
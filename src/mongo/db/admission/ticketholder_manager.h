@@ -74,6 +74,13 @@ public:
     // TicketHolders are initialized and of type PriorityTicketHolders. Otherwise, returns an error.
     static Status updateLowPriorityAdmissionBypassThreshold(const int32_t& newBypassThreshold);
 
+    // The 'deadlineAdmissionFifoBypassThreshold' is only applicable when ticket admission is
+    // controlled via DeadlineTicketHolders.
+    //
+    // Returns Status::OK() and updates the 'deadlineAdmissionFifoBypassThreshold' provided all
+    // TicketHolders are initialized and of type DeadlineTicketHolder. Otherwise, returns an error.
+    static Status updateDeadlineAdmissionFifoBypassThreshold(const int32_t& newBypassThreshold);
+
     static TicketHolderManager* get(ServiceContext* svcCtx);
 
     static void use(ServiceContext* svcCtx,
@@ -868,11 +868,27 @@ bool AuthorizationSessionImpl::isAuthorizedForClusterActions(
 }
 
 bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privilege) {
+    // Bounds the per-session cache of resolved user actions. The bound only matters for
+    // pathological workloads which check exact-namespace patterns against very many distinct
+    // namespaces on one session.
+    static constexpr size_t kResolvedUserActionsMaxSize = 512;
+
     _contract.addPrivilege(privilege);
 
     const auto& rp = privilege.getResourcePattern();
-    auth::ResourcePatternSearchList search(rp);
     ActionSet unmetRequirements = privilege.getActions();
+
+    // Fast path: a repeat check against a resource pattern this session has already resolved is a
+    // single lookup. The cache may only grant; a miss or an insufficient entry falls through to
+    // the full resolution below, so it can never wrongly deny.
+    if (_authenticatedUser != boost::none) {
+        if (auto it = _resolvedUserActions.find(rp);
+            it != _resolvedUserActions.end() && it->second.isSupersetOf(unmetRequirements)) {
+            return true;
+        }
+    }
+
+    auth::ResourcePatternSearchList search(rp);
     for (const auto& priv : _getDefaultPrivileges()) {
         for (auto patternIt = search.cbegin(); patternIt != search.cend(); ++patternIt) {
             if (priv.getResourcePattern() != *patternIt) {
@@ -896,10 +912,22 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
                        (user->getName().tenantId() != rp.tenantId()))) {
         return unmetRequirements.empty();
     }
-    return std::any_of(search.cbegin(), search.cend(), [&](const auto& pattern) {
-        unmetRequirements.removeAllActionsFromSet(user->getActionsForResource(pattern));
-        return unmetRequirements.empty();
-    });
+
+    // Resolve the union of the user's actions across the full search list once, and cache it for
+    // subsequent checks against the same pattern. This is safe to cache because, for a given user
+    // and pattern, the useTenant safeguard above always resolves the same way, and the cache is
+    // cleared whenever the user state changes.
+    ActionSet userActions;
+    for (auto patternIt = search.cbegin(); patternIt != search.cend(); ++patternIt) {
+        userActions.addAllActionsFromSet(user->getActionsForResource(*patternIt));
+    }
+    if (_resolvedUserActions.size() >= kResolvedUserActionsMaxSize) {
+        _resolvedUserActions.clear();
+    }
+    _resolvedUserActions[rp] = userActions;
+
+    unmetRequirements.removeAllActionsFromSet(userActions);
+    return unmetRequirements.empty();
 }
 
 void AuthorizationSessionImpl::setImpersonatedUserData(const UserName& username,
@@ -1081,6 +1109,9 @@ void AuthorizationSessionImpl::verifyContract(const AuthorizationContract* contr
 }
 
 void AuthorizationSessionImpl::_updateInternalAuthorizationState() {
+    // The resolved user actions were derived from the previous user state.
+    _resolvedUserActions.clear();
+
     // Update the authenticated role names vector to reflect current state.
     _authenticatedRoleNames.clear();
     if (_authenticatedUser == boost::none) {
@@ -56,6 +56,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/time_support.h"
 
@@ -247,6 +248,13 @@ private:
     // It is a union of ClusterResource and AnyResource permissions.
     ActionSet _nonTenantClusterActions;
 
+    // Per-session cache of the actions granted to the authenticated user on a given resource
+    // pattern, resolved across the pattern's full resource search list. Entries deliberately
+    // exclude the default privileges, which can change independently of the user state (e.g. when
+    // the localhost exception deactivates). Cleared whenever the user state changes via
+    // _updateInternalAuthorizationState().
+    stdx::unordered_map<ResourcePattern, ActionSet> _resolvedUserActions;
+
     // The expiration time for this session, expressed as a Unix timestamp. After this time passes,
     // the session will be expired and requests will fail until the expiration time is refreshed.
     // If boost::none, then the session never expires (default behavior).
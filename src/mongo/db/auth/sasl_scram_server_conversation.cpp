@@ -268,6 +268,10 @@ StatusWith<std::tuple<bool, std::string>> SaslSCRAMServerMechanism<Policy>::_fir
         }
     }
 
+    // Note that, unlike the client side (see SCRAMClientCache), the server never runs the PBKDF2
+    // key derivation during a conversation: storedKey and serverKey were derived once at user
+    // creation and are read back from the user document here. The per-conversation cost is a
+    // handful of HMAC/SHA operations on the nonce, which cannot be cached by design.
     _secrets.push_back(scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy>(
         "",
         base64::decode(scramCredentials.storedKey),
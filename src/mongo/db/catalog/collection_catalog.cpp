@@ -46,7 +46,6 @@
 #include <exception>
 #include <list>
 #include <mutex>
-#include <shared_mutex>
 
 #include "collection_catalog.h"
 
@@ -78,7 +77,6 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
-#include "mongo/platform/rwmutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/database_name_util.h"
@@ -106,29 +104,29 @@ const SharedCollectionDecorations::Decoration<AtomicWord<bool>>
 namespace {
 constexpr auto kNumDurableCatalogScansDueToMissingMapping = "numScansDueToMissingMapping"_sd;
 
+// Holds the latest published catalog instance. Every operation that has not stashed a catalog
+// snapshot goes through load() for each namespace resolution, so reads must not contend with each
+// other; writers are rare (catalog publishes) and pay the cost instead via copy-on-write.
 class LatestCollectionCatalog {
 public:
     std::shared_ptr<CollectionCatalog> load() const {
-        std::shared_lock lk(_mutex);  // NOLINT
-        return _catalog;
+        return std::atomic_load(&_catalog);  // NOLINT
     }
 
     bool compareAndSet(const std::shared_ptr<CollectionCatalog>& oldCatalog,
                        std::shared_ptr<CollectionCatalog>&& newCatalog) {
-        std::lock_guard lk(_mutex);
-        if (oldCatalog != _catalog)
-            return false;
-        _catalog = std::move(newCatalog);
-        return true;
+        auto expected = oldCatalog;
+        return std::atomic_compare_exchange_strong(  // NOLINT
+            &_catalog,
+            &expected,
+            std::move(newCatalog));
     }
 
     void store(std::shared_ptr<CollectionCatalog>&& newCatalog) {
-        std::lock_guard lk(_mutex);
-        _catalog = std::move(newCatalog);
+        std::atomic_store(&_catalog, std::move(newCatalog));  // NOLINT
     }
 
 private:
-    mutable RWMutex _mutex;
     // TODO SERVER-56428: Replace with std::atomic<std::shared_ptr> when supported in our toolchain
     std::shared_ptr<CollectionCatalog> _catalog = std::make_shared<CollectionCatalog>();
 };
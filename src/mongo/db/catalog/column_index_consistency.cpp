@@ -73,11 +73,6 @@ int64_t ColumnIndexConsistency::traverseIndex(OperationContext* opCtx,
     // Traverse the index in this for loop.
     for (auto cell = csiCursor->seekAtOrPast("", ColumnStore::kNullRowId); cell;
          cell = csiCursor->next()) {
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
-        }
-
         if (_firstPhase) {
             addIndexEntry(cell.get());
         } else {
@@ -85,12 +80,24 @@ int64_t ColumnIndexConsistency::traverseIndex(OperationContext* opCtx,
         }
 
         if (++numIndexEntries % kInterruptIntervalNumRecords == 0) {
+            // Batch the progress meter updates so the Client lock is not taken per cell.
+            {
+                stdx::unique_lock<Client> lk(*opCtx->getClient());
+                _progress.get(lk)->hit(static_cast<int>(kInterruptIntervalNumRecords));
+            }
+
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yieldCursors(opCtx);
         }
     }
 
+    if (const auto remainingHits = numIndexEntries % kInterruptIntervalNumRecords;
+        remainingHits > 0) {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        _progress.get(lk)->hit(static_cast<int>(remainingHits));
+    }
+
     _investigateSuspects(opCtx, index);
 
     return numIndexEntries;
@@ -1669,12 +1669,11 @@ const IndexDescriptor* IndexCatalogImpl::refreshEntry(OperationContext* opCtx,
 
 
 Status IndexCatalogImpl::_indexFilteredRecords(OperationContext* opCtx,
+                                               SharedBufferFragmentBuilder& pooledBuilder,
                                                const CollectionPtr& coll,
                                                const IndexCatalogEntry* index,
                                                const std::vector<BsonRecord>& bsonRecords,
                                                int64_t* keysInsertedOut) const {
-    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
-
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, coll->ns(), index->descriptor(), &options);
 
@@ -1683,6 +1682,7 @@ Status IndexCatalogImpl::_indexFilteredRecords(OperationContext* opCtx,
 }
 
 Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
+                                       SharedBufferFragmentBuilder& pooledBuilder,
                                        const CollectionPtr& coll,
                                        const IndexCatalogEntry* index,
                                        const std::vector<BsonRecord>& bsonRecords,
@@ -1701,7 +1701,8 @@ Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
 
     const MatchExpression* filter = index->getFilterExpression();
     if (!filter)
-        return _indexFilteredRecords(opCtx, coll, index, bsonRecords, keysInsertedOut);
+        return _indexFilteredRecords(
+            opCtx, pooledBuilder, coll, index, bsonRecords, keysInsertedOut);
 
     std::vector<BsonRecord> filteredBsonRecords;
     for (const auto& bsonRecord : bsonRecords) {
@@ -1709,10 +1710,12 @@ Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
             filteredBsonRecords.push_back(bsonRecord);
     }
 
-    return _indexFilteredRecords(opCtx, coll, index, filteredBsonRecords, keysInsertedOut);
+    return _indexFilteredRecords(
+        opCtx, pooledBuilder, coll, index, filteredBsonRecords, keysInsertedOut);
 }
 
 Status IndexCatalogImpl::_updateRecord(OperationContext* const opCtx,
+                                       SharedBufferFragmentBuilder& pooledBuilder,
                                        const CollectionPtr& coll,
                                        const IndexCatalogEntry* index,
                                        const BSONObj& oldDoc,
@@ -1735,7 +1738,6 @@ Status IndexCatalogImpl::_updateRecord(OperationContext* const opCtx,
             return Status::OK();
         }
     }
-    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
 
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, coll->ns(), index->descriptor(), &options);
@@ -1764,6 +1766,7 @@ Status IndexCatalogImpl::_updateRecord(OperationContext* const opCtx,
 }
 
 void IndexCatalogImpl::_unindexRecord(OperationContext* opCtx,
+                                      SharedBufferFragmentBuilder& pooledBuilder,
                                       const CollectionPtr& collection,
                                       const IndexCatalogEntry* entry,
                                       const BSONObj& obj,
@@ -1787,8 +1790,6 @@ void IndexCatalogImpl::_unindexRecord(OperationContext* opCtx,
         }
     }
 
-    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
-
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, collection->ns(), entry->descriptor(), &options);
 
@@ -1844,14 +1845,21 @@ Status IndexCatalogImpl::indexRecords(OperationContext* opCtx,
         } else {
             stopTrackingMultikeyChanges.dismiss();
         }
+        // One pooled builder serves every index, so the key string buffers allocated for the first
+        // index are reused by the remaining ones.
+        SharedBufferFragmentBuilder pooledBuilder(
+            key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+
         for (auto&& it : _readyIndexes) {
-            Status s = _indexRecords(opCtx, coll, it.get(), bsonRecords, keysInsertedOut);
+            Status s =
+                _indexRecords(opCtx, pooledBuilder, coll, it.get(), bsonRecords, keysInsertedOut);
             if (!s.isOK())
                 return s;
         }
 
         for (auto&& it : _buildingIndexes) {
-            Status s = _indexRecords(opCtx, coll, it.get(), bsonRecords, keysInsertedOut);
+            Status s =
+                _indexRecords(opCtx, pooledBuilder, coll, it.get(), bsonRecords, keysInsertedOut);
             if (!s.isOK())
                 return s;
         }
@@ -1918,14 +1926,24 @@ Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
             toUpdate.set();
         }
 
+        SharedBufferFragmentBuilder pooledBuilder(
+            key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+
         for (size_t pos = toUpdate.find_first(); pos != mongo::doc_diff::BitVector::npos;
              pos = toUpdate.find_next(pos)) {
             const IndexCatalogEntry* entry = (pos < _readyIndexes.size())
                 ? (_readyIndexes.begin() + pos)->get()
                 : (_buildingIndexes.begin() + (pos - _readyIndexes.size()))->get();
 
-            auto status = _updateRecord(
-                opCtx, coll, entry, oldDoc, newDoc, recordId, keysInsertedOut, keysDeletedOut);
+            auto status = _updateRecord(opCtx,
+                                        pooledBuilder,
+                                        coll,
+                                        entry,
+                                        oldDoc,
+                                        newDoc,
+                                        recordId,
+                                        keysInsertedOut,
+                                        keysDeletedOut);
             if (!status.isOK()) {
                 return status;
             }
@@ -1945,14 +1963,23 @@ void IndexCatalogImpl::unindexRecord(OperationContext* opCtx,
         *keysDeletedOut = 0;
     }
 
+    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+
     for (IndexCatalogEntryContainer::const_iterator it = _readyIndexes.begin();
          it != _readyIndexes.end();
          ++it) {
         const IndexCatalogEntry* entry = it->get();
 
         bool logIfError = !noWarn;
-        _unindexRecord(
-            opCtx, collection, entry, obj, loc, logIfError, keysDeletedOut, checkRecordId);
+        _unindexRecord(opCtx,
+                       pooledBuilder,
+                       collection,
+                       entry,
+                       obj,
+                       loc,
+                       logIfError,
+                       keysDeletedOut,
+                       checkRecordId);
     }
 
     for (IndexCatalogEntryContainer::const_iterator it = _buildingIndexes.begin();
@@ -1962,8 +1989,15 @@ void IndexCatalogImpl::unindexRecord(OperationContext* opCtx,
 
         // If it's a background index, we DO NOT want to log anything.
         bool logIfError = entry->isReady() ? !noWarn : false;
-        _unindexRecord(
-            opCtx, collection, entry, obj, loc, logIfError, keysDeletedOut, checkRecordId);
+        _unindexRecord(opCtx,
+                       pooledBuilder,
+                       collection,
+                       entry,
+                       obj,
+                       loc,
+                       logIfError,
+                       keysDeletedOut,
+                       checkRecordId);
     }
 }
 
@@ -307,19 +307,25 @@ private:
      */
     std::string _getAccessMethodName(const BSONObj& keyPattern) const;
 
+    // The '_indexRecords', '_updateRecord' and '_unindexRecord' helpers below are invoked once per
+    // index for a single record write, so the callers own a 'pooledBuilder' which is shared across
+    // all indexes to amortize the key string buffer allocations over the whole index catalog.
     Status _indexFilteredRecords(OperationContext* opCtx,
+                                 SharedBufferFragmentBuilder& pooledBuilder,
                                  const CollectionPtr& coll,
                                  const IndexCatalogEntry* index,
                                  const std::vector<BsonRecord>& bsonRecords,
                                  int64_t* keysInsertedOut) const;
 
     Status _indexRecords(OperationContext* opCtx,
+                         SharedBufferFragmentBuilder& pooledBuilder,
                          const CollectionPtr& coll,
                          const IndexCatalogEntry* index,
                          const std::vector<BsonRecord>& bsonRecords,
                          int64_t* keysInsertedOut) const;
 
     Status _updateRecord(OperationContext* opCtx,
+                         SharedBufferFragmentBuilder& pooledBuilder,
                          const CollectionPtr& coll,
                          const IndexCatalogEntry* index,
                          const BSONObj& oldDoc,
@@ -329,6 +335,7 @@ private:
                          int64_t* keysDeletedOut) const;
 
     void _unindexRecord(OperationContext* opCtx,
+                        SharedBufferFragmentBuilder& pooledBuilder,
                         const CollectionPtr& collection,
                         const IndexCatalogEntry* entry,
                         const BSONObj& obj,
@@ -825,14 +825,17 @@ int64_t KeyStringIndexConsistency::traverseIndex(OperationContext* opCtx,
                 results->valid = false;
             }
         }
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
-        }
         numKeys++;
         prevIndexKeyStringEntry = indexEntry;
 
         if (numKeys % kInterruptIntervalNumRecords == 0) {
+            // The progress meter is only updated here so that the Client lock is taken once per
+            // interval rather than once per key.
+            {
+                stdx::unique_lock<Client> lk(*opCtx->getClient());
+                _progress.get(lk)->hit(static_cast<int>(kInterruptIntervalNumRecords));
+            }
+
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yieldCursors(opCtx);
@@ -852,6 +855,11 @@ int64_t KeyStringIndexConsistency::traverseIndex(OperationContext* opCtx,
         }
     }
 
+    if (const auto remainingHits = numKeys % kInterruptIntervalNumRecords; remainingHits > 0) {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        _progress.get(lk)->hit(static_cast<int>(remainingHits));
+    }
+
     if (results && this->getMultikeyMetadataPathCount(&indexInfo) > 0) {
         results->errors.push_back(str::stream()
                                   << "Index '" << descriptor->indexName()
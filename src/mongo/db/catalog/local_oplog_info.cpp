@@ -112,12 +112,14 @@ std::vector<OplogSlot> LocalOplogInfo::getNextOpTimes(OperationContext* opCtx, s
         }
     });
 
-    // Allow the storage engine to start the transaction outside the critical section.
+    // Allow the storage engine to start the transaction outside the critical section. Also resolve
+    // the vector clock decoration before taking the mutex; only the tick itself needs to be inside.
     shard_role_details::getRecoveryUnit(opCtx)->preallocateSnapshot();
+    auto* vectorClock = VectorClockMutable::get(opCtx);
     {
         stdx::lock_guard<Latch> lk(_newOpMutex);
 
-        ts = VectorClockMutable::get(opCtx)->tickClusterTime(count).asTimestamp();
+        ts = vectorClock->tickClusterTime(count).asTimestamp();
         const bool orderedCommit = false;
 
         // The local oplog record store pointer must already be established by this point.
@@ -128,9 +130,10 @@ std::vector<OplogSlot> LocalOplogInfo::getNextOpTimes(OperationContext* opCtx, s
     }
 
     Timer oplogSlotDurationTimer;
-    std::vector<OplogSlot> oplogSlots(count);
+    std::vector<OplogSlot> oplogSlots;
+    oplogSlots.reserve(count);
     for (std::size_t i = 0; i < count; i++) {
-        oplogSlots[i] = {Timestamp(ts.asULL() + i), term};
+        oplogSlots.emplace_back(Timestamp(ts.asULL() + i), term);
     }
 
     // If we abort a transaction that has reserved an optime, we should make sure to update the
@@ -308,7 +308,12 @@ public:
      * delete internal tables, but this is not transactional. Writes the resumable index build
      * state to disk if resumable index builds are supported.
      *
-     * This should only be used during shutdown or rollback.
+     * This should only be used during shutdown or rollback. The state written here is only valid
+     * for resuming after a clean shutdown: it refers to external sorter spill files and
+     * side-writes table contents as they exist at this instant, which after a crash would not
+     * agree with the storage tables rolled back to the last checkpoint. Startup recovery discards
+     * it after an unclean shutdown (see StorageEngineImpl::_handleInternalIdent), so persisting
+     * it periodically during the build would not make builds crash-resumable.
      */
     void abortWithoutCleanup(OperationContext* opCtx,
                              const CollectionPtr& collection,
@@ -731,14 +731,14 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
     bool corruptRecordsSizeLimitWarning = false;
     const std::unique_ptr<SeekableRecordThrottleCursor>& traverseRecordStoreCursor =
         _validateState->getTraverseRecordStoreCursor();
+    // Progress meter updates are batched and applied at the periodic interrupt checks below, so
+    // the Client lock is not taken for every record.
+    int progressHitsPending = 0;
     for (auto record =
              traverseRecordStoreCursor->seekExact(opCtx, _validateState->getFirstRecordId());
          record;
          record = traverseRecordStoreCursor->next(opCtx)) {
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
-        }
+        ++progressHitsPending;
         ++_numRecords;
         auto dataSize = record->data.size();
         interruptIntervalNumBytes += dataSize;
@@ -900,6 +900,12 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
 
         if (_numRecords % IndexConsistency::kInterruptIntervalNumRecords == 0 ||
             interruptIntervalNumBytes >= kInterruptIntervalNumBytes) {
+            {
+                stdx::unique_lock<Client> lk(*opCtx->getClient());
+                _progress.get(lk)->hit(progressHitsPending);
+            }
+            progressHitsPending = 0;
+
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yieldCursors(opCtx);
@@ -910,6 +916,11 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
         }
     }
 
+    if (progressHitsPending > 0) {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        _progress.get(lk)->hit(progressHitsPending);
+    }
+
     if (results->numRemovedCorruptRecords > 0) {
         results->warnings.push_back(str::stream() << "Removed " << results->numRemovedCorruptRecords
                                                   << " invalid documents.");
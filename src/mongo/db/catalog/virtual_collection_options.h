@@ -51,7 +51,9 @@ struct ExternalDataSourceMetadata {
         uassert(6968500,
                 "File url must start with {}"_format(kUrlProtocolFile),
                 urlStr.startsWith(kUrlProtocolFile));
-        uassert(6968501, "Storage type must be 'pipe'", storageType == StorageTypeEnum::pipe);
+        uassert(6968501,
+                "Storage type must be 'pipe' or 'file'",
+                storageType == StorageTypeEnum::pipe || storageType == StorageTypeEnum::file);
         uassert(6968502, "File type must be 'bson'", fileType == FileTypeEnum::bson);
     }
 
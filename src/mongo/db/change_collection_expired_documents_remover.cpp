@@ -52,6 +52,7 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/database_name.h"
 #include "mongo/db/feature_flag.h"
+#include "mongo/db/maintenance_thread_pool.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/read_concern_args.h"
@@ -69,10 +70,8 @@
 #include "mongo/s/shard_version.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/clock_source.h"
-#include "mongo/util/decorable.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
-#include "mongo/util/periodic_runner.h"
 #include "mongo/util/time_support.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
@@ -203,42 +202,29 @@ void removeExpiredDocuments(Client* client) {
     }
 }
 
+constexpr auto kRemoverTaskName = "changeCollectionExpiredDocumentsRemover"_sd;
+
 /**
- * Defines a periodic background job to remove expired documents from change collections.
- * The job will run every 'changeCollectionExpiredDocumentsRemoverJobSleepSeconds', as defined in
- * the cluster parameter.
+ * Registers the removal pass as a periodic task on the shared maintenance pool. The pass runs
+ * every 'changeCollectionExpiredDocumentsRemoverJobSleepSeconds', as defined in the cluster
+ * parameter. Expired change collection documents multiply with user writes, so the task is marked
+ * as disk-reclaiming: when the DiskSpaceMonitor reports low disk space, the pass also runs
+ * immediately instead of waiting out its sleep interval.
  */
 class ChangeCollectionExpiredDocumentsRemover {
 public:
-    ChangeCollectionExpiredDocumentsRemover(ServiceContext* serviceContext) {
-        const auto period = Seconds{gChangeCollectionExpiredDocumentsRemoverJobSleepSeconds.load()};
-        _jobAnchor =
-            serviceContext->getPeriodicRunner()->makeJob({"ChangeCollectionExpiredDocumentsRemover",
-                                                          removeExpiredDocuments,
-                                                          period,
-                                                          true /*isKillableByStepdown*/});
-        _jobAnchor.start();
-    }
-
     static void start(ServiceContext* serviceContext) {
-        auto& changeCollectionExpiredDocumentsRemover = _serviceDecoration(serviceContext);
-        changeCollectionExpiredDocumentsRemover =
-            std::make_unique<ChangeCollectionExpiredDocumentsRemover>(serviceContext);
+        const auto period = Seconds{gChangeCollectionExpiredDocumentsRemoverJobSleepSeconds.load()};
+        MaintenanceThreadPool::get(serviceContext)
+            .registerTask(std::string{kRemoverTaskName},
+                          period,
+                          true /*reclaimsDiskSpace*/,
+                          removeExpiredDocuments);
     }
 
     static void shutdown(ServiceContext* serviceContext) {
-        auto& changeCollectionExpiredDocumentsRemover = _serviceDecoration(serviceContext);
-        if (changeCollectionExpiredDocumentsRemover) {
-            changeCollectionExpiredDocumentsRemover->_jobAnchor.stop();
-            changeCollectionExpiredDocumentsRemover.reset();
-        }
+        MaintenanceThreadPool::get(serviceContext).deregisterTask(kRemoverTaskName);
     }
-
-private:
-    inline static const auto _serviceDecoration = ServiceContext::declareDecoration<
-        std::unique_ptr<ChangeCollectionExpiredDocumentsRemover>>();
-
-    PeriodicJobAnchor _jobAnchor;
 };
 }  // namespace
 
@@ -29,6 +29,8 @@
 
 #include "mongo/db/clientcursor.h"
 
+#include <algorithm>
+
 #include <boost/cstdint.hpp>
 #include <fmt/format.h>
 #include <iosfwd>
@@ -46,6 +48,7 @@
 #include "mongo/db/curop.h"
 #include "mongo/db/cursor_manager.h"
 #include "mongo/db/cursor_server_params.h"
+#include "mongo/db/query/find_common.h"
 #include "mongo/db/query/plan_explainer.h"
 #include "mongo/db/query/query_knob_configuration.h"
 #include "mongo/db/query/query_knobs_gen.h"
@@ -180,7 +183,8 @@ ClientCursor::ClientCursor(ClientCursorParams params,
           CurOp::get(operationUsingCursor)->debug().queryStatsInfo.willNeverExhaust),
       _shouldOmitDiagnosticInformation(
           CurOp::get(operationUsingCursor)->getShouldOmitDiagnosticInformation()),
-      _opKey(operationUsingCursor->getOperationKey()) {
+      _opKey(operationUsingCursor->getOperationKey()),
+      _nextBatchByteBudget(FindCommon::kMaxBytesToReturnToClientAtOnce) {
     invariant(_exec);
     invariant(_operationUsingCursor);
 
@@ -194,6 +198,29 @@ ClientCursor::ClientCursor(ClientCursorParams params,
     }
 }
 
+void ClientCursor::recordBatchDurationForAdaptiveSizing(std::size_t bytesReturned,
+                                                        Microseconds batchDuration) {
+    if (!internalQueryAdaptiveGetMoreBatchSizingEnabled.load()) {
+        _nextBatchByteBudget = FindCommon::kMaxBytesToReturnToClientAtOnce;
+        return;
+    }
+
+    // Never shrink below a budget that comfortably fits a handful of maximally large documents'
+    // worth of typical results; progress is always guaranteed regardless since the first document
+    // of a batch is appended unconditionally.
+    static constexpr std::size_t kMinByteBudget = 512 * 1024;
+
+    const auto target = Milliseconds{internalQueryAdaptiveGetMoreTargetMillis.load()};
+    if (batchDuration > target) {
+        _nextBatchByteBudget = std::max(_nextBatchByteBudget / 2, kMinByteBudget);
+    } else if (batchDuration <= target / 2 && bytesReturned * 2 > _nextBatchByteBudget) {
+        // The batch (nearly) filled its budget well under the target, so the cursor is producing
+        // documents quickly; give the next batch twice the space.
+        _nextBatchByteBudget =
+            std::min(_nextBatchByteBudget * 2, FindCommon::kMaxBytesToReturnToClientAtOnce);
+    }
+}
+
 ClientCursor::~ClientCursor() {
     // Cursors must be unpinned and deregistered from their cursor manager before being deleted.
     invariant(!_operationUsingCursor);
@@ -318,6 +318,25 @@ public:
         _lastKnownCommittedOpTime = std::move(lastCommittedOpTime);
     }
 
+    /**
+     * Returns the byte budget to apply when building the next getMore batch for this cursor. This
+     * is the protocol maximum unless adaptive batch sizing has shrunk it; see
+     * recordBatchDurationForAdaptiveSizing().
+     */
+    std::size_t getNextBatchByteBudget() const {
+        return _nextBatchByteBudget;
+    }
+
+    /**
+     * Adjusts the byte budget for subsequent getMore batches based on how long it took to produce
+     * a batch of 'bytesReturned' bytes. When adaptive batch sizing is enabled, the budget is
+     * halved when a batch overshoots the target duration and doubled (up to the protocol maximum)
+     * when a batch that filled its budget completes well under the target, so slow-to-produce
+     * cursors converge on smaller, lower-latency batches without client-side tuning.
+     */
+    void recordBatchDurationForAdaptiveSizing(std::size_t bytesReturned,
+                                              Microseconds batchDuration);
+
     friend std::size_t partitionOf(const ClientCursor* cursor) {
         return cursor->cursorid();
     }
@@ -520,6 +539,11 @@ private:
 
     // The execution time collected from the initial operation prior to any getMore requests.
     boost::optional<Microseconds> _firstResponseExecutionTime;
+
+    // Byte budget applied when building getMore responses for this cursor. Starts at the protocol
+    // maximum and is adjusted after each batch by recordBatchDurationForAdaptiveSizing() when
+    // adaptive batch sizing is enabled.
+    std::size_t _nextBatchByteBudget;
 };
 
 /**
@@ -29,6 +29,7 @@
 
 
 #include <boost/cstdint.hpp>
+#include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 
 #include "mongo/base/error_codes.h"
@@ -154,4 +155,70 @@ Status autoCompact(OperationContext* opCtx,
     return status;
 }
 
+std::unique_ptr<DiskSpaceMonitor::Action> makeEnableAutoCompactOnLowDiskSpaceAction() {
+    class EnableAutoCompactAction : public DiskSpaceMonitor::Action {
+    public:
+        int64_t getThresholdBytes() noexcept final {
+            // This parameter's validator ensures that this multiplication will not overflow.
+            auto thresholdMB = gAutoCompactLowDiskSpaceThresholdMB.load();
+            // A threshold of zero disables the trigger. Return a negative threshold so that the
+            // action does not fire even when the disk reports no available space at all.
+            return thresholdMB > 0 ? thresholdMB * 1024 * 1024 : -1;
+        }
+
+        void act(OperationContext* opCtx, int64_t availableBytes) noexcept final {
+            if (_triggered) {
+                // Auto compaction was already enabled by this action and stays enabled until the
+                // operator turns it off. Do not fight an operator who has since disabled it.
+                return;
+            }
+
+            // Auto compaction may only be enabled on a primary or secondary in steady state.
+            // Quietly wait for the next pass otherwise; the monitor runs this action every pass
+            // while disk space remains below the threshold.
+            auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+            if (replCoord->getSettings().isReplSet()) {
+                auto state = replCoord->getMemberState();
+                if (!state.primary() && !state.secondary())
+                    return;
+            }
+
+            LOGV2(9512700,
+                  "Enabling background compaction because remaining disk space is less than the "
+                  "configured threshold",
+                  "availableBytes"_attr = availableBytes,
+                  "thresholdBytes"_attr = getThresholdBytes());
+            try {
+                auto status =
+                    autoCompact(opCtx, /*enable=*/true, /*runOnce=*/false, boost::none);
+                if (status.isOK()) {
+                    _triggered = true;
+                } else if (status == ErrorCodes::IllegalOperation ||
+                           status == ErrorCodes::CommandNotSupported) {
+                    // The storage engine cannot run background compaction at all; retrying on
+                    // every monitor pass would only repeat this message.
+                    LOGV2(9512701,
+                          "Background compaction is not supported by the storage engine, the low "
+                          "disk space trigger will not retry",
+                          "error"_attr = status);
+                    _triggered = true;
+                } else {
+                    LOGV2(9512702,
+                          "Failed to enable background compaction",
+                          "error"_attr = status);
+                }
+            } catch (...) {
+                LOGV2(9512703,
+                      "Failed to enable background compaction",
+                      "error"_attr = exceptionToStatus());
+            }
+        }
+
+    private:
+        // Only written by the DiskSpaceMonitor thread, which serializes calls to act().
+        bool _triggered = false;
+    };
+    return std::make_unique<EnableAutoCompactAction>();
+}
+
 }  // namespace mongo
@@ -30,9 +30,11 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 
 #include "mongo/base/status_with.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/storage/disk_space_monitor.h"
 
 namespace mongo {
 
@@ -46,4 +48,11 @@ Status autoCompact(OperationContext* opCtx,
                    bool runOnce,
                    boost::optional<int64_t> freeSpaceTargetMB);
 
+/**
+ * Produces a DiskSpaceMonitor action that enables background auto compaction once the available
+ * disk space drops below 'autoCompactLowDiskSpaceThresholdMB'. The action enables compaction at
+ * most once; disabling it again is left to the operator via the 'autoCompact' command.
+ */
+std::unique_ptr<DiskSpaceMonitor::Action> makeEnableAutoCompactOnLowDiskSpaceAction();
+
 }  // namespace mongo
@@ -175,9 +175,10 @@ public:
     }
 
     void addInsertReplies(OperationContext* opCtx,
-                          size_t firstOpIdx,
+                          const std::vector<size_t>& opIdxs,
                           write_ops_exec::WriteResult& writes) {
         invariant(!writes.results.empty());
+        invariant(writes.results.size() <= opIdxs.size());
 
         // Copy over retriedStmtIds.
         for (auto& stmtId : writes.retriedStmtIds) {
@@ -185,7 +186,7 @@ public:
         }
 
         for (size_t i = 0; i < writes.results.size(); ++i) {
-            auto idx = firstOpIdx + i;
+            auto idx = opIdxs[i];
             if (auto error = write_ops_exec::generateError(
                     opCtx, writes.results[i].getStatus(), idx, _summaryFields.nErrors)) {
                 auto replyItem = BulkWriteReplyItem(idx, error.get().getStatus());
@@ -371,8 +372,11 @@ bool aboveBulkWriteRepliesMaxSize(OperationContext* opCtx,
 }
 
 /*
- * InsertGrouper is a helper class to group consecutive insert operations for the same namespace in
- * a bulkWrite command.
+ * InsertGrouper is a helper class to group insert operations for the same namespace in a bulkWrite
+ * command. For ordered requests only consecutive inserts to the same namespace may be grouped, to
+ * preserve execution order. Unordered requests may be executed in any order, so the grouper keeps
+ * one open group per namespace and inserts interleaved with inserts to other namespaces still
+ * collect into a single per-namespace batch.
  */
 class InsertGrouper {
 public:
@@ -380,59 +384,67 @@ public:
     InsertGrouper(const BulkWriteCommandRequest& request) : _req(request) {}
 
     bool isEmpty() const {
-        return !_firstOpIdx.has_value();
+        return _groups.empty();
     }
 
     /*
      * Return true if the insert op is successfully grouped.
      */
     bool group(const BulkWriteInsertOp* op, size_t currentOpIdx) {
-        const auto& nsInfo = _req.getNsInfo();
-        auto nsIdx = op->getInsert();
-
-        if (!_firstOpIdx.has_value()) {
-            // First op in this group.
-            invariant(_numOps == 0);
-            _firstOpIdx = currentOpIdx;
-            _currentNs = nsInfo[nsIdx];
-            _numOps = 1;
+        const auto& ns = _req.getNsInfo()[op->getInsert()];
+
+        if (!_groups.empty() && !_isDifferentNamespace(_groups.back().ns, ns)) {
+            _groups.back().opIdxs.push_back(currentOpIdx);
             return true;
         }
 
-        if (_isDifferentFromSavedNamespace(nsInfo[nsIdx])) {
-            // This should be in a new group after flush.
+        if (_req.getOrdered() && !_groups.empty()) {
+            // An ordered request cannot batch this insert past the ops in between: the existing
+            // group has to be flushed first.
             return false;
         }
 
-        _numOps += 1;
+        for (auto& group : _groups) {
+            if (!_isDifferentNamespace(group.ns, ns)) {
+                group.opIdxs.push_back(currentOpIdx);
+                return true;
+            }
+        }
+
+        _groups.push_back({ns, {currentOpIdx}});
         return true;
     }
 
     /*
-     * Return (firstOpIdx, numOps) for the current insert group.
+     * Return the op indexes of each insert group, in the order the groups were opened, and reset.
      * This function should only be called when the InsertGrouper is not empty.
      */
-    std::pair<size_t, size_t> getGroupedInsertsAndReset() {
-        invariant(_firstOpIdx.has_value());
-        size_t firstOpIdx = _firstOpIdx.value();
-        size_t numOps = _numOps;
+    std::vector<std::vector<size_t>> getGroupedInsertsAndReset() {
+        invariant(!_groups.empty());
 
-        _currentNs = NamespaceInfoEntry();
-        _numOps = 0;
-        _firstOpIdx = boost::none;
+        std::vector<std::vector<size_t>> groups;
+        groups.reserve(_groups.size());
+        for (auto& group : _groups) {
+            groups.push_back(std::move(group.opIdxs));
+        }
+        _groups.clear();
 
-        return std::make_pair(firstOpIdx, numOps);
+        return groups;
     }
 
 private:
+    struct Group {
+        NamespaceInfoEntry ns;
+        std::vector<size_t> opIdxs;
+    };
+
     const BulkWriteCommandRequest& _req;
-    NamespaceInfoEntry _currentNs;
-    boost::optional<size_t> _firstOpIdx = boost::none;
-    size_t _numOps = 0;
+    std::vector<Group> _groups;
 
-    bool _isDifferentFromSavedNamespace(const NamespaceInfoEntry& newNs) const {
-        if (newNs.getNs() == _currentNs.getNs()) {
-            return newNs.getCollectionUUID() != _currentNs.getCollectionUUID();
+    static bool _isDifferentNamespace(const NamespaceInfoEntry& savedNs,
+                                      const NamespaceInfoEntry& newNs) {
+        if (newNs.getNs() == savedNs.getNs()) {
+            return newNs.getCollectionUUID() != savedNs.getCollectionUUID();
         }
         return true;
     }
@@ -544,15 +556,13 @@ getRetryResultForUpdate(OperationContext* opCtx,
     return std::make_tuple(writeResult.getN(), writeResult.getNModified(), upserted);
 }
 
-std::vector<BSONObj> getConsecutiveInsertDocuments(const BulkWriteCommandRequest& req,
-                                                   size_t firstOpIdx,
-                                                   size_t numOps) {
+std::vector<BSONObj> getGroupedInsertDocuments(const BulkWriteCommandRequest& req,
+                                               const std::vector<size_t>& opIdxs) {
     std::vector<BSONObj> documents;
-    documents.reserve(numOps);
+    documents.reserve(opIdxs.size());
     const auto& ops = req.getOps();
 
-    for (size_t i = 0; i < numOps; i++) {
-        auto idx = firstOpIdx + i;
+    for (auto idx : opIdxs) {
         auto op = BulkWriteCRUDOp(ops[idx]);
         auto insertOp = op.getInsert();
         invariant(insertOp);
@@ -563,19 +573,16 @@ std::vector<BSONObj> getConsecutiveInsertDocuments(const BulkWriteCommandRequest
 }
 
 /*
- * Helper function to build an InsertCommandRequest for 'numOps' consecutive insert operations
- * starting from the 'firstOpIdx'-th operation in the bulkWrite request.
+ * Helper function to build an InsertCommandRequest for the grouped insert operations at the
+ * 'opIdxs' positions in the bulkWrite request.
  */
-write_ops::InsertCommandRequest getConsecutiveInsertRequest(const BulkWriteCommandRequest& req,
-                                                            size_t firstOpIdx,
-                                                            const std::vector<BSONObj>& docs,
-                                                            const NamespaceInfoEntry& nsInfoEntry) {
-    size_t numOps = docs.size();
-
+write_ops::InsertCommandRequest getGroupedInsertRequest(const BulkWriteCommandRequest& req,
+                                                        const std::vector<size_t>& opIdxs,
+                                                        const std::vector<BSONObj>& docs,
+                                                        const NamespaceInfoEntry& nsInfoEntry) {
     std::vector<std::int32_t> stmtIds;
-    stmtIds.reserve(numOps);
-    for (size_t i = 0; i < numOps; i++) {
-        auto idx = firstOpIdx + i;
+    stmtIds.reserve(opIdxs.size());
+    for (auto idx : opIdxs) {
         stmtIds.push_back(bulk_write_common::getStatementId(req, idx));
     }
 
@@ -630,7 +637,7 @@ void populateWriteResultWithInsertReply(size_t nDocsToInsert,
  */
 bool attemptGroupedFLEInserts(OperationContext* opCtx,
                               const BulkWriteCommandRequest& req,
-                              size_t firstOpIdx,
+                              const std::vector<size_t>& opIdxs,
                               const std::vector<BSONObj>& docs,
                               const NamespaceInfoEntry& nsInfoEntry,
                               write_ops_exec::WriteResult& out) {
@@ -639,7 +646,7 @@ bool attemptGroupedFLEInserts(OperationContext* opCtx,
     // For BulkWrite, re-entry is un-expected.
     invariant(!nsInfoEntry.getEncryptionInformation()->getCrudProcessed().value_or(false));
 
-    auto request = getConsecutiveInsertRequest(req, firstOpIdx, docs, nsInfoEntry);
+    auto request = getGroupedInsertRequest(req, opIdxs, docs, nsInfoEntry);
     write_ops::InsertCommandReply insertReply;
 
     FLEBatchResult batchResult = processFLEInsert(opCtx, request, &insertReply);
@@ -676,35 +683,33 @@ private:
  */
 void handleGroupedTimeseriesInserts(OperationContext* opCtx,
                                     const BulkWriteCommandRequest& req,
-                                    size_t firstOpIdx,
+                                    const std::vector<size_t>& opIdxs,
                                     const std::vector<BSONObj>& docs,
                                     const NamespaceInfoEntry& nsInfoEntry,
                                     CurOp* curOp,
                                     write_ops_exec::WriteResult& out) {
     size_t numOps = docs.size();
-    auto request = getConsecutiveInsertRequest(req, firstOpIdx, docs, nsInfoEntry);
+    auto request = getGroupedInsertRequest(req, opIdxs, docs, nsInfoEntry);
     auto insertReply = write_ops_exec::performTimeseriesWrites(opCtx, request, curOp);
     populateWriteResultWithInsertReply(numOps, req.getOrdered(), insertReply, out);
 }
 
 /*
- * Helper function to flush insert ops grouped by the insertGrouper.
+ * Helper function to flush a single per-namespace insert group.
  * Return true if we can continue with the rest of operations in the bulkWrite request.
  */
-bool handleGroupedInserts(OperationContext* opCtx,
-                          const BulkWriteCommandRequest& req,
-                          InsertGrouper& insertGrouper,
-                          write_ops_exec::LastOpFixer& lastOpFixer,
-                          BulkWriteReplies& responses) {
-    if (insertGrouper.isEmpty()) {
-        return true;
-    }
-    auto [firstOpIdx, numOps] = insertGrouper.getGroupedInsertsAndReset();
+bool handleInsertGroup(OperationContext* opCtx,
+                       const BulkWriteCommandRequest& req,
+                       const std::vector<size_t>& opIdxs,
+                       write_ops_exec::LastOpFixer& lastOpFixer,
+                       BulkWriteReplies& responses) {
+    const size_t numOps = opIdxs.size();
+    invariant(numOps > 0);
 
     const auto& nsInfo = req.getNsInfo();
     const auto& ops = req.getOps();
 
-    auto firstInsert = BulkWriteCRUDOp(ops[firstOpIdx]).getInsert();
+    auto firstInsert = BulkWriteCRUDOp(ops[opIdxs.front()]).getInsert();
     invariant(firstInsert);
 
     const auto nsIdx = firstInsert->getInsert();
@@ -714,7 +719,7 @@ bool handleGroupedInserts(OperationContext* opCtx,
     write_ops_exec::WriteResult out;
     out.results.reserve(numOps);
 
-    auto insertDocs = getConsecutiveInsertDocuments(req, firstOpIdx, numOps);
+    auto insertDocs = getGroupedInsertDocuments(req, opIdxs);
     invariant(insertDocs.size() == numOps);
 
     // Handle FLE inserts.
@@ -725,9 +730,9 @@ bool handleGroupedInserts(OperationContext* opCtx,
             CurOp::get(opCtx)->setShouldOmitDiagnosticInformation_inlock(lk, true);
         }
 
-        auto processed = attemptGroupedFLEInserts(opCtx, req, firstOpIdx, insertDocs, nsEntry, out);
+        auto processed = attemptGroupedFLEInserts(opCtx, req, opIdxs, insertDocs, nsEntry, out);
         if (processed) {
-            responses.addInsertReplies(opCtx, firstOpIdx, out);
+            responses.addInsertReplies(opCtx, opIdxs, out);
             return out.canContinue;
         }
         // Fallthrough to standard inserts.
@@ -757,9 +762,8 @@ bool handleGroupedInserts(OperationContext* opCtx,
     if (auto [isTimeseriesViewRequest, _] = timeseries::isTimeseriesViewRequest(opCtx, tsNs);
         isTimeseriesViewRequest) {
         try {
-            handleGroupedTimeseriesInserts(
-                opCtx, req, firstOpIdx, insertDocs, nsEntry, &curOp, out);
-            responses.addInsertReplies(opCtx, firstOpIdx, out);
+            handleGroupedTimeseriesInserts(opCtx, req, opIdxs, insertDocs, nsEntry, &curOp, out);
+            responses.addInsertReplies(opCtx, opIdxs, out);
             return out.canContinue;
         } catch (DBException& ex) {
             // Re-throw timeseries insert exceptions to be consistent with the insert command.
@@ -790,7 +794,7 @@ bool handleGroupedInserts(OperationContext* opCtx,
     for (size_t i = 0; i < numOps; i++) {
         const bool isLastDoc = (i == numOps - 1);
 
-        auto idx = firstOpIdx + i;
+        auto idx = opIdxs[i];
         auto& doc = insertDocs[i];
         bool containsDotsAndDollarsField = false;
 
@@ -868,10 +872,32 @@ bool handleGroupedInserts(OperationContext* opCtx,
     }
 
     invariant(batch.empty() && bytesInBatch == 0);
-    responses.addInsertReplies(opCtx, firstOpIdx, out);
+    responses.addInsertReplies(opCtx, opIdxs, out);
     return out.canContinue;
 }
 
+/*
+ * Helper function to flush the insert ops grouped by the insertGrouper. Unordered requests may
+ * have accumulated one group per namespace; groups are flushed in the order they were opened.
+ * Return true if we can continue with the rest of operations in the bulkWrite request.
+ */
+bool handleGroupedInserts(OperationContext* opCtx,
+                          const BulkWriteCommandRequest& req,
+                          InsertGrouper& insertGrouper,
+                          write_ops_exec::LastOpFixer& lastOpFixer,
+                          BulkWriteReplies& responses) {
+    if (insertGrouper.isEmpty()) {
+        return true;
+    }
+
+    for (const auto& opIdxs : insertGrouper.getGroupedInsertsAndReset()) {
+        if (!handleInsertGroup(opCtx, req, opIdxs, lastOpFixer, responses)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool handleInsertOp(OperationContext* opCtx,
                     const BulkWriteInsertOp* op,
                     const BulkWriteCommandRequest& req,
@@ -893,7 +919,8 @@ bool handleInsertOp(OperationContext* opCtx,
         return true;
     }
 
-    // Not able to group this insert op, flush existing group first.
+    // Not able to group this insert op (ordered request, different namespace), flush the existing
+    // group first.
     auto canContinue = handleGroupedInserts(opCtx, req, insertGrouper, lastOpFixer, responses);
     if (!canContinue) {
         return false;
@@ -1777,7 +1804,8 @@ BulkWriteReply performWrites(OperationContext* opCtx, const BulkWriteCommandRequ
     std::vector<int> validatedNamespaces = std::vector<int>();
     validatedNamespaces.assign(req.getNsInfo().size(), 0);
 
-    // Create an insertGrouper to group consecutive inserts to the same namespace.
+    // Create an insertGrouper to batch inserts per namespace. Ordered requests may only group
+    // consecutive inserts; unordered requests also group inserts interleaved across namespaces.
     auto insertGrouper = InsertGrouper(req);
 
     size_t idx = 0;
@@ -218,6 +218,48 @@ void upsertNullAnchor(FLEQueryInterface* queryImpl,
     }
 }
 
+/**
+ * Computes the next anchor document to insert for the field/value pair in 'ecocDoc', given the
+ * edge count info that getQueryableEncryptionCountInfo returned for its ESC token. Returns
+ * none if no new non-anchors have been inserted since the last compact/cleanup, meaning no
+ * anchor needs to be inserted.
+ */
+boost::optional<BSONObj> generateAnchorFromCountInfo(const FLEEdgeCountInfo& countInfo,
+                                                     const ECOCCompactionDocumentV2& ecocDoc) {
+    auto& emuBinaryResult = countInfo.searchedCounts.value();
+
+    // Check for the invalid case where emuBinary returned (0,0).
+    // This means that the tokens can't be trusted or the state collections are already hosed.
+    if (emuBinaryResult.cpos.value_or(1) == 0) {
+        // apos must also be 0 if cpos is 0
+        uassert(7666501,
+                "getQueryableEncryptionCountInfo returned an invalid position for the next anchor",
+                emuBinaryResult.apos.has_value() && emuBinaryResult.apos.value() == 0);
+        uasserted(7666502,
+                  str::stream() << "Queryable Encryption compaction encountered invalid searched "
+                                   "ESC positions for field "
+                                << ecocDoc.fieldName
+                                << ". This may be due to invalid compaction tokens or corrupted "
+                                   "state collections.");
+    }
+
+    if (emuBinaryResult.cpos == boost::none) {
+        // no new non-anchors since the last compact/cleanup, so don't insert a new anchor
+        return boost::none;
+    }
+
+    // the "count" field contains the next anchor position and must not be zero
+    uassert(7295002,
+            "getQueryableEncryptionCountInfo returned an invalid position for the next anchor",
+            countInfo.count > 0);
+
+    auto valueToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedValueToken(ecocDoc.esc);
+    auto latestCpos = emuBinaryResult.cpos.value();
+
+    return ESCCollection::generateAnchorDocument(
+        ESCTwiceDerivedTagToken(countInfo.tagTokenData), valueToken, countInfo.count, latestCpos);
+}
+
 void checkSchemaAndCompactionTokens(const BSONObj& tokens, const Collection& edc) {
     uassert(6346807,
             "Target namespace is not an encrypted collection",
@@ -372,54 +414,70 @@ void compactOneFieldValuePairV2(FLEQueryInterface* queryImpl,
                                 const ECOCCompactionDocumentV2& ecocDoc,
                                 const NamespaceString& escNss,
                                 ECStats* escStats) {
+    compactFieldValuePairsV2(queryImpl, {ecocDoc}, escNss, escStats);
+}
+
+void compactFieldValuePairsV2(FLEQueryInterface* queryImpl,
+                              const std::vector<ECOCCompactionDocumentV2>& batch,
+                              const NamespaceString& escNss,
+                              ECStats* escStats) {
+    invariant(!batch.empty());
     CompactStatsCounter<ECStats> stats(escStats);
 
     /**
-     * Send a getQueryableEncryptionCountInfo command with query type "compact".
-     * The target of this command will perform the actual search for the next anchor
-     * position, which happens in the getEdgeCountInfoForCompact() function in fle_crypto.
+     * Send a getQueryableEncryptionCountInfo command with query type "compact" that covers
+     * every field/value pair in the batch in a single round trip. The target of this command
+     * will perform the actual search for the next anchor positions, which happens in the
+     * getEdgeCountInfoForCompact() function in fle_crypto.
      *
-     * It is expected to return a single reply token, whose "count" field contains the
+     * It is expected to return one reply token per pair, whose "count" field contains the
      * next anchor position, and whose "searchedCounts" field contains the result of
      * emuBinary.
      */
-    auto countInfo = fetchEdgeCountInfo(
-        queryImpl, ecocDoc.esc, escNss, FLEQueryInterface::TagQueryType::kCompact, "compact"_sd);
-    auto& emuBinaryResult = countInfo.searchedCounts.value();
-
-    stats.add(countInfo.stats.get());
-
-    // Check for the invalid case where emuBinary returned (0,0).
-    // This means that the tokens can't be trusted or the state collections are already hosed.
-    if (emuBinaryResult.cpos.value_or(1) == 0) {
-        // apos must also be 0 if cpos is 0
-        uassert(7666501,
-                "getQueryableEncryptionCountInfo returned an invalid position for the next anchor",
-                emuBinaryResult.apos.has_value() && emuBinaryResult.apos.value() == 0);
-        uasserted(7666502,
-                  str::stream() << "Queryable Encryption compaction encountered invalid searched "
-                                   "ESC positions for field "
-                                << ecocDoc.fieldName
-                                << ". This may be due to invalid compaction tokens or corrupted "
-                                   "state collections.");
+    std::vector<std::vector<FLEEdgePrfBlock>> tags;
+    tags.reserve(batch.size());
+    for (auto& ecocDoc : batch) {
+        tags.emplace_back().push_back(FLEEdgePrfBlock{ecocDoc.esc.data, boost::none});
+    }
+    auto countInfoSets =
+        queryImpl->getTags(escNss, tags, FLEQueryInterface::TagQueryType::kCompact);
+    uassert(9987408,
+            str::stream() << "getQueryableEncryptionCountInfo for compact returned an invalid "
+                             "number of edge count info",
+            countInfoSets.size() == batch.size());
+
+    // Consolidate the next anchors for the whole batch in memory, then emit them below with a
+    // single batched insert, rather than round-tripping a write per field/value pair.
+    std::vector<BSONObj> anchorDocs;
+    anchorDocs.reserve(batch.size());
+
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        uassert(9987409,
+                str::stream() << "getQueryableEncryptionCountInfo for compact returned an invalid "
+                                 "number of edge count info",
+                countInfoSets[i].size() == 1);
+
+        auto& countInfo = countInfoSets[i][0];
+        uassert(9987410,
+                str::stream()
+                    << "getQueryableEncryptionCountInfo for compact returned non-existent stats",
+                countInfo.stats.has_value());
+        uassert(9987411,
+                str::stream() << "getQueryableEncryptionCountInfo for compact returned "
+                                 "non-existent searched counts",
+                countInfo.searchedCounts.has_value());
+
+        stats.add(countInfo.stats.get());
+
+        if (auto anchorDoc = generateAnchorFromCountInfo(countInfo, batch[i])) {
+            anchorDocs.push_back(std::move(anchorDoc.get()));
+        }
     }
 
-    if (emuBinaryResult.cpos == boost::none) {
-        // no new non-anchors since the last compact/cleanup, so don't insert a new anchor
+    if (anchorDocs.empty()) {
         return;
     }
 
-    // the "count" field contains the next anchor position and must not be zero
-    uassert(7295002,
-            "getQueryableEncryptionCountInfo returned an invalid position for the next anchor",
-            countInfo.count > 0);
-
-    auto valueToken = FLETwiceDerivedTokenGenerator::generateESCTwiceDerivedValueToken(ecocDoc.esc);
-    auto latestCpos = emuBinaryResult.cpos.value();
-
-    auto anchorDoc = ESCCollection::generateAnchorDocument(
-        ESCTwiceDerivedTagToken(countInfo.tagTokenData), valueToken, countInfo.count, latestCpos);
-
     StmtId stmtId = kUninitializedStmtId;
 
     if (MONGO_unlikely(fleCompactHangBeforeESCAnchorInsert.shouldFail())) {
@@ -427,10 +485,11 @@ void compactOneFieldValuePairV2(FLEQueryInterface* queryImpl,
         fleCompactHangBeforeESCAnchorInsert.pauseWhileSet();
     }
 
-    auto insertReply =
-        uassertStatusOK(queryImpl->insertDocuments(escNss, {anchorDoc}, &stmtId, true));
+    const auto docsCount = anchorDocs.size();
+    auto insertReply = uassertStatusOK(
+        queryImpl->insertDocuments(escNss, std::move(anchorDocs), &stmtId, true));
     checkWriteErrors(insertReply);
-    stats.addInserts(1);
+    stats.addInserts(docsCount);
 }
 
 
@@ -739,16 +798,31 @@ void processFLECompactV2(OperationContext* opCtx,
         }
     }
 
-    // Each entry in 'C_f' represents a unique field/value pair. For each field/value pair,
-    // compact the ESC entries for that field/value pair in one transaction.
-    for (auto& ecocDoc : *uniqueEcocEntries) {
+    // Each entry in 'C_f' represents a unique field/value pair. Compact the ESC entries in
+    // batches of field/value pairs, one transaction per batch. Each transaction searches the
+    // next anchor positions for all pairs in its batch in a single
+    // getQueryableEncryptionCountInfo round trip and inserts the resulting anchors with a
+    // single batched write, rather than round-tripping per pair.
+    const auto maxPairsPerTxn = static_cast<std::size_t>(
+        ServerParameterSet::getClusterParameterSet()
+            ->get<ClusterParameterWithStorage<FLECompactionOptions>>("fleCompactionOptions")
+            ->getValue(namespaces.escNss.tenantId())
+            .getMaxFieldValuePairsPerCompactionTransaction());
+
+    for (auto it = uniqueEcocEntries->begin(); it != uniqueEcocEntries->end();) {
+        std::vector<ECOCCompactionDocumentV2> batch;
+        batch.reserve(std::min(maxPairsPerTxn, uniqueEcocEntries->size()));
+        for (; it != uniqueEcocEntries->end() && batch.size() < maxPairsPerTxn; ++it) {
+            batch.push_back(*it);
+        }
+
         // start a new transaction
         std::shared_ptr<txn_api::SyncTransactionWithRetries> trun = getTxn(opCtx);
 
         // The function that handles the transaction may outlive this function so we need to use
         // shared_ptrs
-        auto argsBlock = std::make_tuple(ecocDoc, namespaces.escNss);
-        auto sharedBlock = std::make_shared<decltype(argsBlock)>(argsBlock);
+        auto argsBlock = std::make_tuple(std::move(batch), namespaces.escNss);
+        auto sharedBlock = std::make_shared<decltype(argsBlock)>(std::move(argsBlock));
         auto service = opCtx->getService();
 
         auto swResult = trun->runNoThrow(
@@ -757,9 +831,9 @@ void processFLECompactV2(OperationContext* opCtx,
                                                   ExecutorPtr txnExec) {
                 FLEQueryInterfaceImpl queryImpl(txnClient, service);
 
-                auto [ecocDoc2, escNss] = *sharedBlock.get();
+                auto& [batch2, escNss] = *sharedBlock.get();
 
-                compactOneFieldValuePairV2(&queryImpl, ecocDoc2, escNss, innerEscStats.get());
+                compactFieldValuePairsV2(&queryImpl, batch2, escNss, innerEscStats.get());
 
                 return SemiFuture<void>::makeReady();
             });
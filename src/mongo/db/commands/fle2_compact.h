@@ -112,6 +112,19 @@ void compactOneFieldValuePairV2(FLEQueryInterface* queryImpl,
                                 const NamespaceString& escNss,
                                 ECStats* escStats);
 
+/**
+ * Performs compaction of the ESC entries for a batch of encrypted field/value pairs.
+ * The next anchor positions for all pairs in the batch are searched with a single
+ * getQueryableEncryptionCountInfo round trip, and the resulting anchors are inserted
+ * with a single batched write.
+ *
+ * Must be called from within a transaction.
+ */
+void compactFieldValuePairsV2(FLEQueryInterface* queryImpl,
+                              const std::vector<ECOCCompactionDocumentV2>& batch,
+                              const NamespaceString& escNss,
+                              ECStats* escStats);
+
 
 /**
  * Performs compaction for Range fields to add additional padding edges.
@@ -754,6 +754,41 @@ void FleCompactTest::testCompactValueV2_WithNullAnchor(const Value& value,
     assertDocumentCounts(edcCount, escCount, ecocCount);
 }
 
+// Tests V2 compaction of a batch of field/value pairs in a single call
+TEST_F(FleCompactTest, CompactFieldValuePairsV2_MultiplePairs) {
+    ECStats escStats;
+    constexpr auto key = "first"_sd;
+    std::map<std::string, InsertionState> values;
+    std::vector<ECOCCompactionDocumentV2> batch;
+
+    constexpr uint64_t uniqueValues = 5;
+    constexpr uint64_t insertsPerValue = 3;
+    for (uint64_t i = 1; i <= uniqueValues; i++) {
+        auto val = "value_" + std::to_string(i);
+        values[val].toInsertCount = insertsPerValue;
+        batch.push_back(generateTestECOCDocumentV2(BSON(key << val)));
+    }
+    insertFieldValues(key, values);
+
+    const uint64_t inserted = uniqueValues * insertsPerValue;
+    assertDocumentCounts(inserted, inserted, inserted);
+
+    // Compact all pairs in one batch; assert one anchor is inserted per pair
+    compactFieldValuePairsV2(_queryImpl.get(), batch, _namespaces.escNss, &escStats);
+    assertDocumentCounts(inserted, inserted + uniqueValues, inserted);
+    for (uint64_t i = 1; i <= uniqueValues; i++) {
+        auto val = "value_" + std::to_string(i);
+        assertESCAnchorDocument(BSON(key << val), true, 1, insertsPerValue);
+    }
+    ASSERT_EQ(escStats.getInserted(), uniqueValues);
+
+    // Compacting the same batch again should not insert any new anchors since there are
+    // no new non-anchors since the last compact
+    compactFieldValuePairsV2(_queryImpl.get(), batch, _namespaces.escNss, &escStats);
+    assertDocumentCounts(inserted, inserted + uniqueValues, inserted);
+    ASSERT_EQ(escStats.getInserted(), uniqueValues);
+}
+
 TEST_F(FleCompactTest, CompactValueV2_WithNullAnchor) {
     testCompactValueV2_WithNullAnchor(std::string("value"), boost::none);
 }
@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -94,6 +95,7 @@
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/speculative_majority_read_info.h"
 #include "mongo/db/repl/tenant_migration_access_blocker_util.h"
+#include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/session/logical_session_id.h"
 #include "mongo/db/session/logical_session_id_gen.h"
@@ -101,6 +103,7 @@
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/db/stats/top.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/db/transaction/transaction_participant.h"
 #include "mongo/db/transaction_resources.h"
@@ -125,6 +128,7 @@
 #include "mongo/util/serialization_context.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 #include "mongo/util/uuid.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
@@ -449,6 +453,11 @@ public:
             size_t objSize;
             bool failedToAppend = false;
 
+            // The byte budget for this batch. This is the protocol maximum unless adaptive batch
+            // sizing has shrunk this cursor's budget to keep batch latency near its target.
+            const size_t byteBudget = cursor->getNextBatchByteBudget();
+            Timer batchTimer;
+
             // Note that unlike in find, a batch size of 0 means there is no limit on the number of
             // documents, and we may choose to pre-allocate space for the batch after the first
             // object.
@@ -457,8 +466,9 @@ public:
                 // allow the first object to be appended to the batch so we can make
                 // progress.
                 objSize = obj.objsize();
-                auto bytesToReserve =
-                    FindCommon::getBytesToReserveForGetMoreReply(isTailable, objSize, batchSize);
+                auto bytesToReserve = std::min(
+                    FindCommon::getBytesToReserveForGetMoreReply(isTailable, objSize, batchSize),
+                    byteBudget);
                 nextBatch->reserveReplyBuffer(bytesToReserve);
                 // Don't check document size here before appending, since we always want to make
                 // progress.
@@ -482,9 +492,13 @@ public:
                                                       nextBatch,
                                                       docUnitsReturned,
                                                       pbrt,
-                                                      failedToAppend});
+                                                      failedToAppend,
+                                                      byteBudget});
             }
 
+            cursor->recordBatchDurationForAdaptiveSizing(nextBatch->bytesUsed(),
+                                                         Microseconds{batchTimer.micros()});
+
             // Use the resume token generated by the last execution of the plan that didn't stash a
             // document, or the latest resume token if we hit EOF/the end of the batch.
             nextBatch->setPostBatchResumeToken(failedToAppend ? pbrt
@@ -693,6 +707,19 @@ public:
                 // execution to assume read data will not be needed again and need not be cached.
                 shard_role_details::getRecoveryUnit(opCtx)->setReadOnce(true);
             }
+
+            // Let the storage engine detect scans and read ahead of the cursor position, so that
+            // the pages backing the next batch are faulted into cache by background threads while
+            // this thread serializes the current batch into the reply. This must be requested
+            // before the executor restores and reopens its storage cursors. Tailable cursors sit
+            // at the end of their collection, so there is nothing ahead to prefetch for them.
+            if (gFeatureFlagPrefetch.isEnabled(
+                    serverGlobalParams.featureCompatibility.acquireFCVSnapshot()) &&
+                !opCtx->getServiceContext()->getStorageEngine()->isEphemeral() &&
+                !opCtx->inMultiDocumentTransaction() && !cursorPin->isTailable()) {
+                shard_role_details::getRecoveryUnit(opCtx)->setPrefetching(true);
+            }
+
             exec->reattachToOperationContext(opCtx);
             exec->restoreState(readLock ? &readLock->getCollection() : nullptr);
 
@@ -30,11 +30,13 @@
 #pragma once
 
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/db/client.h"
 #include "mongo/db/curop.h"
@@ -100,6 +102,17 @@ template <ErrorCodes::Error ec>
 [[noreturn]] void throwExceptionFor(std::string reason) {
     throw ExceptionFor<ec>({ec, std::move(reason)});
 }
+
+/**
+ * As `throwExceptionFor`, but the thrown exception carries an immortal Status constructed once
+ * per (ec, `makeReason` functor type) pair, so repeated throws from the same call site do not
+ * allocate a fresh error status. Only suitable for call sites whose reason string is constant;
+ * `makeReason` must be a distinct lambda per call site.
+ */
+template <ErrorCodes::Error ec, typename ReasonFn>
+[[noreturn]] void throwInternedExceptionFor(ReasonFn makeReason) {
+    throw ExceptionFor<ec>(Status::interned<ec>(std::move(makeReason)));
+}
 }  // namespace error_details
 
 /**
@@ -114,6 +127,20 @@ template <ErrorCodes::Error ec>
             context));
 }
 
+/**
+ * As above, but for hot call sites whose context string is constant. The fully formatted reason
+ * is computed once and the resulting status is interned, so subsequent throws from the same site
+ * reuse it instead of allocating. `makeContext` must be a distinct lambda per call site.
+ */
+template <typename ContextFn, std::enable_if_t<std::is_invocable_v<ContextFn>, int> = 0>
+[[noreturn]] void throwWriteConflictException(ContextFn makeContext) {
+    error_details::throwInternedExceptionFor<ErrorCodes::WriteConflict>([&] {
+        using namespace fmt::literals;
+        return "Caused by :: {} :: Please retry your operation or multi-document "
+               "transaction."_format(makeContext());
+    });
+}
+
 /**
  * A `TemporarilyUnavailableException` is thrown if an operation aborts due to the server being
  * temporarily unavailable, e.g. due to excessive load. For user-originating operations, this will
@@ -51,6 +51,7 @@
 #include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/processinfo.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
 
@@ -135,6 +136,20 @@ MONGO_STATIC_ASSERT((sizeof(LockRequestStatusNames) / sizeof(LockRequestStatusNa
 
 auto getLockManager = ServiceContext::declareDecoration<LockManager>();
 
+/**
+ * Number of partitions used for the intent-lock fast path. Scales with the core count so that
+ * threads running concurrently mostly hash to distinct partitions. The exact value is not
+ * critical, but it must be a power of two so that reducing a locker id modulo the partition
+ * count stays cheap.
+ */
+unsigned numIntentLockPartitions() {
+    const auto numCores = static_cast<unsigned>(ProcessInfo::getNumAvailableCores());
+    unsigned numPartitions = 32;
+    while (numPartitions < 2 * numCores && numPartitions < 1024)
+        numPartitions *= 2;
+    return numPartitions;
+}
+
 }  // namespace
 
 /**
@@ -414,7 +429,7 @@ LockManager* LockManager::get(ServiceContext& service) {
     return &getLockManager(service);
 }
 
-LockManager::LockManager() {
+LockManager::LockManager() : _numPartitions{numIntentLockPartitions()} {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
@@ -209,9 +209,11 @@ private:
     static constexpr unsigned _numLockBuckets{128};
     LockBucket* _lockBuckets;
 
-    // Balance scalability of intent locks against potential added cost of conflicting locks. The
-    // exact value doesn't appear very important, but should be power of two.
-    static constexpr unsigned _numPartitions{32};
+    // Balance scalability of intent locks against potential added cost of conflicting locks.
+    // Sized from the core count at construction so that concurrently running threads mostly hash
+    // to distinct partitions; conflicting locks only migrate partitions that actually hold
+    // requests, so a larger partition count does not slow down strong-mode locking.
+    const unsigned _numPartitions;
     Partition* _partitions;
 };
 
@@ -118,6 +118,53 @@ private:
     AlignedLockStats _partitions[NumPartitions];
 };
 
+/**
+ * Tracks how many lockers are currently in each ClientState. As with the lock statistics above,
+ * the counters are partitioned by LockerId to minimize conflicts between concurrent state
+ * transitions, and a reader sums the partitions to produce a snapshot. This lets serverStatus
+ * report the global lock queues without touching any other client's state.
+ */
+class PartitionedClientStateCounters {
+    PartitionedClientStateCounters(const PartitionedClientStateCounters&) = delete;
+    PartitionedClientStateCounters& operator=(const PartitionedClientStateCounters&) = delete;
+
+public:
+    PartitionedClientStateCounters() {}
+
+    void transition(LockerId id, Locker::ClientState from, Locker::ClientState to) {
+        if (from != Locker::kInactive)
+            _get(id, from).fetchAndSubtractRelaxed(1);
+        if (to != Locker::kInactive)
+            _get(id, to).fetchAndAddRelaxed(1);
+    }
+
+    Locker::GlobalClientStateCounts report() const {
+        Locker::GlobalClientStateCounts counts;
+        for (auto&& partition : _partitions) {
+            counts.activeReaders += partition.counts[Locker::kActiveReader].loadRelaxed();
+            counts.activeWriters += partition.counts[Locker::kActiveWriter].loadRelaxed();
+            counts.queuedReaders += partition.counts[Locker::kQueuedReader].loadRelaxed();
+            counts.queuedWriters += partition.counts[Locker::kQueuedWriter].loadRelaxed();
+        }
+        return counts;
+    }
+
+private:
+    // This alignment is a best effort approach to ensure that each partition falls on a
+    // separate page/cache line in order to avoid false sharing.
+    struct alignas(stdx::hardware_destructive_interference_size) AlignedClientStateCounts {
+        AtomicWord<long long> counts[5];
+    };
+
+    enum { NumPartitions = 8 };
+
+    AtomicWord<long long>& _get(LockerId id, Locker::ClientState state) {
+        return _partitions[id % NumPartitions].counts[state];
+    }
+
+    AlignedClientStateCounts _partitions[NumPartitions];
+};
+
 /**
  * Periodically purges unused lock buckets. The first time the lock is used again after cleanup it
  * needs to be allocated, and similarly, every first use by a client for an intent  mode may need to
@@ -142,6 +189,10 @@ AtomicWord<LockerId> idCounter(0);
 // indexed by LockerId in order to minimize concurrent access conflicts.
 PartitionedInstanceWideLockStats globalStats;
 
+// Tracks how many lockers are in each ClientState across all Locker instances, partitioned by
+// LockerId like 'globalStats'.
+PartitionedClientStateCounters globalClientStateCounters;
+
 // How often (in millis) to check for deadlock if a lock has not been granted for some time
 constexpr Milliseconds kMaxWaitTime = Milliseconds(500);
 
@@ -168,6 +219,11 @@ Locker::~Locker() {
     invariant(_requests.empty());
 
     invariant(_modeForTicket == MODE_NONE);
+
+    // Remove this locker's contribution to the global client state counters.
+    if (_countedState != kInactive) {
+        globalClientStateCounters.transition(_id, _countedState, kInactive);
+    }
 }
 
 void Locker::updateThreadIdToCurrentThread() {
@@ -197,6 +253,23 @@ Locker::ClientState Locker::getClientState() const {
     return state;
 }
 
+Locker::GlobalClientStateCounts Locker::getGlobalClientStateCounts() {
+    return globalClientStateCounters.report();
+}
+
+void Locker::_setClientState(ClientState state) {
+    _clientState.store(state);
+    _updateClientStateCounters();
+}
+
+void Locker::_updateClientStateCounters() {
+    auto state = getClientState();
+    if (state == _countedState)
+        return;
+    globalClientStateCounters.transition(_id, _countedState, state);
+    _countedState = state;
+}
+
 void Locker::getFlowControlTicket(OperationContext* opCtx, LockMode lockMode) {
     auto ticketholder = FlowControlTicketholder::get(opCtx);
     if (ticketholder && lockMode == LockMode::MODE_IX && _clientState.load() == kInactive &&
@@ -208,8 +281,8 @@ void Locker::getFlowControlTicket(OperationContext* opCtx, LockMode lockMode) {
         // being modified here to change serverStatus' `globalLock.currentQueue` metrics. This
         // method must not exit with a side-effect on the clientState. That value is also used for
         // tracking whether other resources need to be released.
-        _clientState.store(kQueuedWriter);
-        ScopeGuard restoreState([&] { _clientState.store(kInactive); });
+        _setClientState(kQueuedWriter);
+        ScopeGuard restoreState([&] { _setClientState(kInactive); });
         // Acquiring a ticket is a potentially blocking operation. This must not be called after a
         // transaction timestamp has been set, indicating this transaction has created an oplog
         // hole.
@@ -448,6 +521,15 @@ ResourceId Locker::getWaitingResource() const {
     return _waitingResource;
 }
 
+bool Locker::hasConflictingWaiters() const {
+    for (auto it = _requests.begin(); it; it.next()) {
+        if (_lockManager->hasConflictingRequests(it.key(), it.objAddr())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 MONGO_TSAN_IGNORE
 void Locker::getLockerInfo(
     LockerInfo* lockerInfo,
@@ -991,9 +1073,9 @@ bool Locker::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t deadl
 
     if (mode != MODE_X && mode != MODE_NONE && holder) {
         // MODE_X is exclusive of all other locks, thus acquiring a ticket is unnecessary.
-        _clientState.store(reader ? kQueuedReader : kQueuedWriter);
+        _setClientState(reader ? kQueuedReader : kQueuedWriter);
         // If the ticket wait is interrupted, restore the state of the client.
-        ScopeGuard restoreStateOnErrorGuard([&] { _clientState.store(kInactive); });
+        ScopeGuard restoreStateOnErrorGuard([&] { _setClientState(kInactive); });
 
         // Acquiring a ticket is a potentially blocking operation. This must not be called after a
         // transaction timestamp has been set, indicating this transaction has created an oplog
@@ -1019,7 +1101,7 @@ bool Locker::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t deadl
         restoreStateOnErrorGuard.dismiss();
     }
 
-    _clientState.store(reader ? kActiveReader : kActiveWriter);
+    _setClientState(reader ? kActiveReader : kActiveWriter);
     return true;
 }
 
@@ -1047,12 +1129,17 @@ bool Locker::_unlockImpl(LockRequestsMap::Iterator* it) {
 
 void Locker::_releaseTicket() {
     _ticket.reset();
-    _clientState.store(kInactive);
+    _setClientState(kInactive);
 }
 
 void Locker::_setWaitingResource(ResourceId resId) {
-    scoped_spinlock lg(_lock);
-    _waitingResource = resId;
+    {
+        scoped_spinlock lg(_lock);
+        _waitingResource = resId;
+    }
+    // A pending lock request changes what getClientState() reports, so reconcile the global
+    // counters as well.
+    _updateClientStateCounters();
 }
 
 bool Locker::_shouldDelayUnlock(ResourceId resId, LockMode mode) const {
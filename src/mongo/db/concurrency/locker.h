@@ -119,6 +119,23 @@ public:
      */
     ClientState getClientState() const;
 
+    /**
+     * Snapshot of how many lockers are in each non-inactive ClientState across the process.
+     */
+    struct GlobalClientStateCounts {
+        long long activeReaders = 0;
+        long long activeWriters = 0;
+        long long queuedReaders = 0;
+        long long queuedWriters = 0;
+    };
+
+    /**
+     * Returns the number of lockers in each ClientState, summed from partitioned counters that
+     * lockers maintain as their own state changes. This lets the globalLock serverStatus section
+     * report queue depths without iterating, and briefly locking, every Client in the process.
+     */
+    static GlobalClientStateCounts getGlobalClientStateCounts();
+
     bool shouldWaitForTicket(OperationContext* opCtx) const {
         return ExecutionAdmissionContext::get(opCtx).getPriority() !=
             AdmissionContext::Priority::kExempt;
@@ -302,6 +319,14 @@ public:
      */
     ResourceId getWaitingResource() const;
 
+    /**
+     * Returns whether any other operation has a lock request queued behind a resource this locker
+     * holds. May only be called by the thread which owns this locker, and the returned value may
+     * be immediately stale; it is intended as a hint, e.g. for deciding whether a yield would
+     * benefit anyone.
+     */
+    bool hasConflictingWaiters() const;
+
     /**
      * Describes a single lock acquisition for reporting/serialization purposes.
      */
@@ -669,6 +694,18 @@ protected:
      */
     void _setWaitingResource(ResourceId resId);
 
+    /**
+     * Sets _clientState and keeps the process-wide client state counters in sync.
+     */
+    void _setClientState(ClientState state);
+
+    /**
+     * Reconciles the process-wide client state counters with this locker's getClientState()
+     * value, which is derived from both _clientState and any pending lock request. Must be called
+     * by the owning thread whenever either of those changes.
+     */
+    void _updateClientStateCounters();
+
     /**
      * Whether we should use two phase locking. Returns true if the particular lock's release should
      * be delayed until the end of the operation.
@@ -757,6 +794,10 @@ protected:
     // Indicates whether the client is active reader/writer or is queued.
     AtomicWord<ClientState> _clientState{kInactive};
 
+    // The state this locker last contributed to the process-wide client state counters. Only
+    // accessed by the owning thread.
+    ClientState _countedState{kInactive};
+
     // If true, shared locks will participate in two-phase locking.
     bool _sharedLocksShouldTwoPhaseLock = false;
 
@@ -93,6 +93,24 @@ TEST_F(LockerTest, LockNoConflict) {
     locker.unlockGlobal();
 }
 
+TEST_F(LockerTest, GlobalClientStateCountsTrackTransitions) {
+    auto opCtx = makeOperationContext();
+
+    const auto countsBefore = Locker::getGlobalClientStateCounts();
+
+    Locker locker(opCtx->getServiceContext());
+    locker.lockGlobal(opCtx.get(), MODE_IX);
+
+    auto counts = Locker::getGlobalClientStateCounts();
+    ASSERT_EQUALS(countsBefore.activeWriters + 1, counts.activeWriters);
+
+    locker.unlockGlobal();
+
+    counts = Locker::getGlobalClientStateCounts();
+    ASSERT_EQUALS(countsBefore.activeWriters, counts.activeWriters);
+    ASSERT_EQUALS(countsBefore.queuedWriters, counts.queuedWriters);
+}
+
 TEST_F(LockerTest, ReLockNoConflict) {
     auto opCtx = makeOperationContext();
 
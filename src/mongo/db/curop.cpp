@@ -981,6 +981,19 @@ void CurOp::reportState(BSONObjBuilder* builder,
         builder->append("temporarilyUnavailableErrors", n);
     }
 
+    if (_debug.planningTime > Microseconds::zero()) {
+        builder->append("planningTimeMicros", durationCount<Microseconds>(_debug.planningTime));
+    }
+
+    // Time spent blocked on prepare conflicts so far, including any conflict currently being
+    // waited on. OpDebug only captures this when the operation completes.
+    if (auto prepareConflictDuration =
+            PrepareConflictTracker::get(opCtx).getPrepareConflictDuration();
+        prepareConflictDuration > Microseconds::zero()) {
+        builder->append("prepareConflictDurationMillis",
+                        durationCount<Milliseconds>(prepareConflictDuration));
+    }
+
     builder->append("numYields", _numYields.load());
 
     if (_debug.dataThroughputLastSecond) {
@@ -1557,6 +1570,11 @@ void OpDebug::append(OperationContext* opCtx,
                  durationCount<Milliseconds>(waitForWriteConcernDurationMillis));
     }
 
+    if (prepareConflictDurationMillis > Milliseconds::zero()) {
+        b.append("prepareConflictDuration",
+                 durationCount<Milliseconds>(prepareConflictDurationMillis));
+    }
+
     if (storageStats) {
         b.append("storage", storageStats->toBSON());
     }
@@ -1585,6 +1603,14 @@ void OpDebug::append(OperationContext* opCtx,
         b.appendNumber("cpuNanos", durationCount<Nanoseconds>(cpuTime));
     }
 
+    if (gFeatureFlagLogSlowOpsBasedOnTimeWorking.isEnabled(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+        if (waitForTicketDurationMillis > Milliseconds::zero()) {
+            b.appendNumber("ticketWaitMillis", waitForTicketDurationMillis.count());
+        }
+        b.appendNumber("workingMillis", durationCount<Milliseconds>(workingTimeMillis));
+    }
+
     // millis should always be present for any operation
     b.appendNumber(
         "millis",
@@ -1935,6 +1961,19 @@ std::function<BSONObj(ProfileFilter::Args)> OpDebug::appendStaged(StringSet requ
                            args.op.additiveMetrics.clusterWorkingTime.value_or(Milliseconds{0})));
     });
 
+    addIfNeeded("ticketWaitMillis", [](auto field, auto args, auto& b) {
+        if (args.op.waitForTicketDurationMillis > Milliseconds::zero()) {
+            b.appendNumber(field, args.op.waitForTicketDurationMillis.count());
+        }
+    });
+
+    addIfNeeded("prepareConflictDuration", [](auto field, auto args, auto& b) {
+        if (args.op.prepareConflictDurationMillis > Milliseconds::zero()) {
+            b.appendNumber(field,
+                           durationCount<Milliseconds>(args.op.prepareConflictDurationMillis));
+        }
+    });
+
     addIfNeeded("planSummary", [](auto field, auto args, auto& b) {
         if (!args.curop.getPlanSummary().empty()) {
             b.append(field, args.curop.getPlanSummary());
@@ -304,9 +304,12 @@ void CursorManager::unpin(OperationContext* opCtx,
 }
 
 void CursorManager::appendActiveSessions(LogicalSessionIdSet* lsids) const {
-    auto allPartitions = _cursorMap->lockAllPartitions();
-    for (auto&& partition : allPartitions) {
-        for (auto&& entry : *partition) {
+    // Lock and inspect one partition at a time so that the scan does not block cursor pins and
+    // registrations in every other partition. It is acceptable for the output not to include info
+    // about cursors opened/closed while iterating.
+    for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+        for (auto&& entry : *lockedPartition) {
             auto cursor = entry.second;
             if (auto id = cursor->getSessionId()) {
                 lsids->insert(id.value());
@@ -320,9 +323,12 @@ std::vector<GenericCursor> CursorManager::getIdleCursors(
     std::vector<GenericCursor> cursors;
     AuthorizationSession* ctxAuth = AuthorizationSession::get(opCtx->getClient());
 
-    auto allPartitions = _cursorMap->lockAllPartitions();
-    for (auto&& partition : allPartitions) {
-        for (auto&& entry : *partition) {
+    // Lock and inspect one partition at a time so that the scan does not block cursor pins and
+    // registrations in every other partition. It is acceptable for the output not to include info
+    // about cursors opened/closed while iterating.
+    for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+        for (auto&& entry : *lockedPartition) {
             auto cursor = entry.second;
 
             // Exclude cursors that this user does not own if auth is enabled.
@@ -345,9 +351,12 @@ std::vector<GenericCursor> CursorManager::getIdleCursors(
 stdx::unordered_set<CursorId> CursorManager::getCursorsForSession(LogicalSessionId lsid) const {
     stdx::unordered_set<CursorId> cursors;
 
-    auto allPartitions = _cursorMap->lockAllPartitions();
-    for (auto&& partition : allPartitions) {
-        for (auto&& entry : *partition) {
+    // Lock and inspect one partition at a time so that the scan does not block cursor pins and
+    // registrations in every other partition. It is acceptable for the output not to include info
+    // about cursors opened/closed while iterating.
+    for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+        for (auto&& entry : *lockedPartition) {
             auto cursor = entry.second;
             if (cursor->getSessionId() == lsid) {
                 cursors.insert(cursor->cursorid());
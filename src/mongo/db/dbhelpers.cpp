@@ -128,18 +128,7 @@ RecordId Helpers::findOne(OperationContext* opCtx,
     if (!collection)
         return RecordId();
 
-    auto cq = std::make_unique<CanonicalQuery>(CanonicalQueryParams{
-        .expCtx = makeExpressionContext(opCtx, *findCommand),
-        .parsedFind = ParsedFindCommandParams{
-            .findCommand = std::move(findCommand),
-            .extensionsCallback = ExtensionsCallbackReal(opCtx, &collection->ns()),
-            .allowedFeatures = MatchExpressionParser::kAllowAllSpecialFeatures}});
-    cq->setForceGenerateRecordId(true);
-
-    auto exec = uassertStatusOK(getExecutorFind(opCtx,
-                                                MultipleCollectionAccessor{collection},
-                                                std::move(cq),
-                                                PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY));
+    auto exec = makeFindExecutor(opCtx, collection, std::move(findCommand));
 
     PlanExecutor::ExecState state;
     BSONObj obj;
@@ -150,6 +139,24 @@ RecordId Helpers::findOne(OperationContext* opCtx,
     return RecordId();
 }
 
+std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> Helpers::makeFindExecutor(
+    OperationContext* opCtx,
+    const CollectionPtr& collection,
+    std::unique_ptr<FindCommandRequest> findCommand) {
+    auto cq = std::make_unique<CanonicalQuery>(CanonicalQueryParams{
+        .expCtx = makeExpressionContext(opCtx, *findCommand),
+        .parsedFind = ParsedFindCommandParams{
+            .findCommand = std::move(findCommand),
+            .extensionsCallback = ExtensionsCallbackReal(opCtx, &collection->ns()),
+            .allowedFeatures = MatchExpressionParser::kAllowAllSpecialFeatures}});
+    cq->setForceGenerateRecordId(true);
+
+    return uassertStatusOK(getExecutorFind(opCtx,
+                                           MultipleCollectionAccessor{collection},
+                                           std::move(cq),
+                                           PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY));
+}
+
 bool Helpers::findById(OperationContext* opCtx,
                        const NamespaceString& nss,
                        BSONObj query,
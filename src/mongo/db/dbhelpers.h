@@ -35,6 +35,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/ops/update_result.h"
+#include "mongo/db/query/plan_executor.h"
 #include "mongo/db/record_id.h"
 
 namespace mongo {
@@ -86,6 +87,21 @@ struct Helpers {
                             const CollectionPtr& collection,
                             std::unique_ptr<FindCommandRequest> qr);
 
+    /**
+     * Builds a PlanExecutor for the given find request against an already acquired collection.
+     *
+     * This is the preferred way for pre-authorized internal callers to issue local reads: it goes
+     * straight from the request to the query planner, skipping the command serialization, service
+     * entry point dispatch, re-parse and authorization checks a DBDirectClient loopback pays for.
+     * Callers own locking and replication state checks, as with the other helpers in this file.
+     *
+     * The returned executor is non-yielding and always produces RecordIds alongside documents.
+     */
+    static std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeFindExecutor(
+        OperationContext* opCtx,
+        const CollectionPtr& collection,
+        std::unique_ptr<FindCommandRequest> findCommand);
+
     /**
      * Returns true if a matching document was found.
      */
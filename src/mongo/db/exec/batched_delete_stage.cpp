@@ -266,6 +266,13 @@ PlanStage::StageState BatchedDeleteStage::_deleteBatch(WorkingSetID* out) {
         return PlanStage::NEED_TIME;
     }
 
+    if (_batchedDeleteParams->sortStagedDocsByRecordId) {
+        // Apply the batch in record store order. Re-sorting a partially drained buffer after a
+        // write conflict or a time limited batch is a no-op, since the remaining entries are
+        // already ordered.
+        _stagedDeletesBuffer.sortByRecordId();
+    }
+
     const auto saveRet = handlePlanStageYield(
         expCtx(),
         "BatchedDeleteStage saveState",
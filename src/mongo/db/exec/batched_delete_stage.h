@@ -101,6 +101,12 @@ struct BatchedDeleteStageParams {
     // they still match the query and haven't been deleted by a concurrent operation. A value of
     // zero means unlimited.
     Milliseconds targetPassTimeMS;
+
+    // When set, the documents staged in a batch are deleted in RecordId order rather than in the
+    // order the child stage produced them. Applying a batch in record store order improves cache
+    // locality when the plan visits documents in an order uncorrelated with their location, such
+    // as an index scan over a secondary TTL index. Has no effect on which documents are deleted.
+    bool sortStagedDocsByRecordId = false;
 };
 
 /**
@@ -47,6 +47,12 @@ void BatchedDeleteStageBuffer::append(WorkingSetID id) {
     _buffer.emplace_back(id);
 }
 
+void BatchedDeleteStageBuffer::sortByRecordId() {
+    std::sort(_buffer.begin(), _buffer.end(), [&](WorkingSetID lhs, WorkingSetID rhs) {
+        return _ws->get(lhs)->recordId < _ws->get(rhs)->recordId;
+    });
+}
+
 void BatchedDeleteStageBuffer::eraseUpToOffsetInclusive(size_t bufferOffset) {
     tassert(6515701,
             "Cannot erase offset '{}' - beyond the size of the BatchedDeleteStageBuffer {}"_format(
@@ -63,6 +63,12 @@ public:
         return _buffer.at(bufferOffset);
     }
 
+    /**
+     * Sorts the staged documents by their RecordId so that the batch is applied in record store
+     * order.
+     */
+    void sortByRecordId();
+
     /**
      * Erases up to 'bufferOffset' where 'bufferOffset' is inclusive. Frees up resources of
      * WorkingSetMembers associated with the removed entries.
@@ -75,6 +75,11 @@ namespace mongo {
 using std::unique_ptr;
 
 namespace {
+// How many records an I/O-sharing scan advances between publications of its position to the
+// SharedScanTracker. Small enough that attach positions stay close to the leading scan's cached
+// blocks, large enough to keep the tracker mutex off the per-record path.
+constexpr size_t kSharedScanPublishInterval = 256;
+
 bool shouldIncludeStartRecord(const CollectionScanParams& params) {
     return params.boundInclusion ==
         CollectionScanParams::ScanBoundInclusion::kIncludeBothStartAndEndRecords ||
@@ -158,6 +163,19 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
                 "Expected forward collection scan with 'resumeAfterRecordId'",
                 params.direction == CollectionScanParams::FORWARD);
     }
+
+    // Unbounded forward scans of ordinary collections may share I/O with concurrent scans of the
+    // same collection by attaching to an in-flight scan's position and wrapping around at EOF.
+    // Scans whose position or record order is meaningful to the caller (tailable, resumable,
+    // bounded, oplog, clustered, and capped collection scans) are not eligible.
+    if (internalQuerySharedCollectionScansEnabled.load() &&
+        params.direction == CollectionScanParams::FORWARD && !params.tailable &&
+        !params.minRecord && !params.maxRecord && !params.resumeAfterRecordId &&
+        !params.requestResumeToken && !params.shouldTrackLatestOplogTimestamp &&
+        !params.shouldWaitForOplogVisibility && !collPtr->ns().isOplogOrChangeCollection() &&
+        !collPtr->isClustered() && !collPtr->isCapped()) {
+        _sharedScanRegistration.emplace(expCtx->opCtx->getServiceContext(), collPtr->uuid());
+    }
 }
 
 namespace {
@@ -322,6 +340,20 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
                     }
                 }
 
+                if (_sharedScanRegistration && _lastSeenId.isNull() && !_sharedScanWrapped &&
+                    !_sharedScanWrapEnd) {
+                    if (auto attachId = _sharedScanRegistration->attachPosition()) {
+                        // Attach to an in-flight scan of this collection: start at its published
+                        // position so both scans read the same blocks, and cover the skipped
+                        // prefix by wrapping around once we hit EOF. Only set '_sharedScanWrapEnd'
+                        // after the seek returns so a retry after a yield re-attaches cleanly.
+                        record = _cursor->seek(*attachId,
+                                               SeekableRecordCursor::BoundInclusion::kInclude);
+                        _sharedScanWrapEnd = attachId;
+                        return PlanStage::ADVANCED;
+                    }
+                }
+
                 if (_lastSeenId.isNull() && _params.direction == CollectionScanParams::FORWARD &&
                     _params.minRecord) {
                     // Seek to the start location and return it.
@@ -358,6 +390,16 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     }
 
     if (!record) {
+        if (_sharedScanWrapEnd && !_sharedScanWrapped) {
+            // We attached to an in-flight scan partway through the collection. Wrap around to the
+            // beginning to cover the records before the attach position. '_lastSeenId' is cleared
+            // so that the cursor-creation path treats the wrap as a fresh scan.
+            _sharedScanWrapped = true;
+            _lastSeenId = RecordId();
+            _cursor.reset();
+            return PlanStage::NEED_TIME;
+        }
+
         // We hit EOF. If we are tailable, leave us in a state to pick up where we left off on the
         // next call to work(). Otherwise, the EOF is permanent.
         if (_params.tailable) {
@@ -375,11 +417,25 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_sharedScanWrapped && record->id >= *_sharedScanWrapEnd) {
+        // The wrap-around phase has caught up to the attach position, so every record has now been
+        // seen exactly once.
+        _commonStats.isEOF = true;
+        _priority.reset();
+        return PlanStage::IS_EOF;
+    }
+
     _lastSeenId = record->id;
     if (_params.shouldTrackLatestOplogTimestamp) {
         setLatestOplogEntryTimestamp(*record);
     }
 
+    if (_sharedScanRegistration &&
+        MONGO_unlikely(++_sharedScanRecordsSincePublish >= kSharedScanPublishInterval)) {
+        _sharedScanRecordsSincePublish = 0;
+        _sharedScanRegistration->publishPosition(_lastSeenId);
+    }
+
     WorkingSetID id = _workingSet->allocate();
     WorkingSetMember* member = _workingSet->get(id);
     member->recordId = std::move(record->id);
@@ -37,6 +37,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/admission/execution_admission_context.h"
 #include "mongo/db/exec/collection_scan_common.h"
+#include "mongo/db/exec/collection_scan_sharing.h"
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/requires_collection_stage.h"
@@ -149,6 +150,21 @@ private:
     CollectionScanStats _specificStats;
 
     bool _useSeek = false;
+
+    // Present only for scans eligible to share I/O with concurrent scans of the same collection.
+    // See SharedScanTracker.
+    boost::optional<SharedScanRegistration> _sharedScanRegistration;
+
+    // Set when this scan attached to an in-flight scan's position. Records with ids greater than
+    // or equal to this were covered by the first phase of the scan; after hitting EOF the scan
+    // wraps around to the beginning and stops just before this id.
+    boost::optional<RecordId> _sharedScanWrapEnd;
+
+    // True once this scan has wrapped around to cover the prefix it skipped by attaching.
+    bool _sharedScanWrapped = false;
+
+    // Number of records seen since this scan last published its position to the tracker.
+    size_t _sharedScanRecordsSincePublish = 0;
 };
 
 }  // namespace mongo
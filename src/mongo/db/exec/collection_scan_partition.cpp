@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/collection_scan_partition.h"
+
+#include <algorithm>
+
+#include "mongo/db/storage/record_store.h"
+
+namespace mongo {
+namespace {
+
+// Number of random samples drawn per requested partition. More samples give more even partition
+// sizes at a linear cost in sampling time; 16 keeps the relative error of partition sizes low
+// enough for work distribution purposes.
+constexpr size_t kSamplesPerPartition = 16;
+
+}  // namespace
+
+std::vector<RecordId> computeScanPartitionSplitPoints(OperationContext* opCtx,
+                                                      const CollectionPtr& collection,
+                                                      size_t numPartitions) {
+    if (numPartitions <= 1) {
+        return {};
+    }
+
+    auto* recordStore = collection->getRecordStore();
+    auto cursor = recordStore->getRandomCursor(opCtx);
+    if (!cursor) {
+        return {};
+    }
+
+    // A random cursor may return fewer records than requested (e.g. on an almost-empty
+    // collection), and may return duplicates. Collect what we can, then deduplicate.
+    const size_t numSamples = numPartitions * kSamplesPerPartition;
+    std::vector<RecordId> samples;
+    samples.reserve(numSamples);
+    for (size_t i = 0; i < numSamples; ++i) {
+        auto record = cursor->next();
+        if (!record) {
+            break;
+        }
+        samples.push_back(std::move(record->id));
+    }
+
+    std::sort(samples.begin(), samples.end());
+    samples.erase(std::unique(samples.begin(), samples.end()), samples.end());
+
+    // Pick evenly spaced quantiles as split points. If deduplication left us with fewer samples
+    // than partitions, settle for fewer (possibly zero) split points rather than producing empty
+    // ranges.
+    std::vector<RecordId> splitPoints;
+    if (samples.size() < numPartitions) {
+        return splitPoints;
+    }
+    splitPoints.reserve(numPartitions - 1);
+    for (size_t i = 1; i < numPartitions; ++i) {
+        splitPoints.push_back(samples[i * samples.size() / numPartitions]);
+    }
+    splitPoints.erase(std::unique(splitPoints.begin(), splitPoints.end()), splitPoints.end());
+    return splitPoints;
+}
+
+}  // namespace mongo
@@ -0,0 +1,56 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/record_id.h"
+
+namespace mongo {
+
+/**
+ * Computes approximate RecordId split points dividing 'collection' into 'numPartitions' ranges of
+ * roughly equal record count, so that each range can be scanned independently (e.g. as a bounded
+ * CollectionScan per partition for collection-scan + filter + count/group plans).
+ *
+ * The split points are derived by drawing a fixed number of samples per partition from the record
+ * store's random cursor and taking quantiles, so range sizes are approximate. Returns at most
+ * 'numPartitions' - 1 split points in increasing RecordId order; may return fewer (including none)
+ * when the collection is small, or when the storage engine does not support random cursors, in
+ * which case callers should fall back to a single unpartitioned scan.
+ */
+std::vector<RecordId> computeScanPartitionSplitPoints(OperationContext* opCtx,
+                                                      const CollectionPtr& collection,
+                                                      size_t numPartitions);
+
+}  // namespace mongo
@@ -0,0 +1,120 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/collection_scan_sharing.h"
+
+#include <utility>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+
+namespace mongo {
+namespace {
+
+const auto getSharedScanTracker = ServiceContext::declareDecoration<SharedScanTracker>();
+
+/**
+ * Reports globally-aggregated scan sharing stats.
+ */
+struct SharedCollectionScansSSS : ServerStatusSection {
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder bob;
+        SharedScanTracker::get(opCtx->getServiceContext()).appendStats(&bob);
+        return bob.obj();
+    }
+};
+auto& sharedCollectionScansSSS =
+    *ServerStatusSectionBuilder<SharedCollectionScansSSS>("sharedCollectionScans");
+
+}  // namespace
+
+SharedScanTracker& SharedScanTracker::get(ServiceContext* svcCtx) {
+    return getSharedScanTracker(svcCtx);
+}
+
+void SharedScanTracker::registerScan(const UUID& uuid) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    ++_activeScans[uuid].numScanners;
+    _scansRegistered.fetchAndAdd(1);
+}
+
+void SharedScanTracker::deregisterScan(const UUID& uuid) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _activeScans.find(uuid);
+    invariant(it != _activeScans.end());
+    if (--it->second.numScanners == 0) {
+        _activeScans.erase(it);
+    }
+}
+
+void SharedScanTracker::publishPosition(const UUID& uuid, const RecordId& id) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _activeScans.find(uuid);
+    if (it != _activeScans.end()) {
+        it->second.lastPublishedPosition = id;
+    }
+}
+
+boost::optional<RecordId> SharedScanTracker::attachPosition(const UUID& uuid) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _activeScans.find(uuid);
+    if (it == _activeScans.end() || it->second.lastPublishedPosition.isNull()) {
+        return boost::none;
+    }
+    _attachPositionsServed.fetchAndAdd(1);
+    return it->second.lastPublishedPosition;
+}
+
+void SharedScanTracker::appendStats(BSONObjBuilder* bob) const {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        bob->appendNumber("activeSharedScans", static_cast<long long>(_activeScans.size()));
+    }
+    bob->appendNumber("scansRegistered", _scansRegistered.loadRelaxed());
+    bob->appendNumber("attachPositionsServed", _attachPositionsServed.loadRelaxed());
+}
+
+SharedScanRegistration::SharedScanRegistration(ServiceContext* svcCtx, const UUID& uuid)
+    : _tracker(&SharedScanTracker::get(svcCtx)), _uuid(uuid) {
+    _tracker->registerScan(_uuid);
+}
+
+SharedScanRegistration::~SharedScanRegistration() {
+    _tracker->deregisterScan(_uuid);
+}
+
+}  // namespace mongo
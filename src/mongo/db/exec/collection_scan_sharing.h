@@ -0,0 +1,127 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/db/record_id.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+/**
+ * Tracks the progress of in-flight unbounded forward collection scans so that scans of the same
+ * collection which arrive later can attach to an in-flight scan's position rather than starting
+ * from the beginning. An attached scan consumes records from the attach position to EOF while the
+ * leading scan keeps the relevant blocks warm in cache, then wraps around to cover the prefix it
+ * skipped. N concurrent scans of a large collection then cost roughly one pass of disk I/O instead
+ * of N.
+ *
+ * The tracker shares positions, not record streams: every scan still drives its own storage
+ * cursor, so yielding, snapshot management, and error handling are unchanged.
+ */
+class SharedScanTracker {
+public:
+    static SharedScanTracker& get(ServiceContext* svcCtx);
+
+    /**
+     * Records that an eligible scan of the collection with the given uuid has started.
+     */
+    void registerScan(const UUID& uuid);
+
+    /**
+     * Records that a previously registered scan has finished. The collection's entry is dropped
+     * once its last scan deregisters.
+     */
+    void deregisterScan(const UUID& uuid);
+
+    /**
+     * Publishes the position an in-flight scan has reached, making it available as an attach
+     * point for scans of the same collection which start later.
+     */
+    void publishPosition(const UUID& uuid, const RecordId& id);
+
+    /**
+     * Returns the most recently published position of an in-flight scan of the collection, if
+     * any, for a newly starting scan to attach to.
+     */
+    boost::optional<RecordId> attachPosition(const UUID& uuid);
+
+    /**
+     * Appends attachment statistics for serverStatus.
+     */
+    void appendStats(BSONObjBuilder* bob) const;
+
+private:
+    struct ActiveScans {
+        size_t numScanners = 0;
+        RecordId lastPublishedPosition;
+    };
+
+    mutable stdx::mutex _mutex;
+    stdx::unordered_map<UUID, ActiveScans, UUID::Hash> _activeScans;
+
+    AtomicWord<long long> _scansRegistered{0};
+    AtomicWord<long long> _attachPositionsServed{0};
+};
+
+/**
+ * RAII registration of one eligible collection scan with the SharedScanTracker.
+ */
+class SharedScanRegistration {
+public:
+    SharedScanRegistration(ServiceContext* svcCtx, const UUID& uuid);
+    ~SharedScanRegistration();
+
+    SharedScanRegistration(const SharedScanRegistration&) = delete;
+    SharedScanRegistration& operator=(const SharedScanRegistration&) = delete;
+
+    void publishPosition(const RecordId& id) {
+        _tracker->publishPosition(_uuid, id);
+    }
+
+    boost::optional<RecordId> attachPosition() {
+        return _tracker->attachPosition(_uuid);
+    }
+
+private:
+    SharedScanTracker* _tracker;
+    UUID _uuid;
+};
+
+}  // namespace mongo
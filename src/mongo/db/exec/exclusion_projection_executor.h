@@ -142,6 +142,9 @@ protected:
     }
 
 private:
+    // Fields matching '_projectedFieldsSet' are dropped by an exclusion projection.
+    static constexpr bool kKeepsProjectedFields = false;
+
     void _applyToProjectedField(const BSONElement& element, BSONObjBuilder* bob) const {
         // No-op -- this element is excluded.
     }
@@ -66,6 +66,7 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/update_driver.h"
 #include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/db/update/update_util.h"
@@ -1102,17 +1103,46 @@ public:
 
                 bool indexesAffected = false;
                 auto diff = update_oplog_entry::extractDiffFromOplogEntry(logObj);
+
+                // A delta diff describes the update as a handful of byte ranges even when it
+                // could not be applied in place on the pre-image buffer. Writing those ranges
+                // through the partial-update API lets the storage engine journal only the
+                // changed bytes instead of the whole document.
+                boost::optional<doc_diff::DamagesOutput> damagesOutput;
+                if (diff) {
+                    damagesOutput = update::computeDamagesForUpdate(
+                        collection.getCollectionPtr(),
+                        oldObj.value(),
+                        *diff,
+                        newObj.objsize(),
+                        args.mustCheckExistenceForInsertOperations);
+                }
+
                 WriteUnitOfWork wunit(opCtx);
-                collection_internal::updateDocument(
-                    opCtx,
-                    collection.getCollectionPtr(),
-                    rid,
-                    oldObj,
-                    newObj,
-                    diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
-                    &indexesAffected,
-                    &CurOp::get(opCtx)->debug(),
-                    &args);
+                if (damagesOutput) {
+                    newObj = uassertStatusOK(collection_internal::updateDocumentWithDamages(
+                        opCtx,
+                        collection.getCollectionPtr(),
+                        rid,
+                        oldObj,
+                        damagesOutput->damageSource.get(),
+                        damagesOutput->damages,
+                        &*diff,
+                        &indexesAffected,
+                        &CurOp::get(opCtx)->debug(),
+                        &args));
+                } else {
+                    collection_internal::updateDocument(
+                        opCtx,
+                        collection.getCollectionPtr(),
+                        rid,
+                        oldObj,
+                        newObj,
+                        diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
+                        &indexesAffected,
+                        &CurOp::get(opCtx)->debug(),
+                        &args);
+                }
                 tassert(8375907,
                         "Old and new snapshot ids must not change after update",
                         oldObj.snapshotId() ==
@@ -54,6 +54,7 @@ protected:
 
 private:
     void _applyProjections(BSONObj bson, BSONObjBuilder* bob) const;
+    void _applyFlatProjections(BSONObj bson, BSONObjBuilder* bob) const;
     void _applyProjectionsToArray(BSONObj array, BSONArrayBuilder* bab) const;
 };
 
@@ -87,6 +88,15 @@ FastPathProjectionNode<ProjectionNode, BaseProjectionNode>::tryApplyFastPathProj
 template <typename ProjectionNode, typename BaseProjectionNode>
 void FastPathProjectionNode<ProjectionNode, BaseProjectionNode>::_applyProjections(
     BSONObj bson, BSONObjBuilder* bob) const {
+    if (this->_children.empty()) {
+        // Flat projections -- the common {a: 1, b: 1, c: 1} shape -- need none of the per-field
+        // child lookups below, so use a single-pass scanner which copies the raw bytes of kept
+        // fields straight into the output buffer, coalescing consecutive kept fields into a
+        // single copy.
+        _applyFlatProjections(bson, bob);
+        return;
+    }
+
     const auto* projectionNode = static_cast<const ProjectionNode*>(this);
     auto nFieldsLeft = this->_projectedFieldsSet.size() + this->_children.size();
 
@@ -120,6 +130,58 @@ void FastPathProjectionNode<ProjectionNode, BaseProjectionNode>::_applyProjectio
     projectionNode->_applyToRemainingFields(it, bob);
 }
 
+template <typename ProjectionNode, typename BaseProjectionNode>
+void FastPathProjectionNode<ProjectionNode, BaseProjectionNode>::_applyFlatProjections(
+    BSONObj bson, BSONObjBuilder* bob) const {
+    // Whether fields in '_projectedFieldsSet' are kept (inclusion) or dropped (exclusion).
+    constexpr bool kKeepsProjectedFields = ProjectionNode::kKeepsProjectedFields;
+    auto nFieldsLeft = this->_projectedFieldsSet.size();
+
+    // Consecutive kept fields are contiguous in the input, so they are appended with a single
+    // copy of their underlying byte range rather than one append per element.
+    const char* runBegin = nullptr;
+    const char* runEnd = nullptr;
+    auto flushRun = [&] {
+        if (runBegin) {
+            bob->bb().appendBuf(runBegin, runEnd - runBegin);
+            runBegin = nullptr;
+        }
+    };
+
+    BSONObjIterator it{bson};
+    const char* cursor = bson.objdata() + 4;  // The first element follows the length word.
+    while (it.more() && nFieldsLeft > 0) {
+        const auto bsonElement{it.next()};
+        const bool projected =
+            this->_projectedFieldsSet.find(bsonElement.fieldNameStringData()) !=
+            this->_projectedFieldsSet.end();
+        if (projected) {
+            --nFieldsLeft;
+        }
+        if (projected == kKeepsProjectedFields) {
+            if (!runBegin) {
+                runBegin = bsonElement.rawdata();
+            }
+            runEnd = bsonElement.rawdata() + bsonElement.size();
+        } else {
+            flushRun();
+        }
+        cursor = bsonElement.rawdata() + bsonElement.size();
+    }
+
+    if (!kKeepsProjectedFields) {
+        // All fields to drop have been seen; whatever remains before the EOO byte is kept, in one
+        // final copy.
+        if (const char* objEnd = bson.objdata() + bson.objsize() - 1; cursor != objEnd) {
+            if (!runBegin) {
+                runBegin = cursor;
+            }
+            runEnd = objEnd;
+        }
+    }
+    flushRun();
+}
+
 template <typename ProjectionNode, typename BaseProjectionNode>
 void FastPathProjectionNode<ProjectionNode, BaseProjectionNode>::_applyProjectionsToArray(
     BSONObj array, BSONArrayBuilder* bab) const {
@@ -115,7 +115,7 @@ static double computeGeoNearDistance(const GeoNearParams& nearParams, WorkingSet
 
     // Compute the minimum distance of all the geometries in the document
     double minDistance = -1;
-    Value minDistanceMetadata;
+    BSONElement minDistanceElement;
     for (auto it = geometries.begin(); it != geometries.end(); ++it) {
         StoredGeometry& stored = **it;
 
@@ -135,7 +135,7 @@ static double computeGeoNearDistance(const GeoNearParams& nearParams, WorkingSet
 
         if (minDistance < 0 || nextDistance < minDistance) {
             minDistance = nextDistance;
-            minDistanceMetadata = Value{stored.element};
+            minDistanceElement = stored.element;
         }
     }
 
@@ -156,7 +156,9 @@ static double computeGeoNearDistance(const GeoNearParams& nearParams, WorkingSet
     }
 
     if (nearParams.addPointMeta) {
-        member->metadata().setGeoNearPoint(minDistanceMetadata);
+        // Only materialize the Value if the query asked for point metadata, and only for the
+        // winning geometry rather than every candidate that improved the minimum.
+        member->metadata().setGeoNearPoint(Value{minDistanceElement});
     }
 
     return minDistance;
@@ -41,6 +41,7 @@
 #include "mongo/db/exec/idhack.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/index/index_access_method.h"
+#include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/plan_executor_impl.h"
 #include "mongo/db/record_id.h"
@@ -62,7 +63,7 @@ IDHackStage::IDHackStage(ExpressionContext* expCtx,
                          const IndexDescriptor* descriptor)
     : RequiresIndexStage(kStageType, expCtx, collection, descriptor, ws),
       _workingSet(ws),
-      _key(query->getQueryObj()["_id"].wrap()) {
+      _key(CanonicalQuery::simpleIdQueryValue(query->getQueryObj()).wrap("_id")) {
     _specificStats.indexName = descriptor->indexName();
     _addKeyMetadata = query->getFindCommandRequest().getReturnKey();
 }
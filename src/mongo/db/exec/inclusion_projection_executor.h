@@ -192,6 +192,9 @@ protected:
     }
 
 private:
+    // Fields matching '_projectedFieldsSet' are kept by an inclusion projection.
+    static constexpr bool kKeepsProjectedFields = true;
+
     void _applyToProjectedField(const BSONElement& element, BSONObjBuilder* bob) const {
         // This element is included by the projection, so it is added to the output.
         bob->append(element);
@@ -344,6 +344,13 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
                 throw;
             }
 
+            // If only one candidate remains there is nothing left to compare against, so end the
+            // trial rather than spending the rest of the trial period working a plan that wins by
+            // default. Execution resumes from the results it has already produced.
+            if (_failureCount == _candidates.size() - 1) {
+                return false;
+            }
+
             continue;
         }
 
@@ -360,9 +367,10 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
                 doneWorking = true;
             }
         } else if (PlanStage::IS_EOF == state) {
-            // First plan to hit EOF wins automatically.  Stop evaluating other plans.
-            // Assumes that the ranking will pick this plan.
-            doneWorking = true;
+            // First plan to hit EOF wins automatically. Stop evaluating other plans immediately
+            // rather than finishing the round: the ranking gives this plan the EOF bonus, so any
+            // further work on the remaining candidates is thrown away.
+            return false;
         } else if (PlanStage::NEED_YIELD == state) {
             invariant(id == WorkingSet::INVALID_ID);
             // Run-time plan selection occurs before a WriteUnitOfWork is opened and it's not
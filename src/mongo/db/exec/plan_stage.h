@@ -228,6 +228,21 @@ public:
         return workResult;
     }
 
+    /**
+     * Batched form of work(). Performs units of work until up to 'maxOut' units of output have
+     * been produced, appending the WorkingSetID of each result to 'out'. Returns the state of the
+     * last unit of work performed; output may have been appended even when the returned state is
+     * not ADVANCED (e.g. a partial batch followed by NEED_YIELD or IS_EOF). A returned state of
+     * ADVANCED means the batch was filled.
+     *
+     * The default implementation drains work() one document at a time, which already amortizes
+     * the caller's per-document dispatch. Stages that can produce output more cheaply in bulk may
+     * override doWorkBatch() to also avoid their own per-document overhead.
+     */
+    StageState workBatch(size_t maxOut, std::vector<WorkingSetID>* out) {
+        return doWorkBatch(maxOut, out);
+    }
+
     /**
      * Returns true if no more work can be done on the query / out of results.
      */
@@ -372,6 +387,31 @@ protected:
      */
     virtual StageState doWork(WorkingSetID* out) = 0;
 
+    /**
+     * Performs a batch of work. See comment at workBatch() above.
+     *
+     * The default implementation loops work(), so per-stage stats stay accurate. NEED_TIME results
+     * are absorbed inside the batch, but the total number of units of work per call is bounded so
+     * that callers regain control to check for interrupt and yield at a reasonable granularity.
+     */
+    virtual StageState doWorkBatch(size_t maxOut, std::vector<WorkingSetID>* out) {
+        // Bound on work() calls per batch so filters with low selectivity cannot starve
+        // interrupt and yield checks in the caller.
+        size_t worksLeft = maxOut * 4;
+        StageState state = StageState::NEED_TIME;
+        for (size_t produced = 0; produced < maxOut && worksLeft; --worksLeft) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            state = work(&id);
+            if (state == StageState::ADVANCED) {
+                out->push_back(id);
+                ++produced;
+            } else if (state != StageState::NEED_TIME) {
+                break;
+            }
+        }
+        return state;
+    }
+
     /**
      * Saves any stage-specific state required to resume where it was if the underlying data
      * changes.
@@ -45,6 +45,7 @@ struct CheckBoundsStats;
 struct LoopJoinStats;
 struct TraverseStats;
 struct HashAggStats;
+struct HashJoinStats;
 struct HashLookupStats;
 struct WindowStats;
 struct SearchStats;
@@ -114,6 +115,7 @@ public:
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::LoopJoinStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::TraverseStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::HashAggStats> stats) = 0;
+    virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::HashJoinStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::HashLookupStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::WindowStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::SearchStats> stats) = 0;
@@ -177,6 +179,7 @@ struct PlanStatsVisitorBase : public PlanStatsVisitor<IsConst> {
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::LoopJoinStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::TraverseStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::HashAggStats> stats) override {}
+    void visit(tree_walker::MaybeConstPtr<IsConst, sbe::HashJoinStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::HashLookupStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::WindowStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::SearchStats> stats) override {}
@@ -259,6 +259,7 @@ ProjectionStageCovered::ProjectionStageCovered(ExpressionContext* expCtx,
             // If we are including this key field store its field name.
             _keyFieldNames.push_back(*fieldIt);
             _includeKey.push_back(true);
+            ++_nFieldsNeeded;
         }
     }
 }
@@ -270,15 +271,18 @@ void ProjectionStageCovered::transform(WorkingSetMember* member) const {
     tassert(
         7241734, "covered projections must be covered by one index", 1 == member->keyData.size());
     size_t keyIndex = 0;
+    size_t nFieldsLeft = _nFieldsNeeded;
 
-    // Look at every key element...
+    // Look at every key element until all projected fields have been found. For wide compound
+    // keys this stops without visiting the components after the last one we need.
     BSONObjIterator keyIterator(member->keyData[0].keyData);
-    while (keyIterator.more()) {
+    while (keyIterator.more() && nFieldsLeft > 0) {
         BSONElement elt = keyIterator.next();
         // If we're supposed to include it...
         if (_includeKey[keyIndex]) {
             // Do so.
             bob.appendAs(elt, _keyFieldNames[keyIndex]);
+            --nFieldsLeft;
         }
         ++keyIndex;
     }
@@ -157,6 +157,10 @@ private:
 
     // If the i-th entry of _includeKey is true this is the field name for the i-th key field.
     std::vector<StringData> _keyFieldNames;
+
+    // Number of entries in _includeKey that are true. Once this many fields have been appended
+    // the remaining components of a wide compound key need not be visited at all.
+    size_t _nFieldsNeeded = 0;
 };
 
 /**
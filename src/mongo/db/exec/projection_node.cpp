@@ -159,10 +159,17 @@ void ProjectionNode::applyProjections(const Document& inputDoc, MutableDocument*
 
     bool isIncl = isIncluded();
 
+    // Probing an empty container still hashes the field name, so skip the lookups which cannot
+    // match. Leaf-only projections have no children and subtree-only nodes project no fields
+    // directly, and this loop rehashes every field name of every input document.
+    const bool hasProjectedFields = !_projectedFieldsSet.empty();
+    const bool hasChildren = !_children.empty();
+
     while (it.more()) {
         auto fieldName = it.fieldName();
 
-        if (_projectedFieldsSet.find(fieldName) != _projectedFieldsSet.end()) {
+        if (hasProjectedFields &&
+            _projectedFieldsSet.find(fieldName) != _projectedFieldsSet.end()) {
             if (isIncl) {
                 outputProjectedField(fieldName, it.next().second, outputDoc);
             } else {
@@ -170,7 +177,8 @@ void ProjectionNode::applyProjections(const Document& inputDoc, MutableDocument*
                 it.advance();
             }
             ++projectedFields;
-        } else if (auto childIt = _children.find(fieldName); childIt != _children.end()) {
+        } else if (auto childIt = hasChildren ? _children.find(fieldName) : _children.end();
+                   childIt != _children.end()) {
             outputProjectedField(
                 fieldName, childIt->second->applyProjectionsToValue(it.next().second), outputDoc);
             ++projectedFields;
@@ -1168,6 +1168,87 @@ TEST_F(SBEBlockExpressionTest, BlockAggDoubleDoubleSumTest) {
                  makeArrayFromValues(makeInt32s({0, 0, 0, 250})));
 }  // BlockAggDoubleDoubleSumTest
 
+TEST_F(SBEBlockExpressionTest, BlockAggDoubleDoubleSumHomogeneousTest) {
+    auto runSum = [&](value::ValueBlock* block, value::ValueBlock* bitset) {
+        sbe::value::OwnedValueAccessor aggAccessor;
+        bindAccessor(&aggAccessor);
+
+        value::ViewOfValueAccessor blockAccessor;
+        value::ViewOfValueAccessor bitsetAccessor;
+        auto blockSlot = bindAccessor(&blockAccessor);
+        auto bitsetSlot = bindAccessor(&bitsetAccessor);
+
+        blockAccessor.reset(sbe::value::TypeTags::valueBlock,
+                            value::bitcastFrom<value::ValueBlock*>(block));
+        bitsetAccessor.reset(sbe::value::TypeTags::valueBlock,
+                             value::bitcastFrom<value::ValueBlock*>(bitset));
+
+        auto compiledExpr = sbe::makeE<sbe::EFunction>(
+            "valueBlockAggDoubleDoubleSum",
+            sbe::makeEs(makeE<EVariable>(bitsetSlot), makeE<EVariable>(blockSlot)));
+        auto compiledFinalExpr = compileAggExpression(*compiledExpr, &aggAccessor);
+
+        return runCompiledExpression(compiledFinalExpr.get());
+    };
+
+    auto assertResult = [](TypedValue actual, TypedValue expected) {
+        value::ValueGuard actualGuard(actual);
+        value::ValueGuard expectedGuard(expected);
+
+        ASSERT_EQ(actual.first, expected.first);
+        auto [compTag, compVal] =
+            value::compareValue(actual.first, actual.second, expected.first, expected.second);
+        ASSERT_EQ(compTag, value::TypeTags::NumberInt32);
+        ASSERT_EQ(value::bitcastTo<int32_t>(compVal), 0);
+    };
+
+    {
+        // A dense Int64Block with an all-true MonoBlock bitset takes the homogeneous fast path,
+        // which must produce the same accumulator state as the element-wise path.
+        value::Int64Block block;
+        for (int64_t v : {int64_t{1}, int64_t{2}, int64_t{3}, int64_t{4}}) {
+            block.push_back(v);
+        }
+        auto bitset = std::make_unique<value::MonoBlock>(
+            4, value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+
+        assertResult(runSum(&block, bitset.get()), makeArrayFromValues(makeInt32s({0, 10, 0})));
+    }
+    {
+        // Same for a dense DoubleBlock with an all-true BoolBlock bitset.
+        value::DoubleBlock block;
+        for (double v : {1.5, 2.5, 3.0}) {
+            block.push_back(v);
+        }
+        auto bitset = makeBoolBlock({true, true, true});
+
+        assertResult(runSum(&block, bitset.get()), makeArrayFromValues(makeInt32s({0, 7, 0})));
+    }
+    {
+        // A partially-false bitset must fall back to the element-wise path and skip the
+        // deselected values.
+        value::Int64Block block;
+        for (int64_t v : {int64_t{1}, int64_t{2}, int64_t{3}, int64_t{4}}) {
+            block.push_back(v);
+        }
+        auto bitset = makeBoolBlock({true, false, true, true});
+
+        assertResult(runSum(&block, bitset.get()), makeArrayFromValues(makeInt32s({0, 8, 0})));
+    }
+    {
+        // A non-dense homogeneous block must fall back to the element-wise path and skip the
+        // Nothing entries.
+        value::Int32Block block;
+        block.push_back(value::bitcastFrom<int32_t>(5));
+        block.pushNothing();
+        block.push_back(value::bitcastFrom<int32_t>(6));
+        auto bitset = std::make_unique<value::MonoBlock>(
+            3, value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+
+        assertResult(runSum(&block, bitset.get()), makeArrayFromValues(makeInt32s({0, 11, 0})));
+    }
+}  // BlockAggDoubleDoubleSumHomogeneousTest
+
 TEST_F(SBEBlockExpressionTest, BlockMinMaxTest) {
     sbe::value::OwnedValueAccessor aggAccessor;
     bindAccessor(&aggAccessor);
@@ -2301,6 +2382,51 @@ TEST_F(SBEBlockExpressionTest, ValueBlockCmpScalarHomogeneousTest) {
     }
 }
 
+TEST_F(SBEBlockExpressionTest, ValueBlockEqScalarBoundsFastPathTest) {
+    value::ViewOfValueAccessor blockAccessor;
+    value::ViewOfValueAccessor scalarAccessor;
+    auto blockSlot = bindAccessor(&blockAccessor);
+    auto scalarSlot = bindAccessor(&scalarAccessor);
+
+    auto expr = makeE<sbe::EFunction>(
+        "valueBlockEqScalar",
+        sbe::makeEs(makeE<EVariable>(blockSlot), makeE<EVariable>(scalarSlot)));
+    auto compiledExpr = compileExpression(*expr);
+
+    // A dense block with known bounds, so that equality against a scalar outside of the bounds can
+    // be answered for the whole block at once.
+    value::MonoBlock monoBlock(3, value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(10));
+    blockAccessor.reset(value::TypeTags::valueBlock,
+                        value::bitcastFrom<value::ValueBlock*>(&monoBlock));
+
+    {
+        // The scalar is outside of [lowerBound, upperBound], so no value can match.
+        scalarAccessor.reset(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(7));
+        auto [runTag, runVal] = runCompiledExpression(compiledExpr.get());
+        value::ValueGuard guard(runTag, runVal);
+        assertBlockOfBool(runTag, runVal, {false, false, false});
+    }
+
+    {
+        // The scalar is equal to both bounds, so every value matches.
+        scalarAccessor.reset(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(10));
+        auto [runTag, runVal] = runCompiledExpression(compiledExpr.get());
+        value::ValueGuard guard(runTag, runVal);
+        assertBlockOfBool(runTag, runVal, {true, true, true});
+    }
+
+    {
+        // The scalar is not comparable with the bounds, so the fast path must not conclude that
+        // nothing matches; the comparison yields Nothing per value.
+        auto [strTag, strVal] = value::makeNewString("not a number"_sd);
+        value::ValueGuard strGuard(strTag, strVal);
+        scalarAccessor.reset(strTag, strVal);
+        auto [runTag, runVal] = runCompiledExpression(compiledExpr.get());
+        value::ValueGuard guard(runTag, runVal);
+        assertBlockEq(runTag, runVal, {makeNothing(), makeNothing(), makeNothing()});
+    }
+}
+
 void SBEBlockExpressionTest::testBlockBlockArithmeticOp(EPrimBinary::Op scalarOp,
                                                         StringData blockFunctionName,
                                                         value::ValueBlock* bitsetBlock,
@@ -35,6 +35,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include <memory>
+#include <set>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -45,6 +46,7 @@
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/exec/sbe/expressions/compile_ctx.h"
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
@@ -58,6 +60,7 @@
 #include "mongo/db/query/stage_types.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 
@@ -100,6 +103,7 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
                                      makeSV(innerCondSlot),
                                      makeSV(),
                                      boost::optional<value::SlotId>{useCollator, collatorSlot},
+                                     false /* allowDiskUse */,
                                      nullptr /* yieldPolicy */,
                                      kEmptyPlanNodeId);
 
@@ -159,4 +163,79 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
     }
 }
 
+TEST_F(HashJoinStageTest, HashJoinSpillTest) {
+    // Set the memory budget low enough that a handful of build rows forces the stage to degrade to
+    // a partitioned (grace) hash join.
+    auto defaultMemoryLimit = internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+    internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(64);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(defaultMemoryLimit);
+    });
+
+    constexpr int64_t kNumKeys = 50;
+
+    BSONArrayBuilder outerBab;
+    BSONArrayBuilder innerBab;
+    for (int64_t i = 0; i < kNumKeys; ++i) {
+        outerBab.append(i);
+        // Every other key on the probe side has a match on the build side.
+        innerBab.append(i * 2);
+    }
+
+    auto [outerTag, outerVal] = stage_builder::makeValue(outerBab.arr());
+    auto [outerCondSlot, outerStage] = generateVirtualScan(outerTag, outerVal);
+
+    auto [innerTag, innerVal] = stage_builder::makeValue(innerBab.arr());
+    auto [innerCondSlot, innerStage] = generateVirtualScan(innerTag, innerVal);
+
+    auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                      std::move(innerStage),
+                                      makeSV(outerCondSlot),
+                                      makeSV(),
+                                      makeSV(innerCondSlot),
+                                      makeSV(),
+                                      boost::none /* collatorSlot */,
+                                      true /* allowDiskUse */,
+                                      nullptr /* yieldPolicy */,
+                                      kEmptyPlanNodeId);
+
+    auto ctx = makeCompileCtx();
+    auto resultAccessors =
+        prepareTree(ctx.get(), stage.get(), makeSV(innerCondSlot, outerCondSlot));
+
+    auto [resultsTag, resultsVal] = getAllResultsMulti(stage.get(), resultAccessors);
+    value::ValueGuard resultsGuard{resultsTag, resultsVal};
+    ASSERT_EQ(resultsTag, value::TypeTags::Array);
+    auto resultsView = value::getArrayView(resultsVal);
+
+    // The keys 0, 2, 4, ..., 48 appear on both sides, and the join must produce each matched pair
+    // exactly once with equal inner and outer key values.
+    ASSERT_EQ(resultsView->size(), kNumKeys / 2);
+    std::set<int64_t> matchedKeys;
+    for (size_t i = 0; i < resultsView->size(); i++) {
+        auto [pairTag, pairVal] = resultsView->getAt(i);
+        ASSERT_EQ(pairTag, value::TypeTags::Array);
+        auto pairView = value::getArrayView(pairVal);
+        ASSERT_EQ(pairView->size(), 2u);
+
+        auto [innerResTag, innerResVal] = pairView->getAt(0);
+        auto [outerResTag, outerResVal] = pairView->getAt(1);
+        auto [cmpTag, cmpVal] = compareValue(innerResTag, innerResVal, outerResTag, outerResVal);
+        ASSERT_EQ(cmpTag, value::TypeTags::NumberInt32);
+        ASSERT_EQ(value::bitcastTo<int32_t>(cmpVal), 0);
+
+        ASSERT_EQ(innerResTag, value::TypeTags::NumberInt64);
+        auto key = value::bitcastTo<int64_t>(innerResVal);
+        ASSERT_EQ(key % 2, 0);
+        ASSERT_LT(key, kNumKeys);
+        ASSERT_TRUE(matchedKeys.insert(key).second);
+    }
+
+    // Check that the stage did spill to disk.
+    auto stats = static_cast<const HashJoinStats*>(stage->getSpecificStats());
+    ASSERT_TRUE(stats->usedDisk);
+    ASSERT_GT(stats->spills, 0);
+    ASSERT_GT(stats->spilledRecords, 0);
+}
+
 }  // namespace mongo::sbe
@@ -35,15 +35,28 @@
 
 #include <boost/optional/optional.hpp>
 
+#include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/exec/sbe/expressions/compile_ctx.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/sbe/stages/hash_join.h"
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/str.h"
 
+namespace {
+std::string nextFileName() {
+    static mongo::AtomicWord<unsigned> hashJoinFileCounter;
+    return "extsort-hash-join." + std::to_string(hashJoinFileCounter.fetchAndAdd(1));
+}
+}  // namespace
+
+#include "mongo/db/sorter/sorter.cpp"
+
 namespace mongo {
 namespace sbe {
 HashJoinStage::HashJoinStage(std::unique_ptr<PlanStage> outer,
@@ -53,6 +66,7 @@ HashJoinStage::HashJoinStage(std::unique_ptr<PlanStage> outer,
                              value::SlotVector innerCond,
                              value::SlotVector innerProjects,
                              boost::optional<value::SlotId> collatorSlot,
+                             bool allowDiskUse,
                              PlanYieldPolicy* yieldPolicy,
                              PlanNodeId planNodeId,
                              bool participateInTrialRunTracking)
@@ -62,6 +76,7 @@ HashJoinStage::HashJoinStage(std::unique_ptr<PlanStage> outer,
       _innerCond(std::move(innerCond)),
       _innerProjects(std::move(innerProjects)),
       _collatorSlot(collatorSlot),
+      _allowDiskUse(allowDiskUse),
       _probeKey(0) {
     if (_outerCond.size() != _innerCond.size()) {
         uasserted(4822823, "left and right size do not match");
@@ -79,6 +94,7 @@ std::unique_ptr<PlanStage> HashJoinStage::clone() const {
                                            _innerCond,
                                            _innerProjects,
                                            _collatorSlot,
+                                           _allowDiskUse,
                                            _yieldPolicy,
                                            _commonStats.nodeId,
                                            participateInTrialRunTracking());
@@ -112,6 +128,13 @@ void HashJoinStage::prepare(CompileCtx& ctx) {
         uassert(4822825, str::stream() << "duplicate field: " << slot, inserted);
 
         _inInnerKeyAccessors.emplace_back(_children[1]->getAccessor(ctx, slot));
+        _spilledProbeAccessors.emplace_back(
+            std::make_unique<value::MaterializedSingleRowAccessor>(_spilledProbeKey, counter));
+        _outInnerSwitchAccessors.emplace_back(
+            std::make_unique<value::SwitchAccessor>(std::vector<value::SlotAccessor*>{
+                _inInnerKeyAccessors.back(), _spilledProbeAccessors.back().get()}));
+        _outInnerAccessors[slot] = _outInnerSwitchAccessors.back().get();
+        ++counter;
     }
 
     counter = 0;
@@ -125,33 +148,156 @@ void HashJoinStage::prepare(CompileCtx& ctx) {
         _outOuterAccessors[slot] = _outOuterProjectAccessors.back().get();
     }
 
+    counter = 0;
+    for (auto& slot : _innerProjects) {
+        _inInnerProjectAccessors.emplace_back(_children[1]->getAccessor(ctx, slot));
+        _spilledProbeAccessors.emplace_back(
+            std::make_unique<value::MaterializedSingleRowAccessor>(_spilledProbeProject, counter));
+        _outInnerSwitchAccessors.emplace_back(
+            std::make_unique<value::SwitchAccessor>(std::vector<value::SlotAccessor*>{
+                _inInnerProjectAccessors.back(), _spilledProbeAccessors.back().get()}));
+        // An inner project slot may coincide with an inner condition slot, in which case the
+        // accessor bound to the spilled probe key takes precedence; both carry the same value.
+        _outInnerAccessors.emplace(slot, _outInnerSwitchAccessors.back().get());
+        ++counter;
+    }
+
     _probeKey.resize(_inInnerKeyAccessors.size());
+    _spilledProbeKey.resize(_inInnerKeyAccessors.size());
+    _spilledProbeProject.resize(_inInnerProjectAccessors.size());
 }
 
 value::SlotAccessor* HashJoinStage::getAccessor(CompileCtx& ctx, value::SlotId slot) {
     if (auto it = _outOuterAccessors.find(slot); it != _outOuterAccessors.end()) {
         return it->second;
     }
+    if (auto it = _outInnerAccessors.find(slot); it != _outInnerAccessors.end()) {
+        return it->second;
+    }
     return _children[1]->getAccessor(ctx, slot);
 }
 
+void HashJoinStage::makeHashTable() {
+    if (_collator) {
+        const value::MaterializedRowHasher hasher(_collator);
+        const value::MaterializedRowEq equator(_collator);
+        _ht.emplace(0, hasher, equator);
+    } else {
+        _ht.emplace();
+    }
+}
+
+size_t HashJoinStage::partitionOf(const value::MaterializedRow& key) const {
+    // Take the partition number from the top bits of a Fibonacci-mixed hash so that it stays
+    // independent from the hash table's bucket selection, which consumes the low bits of the same
+    // hash.
+    const uint64_t hash = (*_partitionHasher)(key);
+    return (hash * 0x9e3779b97f4a7c15ull) >> (64 - kSpillPartitionBits);
+}
+
+void HashJoinStage::spillBuildSide() {
+    uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
+            "Exceeded memory limit for hash join, but didn't allow external spilling;"
+            " pass allowDiskUse:true to opt in",
+            _allowDiskUse);
+
+    if (!_spillFileStats) {
+        _spillFileStats = std::make_unique<SorterFileStats>(nullptr /* sorterTracker */);
+    }
+    _specificStats.usedDisk = true;
+    _spilled = true;
+
+    // Repartition everything accumulated so far; subsequent build rows are routed straight to
+    // their partition files.
+    for (auto it = _ht->begin(); it != _ht->end(); ++it) {
+        spillBuildRow(it->first, it->second);
+    }
+    makeHashTable();
+    _htMemUsage = 0;
+}
+
+void HashJoinStage::spillBuildRow(const value::MaterializedRow& key,
+                                  const value::MaterializedRow& project) {
+    writeToPartition(_buildFiles, _buildWriters, partitionOf(key), key, project);
+}
+
+void HashJoinStage::writeToPartition(std::vector<SpillFile>& files,
+                                     std::vector<std::unique_ptr<SpillWriter>>& writers,
+                                     size_t partition,
+                                     const value::MaterializedRow& key,
+                                     const value::MaterializedRow& project) {
+    if (files.empty()) {
+        files.resize(kSpillPartitions);
+        writers.resize(kSpillPartitions);
+    }
+
+    if (!writers[partition]) {
+        // Each partition gets a file of its own so that every spill file holds one contiguous run
+        // of rows, which is what the Sorter's file iterator expects.
+        auto tempDir = storageGlobalParams.dbpath + "/_tmp";
+        files[partition] = std::make_shared<Sorter<SpillRow, SpillRow>::File>(
+            tempDir + "/" + nextFileName(), _spillFileStats.get());
+
+        auto opts = SortOptions().TempDir(tempDir);
+        opts.FileStats(_spillFileStats.get());
+        writers[partition] = std::make_unique<SpillWriter>(opts, files[partition]);
+        ++_specificStats.spills;
+    }
+
+    // The rows within a partition are in no particular order; the 'addAlreadySorted' contract only
+    // concerns the merge phase of an external sort, which a grace hash join never runs.
+    writers[partition]->addAlreadySorted(key, project);
+    ++_specificStats.spilledRecords;
+}
+
+std::vector<std::unique_ptr<HashJoinStage::SpillIter>> HashJoinStage::finalizeWriters(
+    std::vector<std::unique_ptr<SpillWriter>>& writers) {
+    std::vector<std::unique_ptr<SpillIter>> iters(kSpillPartitions);
+    for (size_t idx = 0; idx < writers.size(); ++idx) {
+        if (writers[idx]) {
+            iters[idx].reset(writers[idx]->done());
+            writers[idx].reset();
+        }
+    }
+    _specificStats.spilledDataStorageSize = _spillFileStats->bytesSpilled();
+    return iters;
+}
+
+void HashJoinStage::resetSpillState() {
+    _spilled = false;
+    _probePartitioned = false;
+    _htMemUsage = 0;
+    _nextPartition = 0;
+    _probeIt.reset();
+    _buildWriters.clear();
+    _probeWriters.clear();
+    _buildIters.clear();
+    _probeIters.clear();
+    _buildFiles.clear();
+    _probeFiles.clear();
+    for (auto& accessor : _outInnerSwitchAccessors) {
+        accessor->setIndex(0);
+    }
+}
+
 void HashJoinStage::open(bool reOpen) {
     auto optTimer(getOptTimer(_opCtx));
 
+    _collator = nullptr;
     if (_collatorAccessor) {
         auto [tag, collatorVal] = _collatorAccessor->getViewOfValue();
         uassert(5402504, "collatorSlot must be of collator type", tag == value::TypeTags::collator);
-        auto collatorView = value::getCollatorView(collatorVal);
-        const value::MaterializedRowHasher hasher(collatorView);
-        const value::MaterializedRowEq equator(collatorView);
-        _ht.emplace(0, hasher, equator);
-    } else {
-        _ht.emplace();
+        _collator = value::getCollatorView(collatorVal);
     }
+    _partitionHasher.emplace(_collator);
+
+    resetSpillState();
+    makeHashTable();
 
     _commonStats.opens++;
     _children[0]->open(reOpen);
-    // Insert the outer side into the hash table.
+    // Insert the outer side into the hash table, degrading to partitioned spilling if the build
+    // side exceeds the memory budget.
     while (_children[0]->getNext() == PlanState::ADVANCED) {
         value::MaterializedRow key{_inOuterKeyAccessors.size()};
         value::MaterializedRow project{_inOuterProjectAccessors.size()};
@@ -170,21 +316,134 @@ void HashJoinStage::open(bool reOpen) {
             project.reset(idx++, true, tag, val);
         }
 
-        _ht->emplace(std::move(key), std::move(project));
+        if (_spilled) {
+            spillBuildRow(key, project);
+        } else {
+            _htMemUsage += key.memUsageForSorter() + project.memUsageForSorter();
+            _ht->emplace(std::move(key), std::move(project));
+            if (_htMemUsage > _approxMemoryUseInBytesBeforeSpill) {
+                spillBuildSide();
+            }
+        }
     }
 
     _children[0]->close();
 
+    if (_spilled) {
+        _buildIters = finalizeWriters(_buildWriters);
+    }
+
     _children[1]->open(reOpen);
 
     _htIt = _ht->end();
     _htItEnd = _ht->end();
 }
 
+void HashJoinStage::partitionProbeSide() {
+    // Route every probe row to the partition file matching its key hash. No row can be returned
+    // until the corresponding build partition has been loaded back into memory, so the inner child
+    // is drained up front, mirroring what has already happened to the build side.
+    while (_children[1]->getNext() == PlanState::ADVANCED) {
+        value::MaterializedRow key{_inInnerKeyAccessors.size()};
+        value::MaterializedRow project{_inInnerProjectAccessors.size()};
+
+        size_t idx = 0;
+        for (auto& p : _inInnerKeyAccessors) {
+            auto [tag, val] = p->getCopyOfValue();
+            key.reset(idx++, true, tag, val);
+        }
+
+        idx = 0;
+        for (auto& p : _inInnerProjectAccessors) {
+            auto [tag, val] = p->getCopyOfValue();
+            project.reset(idx++, true, tag, val);
+        }
+
+        writeToPartition(_probeFiles, _probeWriters, partitionOf(key), key, project);
+    }
+    _probeIters = finalizeWriters(_probeWriters);
+
+    // From now on the inner-side output slots are bound to the spilled probe row.
+    for (auto& accessor : _outInnerSwitchAccessors) {
+        accessor->setIndex(1);
+    }
+    _probePartitioned = true;
+    _nextPartition = 0;
+}
+
+bool HashJoinStage::loadNextPartition() {
+    while (_nextPartition < kSpillPartitions) {
+        auto partition = _nextPartition++;
+
+        _probeIt = std::move(_probeIters[partition]);
+        if (!_probeIt || !_probeIt->more()) {
+            // No probe rows landed in this partition, so nothing can match.
+            continue;
+        }
+
+        // Read the matching build partition back into the hash table. A pathologically skewed
+        // partition is loaded in full even if it exceeds the memory budget; recursive
+        // repartitioning could be layered on here should that prove to be a problem in practice.
+        makeHashTable();
+        if (!_buildIters.empty() && _buildIters[partition]) {
+            auto& buildIt = _buildIters[partition];
+            while (buildIt->more()) {
+                auto data = buildIt->next();
+                _ht->emplace(std::move(data.first), std::move(data.second));
+            }
+            buildIt.reset();
+        }
+
+        _htIt = _ht->end();
+        _htItEnd = _ht->end();
+        return true;
+    }
+    return false;
+}
+
+PlanState HashJoinStage::getNextSpilled() {
+    if (!_probePartitioned) {
+        partitionProbeSide();
+    }
+
+    if (_htIt != _htItEnd) {
+        ++_htIt;
+    }
+
+    while (_htIt == _htItEnd) {
+        // Advance to the next spilled probe row, loading the next partition pair whenever the
+        // current one is exhausted.
+        while (!_probeIt || !_probeIt->more()) {
+            if (!loadNextPartition()) {
+                return PlanState::IS_EOF;
+            }
+        }
+
+        auto data = _probeIt->next();
+        _spilledProbeKey = std::move(data.first);
+        _spilledProbeProject = std::move(data.second);
+
+        for (size_t idx = 0; idx < _spilledProbeKey.size(); ++idx) {
+            auto [tag, val] = _spilledProbeKey.getViewOfValue(idx);
+            _probeKey.reset(idx, false, tag, val);
+        }
+
+        auto [low, hi] = _ht->equal_range(_probeKey);
+        _htIt = low;
+        _htItEnd = hi;
+    }
+
+    return PlanState::ADVANCED;
+}
+
 PlanState HashJoinStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
     checkForInterruptAndYield(_opCtx);
 
+    if (_spilled) {
+        return trackPlanState(getNextSpilled());
+    }
+
     if (_htIt != _htItEnd) {
         ++_htIt;
     }
@@ -221,17 +480,30 @@ void HashJoinStage::close() {
     trackClose();
     _children[1]->close();
     _ht = boost::none;
+    resetSpillState();
 }
 
 std::unique_ptr<PlanStageStats> HashJoinStage::getStats(bool includeDebugInfo) const {
     auto ret = std::make_unique<PlanStageStats>(_commonStats);
+    ret->specific = std::make_unique<HashJoinStats>(_specificStats);
+
+    if (includeDebugInfo) {
+        // Spilling stats.
+        BSONObjBuilder bob;
+        bob.appendBool("usedDisk", _specificStats.usedDisk);
+        bob.appendNumber("spills", _specificStats.spills);
+        bob.appendNumber("spilledRecords", _specificStats.spilledRecords);
+        bob.appendNumber("spilledDataStorageSize", _specificStats.spilledDataStorageSize);
+        ret->debugInfo = bob.obj();
+    }
+
     ret->children.emplace_back(_children[0]->getStats(includeDebugInfo));
     ret->children.emplace_back(_children[1]->getStats(includeDebugInfo));
     return ret;
 }
 
 const SpecificStats* HashJoinStage::getSpecificStats() const {
-    return nullptr;
+    return &_specificStats;
 }
 
 std::vector<DebugPrinter::Block> HashJoinStage::debugPrint() const {
@@ -43,7 +43,10 @@
 #include "mongo/db/exec/sbe/util/debug_print.h"
 #include "mongo/db/exec/sbe/values/row.h"
 #include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/stage_types.h"
+#include "mongo/db/sorter/sorter.h"
+#include "mongo/db/sorter/sorter_stats.h"
 
 namespace mongo::sbe {
 /**
@@ -62,6 +65,15 @@ namespace mongo::sbe {
  * for string equality. For example, this can be used to perform a case-insensitive join on string
  * values.
  *
+ * The 'allowDiskUse' flag controls whether this stage can spill. The build side is accumulated in
+ * memory until its estimated footprint exceeds the budget given by the
+ * 'internalQuerySlotBasedExecutionHashJoinApproxMemoryUseInBytesBeforeSpill' knob. If the budget is
+ * exceeded and 'allowDiskUse' is false, this stage throws
+ * 'QueryExceededMemoryLimitNoDiskUseAllowed'. Otherwise the stage degrades to a grace hash join:
+ * both sides are partitioned by key hash into spill files written in the Sorter's file format, and
+ * the join is then carried out one partition pair at a time, with only the current build partition
+ * resident in memory.
+ *
  * Debug string representation:
  *
  *   hj collatorSlot?
@@ -77,6 +89,7 @@ public:
                   value::SlotVector innerCond,
                   value::SlotVector innerProjects,
                   boost::optional<value::SlotId> collatorSlot,
+                  bool allowDiskUse,
                   PlanYieldPolicy* yieldPolicy,
                   PlanNodeId planNodeId,
                   bool participateInTrialRunTracking = true);
@@ -103,11 +116,58 @@ private:
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<TableType::iterator>;
     using HashProjectAccessor = value::MaterializedRowValueAccessor<TableType::iterator>;
 
+    using SpillRow = value::MaterializedRow;
+    using SpillFile = std::shared_ptr<Sorter<SpillRow, SpillRow>::File>;
+    using SpillWriter = SortedFileWriter<SpillRow, SpillRow>;
+    using SpillIter = SortIteratorInterface<SpillRow, SpillRow>;
+
+    // The number of partition pairs that the build and probe sides are split into when the build
+    // side exceeds its memory budget. Each partition is expected to hold roughly
+    // 1/kSpillPartitions'th of the build side, so a single level of partitioning suffices unless
+    // the key distribution is heavily skewed.
+    static constexpr size_t kSpillPartitionBits = 4;
+    static constexpr size_t kSpillPartitions = size_t{1} << kSpillPartitionBits;
+
+    void makeHashTable();
+    size_t partitionOf(const value::MaterializedRow& key) const;
+
+    /**
+     * Switches the stage into grace-hash mode: every build row accumulated so far is repartitioned
+     * into per-partition spill files and the in-memory hash table is released. Throws
+     * 'QueryExceededMemoryLimitNoDiskUseAllowed' if 'allowDiskUse' is false.
+     */
+    void spillBuildSide();
+    void spillBuildRow(const value::MaterializedRow& key, const value::MaterializedRow& project);
+    void writeToPartition(std::vector<SpillFile>& files,
+                          std::vector<std::unique_ptr<SpillWriter>>& writers,
+                          size_t partition,
+                          const value::MaterializedRow& key,
+                          const value::MaterializedRow& project);
+    std::vector<std::unique_ptr<SpillIter>> finalizeWriters(
+        std::vector<std::unique_ptr<SpillWriter>>& writers);
+
+    /**
+     * Drains the probe (inner) child into per-partition spill files and rebinds the inner output
+     * slots to the spilled probe row. Called once, before the first spilled-mode result is
+     * returned.
+     */
+    void partitionProbeSide();
+
+    /**
+     * Loads the next partition pair to be joined: the build partition is read back into the hash
+     * table and '_probeIt' is set to iterate the matching probe partition. Partitions without any
+     * probe rows are skipped. Returns false when all partitions have been consumed.
+     */
+    bool loadNextPartition();
+    PlanState getNextSpilled();
+    void resetSpillState();
+
     const value::SlotVector _outerCond;
     const value::SlotVector _outerProjects;
     const value::SlotVector _innerCond;
     const value::SlotVector _innerProjects;
     const boost::optional<value::SlotId> _collatorSlot;
+    const bool _allowDiskUse;
 
     // All defined values from the outer side (i.e. they come from the hash table).
     value::SlotAccessorMap _outOuterAccessors;
@@ -127,6 +187,16 @@ private:
     // Accessors of input condition values (keys) that are being inserted into the hash table.
     std::vector<value::SlotAccessor*> _inInnerKeyAccessors;
 
+    // Accessors of input projection values on the inner side. Only needed to materialize probe
+    // rows when spilling.
+    std::vector<value::SlotAccessor*> _inInnerProjectAccessors;
+
+    // The inner-side output slots, bound through switch accessors so that they can be redirected
+    // from the inner child to the spilled probe row when operating in grace-hash mode.
+    value::SlotAccessorMap _outInnerAccessors;
+    std::vector<std::unique_ptr<value::SwitchAccessor>> _outInnerSwitchAccessors;
+    std::vector<std::unique_ptr<value::MaterializedSingleRowAccessor>> _spilledProbeAccessors;
+
     // Accessor for collator. Only set if collatorSlot provided during construction.
     value::SlotAccessor* _collatorAccessor = nullptr;
 
@@ -136,5 +206,41 @@ private:
     boost::optional<TableType> _ht;
     TableType::iterator _htIt;
     TableType::iterator _htItEnd;
+
+    // Memory tracking and spilling to disk.
+    const long long _approxMemoryUseInBytesBeforeSpill =
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+    long long _htMemUsage{0};
+
+    // View of the collator, if any, set when the stage is opened.
+    CollatorInterface* _collator{nullptr};
+
+    // Hasher used to route rows to spill partitions. Constructed when the stage is opened so that
+    // it can reflect the collator.
+    boost::optional<value::MaterializedRowHasher> _partitionHasher;
+
+    // Grace-hash state. The per-partition files and writers are created lazily, the iterators are
+    // produced once the corresponding side has been fully partitioned.
+    bool _spilled{false};
+    bool _probePartitioned{false};
+    size_t _nextPartition{0};
+    std::vector<SpillFile> _buildFiles;
+    std::vector<SpillFile> _probeFiles;
+    std::vector<std::unique_ptr<SpillWriter>> _buildWriters;
+    std::vector<std::unique_ptr<SpillWriter>> _probeWriters;
+    std::vector<std::unique_ptr<SpillIter>> _buildIters;
+    std::vector<std::unique_ptr<SpillIter>> _probeIters;
+
+    // Iterator over the probe rows of the partition currently being joined.
+    std::unique_ptr<SpillIter> _probeIt;
+
+    // The current spilled probe row. The inner-side output slots point into these rows while in
+    // grace-hash mode.
+    value::MaterializedRow _spilledProbeKey{0};
+    value::MaterializedRow _spilledProbeProject{0};
+
+    std::unique_ptr<SorterFileStats> _spillFileStats;
+
+    HashJoinStats _specificStats;
 };
 }  // namespace mongo::sbe
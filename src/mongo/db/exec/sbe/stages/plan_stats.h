@@ -374,6 +374,33 @@ struct BlockHashAggStats : public HashAggStats {
     long long elementWiseAccumulations{0};
 };
 
+struct HashJoinStats : public SpecificStats {
+    std::unique_ptr<SpecificStats> clone() const final {
+        return std::make_unique<HashJoinStats>(*this);
+    }
+
+    uint64_t estimateObjectSizeInBytes() const final {
+        return sizeof(*this);
+    }
+
+    void acceptVisitor(PlanStatsConstVisitor* visitor) const final {
+        visitor->visit(this);
+    }
+
+    void acceptVisitor(PlanStatsMutableVisitor* visitor) final {
+        visitor->visit(this);
+    }
+
+    bool usedDisk{false};
+    // The number of partition spill files that were written out to disk, counting the build and
+    // probe sides separately.
+    long long spills{0};
+    // The number of individual build and probe rows spilled to disk.
+    long long spilledRecords{0};
+    // The size, in bytes, of the spill files after all spill events have taken place.
+    long long spilledDataStorageSize{0};
+};
+
 struct HashLookupStats : public SpecificStats {
     std::unique_ptr<SpecificStats> clone() const final {
         return std::make_unique<HashLookupStats>(*this);
@@ -570,6 +570,8 @@ private:
 template <typename T, value::TypeTags TypeTag>
 class HomogeneousBlock : public ValueBlock {
 public:
+    static constexpr TypeTags kTypeTag = TypeTag;
+
     HomogeneousBlock() = default;
     // HomogeneousBlock's can only store shallow values so we don't need to call copyValue on each
     // Value in o._vals.
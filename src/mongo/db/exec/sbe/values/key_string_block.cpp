@@ -0,0 +1,76 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/sbe/values/key_string_block.h"
+
+#include <utility>
+
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo::sbe::value {
+
+KeyStringBlockBuilder::KeyStringBlockBuilder(
+    const Ordering& ordering,
+    size_t numComponents,
+    boost::optional<IndexKeysInclusionSet> indexKeysToInclude)
+    : _ordering(ordering),
+      _indexKeysToInclude(indexKeysToInclude),
+      _accessors(numComponents),
+      _blocks(numComponents) {
+    invariant(!_indexKeysToInclude || _indexKeysToInclude->count() == numComponents);
+    for (auto& block : _blocks) {
+        block = std::make_unique<HeterogeneousBlock>();
+    }
+}
+
+void KeyStringBlockBuilder::append(const SortedDataKeyValueView& keyString) {
+    _valuesBuffer.reset();
+    readKeyStringValueIntoAccessors(
+        keyString, _ordering, &_valuesBuffer, &_accessors, _indexKeysToInclude);
+
+    for (size_t i = 0; i < _accessors.size(); ++i) {
+        auto [tag, val] = _accessors[i].getViewOfValue();
+        _blocks[i]->push_back(copyValue(tag, val));
+    }
+    ++_count;
+}
+
+std::vector<std::unique_ptr<HeterogeneousBlock>> KeyStringBlockBuilder::extractBlocks() {
+    auto out = std::move(_blocks);
+    _blocks.clear();
+    _blocks.resize(out.size());
+    for (auto& block : _blocks) {
+        block = std::make_unique<HeterogeneousBlock>();
+    }
+    _count = 0;
+    return out;
+}
+
+}  // namespace mongo::sbe::value
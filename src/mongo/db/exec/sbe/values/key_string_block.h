@@ -0,0 +1,104 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/bson/ordering.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/db/exec/sbe/values/block_interface.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/storage/sorted_data_interface.h"
+
+namespace mongo::sbe::value {
+
+/**
+ * The number of index keys an index scan accumulates per batch when producing ValueBlocks of
+ * decoded key components.
+ */
+inline constexpr size_t kIndexKeyBlockSize = 256;
+
+/**
+ * Accumulates decoded index key components into one HeterogeneousBlock per component, so that an
+ * index scan can emit ValueBlocks of keys to block-aware consumers (e.g. block hashagg) instead of
+ * flowing tuple-at-a-time. The decoding itself reuses readKeyStringValueIntoAccessors(); the
+ * builder deep-copies each component out of the scratch buffer so the produced blocks own their
+ * values and remain valid across cursor advances and yields.
+ */
+class KeyStringBlockBuilder {
+public:
+    /**
+     * 'numComponents' is the number of blocks to produce per batch. If 'indexKeysToInclude' is
+     * provided, its count must equal 'numComponents' and only the selected key components are
+     * decoded into blocks, mirroring the tuple-at-a-time index scan contract.
+     */
+    KeyStringBlockBuilder(const Ordering& ordering,
+                          size_t numComponents,
+                          boost::optional<IndexKeysInclusionSet> indexKeysToInclude = boost::none);
+
+    /**
+     * Decodes 'keyString' and appends one value to each component block.
+     */
+    void append(const SortedDataKeyValueView& keyString);
+
+    /**
+     * Number of keys appended since the last extractBlocks() call.
+     */
+    size_t count() const {
+        return _count;
+    }
+
+    bool isFull() const {
+        return _count >= kIndexKeyBlockSize;
+    }
+
+    /**
+     * Returns the accumulated blocks, one per component, and resets the builder for the next
+     * batch.
+     */
+    std::vector<std::unique_ptr<HeterogeneousBlock>> extractBlocks();
+
+private:
+    const Ordering _ordering;
+    const boost::optional<IndexKeysInclusionSet> _indexKeysToInclude;
+
+    // Scratch state for readKeyStringValueIntoAccessors(); reset for every key.
+    std::vector<OwnedValueAccessor> _accessors;
+    BufBuilder _valuesBuffer;
+
+    std::vector<std::unique_ptr<HeterogeneousBlock>> _blocks;
+    size_t _count = 0;
+};
+
+}  // namespace mongo::sbe::value
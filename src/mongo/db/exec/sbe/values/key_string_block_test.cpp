@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/ordering.h"
+#include "mongo/db/exec/sbe/values/key_string_block.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/storage/key_string.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo::sbe {
+namespace {
+
+const Ordering kAllAscending = Ordering::make(BSONObj());
+
+value::KeyStringBlockBuilder appendKeys(const std::vector<BSONObj>& keys,
+                                        size_t numComponents,
+                                        value::KeyStringBlockBuilder builder) {
+    for (const auto& key : keys) {
+        key_string::Builder ks(key_string::Version::V1, key, kAllAscending);
+        auto typeBits = ks.getTypeBits();
+        SortedDataKeyValueView view{ks.getBuffer(),
+                                    static_cast<int32_t>(ks.getSize()),
+                                    nullptr /* ridData */,
+                                    0 /* ridSize */,
+                                    typeBits.getBuffer(),
+                                    static_cast<int32_t>(typeBits.getSize()),
+                                    key_string::Version::V1,
+                                    false /* isRecordIdAtEndOfKeyString */};
+        builder.append(view);
+    }
+    return builder;
+}
+
+TEST(KeyStringBlockBuilderTest, DecodesCompoundKeysIntoPerComponentBlocks) {
+    std::vector<BSONObj> keys;
+    for (int i = 0; i < 4; ++i) {
+        keys.push_back(BSON("" << static_cast<long long>(i * 10) << ""
+                               << "str"));
+    }
+
+    auto builder =
+        appendKeys(keys, 2, value::KeyStringBlockBuilder{kAllAscending, 2 /* numComponents */});
+    ASSERT_EQ(builder.count(), 4u);
+
+    auto blocks = builder.extractBlocks();
+    ASSERT_EQ(blocks.size(), 2u);
+    ASSERT_EQ(builder.count(), 0u);
+
+    auto firstComponent = blocks[0]->extract();
+    auto secondComponent = blocks[1]->extract();
+    ASSERT_EQ(firstComponent.count(), 4u);
+    ASSERT_EQ(secondComponent.count(), 4u);
+    for (size_t i = 0; i < firstComponent.count(); ++i) {
+        ASSERT_EQ(firstComponent.tags()[i], value::TypeTags::NumberInt64);
+        ASSERT_EQ(value::bitcastTo<int64_t>(firstComponent.vals()[i]),
+                  static_cast<int64_t>(i * 10));
+        ASSERT(value::isString(secondComponent.tags()[i]));
+        ASSERT_EQ(value::getStringView(secondComponent.tags()[i], secondComponent.vals()[i]),
+                  "str");
+    }
+}
+
+TEST(KeyStringBlockBuilderTest, InclusionSetSelectsComponents) {
+    std::vector<BSONObj> keys{BSON("" << 1LL << "" << 2LL), BSON("" << 3LL << "" << 4LL)};
+
+    // Include only the second component of the compound key.
+    value::IndexKeysInclusionSet inclusion;
+    inclusion.set(1);
+
+    auto builder = appendKeys(
+        keys, 1, value::KeyStringBlockBuilder{kAllAscending, 1 /* numComponents */, inclusion});
+    auto blocks = builder.extractBlocks();
+    ASSERT_EQ(blocks.size(), 1u);
+
+    auto extracted = blocks[0]->extract();
+    ASSERT_EQ(extracted.count(), 2u);
+    ASSERT_EQ(value::bitcastTo<int64_t>(extracted.vals()[0]), 2);
+    ASSERT_EQ(value::bitcastTo<int64_t>(extracted.vals()[1]), 4);
+}
+
+}  // namespace
+}  // namespace mongo::sbe
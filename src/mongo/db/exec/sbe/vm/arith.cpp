@@ -453,6 +453,68 @@ void ByteCode::aggDoubleDoubleSumImpl(value::Array* accumulator,
     }
 }  // aggDoubleDoubleSumImpl
 
+void ByteCode::aggDoubleDoubleSumBlockImpl(value::Array* accumulator,
+                                           value::TypeTags blockTag,
+                                           const std::vector<value::Value>& vals) {
+    tassert(9106704,
+            str::stream() << "The result slot must have at least "
+                          << AggSumValueElems::kMaxSizeOfArray - 1
+                          << " elements but got: " << accumulator->size(),
+            accumulator->size() >= AggSumValueElems::kMaxSizeOfArray - 1);
+
+    auto [nonDecimalTotalTag, _] = accumulator->getAt(AggSumValueElems::kNonDecimalTotalTag);
+    tassert(9106705,
+            "The nonDecimalTag can't be NumberDecimal",
+            nonDecimalTotalTag != TypeTags::NumberDecimal);
+    auto [sumTag, sum] = accumulator->getAt(AggSumValueElems::kNonDecimalTotalSum);
+    auto [addendTag, addend] = accumulator->getAt(AggSumValueElems::kNonDecimalTotalAddend);
+    tassert(9106706,
+            "The sum and addend must be NumberDouble",
+            sumTag == addendTag && sumTag == TypeTags::NumberDouble);
+
+    auto nonDecimalTotal = DoubleDoubleSummation::create(value::bitcastTo<double>(sum),
+                                                         value::bitcastTo<double>(addend));
+
+    // With the tag fixed for the whole run, each iteration is a plain compensated add on values
+    // already laid out contiguously, rather than a tag dispatch plus an accumulator round-trip.
+    switch (blockTag) {
+        case TypeTags::NumberInt64:
+            for (auto val : vals) {
+                nonDecimalTotal.addLong(value::bitcastTo<int64_t>(val));
+            }
+            break;
+        case TypeTags::NumberInt32:
+            for (auto val : vals) {
+                nonDecimalTotal.addInt(value::bitcastTo<int32_t>(val));
+            }
+            break;
+        case TypeTags::NumberDouble:
+            for (auto val : vals) {
+                nonDecimalTotal.addDouble(value::bitcastTo<double>(val));
+            }
+            break;
+        default:
+            MONGO_UNREACHABLE_TASSERT(9106707);
+    }
+
+    nonDecimalTotalTag = getWidestNumericalType(nonDecimalTotalTag, blockTag);
+    if (accumulator->size() < AggSumValueElems::kMaxSizeOfArray) {
+        setNonDecimalTotal(nonDecimalTotalTag, nonDecimalTotal, accumulator);
+    } else {
+        // A decimal value was seen before this block; keep the decimal total unchanged and fold
+        // the whole run into the non-decimal total.
+        auto [decimalTotalTag, decimalTotalVal] =
+            accumulator->getAt(AggSumValueElems::kDecimalTotal);
+        tassert(9106708,
+                "The decimalTotal must be NumberDecimal",
+                decimalTotalTag == TypeTags::NumberDecimal);
+        setDecimalTotal(nonDecimalTotalTag,
+                        nonDecimalTotal,
+                        value::bitcastTo<Decimal128>(decimalTotalVal),
+                        accumulator);
+    }
+}  // aggDoubleDoubleSumBlockImpl
+
 void ByteCode::aggMergeDoubleDoubleSumsImpl(value::Array* accumulator,
                                             value::TypeTags rhsTag,
                                             value::Value rhsValue) {
@@ -1471,6 +1471,16 @@ private:
     void aggDoubleDoubleSumImpl(value::Array* accumulator,
                                 value::TypeTags rhsTag,
                                 value::Value rhsValue);
+
+    /**
+     * Adds a run of homogeneous non-decimal numeric values to a DoubleDouble sum accumulator,
+     * reading and writing the accumulator state once rather than once per element. Produces
+     * exactly the same state as calling aggDoubleDoubleSumImpl() for each value in turn.
+     */
+    void aggDoubleDoubleSumBlockImpl(value::Array* accumulator,
+                                     value::TypeTags blockTag,
+                                     const std::vector<value::Value>& vals);
+
     void aggMergeDoubleDoubleSumsImpl(value::Array* accumulator,
                                       value::TypeTags rhsTag,
                                       value::Value rhsValue);
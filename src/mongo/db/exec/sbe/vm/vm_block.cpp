@@ -28,6 +28,7 @@
  */
 
 #include <algorithm>
+#include <type_traits>
 
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/vm/vm.h"
@@ -618,6 +619,27 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockAggDou
     tassert(8695109, "The result slot must be Array-typed", accTag == value::TypeTags::Array);
     value::Array* accumulator = value::getArrayView(accValue);
 
+    // Fast path: a dense homogeneous numeric block with a fully-true bitset can be folded into
+    // the accumulator state in one pass over its contiguous values, without deblocking and
+    // without per-element tag dispatch. This is the common shape for time-series rollups.
+    if (inputBitset->allTrue().value_or(false)) {
+        auto homogeneousFastPath = [&](auto* typedBlock) {
+            if (typedBlock == nullptr || !typedBlock->tryDense().value_or(false) ||
+                typedBlock->count() != inputBitset->count()) {
+                return false;
+            }
+            using BlockType = std::remove_pointer_t<decltype(typedBlock)>;
+            aggDoubleDoubleSumBlockImpl(accumulator, BlockType::kTypeTag, typedBlock->getVector());
+            return true;
+        };
+        if (homogeneousFastPath(inputBlock->as<value::DoubleBlock>()) ||
+            homogeneousFastPath(inputBlock->as<value::Int64Block>()) ||
+            homogeneousFastPath(inputBlock->as<value::Int32Block>())) {
+            guard.reset();
+            return {true, accTag, accValue};
+        }
+    }
+
     const value::DeblockedTagVals block = inputBlock->extract();
     const value::DeblockedTagVals bitset = inputBitset->extract();
     tassert(
@@ -1986,6 +2008,47 @@ FastTuple<bool, value::TypeTags, value::Value> blockCompareGeneric(value::ValueB
     return {
         true, value::TypeTags::valueBlock, value::bitcastFrom<value::ValueBlock*>(res.release())};
 }
+
+/**
+ * An equality comparison is not a monotonic function of its input, so it cannot use the generic
+ * monotonic fast path in 'ValueBlock::map()'. However, when the block is dense and both of its
+ * bounds are comparable with the scalar, the comparison can still be answered for the whole block
+ * without decompressing it: a scalar lying outside [lowerBound, upperBound] is equal to no value
+ * in the block, and a scalar equal to both bounds is equal to all of them. For BSONColumn-backed
+ * time-series blocks the bounds come from the bucket control fields, so this skips the decode work
+ * entirely for blocks that cannot match. Returns nullptr when the result cannot be determined from
+ * the bounds alone.
+ */
+std::unique_ptr<value::ValueBlock> tryEqScalarBoundsFastPath(value::ValueBlock* blockView,
+                                                             value::TypeTags rhsTag,
+                                                             value::Value rhsVal) {
+    if (!blockView->tryDense().get_value_or(false)) {
+        // A missing value compares as Nothing rather than false, so the bounds are not enough to
+        // describe a block with holes.
+        return nullptr;
+    }
+
+    auto [lbTag, lbVal] = blockView->tryLowerBound();
+    auto [ubTag, ubVal] = blockView->tryUpperBound();
+    auto [lbCmpTag, lbCmpVal] = value::compareValue(rhsTag, rhsVal, lbTag, lbVal);
+    auto [ubCmpTag, ubCmpVal] = value::compareValue(rhsTag, rhsVal, ubTag, ubVal);
+    if (lbCmpTag != value::TypeTags::NumberInt32 || ubCmpTag != value::TypeTags::NumberInt32) {
+        return nullptr;
+    }
+
+    // The scalar is comparable with both bounds, so the bounds share the scalar's canonical type
+    // bracket and so does every value in the block: a value from another bracket would sort
+    // outside of [lowerBound, upperBound].
+    if (value::bitcastTo<int32_t>(lbCmpVal) < 0 || value::bitcastTo<int32_t>(ubCmpVal) > 0) {
+        return std::make_unique<value::MonoBlock>(
+            blockView->count(), value::TypeTags::Boolean, value::bitcastFrom<bool>(false));
+    }
+    if (value::bitcastTo<int32_t>(lbCmpVal) == 0 && value::bitcastTo<int32_t>(ubCmpVal) == 0) {
+        return std::make_unique<value::MonoBlock>(
+            blockView->count(), value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+    }
+    return nullptr;
+}
 }  // namespace
 
 template <class Cmp, ColumnOpType::Flags AddFlags>
@@ -2000,6 +2063,14 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockCmpSca
 
     auto blockView = value::getValueBlock(blockVal);
 
+    if constexpr (std::is_same_v<Cmp, std::equal_to<>>) {
+        if (auto fastPathResult = tryEqScalarBoundsFastPath(blockView, valueTag, valueVal)) {
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(fastPathResult.release())};
+        }
+    }
+
     return blockCompareGeneric<Cmp, AddFlags>(blockView, valueTag, valueVal);
 }
 
@@ -2019,7 +2090,9 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockGteSca
 FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockEqScalar(
     ArityType arity) {
     // This is not monotonic, because the min and max not being equal to the target value does not
-    // imply that no values in the block will be equal to the target value.
+    // imply that no values in the block will be equal to the target value. It may still be decided
+    // for the whole block by the bounds fast path in builtinValueBlockCmpScalar() when the target
+    // value lies outside of the block's bounds.
     return builtinValueBlockCmpScalar<std::equal_to<>>(arity);
 }
 
@@ -88,7 +88,11 @@ void SortStageDefault::loadingDone() {
 }
 
 void SortStageSimple::loadingDone() {
-    _sortExecutor.loadingDone();
+    if (_keyStringSortExecutor) {
+        _keyStringSortExecutor->loadingDone();
+    } else {
+        _sortExecutor->loadingDone();
+    }
 }
 
 std::unique_ptr<PlanStageStats> SortStage::getStats() {
@@ -143,12 +147,23 @@ SortStageSimple::SortStageSimple(boost::intrusive_ptr<ExpressionContext> expCtx,
                                  uint64_t maxMemoryUsageBytes,
                                  bool addSortKeyMetadata,
                                  std::unique_ptr<PlanStage> child)
-    : SortStage(expCtx, ws, sortPattern, addSortKeyMetadata, std::move(child)),
-      _sortExecutor(std::move(sortPattern),
-                    limit,
-                    maxMemoryUsageBytes,
-                    expCtx->tempDir,
-                    expCtx->allowDiskUse) {}
+    : SortStage(expCtx, ws, sortPattern, addSortKeyMetadata, std::move(child)) {
+    if (addSortKeyMetadata) {
+        // The sort key must be kept in the Value format so that it can be attached as metadata to
+        // the returned members.
+        _sortExecutor.emplace(std::move(sortPattern),
+                              limit,
+                              maxMemoryUsageBytes,
+                              expCtx->tempDir,
+                              expCtx->allowDiskUse);
+    } else {
+        _keyStringSortExecutor.emplace(std::move(sortPattern),
+                                       limit,
+                                       maxMemoryUsageBytes,
+                                       expCtx->tempDir,
+                                       expCtx->allowDiskUse);
+    }
+}
 
 void SortStageSimple::spool(WorkingSetID wsid) {
     auto member = _ws->get(wsid);
@@ -156,18 +171,37 @@ void SortStageSimple::spool(WorkingSetID wsid) {
     invariant(!member->doc.value().metadata());
     invariant(member->hasObj());
 
-    auto sortKey = _sortKeyGen.computeSortKeyFromDocument(member->doc.value());
-
-    _sortExecutor.add(sortKey, member->doc.value().toBson());
+    if (_keyStringSortExecutor) {
+        auto obj = member->doc.value().toBson();
+        _keyStringSortExecutor->add(_sortKeyGen.computeSortKeyString(obj), obj);
+    } else {
+        auto sortKey = _sortKeyGen.computeSortKeyFromDocument(member->doc.value());
+        _sortExecutor->add(sortKey, member->doc.value().toBson());
+    }
     _ws->free(wsid);
 }
 
 PlanStage::StageState SortStageSimple::unspool(WorkingSetID* out) {
-    if (!_sortExecutor.hasNext()) {
+    if (_keyStringSortExecutor) {
+        if (!_keyStringSortExecutor->hasNext()) {
+            return PlanStage::IS_EOF;
+        }
+
+        auto&& [key, nextObj] = _keyStringSortExecutor->getNext();
+
+        *out = _ws->allocate();
+        auto member = _ws->get(*out);
+        member->resetDocument(SnapshotId{}, nextObj.getOwned());
+        member->transitionToOwnedObj();
+
+        return PlanStage::ADVANCED;
+    }
+
+    if (!_sortExecutor->hasNext()) {
         return PlanStage::IS_EOF;
     }
 
-    auto&& [key, nextObj] = _sortExecutor.getNext();
+    auto&& [key, nextObj] = _sortExecutor->getNext();
 
     *out = _ws->allocate();
     auto member = _ws->get(*out);
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <cstdint>
 #include <memory>
@@ -101,7 +102,8 @@ protected:
     // Not owned by us.
     WorkingSet* _ws;
 
-    const SortKeyGenerator _sortKeyGen;
+    // Not const because generating key_string sort keys reuses scratch space inside the generator.
+    SortKeyGenerator _sortKeyGen;
 
     const bool _addSortKeyMetadata;
 
@@ -154,6 +156,10 @@ private:
  * OWNED_OBJ state. Therefore, this sort implementation cannot be used if the plan requires the
  * record id to be preserved (e.g. for update or delete plans, where an ancestor stage needs to
  * refer to the record in order to perform a write).
+ *
+ * When the plan does not need sort key metadata on the returned members, each document's sort key
+ * is encoded once as a key_string and the sorter compares keys with memcmp, avoiding per-element
+ * BSON type dispatch in every comparison.
  */
 class SortStageSimple final : public SortStage {
 public:
@@ -176,15 +182,21 @@ public:
     }
 
     bool isEOF() final {
-        return _sortExecutor.isEOF();
+        return _keyStringSortExecutor ? _keyStringSortExecutor->isEOF() : _sortExecutor->isEOF();
     }
 
     const SpecificStats* getSpecificStats() const final {
-        return &_sortExecutor.stats();
+        return _keyStringSortExecutor ? &_keyStringSortExecutor->stats() : &_sortExecutor->stats();
     }
 
 private:
-    SortExecutor<BSONObj> _sortExecutor;
+    // Engaged when the plan needs sort key metadata on the returned members, which must be in the
+    // Value format.
+    boost::optional<SortExecutor<BSONObj>> _sortExecutor;
+
+    // Engaged otherwise. Sort keys are key_string-encoded once per document so that every
+    // comparison in the sorter is a memcmp.
+    boost::optional<SortExecutor<BSONObj, key_string::Value>> _keyStringSortExecutor;
 };
 
 }  // namespace mongo
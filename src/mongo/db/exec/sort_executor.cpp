@@ -50,6 +50,10 @@ std::string nextFileName() {
     return "extsort-sort-executor." + std::to_string(sortExecutorFileCounter.fetchAndAdd(1));
 }
 }  // namespace
+
+// The sorter instantiation macro cannot take a template-id containing a comma, so name the
+// comparator for the key_string-keyed executor here.
+using BSONObjKeyStringComparator = SortExecutor<BSONObj, key_string::Value>::Comparator;
 }  // namespace mongo
 
 #include "mongo/db/sorter/sorter.cpp"
@@ -61,3 +65,4 @@ MONGO_CREATE_SORTER(mongo::Value,
                     mongo::SortableWorkingSetMember,
                     mongo::SortExecutor<mongo::SortableWorkingSetMember>::Comparator);
 MONGO_CREATE_SORTER(mongo::Value, mongo::BSONObj, mongo::SortExecutor<mongo::BSONObj>::Comparator);
+MONGO_CREATE_SORTER(mongo::key_string::Value, mongo::BSONObj, mongo::BSONObjKeyStringComparator);
@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "mongo/bson/bsonobj.h"
@@ -44,6 +45,7 @@
 #include "mongo/db/query/sort_pattern.h"
 #include "mongo/db/sorter/sorter.h"
 #include "mongo/db/sorter/sorter_stats.h"
+#include "mongo/db/storage/key_string.h"
 
 namespace mongo {
 /**
@@ -52,19 +54,28 @@ namespace mongo {
  * complete the loading process with a single call to loadingDone(). Finally, getNext() should be
  * called to return the documents one by one in sorted order.
  *
- * The template parameter is the type of data being sorted. In DocumentSource execution, we sort
- * Document objects directly, but in the PlanStage layer we may sort WorkingSetMembers. The type of
- * the sort key, on the other hand, is always Value.
+ * The first template parameter is the type of data being sorted. In DocumentSource execution, we
+ * sort Document objects directly, but in the PlanStage layer we may sort WorkingSetMembers. The
+ * second template parameter is the type of the sort key, which is Value by default. Callers that
+ * do not need the sort key afterwards (e.g. for "$sortKey" metadata) can instead provide
+ * key_string::Value keys generated with SortKeyGenerator::computeSortKeyString(): the sort
+ * direction is then pre-encoded in each key and every comparison in the sorter is a plain memcmp.
  */
-template <typename T>
+template <typename T, typename KeyType = Value>
 class SortExecutor {
 public:
-    using DocumentSorter = Sorter<Value, T>;
+    using DocumentSorter = Sorter<KeyType, T>;
     class Comparator {
     public:
         Comparator(const SortPattern& sortPattern) : _sortKeyComparator(sortPattern) {}
-        int operator()(const Value& lhs, const Value& rhs) const {
-            return _sortKeyComparator(lhs, rhs);
+        int operator()(const KeyType& lhs, const KeyType& rhs) const {
+            if constexpr (std::is_same_v<KeyType, key_string::Value>) {
+                // The sort pattern's directions were already encoded into the keys when they were
+                // generated, so the keys compare correctly as raw bytes.
+                return lhs.compare(rhs);
+            } else {
+                return _sortKeyComparator(lhs, rhs);
+            }
         }
 
     private:
@@ -151,7 +162,7 @@ public:
      * Add data item to be sorted of type T with sort key specified by Value to the sort executor.
      * Should only be called before 'loadingDone()' is called.
      */
-    void add(const Value& sortKey, const T& data) {
+    void add(const KeyType& sortKey, const T& data) {
         ensureSorter();
         _sorter->add(sortKey, data);
     }
@@ -193,7 +204,7 @@ public:
      * and the corresponding item being sorted. Illegal to call if there is no next item;
      * end-of-stream must be detected with 'hasNext()'.
      */
-    std::pair<Value, T> getNext() {
+    std::pair<KeyType, T> getNext() {
         return _output->next();
     }
 
@@ -259,7 +270,16 @@ private:
     void ensureSorter() {
         // This conditional should only pass if no documents were added to the sorter.
         if (!_sorter) {
-            _sorter.reset(DocumentSorter::make(makeSortOptions(), Comparator(_sortPattern)));
+            if constexpr (std::is_same_v<KeyType, key_string::Value>) {
+                // Spilled keys must be deserialized with the same key_string version they were
+                // generated with.
+                typename DocumentSorter::Settings settings(
+                    {key_string::Version::kLatestVersion, boost::none}, {});
+                _sorter.reset(
+                    DocumentSorter::make(makeSortOptions(), Comparator(_sortPattern), settings));
+            } else {
+                _sorter.reset(DocumentSorter::make(makeSortOptions(), Comparator(_sortPattern)));
+            }
         }
     }
 
@@ -94,7 +94,8 @@ public:
                   CollatorInterface* collator,
                   int limit,
                   const char* inputStr,
-                  const char* expectedStr) {
+                  const char* expectedStr,
+                  bool useSimpleSort = false) {
         // WorkingSet is not owned by stages
         // so it's fine to declare
         WorkingSet ws;
@@ -123,27 +124,41 @@ public:
 
         auto sortPattern = fromjson(patternStr);
 
-        auto sortKeyGen = std::make_unique<SortKeyGeneratorStage>(
-            expCtx, std::move(queuedDataStage), &ws, sortPattern);
-
-        SortStageDefault sort(expCtx,
-                              &ws,
-                              SortPattern{sortPattern, expCtx},
-                              limit,
-                              kMaxMemoryUsageBytes,
-                              false,  // addSortKeyMetadata
-                              std::move(sortKeyGen));
+        std::unique_ptr<SortStage> sort;
+        if (useSimpleSort) {
+            // SortStageSimple computes its own sort keys and requires members without metadata, so
+            // the queued data feeds it directly, without a SortKeyGeneratorStage.
+            sort = std::make_unique<SortStageSimple>(expCtx,
+                                                     &ws,
+                                                     SortPattern{sortPattern, expCtx},
+                                                     limit,
+                                                     kMaxMemoryUsageBytes,
+                                                     false,  // addSortKeyMetadata
+                                                     std::move(queuedDataStage));
+        } else {
+            auto sortKeyGen = std::make_unique<SortKeyGeneratorStage>(
+                expCtx, std::move(queuedDataStage), &ws, sortPattern);
+
+            sort = std::make_unique<SortStageDefault>(expCtx,
+                                                      &ws,
+                                                      SortPattern{sortPattern, expCtx},
+                                                      limit,
+                                                      kMaxMemoryUsageBytes,
+                                                      false,  // addSortKeyMetadata
+                                                      std::move(sortKeyGen));
+        }
 
         WorkingSetID id = WorkingSet::INVALID_ID;
         PlanStage::StageState state = PlanStage::NEED_TIME;
 
         // Keep working sort stage until data is available.
         while (state == PlanStage::NEED_TIME) {
-            state = sort.work(&id);
+            state = sort->work(&id);
         }
 
         // QueuedDataStage's state should be EOF when sort is ready to advance.
-        ASSERT_TRUE(sort.child()->child()->isEOF());
+        auto* queuedStage = useSimpleSort ? sort->child().get() : sort->child()->child().get();
+        ASSERT_TRUE(queuedStage->isEOF());
 
         // While there's data to be retrieved, state should be equal to ADVANCED.
         // Insert documents into BSON document in this format:
@@ -154,14 +169,14 @@ public:
             WorkingSetMember* member = ws.get(id);
             BSONObj obj = member->doc.value().toBson();
             arr.append(obj);
-            state = sort.work(&id);
+            state = sort->work(&id);
         }
         arr.doneFast();
         BSONObj outputObj = bob.obj();
 
         // Sort stage should be EOF after data is retrieved.
         ASSERT_EQUALS(state, PlanStage::IS_EOF);
-        ASSERT_TRUE(sort.isEOF());
+        ASSERT_TRUE(sort->isEOF());
 
         // Finally, we get to compare the sorted results against what we expect.
         BSONObj expectedObj = fromjson(expectedStr);
@@ -319,4 +334,55 @@ TEST_F(SortStageDefaultTest, SortDescendingWithCollation) {
              "{input: [{a: 'ba'}, {a: 'aa'}, {a: 'ab'}]}",
              "{output: [{a: 'ab'}, {a: 'ba'}, {a: 'aa'}]}");
 }
+
+//
+// SortStageSimple without sort key metadata uses key_string-encoded sort keys and memcmp
+// comparisons; verify it orders identically to the default implementation.
+//
+
+TEST_F(SortStageDefaultTest, SimpleSortAscending) {
+    testWork("{a: 1}",
+             nullptr,
+             0,
+             "{input: [{a: 2}, {a: 1}, {a: 3}]}",
+             "{output: [{a: 1}, {a: 2}, {a: 3}]}",
+             true /* useSimpleSort */);
+}
+
+TEST_F(SortStageDefaultTest, SimpleSortDescending) {
+    testWork("{a: -1}",
+             nullptr,
+             0,
+             "{input: [{a: 2}, {a: 1}, {a: 3}]}",
+             "{output: [{a: 3}, {a: 2}, {a: 1}]}",
+             true /* useSimpleSort */);
+}
+
+TEST_F(SortStageDefaultTest, SimpleSortCompoundMixedTypes) {
+    testWork("{a: 1, b: -1}",
+             nullptr,
+             0,
+             "{input: [{a: 1, b: 1}, {a: 'x', b: 1}, {a: 1, b: 2}, {a: 1}]}",
+             "{output: [{a: 1, b: 2}, {a: 1, b: 1}, {a: 1}, {a: 'x', b: 1}]}",
+             true /* useSimpleSort */);
+}
+
+TEST_F(SortStageDefaultTest, SimpleSortAscendingWithLimit) {
+    testWork("{a: 1}",
+             nullptr,
+             2,
+             "{input: [{a: 2}, {a: 1}, {a: 3}]}",
+             "{output: [{a: 1}, {a: 2}]}",
+             true /* useSimpleSort */);
+}
+
+TEST_F(SortStageDefaultTest, SimpleSortAscendingWithCollation) {
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
+    testWork("{a: 1}",
+             &collator,
+             0,
+             "{input: [{a: 'ba'}, {a: 'aa'}, {a: 'ab'}]}",
+             "{output: [{a: 'aa'}, {a: 'ba'}, {a: 'ab'}]}",
+             true /* useSimpleSort */);
+}
 }  // namespace
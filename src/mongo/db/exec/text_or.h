@@ -32,6 +32,8 @@
 #include <cstddef>
 #include <memory>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/requires_collection_stage.h"
@@ -43,7 +45,6 @@
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/record_store.h"
-#include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
 
@@ -155,7 +156,11 @@ private:
         double score;
     };
 
-    typedef stdx::unordered_map<RecordId, TextRecordData, RecordId::Hasher> ScoreMap;
+    // Open-addressing table: score accumulation does one lookup per (term, document) index entry,
+    // and the node-based stdx::unordered_map paid one heap allocation per document for its small
+    // trivially-copyable mapped value. No pointer into the map outlives an insertion, so the lack
+    // of pointer stability on rehash is fine.
+    typedef absl::flat_hash_map<RecordId, TextRecordData, RecordId::Hasher> ScoreMap;
     ScoreMap _scores;
     ScoreMap::const_iterator _scoreIterator;
 
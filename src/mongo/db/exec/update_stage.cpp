@@ -69,6 +69,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/path_support.h"
 #include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/db/update/update_util.h"
@@ -347,17 +348,46 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
                 }
 
                 auto diff = update_oplog_entry::extractDiffFromOplogEntry(logObj);
+
+                // Even when the update could not be applied in place on the pre-image buffer, a
+                // delta diff still describes it as a handful of byte ranges. Writing those ranges
+                // through the partial-update API lets the storage engine journal only the changed
+                // bytes instead of the whole document.
+                boost::optional<doc_diff::DamagesOutput> damagesOutput;
+                if (diff) {
+                    damagesOutput =
+                        update::computeDamagesForUpdate(collectionPtr(),
+                                                        oldObjValue,
+                                                        *diff,
+                                                        newObj.objsize(),
+                                                        args.mustCheckExistenceForInsertOperations);
+                }
+
                 WriteUnitOfWork wunit(opCtx());
-                collection_internal::updateDocument(
-                    opCtx(),
-                    collectionPtr(),
-                    recordId,
-                    oldObj,
-                    newObj,
-                    diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
-                    &indexesAffected,
-                    _params.opDebug,
-                    &args);
+                if (damagesOutput) {
+                    newObj = uassertStatusOK(collection_internal::updateDocumentWithDamages(
+                        opCtx(),
+                        collectionPtr(),
+                        recordId,
+                        oldObj,
+                        damagesOutput->damageSource.get(),
+                        damagesOutput->damages,
+                        &*diff,
+                        &indexesAffected,
+                        _params.opDebug,
+                        &args));
+                } else {
+                    collection_internal::updateDocument(
+                        opCtx(),
+                        collectionPtr(),
+                        recordId,
+                        oldObj,
+                        newObj,
+                        diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
+                        &indexesAffected,
+                        _params.opDebug,
+                        &args);
+                }
                 invariant(oldObj.snapshotId() ==
                           shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId());
                 wunit.commit();
@@ -168,7 +168,9 @@ bool WorkingSetMember::getFieldDotted(const string& field, BSONElement* out) con
 }
 
 size_t WorkingSetMember::getMemUsage() const {
-    size_t memUsage = 0;
+    // Account for the member itself, so that stages buffering many small members (e.g. a large
+    // in-memory sort) charge their fixed per-member overhead against their memory budget.
+    size_t memUsage = sizeof(WorkingSetMember);
 
     if (hasRecordId()) {
         memUsage += recordId.memUsage();
@@ -183,6 +185,10 @@ size_t WorkingSetMember::getMemUsage() const {
         memUsage += keyDatum.keyData.objsize();
     }
 
+    // 'getApproximateSize()' reports only the "deep" size of the metadata, the shallow part is
+    // covered by sizeof(WorkingSetMember) above.
+    memUsage += _metadata.getApproximateSize();
+
     return memUsage;
 }
 
@@ -133,7 +133,8 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
 
     if (_metricsCount != 0 && _deltaCount != 0) {
         // On average, we do not need all 10 bytes for every sample, worst case, we grow the buffer
-        DataBuilder db(_metricsCount * _deltaCount * FTDCVarInt::kMaxSizeBytes64 / 2);
+        _deltaBuffer.clear();
+        _deltaBuffer.reserve(_metricsCount * _deltaCount * FTDCVarInt::kMaxSizeBytes64 / 2);
 
         std::uint32_t zeroesCount = 0;
 
@@ -161,12 +162,12 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
 
                 // If we have a non-zero sample, then write out all the accumulated zero samples.
                 if (zeroesCount > 0) {
-                    auto s1 = db.writeAndAdvance(FTDCVarInt(0));
+                    auto s1 = _deltaBuffer.writeAndAdvance(FTDCVarInt(0));
                     if (!s1.isOK()) {
                         return s1;
                     }
 
-                    auto s2 = db.writeAndAdvance(FTDCVarInt(zeroesCount - 1));
+                    auto s2 = _deltaBuffer.writeAndAdvance(FTDCVarInt(zeroesCount - 1));
                     if (!s2.isOK()) {
                         return s2;
                     }
@@ -174,7 +175,7 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
                     zeroesCount = 0;
                 }
 
-                auto s3 = db.writeAndAdvance(FTDCVarInt(delta));
+                auto s3 = _deltaBuffer.writeAndAdvance(FTDCVarInt(delta));
                 if (!s3.isOK()) {
                     return s3;
                 }
@@ -184,12 +185,12 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
             // RLE
             // pair of zero information.
             if ((i == (_metricsCount - 1)) && zeroesCount) {
-                auto s1 = db.writeAndAdvance(FTDCVarInt(0));
+                auto s1 = _deltaBuffer.writeAndAdvance(FTDCVarInt(0));
                 if (!s1.isOK()) {
                     return s1;
                 }
 
-                auto s2 = db.writeAndAdvance(FTDCVarInt(zeroesCount - 1));
+                auto s2 = _deltaBuffer.writeAndAdvance(FTDCVarInt(zeroesCount - 1));
                 if (!s2.isOK()) {
                     return s2;
                 }
@@ -197,7 +198,7 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
         }
 
         // Append the entire compacted metric chunk into the uncompressed buffer
-        ConstDataRange cdr = db.getCursor();
+        ConstDataRange cdr = _deltaBuffer.getCursor();
         _uncompressedChunkBuffer.appendBuf(cdr.data(), cdr.length());
     }
 
@@ -36,6 +36,7 @@
 #include <tuple>
 #include <vector>
 
+#include "mongo/base/data_builder.h"
 #include "mongo/base/data_range.h"
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
@@ -187,6 +188,10 @@ private:
     // Buffer for uncompressed metric chunk
     BufBuilder _uncompressedChunkBuffer;
 
+    // Buffer for the varint-packed deltas, reused across chunk flushes so that steady-state
+    // flushes do not reallocate it
+    DataBuilder _deltaBuffer;
+
     // Buffer to hold metrics
     std::vector<std::uint64_t> _metrics;
     std::vector<std::uint64_t> _prevmetrics;
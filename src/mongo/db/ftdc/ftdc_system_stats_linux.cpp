@@ -101,12 +101,27 @@ static const std::map<StringData, std::set<StringData>> kSockstatKeys{
     {"TCP"_sd, {"inuse"_sd, "orphan"_sd, "tw"_sd, "alloc"_sd}},
 };
 
+// Keys the system stats collector wants to collect out of each NUMA node's
+// /sys/devices/system/node/node<N>/numastat file. "numa_miss"/"other_node" count allocations
+// that landed on a remote node and so, together with "numa_foreign", expose cross-node memory
+// traffic.
+static const std::vector<StringData> kNumaStatKeys{
+    "numa_hit"_sd,
+    "numa_miss"_sd,
+    "numa_foreign"_sd,
+    "interleave_hit"_sd,
+    "local_node"_sd,
+    "other_node"_sd,
+};
+
 /**
  *  Collect metrics from the Linux /proc file system.
  */
 class LinuxSystemMetricsCollector final : public SystemMetricsCollector {
 public:
-    LinuxSystemMetricsCollector() : _disks(procparser::findPhysicalDisks("/sys/block"_sd)) {
+    LinuxSystemMetricsCollector()
+        : _disks(procparser::findPhysicalDisks("/sys/block"_sd)),
+          _numaNodes(procparser::findNumaNodes("/sys/devices/system/node"_sd)) {
         for (const auto& disk : _disks) {
             _disksStringData.emplace_back(disk);
         }
@@ -193,6 +208,23 @@ public:
             subObjBuilder.doneFast();
         }
 
+        // Skip the NUMA section on single-node hosts since every access is node-local there. The
+        // per-node numastat files share the /proc/vmstat "name value" line format.
+        if (_numaNodes.size() > 1) {
+            BSONObjBuilder subObjBuilder(builder.subobjStart("numa"_sd));
+            for (const auto& node : _numaNodes) {
+                BSONObjBuilder nodeBuilder(subObjBuilder.subobjStart(node));
+                processStatusErrors(
+                    procparser::parseProcVMStatFile("/sys/devices/system/node/" + node +
+                                                        "/numastat",
+                                                    kNumaStatKeys,
+                                                    &nodeBuilder),
+                    &nodeBuilder);
+                nodeBuilder.doneFast();
+            }
+            subObjBuilder.doneFast();
+        }
+
         {
             BSONObjBuilder subObjBuilder(builder.subobjStart("files"_sd));
             processStatusErrors(
@@ -227,6 +259,10 @@ private:
 
     // List of physical disks to collect stats from as StringData to pass to parseProcDiskStatsFile.
     std::vector<StringData> _disksStringData;
+
+    // List of NUMA node directory names (e.g. "node0") to collect per-node memory traffic stats
+    // from.
+    std::vector<std::string> _numaNodes;
 };
 
 class SimpleFunctionCollector final : public FTDCCollectorInterface {
@@ -33,6 +33,7 @@
 #include <algorithm>
 #include <boost/cstdint.hpp>
 #include <boost/move/utility_core.hpp>
+#include <deque>
 #include <set>
 #include <type_traits>
 #include <utility>
@@ -44,6 +45,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/client.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/index/bulk_builder_common.h"
 #include "mongo/db/index/column_cell.h"
@@ -53,6 +55,7 @@
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index/multikey_paths.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/sorter/sorter.h"
 #include "mongo/db/sorter/sorter_gen.h"
 #include "mongo/db/storage/execution_context.h"
@@ -62,8 +65,11 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/future.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kIndex
@@ -80,6 +86,20 @@ inline void dec(int64_t* counter) {
     if (counter)
         --*counter;
 };
+
+// During a bulk build, documents are handed to cell-generation workers in batches of this size.
+// Cell generation dominates the cost of the scan phase, so batches just need to be large enough
+// to amortize the scheduling overhead.
+constexpr size_t kDocsPerCellGenBatch = 64;
+constexpr size_t kMaxCellGenWorkers = 8;
+
+// An encoded cell produced by a cell-generation worker, owned so that it can outlive the
+// BufBuilder the worker encoded it into.
+struct EncodedCell {
+    PathValue path;
+    RowId rowId;
+    CellValue cell;
+};
 }  // namespace
 
 ColumnStoreAccessMethod::ColumnStoreAccessMethod(IndexCatalogEntry* ice,
@@ -101,6 +121,8 @@ public:
                 const IndexStateInfo& stateInfo,
                 const DatabaseName& dbName);
 
+    ~BulkBuilder();
+
     //
     // Generic APIs
     //
@@ -142,11 +164,43 @@ public:
                         bool isDup);
 
 private:
+    /**
+     * Starts the cell-generation worker pool when there are enough cores to make pipelining
+     * worthwhile. Leaves '_cellGenPool' null otherwise.
+     */
+    void _setUpCellGenPool();
+
+    /**
+     * Hands the documents accumulated in '_docBatch' to a cell-generation worker.
+     */
+    void _dispatchCellGenBatch();
+
+    /**
+     * Feeds completed batches into the sorter in dispatch order, which preserves the RecordId
+     * ordering the sorter requires. Blocks until all dispatched batches are consumed when
+     * 'drainAll' is true, or while the pipeline is at capacity; otherwise consumes only batches
+     * that are already complete. Throws if a worker failed to generate cells.
+     */
+    void _drainCellGenBatches(bool drainAll);
+
+    /**
+     * Dispatches any partial batch and waits for all outstanding batches to reach the sorter.
+     */
+    void _flushCellGenPipeline();
+
     ColumnStoreAccessMethod* const _columnsAccess;
 
     ColumnStoreSorter _sorter;
     BufBuilder _cellBuilder;
 
+    // Set up when enough cores are available: insert() then stages owned copies of documents and
+    // cell generation runs on the pool, pipelined with the collection scan. Null when cells are
+    // generated synchronously in insert().
+    std::unique_ptr<ThreadPool> _cellGenPool;
+    size_t _maxPendingCellGenBatches = 0;
+    std::vector<std::pair<BSONObj, RowId>> _docBatch;
+    std::deque<Future<std::vector<EncodedCell>>> _pendingCellGenBatches;
+
     boost::optional<std::pair<PathValue, RowId>> _previousPathAndRowId;
 };
 
@@ -160,6 +214,7 @@ ColumnStoreAccessMethod::BulkBuilder::BulkBuilder(ColumnStoreAccessMethod* index
       _columnsAccess(index),
       _sorter(maxMemoryUsageBytes, dbName, bulkBuilderFileStats(), bulkBuilderTracker()) {
     countNewBuildInStats();
+    _setUpCellGenPool();
 }
 
 ColumnStoreAccessMethod::BulkBuilder::BulkBuilder(ColumnStoreAccessMethod* index,
@@ -178,6 +233,91 @@ ColumnStoreAccessMethod::BulkBuilder::BulkBuilder(ColumnStoreAccessMethod* index
               *stateInfo.getRanges(),
               bulkBuilderTracker()) {
     countResumedBuildInStats();
+    _setUpCellGenPool();
+}
+
+ColumnStoreAccessMethod::BulkBuilder::~BulkBuilder() {
+    if (_cellGenPool) {
+        // Let outstanding cell-generation work finish before the state it references goes away.
+        // The results are discarded if the build was abandoned.
+        _cellGenPool->shutdown();
+        _cellGenPool->join();
+    }
+}
+
+void ColumnStoreAccessMethod::BulkBuilder::_setUpCellGenPool() {
+    const size_t numWorkers = std::min(
+        static_cast<size_t>(ProcessInfo::getNumAvailableCores()) / 2, kMaxCellGenWorkers);
+    if (numWorkers < 2) {
+        return;
+    }
+
+    ThreadPool::Options options;
+    options.poolName = "ColumnCellGeneration";
+    options.maxThreads = numWorkers;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName,
+                           getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+    };
+    _cellGenPool = std::make_unique<ThreadPool>(options);
+    _cellGenPool->startup();
+
+    // Allow the scan to run ahead of cell generation by a bounded number of batches before
+    // insert() starts blocking on the oldest batch.
+    _maxPendingCellGenBatches = 2 * numWorkers;
+}
+
+void ColumnStoreAccessMethod::BulkBuilder::_dispatchCellGenBatch() {
+    auto pf = makePromiseFuture<std::vector<EncodedCell>>();
+    _pendingCellGenBatches.push_back(std::move(pf.future));
+    _cellGenPool->schedule([keyGen = &_columnsAccess->_keyGen,
+                            batch = std::move(_docBatch),
+                            promise = std::move(pf.promise)](Status status) mutable {
+        invariant(status);
+        promise.setWith([&] {
+            std::vector<EncodedCell> cells;
+            BufBuilder cellBuilder;
+            for (const auto& [obj, rowId] : batch) {
+                keyGen->visitCellsForInsert(
+                    obj, [&](PathView path, const column_keygen::UnencodedCellView& cell) {
+                        cellBuilder.reset();
+                        column_keygen::writeEncodedCell(cell, &cellBuilder);
+                        cells.push_back({path.toString(),
+                                         rowId,
+                                         CellValue(cellBuilder.buf(), cellBuilder.len())});
+                    });
+            }
+            return cells;
+        });
+    });
+    _docBatch = {};
+    _docBatch.reserve(kDocsPerCellGenBatch);
+}
+
+void ColumnStoreAccessMethod::BulkBuilder::_drainCellGenBatches(bool drainAll) {
+    while (!_pendingCellGenBatches.empty()) {
+        const bool mustWait =
+            drainAll || _pendingCellGenBatches.size() > _maxPendingCellGenBatches;
+        if (!mustWait && !_pendingCellGenBatches.front().isReady()) {
+            break;
+        }
+        auto cells = std::move(_pendingCellGenBatches.front()).get();
+        _pendingCellGenBatches.pop_front();
+        for (const auto& encoded : cells) {
+            _sorter.add(encoded.path, encoded.rowId, encoded.cell);
+            ++_keysInserted;
+        }
+    }
+}
+
+void ColumnStoreAccessMethod::BulkBuilder::_flushCellGenPipeline() {
+    if (!_cellGenPool) {
+        return;
+    }
+    if (!_docBatch.empty()) {
+        _dispatchCellGenBatch();
+    }
+    _drainCellGenBatches(true /* drainAll */);
 }
 
 Status ColumnStoreAccessMethod::BulkBuilder::insert(
@@ -189,17 +329,36 @@ Status ColumnStoreAccessMethod::BulkBuilder::insert(
     const InsertDeleteOptions& options,
     const OnSuppressedErrorFn& onSuppressedError,
     const ShouldRelaxConstraintsFn& shouldRelaxConstraints) {
-    _columnsAccess->_keyGen.visitCellsForInsert(
-        obj, [&](PathView path, const column_keygen::UnencodedCellView& cell) {
-            _cellBuilder.reset();
-            column_keygen::writeEncodedCell(cell, &_cellBuilder);
-            tassert(6762300, "RecordID cannot be a string for column store indexes", !rid.isStr());
-            _sorter.add(path, rid.getLong(), CellView(_cellBuilder.buf(), _cellBuilder.len()));
+    try {
+        if (_cellGenPool) {
+            tassert(9106702,
+                    "RecordID cannot be a string for column store indexes",
+                    !rid.isStr());
+            _docBatch.emplace_back(obj.getOwned(), rid.getLong());
+            if (_docBatch.size() >= kDocsPerCellGenBatch) {
+                _dispatchCellGenBatch();
+            }
+            // Feed completed batches into the sorter, blocking if the scan is too far ahead of
+            // the workers. This also surfaces any cell-generation failure on this thread.
+            _drainCellGenBatches(false /* drainAll */);
+            return Status::OK();
+        }
 
-            ++_keysInserted;
-        });
+        _columnsAccess->_keyGen.visitCellsForInsert(
+            obj, [&](PathView path, const column_keygen::UnencodedCellView& cell) {
+                _cellBuilder.reset();
+                column_keygen::writeEncodedCell(cell, &_cellBuilder);
+                tassert(
+                    6762300, "RecordID cannot be a string for column store indexes", !rid.isStr());
+                _sorter.add(path, rid.getLong(), CellView(_cellBuilder.buf(), _cellBuilder.len()));
 
-    return Status::OK();
+                ++_keysInserted;
+            });
+
+        return Status::OK();
+    } catch (const AssertionException& ex) {
+        return ex.toStatus();
+    }
 }
 
 // The "multikey" property does not apply to columnstore indexes, because the array key does not
@@ -218,6 +377,7 @@ int64_t ColumnStoreAccessMethod::BulkBuilder::getKeysInserted() const {
 }
 
 IndexStateInfo ColumnStoreAccessMethod::BulkBuilder::persistDataForShutdown() {
+    _flushCellGenPipeline();
     auto state = _sorter.persistDataForShutdown();
 
     IndexStateInfo stateInfo;
@@ -229,6 +389,7 @@ IndexStateInfo ColumnStoreAccessMethod::BulkBuilder::persistDataForShutdown() {
 }
 
 std::unique_ptr<ColumnStoreSorter::Iterator> ColumnStoreAccessMethod::BulkBuilder::finalizeSort() {
+    _flushCellGenPipeline();
     return std::unique_ptr<ColumnStoreSorter::Iterator>(_sorter.done());
 }
 
@@ -270,6 +270,18 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
                                            const std::vector<BsonRecord>& bsonRecords,
                                            const InsertDeleteOptions& options,
                                            int64_t* numInserted) {
+    // When every record carries the same commit timestamp, generate the keys for the whole batch
+    // up front and write them to the index in a single pass, amortizing the per-document
+    // bookkeeping over the batch. Hybrid index builds keep the per-document path below because the
+    // side table consults the partial filter expression against each document.
+    const bool batchable = bsonRecords.size() > 1 && !entry->isHybridBuilding() &&
+        std::all_of(bsonRecords.begin(), bsonRecords.end(), [&](const BsonRecord& bsonRecord) {
+            return bsonRecord.ts == bsonRecords.front().ts;
+        });
+    if (batchable) {
+        return _insertBatch(opCtx, pooledBuilder, coll, entry, bsonRecords, options, numInserted);
+    }
+
     for (const auto& bsonRecord : bsonRecords) {
         invariant(bsonRecord.id != RecordId());
 
@@ -313,6 +325,90 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
     return Status::OK();
 }
 
+Status SortedDataIndexAccessMethod::_insertBatch(OperationContext* opCtx,
+                                                 SharedBufferFragmentBuilder& pooledBuilder,
+                                                 const CollectionPtr& coll,
+                                                 const IndexCatalogEntry* entry,
+                                                 const std::vector<BsonRecord>& bsonRecords,
+                                                 const InsertDeleteOptions& options,
+                                                 int64_t* numInserted) {
+    if (!bsonRecords.front().ts.isNull()) {
+        Status status =
+            shard_role_details::getRecoveryUnit(opCtx)->setTimestamp(bsonRecords.front().ts);
+        if (!status.isOK())
+            return status;
+    }
+
+    auto& executionCtx = StorageExecutionContext::get(opCtx);
+
+    KeyStringSet batchKeys;
+    KeyStringSet batchMultikeyMetadataKeys;
+    MultikeyPaths batchMultikeyPaths;
+    bool shouldMarkMultikey = false;
+
+    for (const auto& bsonRecord : bsonRecords) {
+        invariant(bsonRecord.id != RecordId());
+
+        auto keys = executionCtx.keys();
+        auto multikeyMetadataKeys = executionCtx.multikeyMetadataKeys();
+        auto multikeyPaths = executionCtx.multikeyPaths();
+
+        getKeys(opCtx,
+                coll,
+                entry,
+                pooledBuilder,
+                *bsonRecord.docPtr,
+                options.getKeysMode,
+                GetKeysContext::kAddingKeys,
+                keys.get(),
+                multikeyMetadataKeys.get(),
+                multikeyPaths.get(),
+                bsonRecord.id);
+
+        // The multikey decision must be made per document; the merged key set below no longer
+        // reveals whether any single document generated more than one key.
+        shouldMarkMultikey = shouldMarkMultikey ||
+            shouldMarkIndexAsMultikey(keys->size(), *multikeyMetadataKeys, *multikeyPaths);
+
+        // The RecordId encoded in each KeyString keeps keys from different documents distinct, so
+        // merging loses no keys and duplicate key checking on unique indexes is unaffected.
+        batchKeys.insert(keys->begin(), keys->end());
+        batchMultikeyMetadataKeys.insert(multikeyMetadataKeys->begin(),
+                                         multikeyMetadataKeys->end());
+
+        if (!multikeyPaths->empty()) {
+            if (batchMultikeyPaths.empty()) {
+                batchMultikeyPaths = *multikeyPaths;
+            } else {
+                invariant(batchMultikeyPaths.size() == multikeyPaths->size());
+                for (size_t i = 0; i < multikeyPaths->size(); ++i) {
+                    batchMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
+                                                 (*multikeyPaths)[i].begin(),
+                                                 (*multikeyPaths)[i].end());
+                }
+            }
+        }
+    }
+
+    int64_t inserted = 0;
+    Status status = insertKeys(opCtx, coll, entry, batchKeys, options, nullptr, &inserted);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    if (shouldMarkMultikey) {
+        entry->setMultikey(opCtx, coll, batchMultikeyMetadataKeys, batchMultikeyPaths);
+    }
+    if (!batchMultikeyMetadataKeys.empty()) {
+        inserted += batchMultikeyMetadataKeys.size();
+    }
+    if (numInserted) {
+        *numInserted += inserted;
+    }
+
+    return Status::OK();
+}
+
 void SortedDataIndexAccessMethod::remove(OperationContext* opCtx,
                                          SharedBufferFragmentBuilder& pooledBuilder,
                                          const CollectionPtr& coll,
@@ -669,6 +669,21 @@ private:
                                const key_string::Value& dataKey,
                                const RecordIdHandlerFn& onDuplicateRecord);
 
+    /**
+     * Generates the keys for all of 'bsonRecords' before writing any of them to the index, so the
+     * index is updated in a single pass over the batch. Only valid when every record carries the
+     * same commit timestamp and the index is not hybrid building.
+     *
+     * Used by insert() only.
+     */
+    Status _insertBatch(OperationContext* opCtx,
+                        SharedBufferFragmentBuilder& pooledBuilder,
+                        const CollectionPtr& coll,
+                        const IndexCatalogEntry* entry,
+                        const std::vector<BsonRecord>& bsonRecords,
+                        const InsertDeleteOptions& options,
+                        int64_t* numInserted);
+
     Status _indexKeysOrWriteToSideTable(OperationContext* opCtx,
                                         const CollectionPtr& coll,
                                         const IndexCatalogEntry* entry,
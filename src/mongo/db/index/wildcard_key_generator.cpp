@@ -57,6 +57,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/intrusive_counter.h"
 #include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 namespace {
@@ -65,6 +66,72 @@ namespace {
 // to prevent the _id field from being indexed, since it already has its own dedicated index.
 static const BSONObj kDefaultProjection = BSON("_id"_sd << 0);
 
+// Computes the projection specification for the given wildcard key pattern, either from the path
+// in a "path.$**" pattern, the user's wildcardProjection, or the default {_id: 0} projection.
+BSONObj makeProjectionSpec(BSONObj keyPattern, BSONObj pathProjection) {
+    StringData indexRoot = "";
+    size_t suffixPos = std::string::npos;
+    for (auto elem : keyPattern) {
+        StringData fieldName(elem.fieldNameStringData());
+        if (WildcardNames::isWildcardFieldName(fieldName)) {
+            // The _keyPattern is either {..., "$**": 1, ..} for all paths or
+            // {.., "path.$**": 1, ...} for a single subtree. If we are indexing a single subtree
+            // then we will project just that path.
+            indexRoot = fieldName;
+            suffixPos = indexRoot.find(WildcardKeyGenerator::kSubtreeSuffix);
+            break;
+        }
+    }
+
+    // If we're indexing a single subtree, we can't also specify a path projection.
+    uassert(7246102,
+            str::stream() << "the wildcard keyPattern " << keyPattern.toString() << " is invalid",
+            !indexRoot.empty() && (suffixPos == std::string::npos || pathProjection.isEmpty()));
+
+    return (suffixPos != std::string::npos ? BSON(indexRoot.substr(0, suffixPos) << 1)
+                : pathProjection.isEmpty() ? kDefaultProjection
+                                           : pathProjection);
+}
+
+// Determines whether 'projSpec' consists solely of complete top-level subtree inclusions or
+// exclusions and, if so, compiles it into an equivalent top-level field filter. The semantics
+// mirror ProjectionPolicies::wildcardIndexSpecProjectionPolicies(): _id is excluded unless the
+// projection explicitly includes it.
+boost::optional<WildcardKeyGenerator::TopLevelProjection> computeTopLevelProjection(
+    BSONObj projSpec) {
+    boost::optional<bool> isInclusion;
+    boost::optional<bool> idIncluded;
+    StringSet fields;
+    for (auto&& elem : projSpec) {
+        const auto fieldName = elem.fieldNameStringData();
+        if (fieldName.find('.') != std::string::npos || (!elem.isNumber() && !elem.isBoolean())) {
+            // Dotted paths and non-literal specs require the full ProjectionExecutor.
+            return boost::none;
+        }
+        if (fieldName == "_id"_sd) {
+            idIncluded = elem.trueValue();
+        } else {
+            // parseAndAnalyze() has already rejected projections that mix inclusions and
+            // exclusions, so every non-_id field shares the same sense.
+            isInclusion = elem.trueValue();
+            fields.insert(fieldName.toString());
+        }
+    }
+
+    if (!isInclusion) {
+        // The projection mentions _id alone, e.g. the default {_id: 0} projection.
+        isInclusion = *idIncluded;
+    }
+
+    // Add _id to the filtered set when it is included in an inclusion projection or excluded from
+    // an exclusion projection.
+    if (*isInclusion == idIncluded.value_or(false)) {
+        fields.insert("_id");
+    }
+
+    return WildcardKeyGenerator::TopLevelProjection{*isInclusion, std::move(fields)};
+}
+
 // If the enclosing object is an array, then the current element's fieldname is the array index, so
 // we omit this when computing the full path. Otherwise, the full path is the pathPrefix plus the
 // element's fieldname.
@@ -124,7 +191,8 @@ public:
                              KeyStringSet::sequence_type* keys,
                              KeyStringSet::sequence_type* multikeyPaths,
                              const std::vector<BSONElement>& preElems,
-                             const std::vector<BSONElement>& postElems)
+                             const std::vector<BSONElement>& postElems,
+                             const WildcardKeyGenerator::TopLevelProjection* topLevelProjection)
         : _keyStringVersion(keyStringVersion),
           _ordering(ordering),
           _collator(collator),
@@ -134,7 +202,8 @@ public:
           _keys(keys),
           _multikeyPaths(multikeyPaths),
           _preElems(preElems),
-          _postElems(postElems) {}
+          _postElems(postElems),
+          _topLevelProjection(topLevelProjection) {}
 
     // Traverses every path of the post-projection document, adding keys to the set as it goes.
     void traverseWildcard(BSONObj obj, bool objIsArray, FieldRef* path);
@@ -162,6 +231,10 @@ private:
     KeyStringSet::sequence_type* _multikeyPaths;
     const std::vector<BSONElement>& _preElems;
     const std::vector<BSONElement>& _postElems;
+
+    // When non-null, the traversal is over the raw document and this filter stands in for the
+    // projection executor at the top level.
+    const WildcardKeyGenerator::TopLevelProjection* _topLevelProjection;
 };
 
 void SingleDocumentKeyEncoder::traverseWildcard(BSONObj obj, bool objIsArray, FieldRef* path) {
@@ -170,6 +243,12 @@ void SingleDocumentKeyEncoder::traverseWildcard(BSONObj obj, bool objIsArray, Fi
         if (elem.fieldNameStringData().find('.', 0) != std::string::npos)
             continue;
 
+        // Skip any top-level subtree the wildcard projection would have removed. Path components
+        // are only pushed for object fields, so an empty path means we are at the top level.
+        if (_topLevelProjection && path->numParts() == 0 &&
+            !_topLevelProjection->shouldTraverse(elem.fieldNameStringData()))
+            continue;
+
         // Append the element's fieldname to the path, if the enclosing object is not an array.
         pushPathComponent(elem, objIsArray, path);
 
@@ -281,28 +360,7 @@ constexpr StringData WildcardKeyGenerator::kSubtreeSuffix;
 
 WildcardProjection WildcardKeyGenerator::createProjectionExecutor(BSONObj keyPattern,
                                                                   BSONObj pathProjection) {
-    StringData indexRoot = "";
-    size_t suffixPos = std::string::npos;
-    for (auto elem : keyPattern) {
-        StringData fieldName(elem.fieldNameStringData());
-        if (WildcardNames::isWildcardFieldName(fieldName)) {
-            // The _keyPattern is either {..., "$**": 1, ..} for all paths or
-            // {.., "path.$**": 1, ...} for a single subtree. If we are indexing a single subtree
-            // then we will project just that path.
-            indexRoot = fieldName;
-            suffixPos = indexRoot.find(kSubtreeSuffix);
-            break;
-        }
-    }
-
-    // If we're indexing a single subtree, we can't also specify a path projection.
-    uassert(7246102,
-            str::stream() << "the wildcard keyPattern " << keyPattern.toString() << " is invalid",
-            !indexRoot.empty() && (suffixPos == std::string::npos || pathProjection.isEmpty()));
-
-    auto projSpec = (suffixPos != std::string::npos ? BSON(indexRoot.substr(0, suffixPos) << 1)
-                         : pathProjection.isEmpty() ? kDefaultProjection
-                                                    : pathProjection);
+    auto projSpec = makeProjectionSpec(keyPattern, pathProjection);
 
     // Construct a dummy ExpressionContext for ProjectionExecutor. It's OK to set the
     // ExpressionContext's OperationContext and CollatorInterface to 'nullptr' and the namespace
@@ -322,6 +380,8 @@ WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
                                            Ordering ordering,
                                            boost::optional<KeyFormat> rsKeyFormat)
     : _proj(createProjectionExecutor(keyPattern, pathProjection)),
+      _topLevelProjection(
+          computeTopLevelProjection(makeProjectionSpec(keyPattern, pathProjection))),
       _collator(collator),
       _keyPattern(keyPattern),
       _keyStringVersion(keyStringVersion),
@@ -403,10 +463,17 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
                                         &keysSequence,
                                         multikeyPaths ? &multikeyPathsSequence : nullptr,
                                         preElems,
-                                        postElems};
+                                        postElems,
+                                        _topLevelProjection ? &*_topLevelProjection : nullptr};
 
-    keyEncoder.traverseWildcard(
-        _proj.exec()->applyTransformation(Document{inputDoc}).toBson(), false, &rootPath);
+    if (_topLevelProjection) {
+        // The projection only references complete top-level subtrees, so it can be applied by
+        // filtering fields during the walk rather than materializing a projected document.
+        keyEncoder.traverseWildcard(inputDoc, false, &rootPath);
+    } else {
+        keyEncoder.traverseWildcard(
+            _proj.exec()->applyTransformation(Document{inputDoc}).toBson(), false, &rootPath);
+    }
 
     // If no key is generated for this index at this point, that means the document doesn't have any
     // field that is indexed by the wildcard field. We should still add index keys for this
@@ -45,6 +45,7 @@
 #include "mongo/db/storage/key_string.h"
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/util/shared_buffer_fragment.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -97,8 +98,28 @@ public:
                       KeyStringSet* multikeyPaths,
                       const boost::optional<RecordId>& id = boost::none) const;
 
+    /**
+     * Describes a wildcard projection whose paths are all complete top-level subtrees, such as the
+     * default {_id: 0} projection or the projection derived from a "path.$**" key pattern. Such a
+     * projection can be applied by filtering top-level fields during the document walk, without
+     * materializing a post-projection document through the ProjectionExecutor.
+     */
+    struct TopLevelProjection {
+        bool isInclusion;
+        StringSet fields;
+
+        bool shouldTraverse(StringData fieldName) const {
+            return isInclusion == (fields.count(fieldName) > 0);
+        }
+    };
+
 private:
     WildcardProjection _proj;
+
+    // Engaged when the projection only references complete top-level subtrees; disengaged
+    // projections fall back to the ProjectionExecutor in generateKeys().
+    boost::optional<TopLevelProjection> _topLevelProjection;
+
     const CollatorInterface* _collator;
     const BSONObj _keyPattern;
     const key_string::Version _keyStringVersion;
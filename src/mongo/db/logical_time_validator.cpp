@@ -29,6 +29,7 @@
 
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -102,19 +103,26 @@ SignedLogicalTime LogicalTimeValidator::_getProof(const KeysCollectionDocument&
                                                   LogicalTime newTime) {
     auto key = keyDoc.getKey();
 
+    // Most calls sign a cluster time that has already been signed, so check the last seen time
+    // lock-free first. Note: _lastSeenValidTime will initially not have a proof set.
+    if (auto lastSeen = std::atomic_load(&_lastSeenValidTime);  // NOLINT
+        newTime == lastSeen->getTime() && lastSeen->getProof()) {
+        return *lastSeen;
+    }
+
     // Compare and calculate HMAC inside mutex to prevent multiple threads computing HMAC for the
     // same cluster time.
     stdx::lock_guard<Latch> lk(_mutex);
-    // Note: _lastSeenValidTime will initially not have a proof set.
-    if (newTime == _lastSeenValidTime.getTime() && _lastSeenValidTime.getProof()) {
-        return _lastSeenValidTime;
+    if (newTime == _lastSeenValidTime->getTime() && _lastSeenValidTime->getProof()) {
+        return *_lastSeenValidTime;
     }
 
     auto signature = _timeProofService.getProof(newTime, key);
     SignedLogicalTime newSignedTime(newTime, std::move(signature), keyDoc.getKeyId());
 
-    if (newTime > _lastSeenValidTime.getTime() || !_lastSeenValidTime.getProof()) {
-        _lastSeenValidTime = newSignedTime;
+    if (newTime > _lastSeenValidTime->getTime() || !_lastSeenValidTime->getProof()) {
+        std::atomic_store(&_lastSeenValidTime,  // NOLINT
+                          std::make_shared<const SignedLogicalTime>(newSignedTime));
     }
 
     return newSignedTime;
@@ -163,12 +171,10 @@ SignedLogicalTime LogicalTimeValidator::signLogicalTime(OperationContext* opCtx,
 }
 
 Status LogicalTimeValidator::validate(OperationContext* opCtx, const SignedLogicalTime& newTime) {
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (newTime.getTime() <= _lastSeenValidTime.getTime() &&
-            !MONGO_unlikely(alwaysValidateClientsClusterTime.shouldFail())) {
-            return Status::OK();
-        }
+    if (auto lastSeen = std::atomic_load(&_lastSeenValidTime);  // NOLINT
+        newTime.getTime() <= lastSeen->getTime() &&
+        !MONGO_unlikely(alwaysValidateClientsClusterTime.shouldFail())) {
+        return Status::OK();
     }
 
     auto keyStatusWith =
@@ -240,7 +246,8 @@ void LogicalTimeValidator::resetKeyManagerCache() {
     invariant(_keyManager);
     _keyManager->clearCache();
     stdx::lock_guard<Latch> lk(_mutex);
-    _lastSeenValidTime = SignedLogicalTime();
+    std::atomic_store(&_lastSeenValidTime,  // NOLINT
+                      std::make_shared<const SignedLogicalTime>());
     _timeProofService.resetCache();
 }
 
@@ -251,7 +258,8 @@ void LogicalTimeValidator::stopKeyManager() {
         _keyManager->clearCache();
 
         stdx::lock_guard<Latch> lk(_mutex);
-        _lastSeenValidTime = SignedLogicalTime();
+        std::atomic_store(&_lastSeenValidTime,  // NOLINT
+                          std::make_shared<const SignedLogicalTime>());
         _timeProofService.resetCache();
     } else {
         LOGV2(20718, "Stopping key manager: no key manager exists.");
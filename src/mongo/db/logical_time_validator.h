@@ -132,8 +132,14 @@ private:
 
     SignedLogicalTime _getProof(const KeysCollectionDocument& keyDoc, LogicalTime newTime);
 
-    Mutex _mutex = MONGO_MAKE_LATCH("LogicalTimeValidator::_mutex");  // protects _lastSeenValidTime
-    SignedLogicalTime _lastSeenValidTime;
+    // Serializes writers of '_lastSeenValidTime' so concurrent signing requests for the same
+    // cluster time compute its HMAC only once.
+    Mutex _mutex = MONGO_MAKE_LATCH("LogicalTimeValidator::_mutex");
+
+    // Most recently signed or validated time, read lock-free via the std::atomic_load and
+    // std::atomic_store free functions. Never null.
+    std::shared_ptr<const SignedLogicalTime> _lastSeenValidTime =
+        std::make_shared<const SignedLogicalTime>();
     TimeProofService _timeProofService;
     std::shared_ptr<KeysCollectionManager> _keyManager;
 };
@@ -0,0 +1,222 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/maintenance_thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mongo/base/status.h"
+#include "mongo/db/client.h"
+#include "mongo/db/maintenance_thread_pool_gen.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/logv2/log.h"
+#include "mongo/logv2/log_attr.h"
+#include "mongo/logv2/log_component.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/str.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+namespace mongo {
+namespace {
+
+const auto getMaintenanceThreadPool = ServiceContext::declareDecoration<MaintenanceThreadPool>();
+
+// The dispatcher wakes up this often to check for tasks whose period has elapsed. Maintenance
+// periods are measured in seconds to hours, so a coarse tick is sufficient.
+constexpr Seconds kDispatchInterval{1};
+
+// Maintenance passes are I/O bound and largely serialize on collection locks, so a small cap keeps
+// background deletion work from monopolizing disk bandwidth while still letting independent tasks
+// overlap. Idle workers retire after the pool's default idle age, so a quiet server holds no
+// maintenance threads at all.
+constexpr size_t kMaxWorkerThreads = 4;
+
+}  // namespace
+
+MaintenanceThreadPool::~MaintenanceThreadPool() {
+    shutdown();
+}
+
+MaintenanceThreadPool& MaintenanceThreadPool::get(ServiceContext* serviceContext) {
+    return getMaintenanceThreadPool(serviceContext);
+}
+
+void MaintenanceThreadPool::registerTask(std::string name,
+                                         Milliseconds period,
+                                         bool reclaimsDiskSpace,
+                                         unique_function<void(Client*)> fn) {
+    auto task = std::make_shared<Task>();
+    task->name = std::move(name);
+    task->period = period;
+    task->reclaimsDiskSpace = reclaimsDiskSpace;
+    task->fn = std::move(fn);
+    task->nextRun = Date_t::now() + period;
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    for (auto&& existing : _tasks) {
+        invariant(existing->name != task->name,
+                  str::stream() << "duplicate maintenance task registration: " << task->name);
+    }
+    _tasks.push_back(std::move(task));
+}
+
+void MaintenanceThreadPool::deregisterTask(StringData name) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _tasks.erase(std::remove_if(_tasks.begin(),
+                                _tasks.end(),
+                                [&](const auto& task) { return task->name == name; }),
+                 _tasks.end());
+}
+
+void MaintenanceThreadPool::kickDiskReclaimTasks() {
+    auto now = Date_t::now();
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        for (auto&& task : _tasks) {
+            if (task->reclaimsDiskSpace) {
+                task->nextRun = now;
+            }
+        }
+    }
+    _dispatchDueTasks(now);
+}
+
+void MaintenanceThreadPool::start(ServiceContext* serviceContext) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    invariant(!_shutdown);
+    if (_dispatcher) {
+        return;
+    }
+    _ensurePoolStarted(lk);
+    _dispatcher = serviceContext->getPeriodicRunner()->makeJob(
+        {"MaintenanceThreadPoolDispatcher",
+         [this](Client*) { _dispatchDueTasks(Date_t::now()); },
+         kDispatchInterval,
+         false /*isKillableByStepdown*/});
+    _dispatcher.start();
+}
+
+void MaintenanceThreadPool::shutdown() {
+    PeriodicJobAnchor dispatcher;
+    std::unique_ptr<ThreadPool> pool;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_shutdown) {
+            return;
+        }
+        _shutdown = true;
+        dispatcher = std::move(_dispatcher);
+        pool = std::move(_pool);
+    }
+    if (dispatcher) {
+        dispatcher.stop();
+    }
+    if (pool) {
+        pool->shutdown();
+        pool->join();
+    }
+}
+
+void MaintenanceThreadPool::dispatchDueTasks_forTest(Date_t now) {
+    _dispatchDueTasks(now);
+}
+
+void MaintenanceThreadPool::_dispatchDueTasks(Date_t now) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (_shutdown) {
+        return;
+    }
+    for (auto&& task : _tasks) {
+        if (task->inFlight || now < task->nextRun) {
+            continue;
+        }
+        _ensurePoolStarted(lk);
+        task->inFlight = true;
+        _pool->schedule([this, task](Status status) {
+            if (status.isOK()) {
+                try {
+                    task->fn(&cc());
+                } catch (const DBException& ex) {
+                    LOGV2_WARNING(9512801,
+                                  "Maintenance task pass failed",
+                                  "task"_attr = task->name,
+                                  "error"_attr = ex.toStatus());
+                }
+            }
+            stdx::lock_guard<Latch> lk(_mutex);
+            task->nextRun = Date_t::now() + task->period;
+            task->inFlight = false;
+        });
+    }
+}
+
+void MaintenanceThreadPool::_ensurePoolStarted(WithLock) {
+    if (_pool) {
+        return;
+    }
+    ThreadPool::Options options;
+    options.poolName = "MaintenanceThreadPool";
+    options.threadNamePrefix = "Maintenance-";
+    options.minThreads = 0;
+    options.maxThreads = kMaxWorkerThreads;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName, getGlobalServiceContext()->getService());
+    };
+    _pool = std::make_unique<ThreadPool>(options);
+    _pool->startup();
+}
+
+std::unique_ptr<DiskSpaceMonitor::Action> makeKickMaintenanceReclaimTasksOnLowDiskSpaceAction() {
+    class KickReclaimTasksAction : public DiskSpaceMonitor::Action {
+    public:
+        int64_t getThresholdBytes() noexcept final {
+            // This parameter's validator ensures that this multiplication will not overflow.
+            auto thresholdMB = gMaintenanceReclaimLowDiskSpaceThresholdMB.load();
+            // A threshold of zero disables the trigger. Return a negative threshold so that the
+            // action does not fire even when the disk reports no available space at all.
+            return thresholdMB > 0 ? thresholdMB * 1024 * 1024 : -1;
+        }
+
+        void act(OperationContext* opCtx, int64_t availableBytes) noexcept final {
+            LOGV2_DEBUG(9512802,
+                        2,
+                        "Kicking disk-reclaiming maintenance tasks because remaining disk space "
+                        "is below the configured threshold",
+                        "availableBytes"_attr = availableBytes,
+                        "thresholdBytes"_attr = getThresholdBytes());
+            MaintenanceThreadPool::get(opCtx->getServiceContext()).kickDiskReclaimTasks();
+        }
+    };
+    return std::make_unique<KickReclaimTasksAction>();
+}
+
+}  // namespace mongo
@@ -0,0 +1,144 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/disk_space_monitor.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/functional.h"
+#include "mongo/util/periodic_runner.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * A process-wide scheduler for periodic maintenance passes (expired document removal, truncate
+ * maintenance and similar background deletion work).
+ *
+ * Maintenance subsystems have historically each owned a dedicated thread that spends most of its
+ * life sleeping between passes. Tasks registered here instead share a single dispatcher job and an
+ * elastic worker pool that keeps no threads alive while there is no work. Tasks that reclaim disk
+ * space can additionally be kicked out-of-band when the DiskSpaceMonitor reports that available
+ * disk space is running low, so space-reclaiming passes react to disk pressure together instead of
+ * waiting out their individual sleep intervals.
+ */
+class MaintenanceThreadPool {
+public:
+    MaintenanceThreadPool() = default;
+    ~MaintenanceThreadPool();
+
+    static MaintenanceThreadPool& get(ServiceContext* serviceContext);
+
+    /**
+     * Registers a periodic maintenance task. The first pass runs one 'period' after registration.
+     * A pass that is still running when the next period elapses is not scheduled again until it
+     * finishes. Tasks registered with 'reclaimsDiskSpace' also run when kickDiskReclaimTasks() is
+     * invoked. Task names must be unique.
+     */
+    void registerTask(std::string name,
+                      Milliseconds period,
+                      bool reclaimsDiskSpace,
+                      unique_function<void(Client*)> fn);
+
+    /**
+     * Removes the task registered under 'name', if any. A pass that has already been handed to the
+     * worker pool may still run to completion.
+     */
+    void deregisterTask(StringData name);
+
+    /**
+     * Makes every task registered with 'reclaimsDiskSpace' due immediately, regardless of where it
+     * is in its period, and dispatches the due tasks to the worker pool.
+     */
+    void kickDiskReclaimTasks();
+
+    /**
+     * Starts the dispatcher job on the service context's periodic runner. Tasks may be registered
+     * before start(); their passes begin running afterwards.
+     */
+    void start(ServiceContext* serviceContext);
+
+    /**
+     * Stops the dispatcher and joins the worker threads. Safe to call multiple times and without a
+     * prior start().
+     */
+    void shutdown();
+
+    /**
+     * Runs the dispatcher once as if the current time were 'now'. Lets unit tests drive the
+     * scheduler without a periodic runner.
+     */
+    void dispatchDueTasks_forTest(Date_t now);
+
+private:
+    struct Task {
+        std::string name;
+        Milliseconds period;
+        bool reclaimsDiskSpace;
+        unique_function<void(Client*)> fn;
+
+        // The next time a pass of this task should be dispatched. Only meaningful while the task
+        // is not in flight.
+        Date_t nextRun;
+
+        // Set while a pass is queued on or running in the worker pool.
+        bool inFlight = false;
+    };
+
+    void _dispatchDueTasks(Date_t now);
+    void _ensurePoolStarted(WithLock);
+
+    // Protects all state below.
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("MaintenanceThreadPool::_mutex");
+
+    // Tasks are shared with the worker passes currently executing them so that deregistration
+    // cannot pull a task out from under a running pass.
+    std::vector<std::shared_ptr<Task>> _tasks;
+
+    std::unique_ptr<ThreadPool> _pool;
+    PeriodicJobAnchor _dispatcher;
+    bool _shutdown = false;
+};
+
+/**
+ * Returns an action for the DiskSpaceMonitor that kicks the maintenance pool's disk-reclaiming
+ * tasks when the available disk space drops below 'maintenanceReclaimLowDiskSpaceThresholdMB'.
+ */
+std::unique_ptr<DiskSpaceMonitor::Action> makeKickMaintenanceReclaimTasksOnLowDiskSpaceAction();
+
+}  // namespace mongo
@@ -0,0 +1,112 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/maintenance_thread_pool.h"
+
+#include <string>
+
+#include "mongo/db/client.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/future.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+class MaintenanceThreadPoolTest : public ServiceContextTest {
+protected:
+    MaintenanceThreadPool& pool() {
+        return MaintenanceThreadPool::get(getServiceContext());
+    }
+};
+
+TEST_F(MaintenanceThreadPoolTest, DispatchesTaskWhenPeriodElapses) {
+    auto pf = makePromiseFuture<void>();
+    pool().registerTask("testTask", Minutes{5}, false /*reclaimsDiskSpace*/, [&](Client* client) {
+        ASSERT(client);
+        pf.promise.emplaceValue();
+    });
+
+    // The first run is not due until one period after registration.
+    auto now = Date_t::now();
+    pool().dispatchDueTasks_forTest(now);
+    ASSERT_FALSE(pf.future.isReady());
+
+    pool().dispatchDueTasks_forTest(now + Minutes{10});
+    pf.future.get();
+
+    pool().deregisterTask("testTask");
+}
+
+TEST_F(MaintenanceThreadPoolTest, KickRunsOnlyDiskReclaimTasks) {
+    AtomicWord<bool> nonReclaimTaskRan{false};
+    auto pf = makePromiseFuture<void>();
+
+    pool().registerTask("reclaimTask", Minutes{5}, true /*reclaimsDiskSpace*/, [&](Client*) {
+        pf.promise.emplaceValue();
+    });
+    pool().registerTask("ordinaryTask", Minutes{5}, false /*reclaimsDiskSpace*/, [&](Client*) {
+        nonReclaimTaskRan.store(true);
+    });
+
+    // A kick makes the reclaim task due immediately but leaves the ordinary task waiting out its
+    // period.
+    pool().kickDiskReclaimTasks();
+    pf.future.get();
+
+    // Joining the workers guarantees that no pass is still silently in flight.
+    pool().shutdown();
+    ASSERT_FALSE(nonReclaimTaskRan.load());
+}
+
+TEST_F(MaintenanceThreadPoolTest, DeregisteredTaskDoesNotRun) {
+    AtomicWord<bool> deregisteredTaskRan{false};
+    auto pf = makePromiseFuture<void>();
+
+    pool().registerTask("keptTask", Minutes{5}, false /*reclaimsDiskSpace*/, [&](Client*) {
+        pf.promise.emplaceValue();
+    });
+    pool().registerTask("droppedTask", Minutes{5}, false /*reclaimsDiskSpace*/, [&](Client*) {
+        deregisteredTaskRan.store(true);
+    });
+    pool().deregisterTask("droppedTask");
+
+    pool().dispatchDueTasks_forTest(Date_t::now() + Minutes{10});
+    pf.future.get();
+
+    pool().shutdown();
+    ASSERT_FALSE(deregisteredTaskRan.load());
+}
+
+}  // namespace
+}  // namespace mongo
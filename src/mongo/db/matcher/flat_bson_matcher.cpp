@@ -0,0 +1,131 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/matcher/flat_bson_matcher.h"
+
+#include <cstdint>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsontypes.h"
+
+namespace mongo {
+
+namespace {
+
+/**
+ * Returns 'expr' as a ComparisonMatchExpression if it is a comparison on a non-dotted path,
+ * nullptr otherwise. Dotted paths and non-comparison leaves need the full path machinery.
+ */
+const ComparisonMatchExpression* eligibleLeaf(const MatchExpression* expr) {
+    switch (expr->matchType()) {
+        case MatchExpression::EQ:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+            break;
+        default:
+            return nullptr;
+    }
+
+    auto cmp = static_cast<const ComparisonMatchExpression*>(expr);
+    auto path = cmp->path();
+    if (path.empty() || path.find('.') != std::string::npos) {
+        return nullptr;
+    }
+    return cmp;
+}
+
+}  // namespace
+
+boost::optional<FlatBsonMatcher> FlatBsonMatcher::tryCreate(const MatchExpression* root) {
+    std::vector<Predicate> predicates;
+
+    auto addLeaf = [&](const MatchExpression* expr) {
+        auto cmp = eligibleLeaf(expr);
+        if (!cmp) {
+            return false;
+        }
+        predicates.push_back({cmp->path(), cmp});
+        return true;
+    };
+
+    if (root->matchType() == MatchExpression::AND) {
+        if (root->numChildren() == 0 || root->numChildren() > kMaxPredicates) {
+            return boost::none;
+        }
+        for (size_t i = 0; i < root->numChildren(); i++) {
+            if (!addLeaf(root->getChild(i))) {
+                return boost::none;
+            }
+        }
+    } else if (!addLeaf(root)) {
+        return boost::none;
+    }
+
+    return FlatBsonMatcher(std::move(predicates));
+}
+
+boost::optional<bool> FlatBsonMatcher::matches(const BSONObj& doc) const {
+    uint64_t seen = 0;
+    const uint64_t allSeen =
+        _predicates.size() == kMaxPredicates ? ~0ULL : (1ULL << _predicates.size()) - 1;
+
+    for (auto&& elem : doc) {
+        if (seen == allSeen) {
+            break;
+        }
+        const StringData name = elem.fieldNameStringData();
+        for (size_t i = 0; i < _predicates.size(); i++) {
+            const uint64_t bit = 1ULL << i;
+            // Only the first occurrence of a field participates, matching BSONObj::getField().
+            if ((seen & bit) || _predicates[i].fieldName != name) {
+                continue;
+            }
+            seen |= bit;
+            if (elem.type() == BSONType::Array) {
+                return boost::none;
+            }
+            if (!_predicates[i].expr->matchesSingleElement(elem)) {
+                return false;
+            }
+        }
+    }
+
+    // Predicates whose field is absent compare against the missing (EOO) element, which is how
+    // the path machinery implements e.g. equality to null on a missing field.
+    for (size_t i = 0; i < _predicates.size(); i++) {
+        if (!(seen & (1ULL << i)) && !_predicates[i].expr->matchesSingleElement(BSONElement())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace mongo
@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/expression_leaf.h"
+
+namespace mongo {
+
+/**
+ * Evaluates a conjunction of top-level comparison predicates, such as {a: {$gt: 5}, b: "x"}, in a
+ * single pass over a document's fields. MatchExpression::matchesBSON() walks the document once per
+ * leaf through the path machinery, so a filter with N predicates scans a document with F fields
+ * O(N * F) times; this matcher scans it once and dispatches to each leaf's
+ * matchesSingleElement(), which preserves the leaf's exact comparison semantics (including
+ * collation and null/missing equivalence).
+ */
+class FlatBsonMatcher {
+public:
+    // Predicate resolution state is tracked in a 64-bit mask, so wider conjunctions are not
+    // eligible.
+    static constexpr size_t kMaxPredicates = 64;
+
+    /**
+     * Returns a matcher when 'root' is a single comparison predicate ($eq, $lt, $lte, $gt, $gte)
+     * on a non-dotted path, or an $and of up to kMaxPredicates of them. Returns boost::none for
+     * any other expression shape.
+     *
+     * The returned matcher stores pointers into 'root' and must not outlive it. In-place updates
+     * to the expression, such as collator changes, are reflected by the matcher.
+     */
+    static boost::optional<FlatBsonMatcher> tryCreate(const MatchExpression* root);
+
+    /**
+     * Evaluates all predicates against 'doc' in one pass over its fields, short-circuiting as
+     * soon as a predicate fails or all predicates have been resolved. Returns boost::none when a
+     * predicate's field holds an array, whose implicit-traversal semantics this scan does not
+     * implement; the caller must then fall back to MatchExpression::matchesBSON().
+     */
+    boost::optional<bool> matches(const BSONObj& doc) const;
+
+private:
+    struct Predicate {
+        StringData fieldName;
+        const ComparisonMatchExpression* expr;
+    };
+
+    explicit FlatBsonMatcher(std::vector<Predicate> predicates)
+        : _predicates(std::move(predicates)) {}
+
+    std::vector<Predicate> _predicates;
+};
+
+}  // namespace mongo
@@ -0,0 +1,123 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/json.h"
+#include "mongo/db/matcher/flat_bson_matcher.h"
+#include "mongo/db/matcher/parsed_match_expression_for_test.h"
+#include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+void assertAgreesWithMatchesBSON(const std::string& filter,
+                                 const std::vector<std::string>& docs,
+                                 const CollatorInterface* collator = nullptr) {
+    ParsedMatchExpressionForTest expr(filter, collator);
+    auto matcher = FlatBsonMatcher::tryCreate(expr.get());
+    ASSERT(matcher) << "expected filter to be eligible: " << filter;
+    for (const auto& doc : docs) {
+        const BSONObj obj = fromjson(doc);
+        auto result = matcher->matches(obj);
+        ASSERT(result) << "unexpected fallback for doc: " << doc;
+        ASSERT_EQ(*result, expr.get()->matchesBSON(obj)) << "filter: " << filter
+                                                         << " doc: " << doc;
+    }
+}
+
+TEST(FlatBsonMatcherTest, IneligibleShapesAreRejected) {
+    ASSERT_FALSE(FlatBsonMatcher::tryCreate(ParsedMatchExpressionForTest("{}").get()));
+    ASSERT_FALSE(
+        FlatBsonMatcher::tryCreate(ParsedMatchExpressionForTest("{'a.b': 1}").get()));
+    ASSERT_FALSE(FlatBsonMatcher::tryCreate(
+        ParsedMatchExpressionForTest("{$or: [{a: 1}, {b: 1}]}").get()));
+    ASSERT_FALSE(
+        FlatBsonMatcher::tryCreate(ParsedMatchExpressionForTest("{a: {$in: [1, 2]}}").get()));
+    ASSERT_FALSE(
+        FlatBsonMatcher::tryCreate(ParsedMatchExpressionForTest("{a: {$exists: true}}").get()));
+}
+
+TEST(FlatBsonMatcherTest, SingleComparisonAgreesWithMatchesBSON) {
+    assertAgreesWithMatchesBSON("{a: {$gt: 5}}",
+                                {"{a: 6}",
+                                 "{a: 5}",
+                                 "{a: 4}",
+                                 "{a: 6.5}",
+                                 "{a: NumberLong(10)}",
+                                 "{a: 'str'}",
+                                 "{b: 6}",
+                                 "{}"});
+}
+
+TEST(FlatBsonMatcherTest, ConjunctionEvaluatesAllPredicatesInOnePass) {
+    assertAgreesWithMatchesBSON("{a: {$gt: 5}, b: 'x'}",
+                                {"{a: 6, b: 'x'}",
+                                 "{b: 'x', a: 6}",
+                                 "{a: 6, b: 'y'}",
+                                 "{a: 5, b: 'x'}",
+                                 "{a: 6}",
+                                 "{b: 'x'}",
+                                 "{a: 6, c: 1, b: 'x'}"});
+}
+
+TEST(FlatBsonMatcherTest, EqualityToNullMatchesMissingField) {
+    assertAgreesWithMatchesBSON("{a: null}", {"{}", "{a: null}", "{b: 1}", "{a: 1}"});
+}
+
+TEST(FlatBsonMatcherTest, RespectsCollator) {
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+    assertAgreesWithMatchesBSON("{a: 'foo'}", {"{a: 'FOO'}", "{a: 'bar'}"}, &collator);
+}
+
+TEST(FlatBsonMatcherTest, ArrayValueFallsBackToFullMatcher) {
+    ParsedMatchExpressionForTest expr("{a: {$gt: 5}}");
+    auto matcher = FlatBsonMatcher::tryCreate(expr.get());
+    ASSERT(matcher);
+    ASSERT_FALSE(matcher->matches(fromjson("{a: [4, 6]}")));
+}
+
+TEST(FlatBsonMatcherTest, FirstOccurrenceOfDuplicateFieldWins) {
+    ParsedMatchExpressionForTest expr("{a: 1}");
+    auto matcher = FlatBsonMatcher::tryCreate(expr.get());
+    ASSERT(matcher);
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 2);
+    const BSONObj doc = bob.obj();
+    auto result = matcher->matches(doc);
+    ASSERT(result);
+    ASSERT_EQ(*result, expr.get()->matchesBSON(doc));
+}
+
+}  // namespace
+}  // namespace mongo
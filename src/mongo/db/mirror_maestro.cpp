@@ -78,6 +78,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/future.h"
 #include "mongo/util/net/hostandport.h"
@@ -102,9 +103,14 @@ constexpr auto kMirroredReadsSentKey = "sent"_sd;
 constexpr auto kMirroredReadsProcessedAsSecondaryKey = "processedAsSecondary"_sd;
 constexpr auto kMirroredReadsResolvedKey = "resolved"_sd;
 constexpr auto kMirroredReadsResolvedBreakdownKey = "resolvedBreakdown"_sd;
+constexpr auto kMirroredReadsLatencyBreakdownKey = "latencyBreakdown"_sd;
 constexpr auto kMirroredReadsSucceededKey = "succeeded"_sd;
 constexpr auto kMirroredReadsPendingKey = "pending"_sd;
 
+// Weight given to the most recent sample in the per-host exponentially weighted moving average of
+// mirrored-read latency.
+constexpr double kMirroredReadsLatencyEwmaAlpha = 0.2;
+
 MONGO_FAIL_POINT_DEFINE(mirrorMaestroExpectsResponse);
 MONGO_FAIL_POINT_DEFINE(mirrorMaestroTracksPending);
 
@@ -219,6 +225,7 @@ public:
             // We only can see if the command resolved if we got a response
             section.append(kMirroredReadsResolvedKey, resolved.loadRelaxed());
             section.append(kMirroredReadsResolvedBreakdownKey, resolvedBreakdown.toBSON());
+            section.append(kMirroredReadsLatencyBreakdownKey, resolvedBreakdown.latencyToBSON());
             section.append(kMirroredReadsSucceededKey, succeeded.loadRelaxed());
         }
         if (MONGO_unlikely(mirrorMaestroTracksPending.shouldFail())) {
@@ -228,35 +235,62 @@ public:
     };
 
     /**
-     * Maintains a breakdown for resolved requests by host name.
-     * This class may only be used for testing (e.g., as part of a fail-point).
+     * Maintains a breakdown for resolved requests by host name, along with an exponentially
+     * weighted moving average of each host's mirrored-read latency. The latency average gives a
+     * cheap signal for how warm a secondary's caches are (e.g. after a restart) relative to its
+     * peers. This class may only be used for testing (e.g., as part of a fail-point).
      */
     class ResolvedBreakdownByHost {
     public:
-        void onResponseReceived(const HostAndPort& host) noexcept {
+        void onResponseReceived(const HostAndPort& host,
+                                boost::optional<Microseconds> elapsed) noexcept {
             const auto hostName = host.toString();
             stdx::lock_guard<Mutex> lk(_mutex);
 
-            if (_resolved.find(hostName) == _resolved.end()) {
-                _resolved[hostName] = 0;
-            }
+            auto& stats = _statsByHost[hostName];
+            stats.resolved++;
 
-            _resolved[hostName]++;
+            if (elapsed) {
+                const auto micros = static_cast<double>(durationCount<Microseconds>(*elapsed));
+                if (stats.latencyEwmaMicros) {
+                    stats.latencyEwmaMicros = kMirroredReadsLatencyEwmaAlpha * micros +
+                        (1 - kMirroredReadsLatencyEwmaAlpha) * *stats.latencyEwmaMicros;
+                } else {
+                    stats.latencyEwmaMicros = micros;
+                }
+            }
         }
 
         BSONObj toBSON() const noexcept {
             stdx::lock_guard<Mutex> lk(_mutex);
             BSONObjBuilder bob;
-            for (const auto& entry : _resolved) {
-                bob.append(entry.first, entry.second);
+            for (const auto& entry : _statsByHost) {
+                bob.append(entry.first, entry.second.resolved);
+            }
+            return bob.obj();
+        }
+
+        BSONObj latencyToBSON() const noexcept {
+            stdx::lock_guard<Mutex> lk(_mutex);
+            BSONObjBuilder bob;
+            for (const auto& entry : _statsByHost) {
+                if (entry.second.latencyEwmaMicros) {
+                    bob.append(entry.first,
+                               static_cast<long long>(*entry.second.latencyEwmaMicros));
+                }
             }
             return bob.obj();
         }
 
     private:
+        struct HostStats {
+            CounterT resolved = 0;
+            boost::optional<double> latencyEwmaMicros;
+        };
+
         mutable Mutex _mutex = MONGO_MAKE_LATCH("ResolvedBreakdownByHost"_sd);
 
-        stdx::unordered_map<std::string, CounterT> _resolved;
+        stdx::unordered_map<std::string, HostStats> _statsByHost;
     };
 
     ResolvedBreakdownByHost resolvedBreakdown;
@@ -459,7 +493,8 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
 
             // Count both failed and successful reads as resolved
             gMirroredReadsSection.resolved.fetchAndAdd(1);
-            gMirroredReadsSection.resolvedBreakdown.onResponseReceived(host);
+            gMirroredReadsSection.resolvedBreakdown.onResponseReceived(host,
+                                                                       args.response.elapsed);
 
             if (getStatusFromCommandResult(args.response.data).isOK()) {
                 gMirroredReadsSection.succeeded.fetchAndAdd(1);
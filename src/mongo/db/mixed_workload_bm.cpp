@@ -0,0 +1,479 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_impl.h"
+#include "mongo/db/catalog/create_collection.h"
+#include "mongo/db/catalog/database_holder.h"
+#include "mongo/db/catalog/database_holder_impl.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/d_concurrency.h"
+#include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/cursor_manager.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/global_settings.h"
+#include "mongo/db/index_builds_coordinator.h"
+#include "mongo/db/index_builds_coordinator_mongod.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/op_observer/op_observer.h"
+#include "mongo/db/op_observer/op_observer_impl.h"
+#include "mongo/db/op_observer/op_observer_registry.h"
+#include "mongo/db/op_observer/operation_logger_impl.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/drop_pending_collection_reaper.h"
+#include "mongo/db/repl/member_state.h"
+#include "mongo/db/repl/oplog.h"
+#include "mongo/db/repl/repl_settings.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/repl/storage_interface.h"
+#include "mongo/db/repl/storage_interface_impl.h"
+#include "mongo/db/s/collection_sharding_state.h"
+#include "mongo/db/s/collection_sharding_state_factory_shard.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/service_entry_point_shard_role.h"
+#include "mongo/db/session/session_catalog.h"
+#include "mongo/db/session/session_catalog_mongod.h"
+#include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/db/transaction/session_catalog_mongod_transaction_interface_impl.h"
+#include "mongo/logv2/log_component.h"
+#include "mongo/logv2/log_component_settings.h"
+#include "mongo/logv2/log_manager.h"
+#include "mongo/logv2/log_severity.h"
+#include "mongo/platform/random.h"
+#include "mongo/s/sharding_state.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/clock_source_mock.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/periodic_runner.h"
+#include "mongo/util/periodic_runner_factory.h"
+#include "mongo/util/timer.h"
+#include "mongo/util/version/releases.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * In-process macro-benchmark that drives mixed workloads through the server's full write and
+ * query paths via DBDirectClient: point reads, batched inserts, aggregations and index builds,
+ * each reported as a separate benchmark case so regressions can be attributed per operation
+ * class. The service context setup mirrors the oplog application benchmarks: a real WiredTiger
+ * storage engine on a temporary dbpath with a mocked replication coordinator acting as primary.
+ */
+class TestServiceContext {
+public:
+    TestServiceContext() {
+        // Disable server info logging so that the benchmark output is cleaner.
+        logv2::LogManager::global().getGlobalSettings().setMinimumLoggedSeverity(
+            mongo::logv2::LogComponent::kDefault, mongo::logv2::LogSeverity::Error());
+
+        // (Generic FCV reference): Test latest FCV behavior. This FCV reference should exist across
+        // LTS binary versions.
+        serverGlobalParams.mutableFCV.setVersion(multiversion::GenericFCV::kLatest);
+
+        if (haveClient()) {
+            Client::releaseCurrent();
+        }
+        setGlobalServiceContext(ServiceContext::make());
+        _svcCtx = getGlobalServiceContext();
+
+        _svcCtx->getService()->setServiceEntryPoint(std::make_unique<ServiceEntryPointShardRole>());
+
+        auto fastClock = std::make_unique<ClockSourceMock>();
+        // Timestamps are split into two 32-bit integers, seconds and "increments". Currently (but
+        // maybe not for eternity), a Timestamp with a value of `0` seconds is always considered
+        // "null" by `Timestamp::isNull`, regardless of its increment value. Ticking the
+        // `ClockSourceMock` only bumps the "increment" counter, thus by default, generating "null"
+        // timestamps. Bumping by one second here avoids any accidental interpretations.
+        fastClock->advance(Seconds(1));
+        _svcCtx->setFastClockSource(std::move(fastClock));
+
+        auto preciseClock = std::make_unique<ClockSourceMock>();
+        // See above.
+        preciseClock->advance(Seconds(1));
+        CursorManager::get(_svcCtx)->setPreciseClockSource(preciseClock.get());
+        _svcCtx->setPreciseClockSource(std::move(preciseClock));
+
+        auto runner = makePeriodicRunner(_svcCtx);
+        _svcCtx->setPeriodicRunner(std::move(runner));
+
+        Collection::Factory::set(_svcCtx, std::make_unique<CollectionImpl::FactoryImpl>());
+        storageGlobalParams.engine = "wiredTiger";
+        storageGlobalParams.engineSetByUser = true;
+
+        _tempDir.emplace("mixed_workload_bm_data");
+        storageGlobalParams.dbpath = _tempDir->path();
+        storageGlobalParams.ephemeral = false;
+
+        Client::initThread("mixed workload main", getGlobalServiceContext()->getService());
+        _client = Client::getCurrent();
+
+        repl::ReplSettings replSettings;
+        replSettings.setOplogSizeBytes(1024 * 1024 * 1024);
+        replSettings.setReplSetString("mixed workload benchmark replset");
+        setGlobalReplSettings(replSettings);
+        _replCoord = new repl::ReplicationCoordinatorMock(_svcCtx, replSettings);
+        repl::ReplicationCoordinator::set(
+            _svcCtx, std::unique_ptr<repl::ReplicationCoordinator>(_replCoord));
+
+        // Disable fast shutdown so that WT can free memory.
+        globalFailPointRegistry().find("WTDisableFastShutDown")->setMode(FailPoint::alwaysOn);
+
+        auto startupOpCtx = _svcCtx->makeOperationContext(&cc());
+        initializeStorageEngine(startupOpCtx.get(),
+                                StorageEngineInitFlags::kAllowNoLockFile |
+                                    StorageEngineInitFlags::kSkipMetadataFile);
+        DatabaseHolder::set(_svcCtx, std::make_unique<DatabaseHolderImpl>());
+        repl::StorageInterface::set(_svcCtx, std::make_unique<repl::StorageInterfaceImpl>());
+
+        repl::DropPendingCollectionReaper::set(
+            _svcCtx,
+            std::make_unique<repl::DropPendingCollectionReaper>(
+                repl::StorageInterface::get(_svcCtx)));
+        IndexBuildsCoordinator::set(_svcCtx, std::make_unique<IndexBuildsCoordinatorMongod>());
+
+        auto registry = std::make_unique<OpObserverRegistry>();
+        registry->addObserver(
+            std::make_unique<OpObserverImpl>(std::make_unique<OperationLoggerImpl>()));
+        _svcCtx->setOpObserver(std::move(registry));
+        ShardingState::create(_svcCtx);
+        CollectionShardingStateFactory::set(
+            _svcCtx, std::make_unique<CollectionShardingStateFactoryShard>(_svcCtx));
+
+        MongoDSessionCatalog::set(
+            _svcCtx,
+            std::make_unique<MongoDSessionCatalog>(
+                std::make_unique<MongoDSessionCatalogTransactionInterfaceImpl>()));
+
+        _svcCtx->notifyStorageStartupRecoveryComplete();
+
+        _replCoord->setFollowerMode(repl::MemberState::RS_PRIMARY).ignore();
+        {
+            auto opCtxRaii = _svcCtx->makeOperationContext(&cc());
+            repl::createOplog(opCtxRaii.get());
+        }
+    }
+
+    ~TestServiceContext() {
+        {
+            ServiceContext::UniqueOperationContext uniqueOpCtx;
+            auto opCtx = _client->getOperationContext();
+            if (!opCtx) {
+                uniqueOpCtx = _client->makeOperationContext();
+                opCtx = uniqueOpCtx.get();
+            }
+
+            Lock::GlobalLock lk(opCtx, LockMode::MODE_X);
+
+            SessionCatalog::get(_svcCtx)->reset_forTest();
+
+            auto databaseHolder = DatabaseHolder::get(opCtx);
+            databaseHolder->closeAll(opCtx);
+
+            shutdownGlobalStorageEngineCleanly(_svcCtx);
+        }
+        if (haveClient()) {
+            Client::releaseCurrent();
+        }
+    }
+
+    ServiceContext* getSvcCtx() {
+        return _svcCtx;
+    }
+
+    Client* getClient() {
+        return _client;
+    }
+
+private:
+    ServiceContext* _svcCtx;
+    Client* _client;
+    repl::ReplicationCoordinatorMock* _replCoord;
+    boost::optional<unittest::TempDir> _tempDir;
+};
+
+BSONObj makeDoc(int64_t idx, int64_t payloadSize) {
+    std::string payload;
+    payload.resize(payloadSize, 'x');
+    return BSON("_id" << idx << "value" << idx << "payload" << payload);
+}
+
+/**
+ * Creates the benchmark collection with a secondary index on 'value' and bulk loads 'numDocs'
+ * documents of roughly 'payloadSize' bytes each through the insert command.
+ */
+class Fixture {
+public:
+    Fixture(TestServiceContext* testSvcCtx, int64_t numDocs, int64_t payloadSize)
+        : _testSvcCtx(testSvcCtx), _numDocs(numDocs), _payloadSize(payloadSize) {
+        auto opCtxRaii = _testSvcCtx->getSvcCtx()->makeOperationContext(_testSvcCtx->getClient());
+        auto opCtx = opCtxRaii.get();
+
+        DBDirectClient client(opCtx);
+        client.createCollection(kNss);
+        client.createIndex(kNss, BSON("value" << 1));
+
+        std::vector<BSONObj> batch;
+        batch.reserve(kLoadBatchSize);
+        for (int64_t idx = 0; idx < _numDocs; ++idx) {
+            batch.push_back(makeDoc(idx, _payloadSize));
+            if (batch.size() == kLoadBatchSize || idx + 1 == _numDocs) {
+                insertBatch(opCtx, batch);
+                batch.clear();
+            }
+        }
+    }
+
+    void insertBatch(OperationContext* opCtx, const std::vector<BSONObj>& docs) {
+        DBDirectClient client(opCtx);
+        write_ops::InsertCommandRequest insertOp(kNss);
+        insertOp.setDocuments(docs);
+        auto reply = client.insert(insertOp);
+        invariant(!reply.getWriteErrors());
+    }
+
+    BSONObj pointRead(OperationContext* opCtx, int64_t key) {
+        DBDirectClient client(opCtx);
+        return client.findOne(kNss, BSON("_id" << key));
+    }
+
+    void aggregate(OperationContext* opCtx) {
+        DBDirectClient client(opCtx);
+        BSONObj result;
+        auto ok = client.runCommand(
+            kNss.dbName(),
+            BSON("aggregate" << kNss.coll() << "pipeline"
+                             << BSON_ARRAY(BSON("$match" << BSON("value" << BSON("$gte" << 0)))
+                                           << BSON("$group" << BSON("_id" << BSONNULL << "total"
+                                                                          << BSON("$sum"
+                                                                                  << "$value"))))
+                             << "cursor" << BSONObj()),
+            result);
+        invariant(ok, result.toString());
+    }
+
+    void buildIndex(OperationContext* opCtx, const std::string& fieldName) {
+        DBDirectClient client(opCtx);
+        BSONObj result;
+        // Commit quorum is disabled since the mocked replication coordinator has no electable
+        // secondaries to vote on commit readiness.
+        auto ok = client.runCommand(
+            kNss.dbName(),
+            BSON("createIndexes"
+                 << kNss.coll() << "indexes"
+                 << BSON_ARRAY(BSON("key" << BSON(fieldName << 1) << "name" << fieldName + "_1"))
+                 << "commitQuorum" << 0),
+            result);
+        invariant(ok, result.toString());
+    }
+
+    void dropIndex(OperationContext* opCtx, const std::string& fieldName) {
+        DBDirectClient client(opCtx);
+        BSONObj result;
+        auto ok = client.runCommand(
+            kNss.dbName(),
+            BSON("dropIndexes" << kNss.coll() << "index" << fieldName + "_1"),
+            result);
+        invariant(ok, result.toString());
+    }
+
+    int64_t numDocs() const {
+        return _numDocs;
+    }
+
+    int64_t payloadSize() const {
+        return _payloadSize;
+    }
+
+    static inline const NamespaceString kNss =
+        NamespaceString::createNamespaceString_forTest("mixed_workload.coll");
+
+private:
+    static constexpr std::size_t kLoadBatchSize = 1000;
+
+    TestServiceContext* _testSvcCtx;
+    int64_t _numDocs;
+    int64_t _payloadSize;
+};
+
+// Input: numDocs | payloadSize
+void BM_PointRead(benchmark::State& state) {
+    TestServiceContext testSvcCtx;
+    Fixture fixture(&testSvcCtx, state.range(0), state.range(1));
+
+    auto opCtxRaii = testSvcCtx.getSvcCtx()->makeOperationContext(testSvcCtx.getClient());
+    PseudoRandom prng(1729 /* seed */);
+    for (auto _ : state) {
+        auto doc = fixture.pointRead(opCtxRaii.get(), prng.nextInt64(fixture.numDocs()));
+        benchmark::DoNotOptimize(doc);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Input: batchSize | payloadSize
+void BM_BatchedInsert(benchmark::State& state) {
+    TestServiceContext testSvcCtx;
+    Fixture fixture(&testSvcCtx, 0 /* numDocs */, state.range(1));
+
+    auto opCtxRaii = testSvcCtx.getSvcCtx()->makeOperationContext(testSvcCtx.getClient());
+    const int64_t batchSize = state.range(0);
+    int64_t nextId = 0;
+    std::vector<BSONObj> batch;
+    batch.reserve(batchSize);
+    for (auto _ : state) {
+        state.PauseTiming();
+        batch.clear();
+        for (int64_t i = 0; i < batchSize; ++i) {
+            batch.push_back(makeDoc(nextId++, fixture.payloadSize()));
+        }
+        state.ResumeTiming();
+        fixture.insertBatch(opCtxRaii.get(), batch);
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
+// Input: numDocs | payloadSize
+void BM_Aggregation(benchmark::State& state) {
+    TestServiceContext testSvcCtx;
+    Fixture fixture(&testSvcCtx, state.range(0), state.range(1));
+
+    auto opCtxRaii = testSvcCtx.getSvcCtx()->makeOperationContext(testSvcCtx.getClient());
+    for (auto _ : state) {
+        fixture.aggregate(opCtxRaii.get());
+    }
+    state.SetItemsProcessed(state.iterations() * fixture.numDocs());
+}
+
+// Input: numDocs | payloadSize
+void BM_IndexBuild(benchmark::State& state) {
+    TestServiceContext testSvcCtx;
+    Fixture fixture(&testSvcCtx, state.range(0), state.range(1));
+
+    auto opCtxRaii = testSvcCtx.getSvcCtx()->makeOperationContext(testSvcCtx.getClient());
+    for (auto _ : state) {
+        Timer timer;
+        fixture.buildIndex(opCtxRaii.get(), "payload");
+        state.SetIterationTime(durationCount<Microseconds>(timer.elapsed()) / 1E6);
+        fixture.dropIndex(opCtxRaii.get(), "payload");
+    }
+    state.SetItemsProcessed(state.iterations() * fixture.numDocs());
+}
+
+// Interleaves point reads and batched inserts at a given read percentage, attributing time to
+// each class through per-class rate counters in addition to the overall iteration time.
+// Input: numDocs | payloadSize | readPercent | insertBatchSize
+void BM_MixedReadInsert(benchmark::State& state) {
+    TestServiceContext testSvcCtx;
+    Fixture fixture(&testSvcCtx, state.range(0), state.range(1));
+
+    auto opCtxRaii = testSvcCtx.getSvcCtx()->makeOperationContext(testSvcCtx.getClient());
+    PseudoRandom prng(1729 /* seed */);
+    const int64_t readPercent = state.range(2);
+    const int64_t batchSize = state.range(3);
+    int64_t nextId = fixture.numDocs();
+    int64_t readMicros = 0, readOps = 0;
+    int64_t insertMicros = 0, insertOps = 0;
+    for (auto _ : state) {
+        if (prng.nextInt64(100) < readPercent) {
+            Timer timer;
+            auto doc = fixture.pointRead(opCtxRaii.get(), prng.nextInt64(fixture.numDocs()));
+            readMicros += durationCount<Microseconds>(timer.elapsed());
+            ++readOps;
+            benchmark::DoNotOptimize(doc);
+        } else {
+            state.PauseTiming();
+            std::vector<BSONObj> batch;
+            batch.reserve(batchSize);
+            for (int64_t i = 0; i < batchSize; ++i) {
+                batch.push_back(makeDoc(nextId++, fixture.payloadSize()));
+            }
+            state.ResumeTiming();
+            Timer timer;
+            fixture.insertBatch(opCtxRaii.get(), batch);
+            insertMicros += durationCount<Microseconds>(timer.elapsed());
+            ++insertOps;
+        }
+    }
+    if (readOps > 0) {
+        state.counters["readMicrosPerOp"] = static_cast<double>(readMicros) / readOps;
+    }
+    if (insertOps > 0) {
+        state.counters["insertMicrosPerBatch"] = static_cast<double>(insertMicros) / insertOps;
+    }
+    state.SetItemsProcessed(readOps + insertOps * batchSize);
+}
+
+BENCHMARK(BM_PointRead)
+    ->Args({10 * 1000, 256})
+    ->Args({100 * 1000, 256})
+    ->Args({100 * 1000, 4 * 1024})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BatchedInsert)
+    ->Args({1, 256})
+    ->Args({10, 256})
+    ->Args({100, 256})
+    ->Args({1000, 256})
+    ->Args({100, 4 * 1024})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Aggregation)
+    ->Args({10 * 1000, 256})
+    ->Args({100 * 1000, 256})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_IndexBuild)
+    ->Args({10 * 1000, 256})
+    ->Args({100 * 1000, 256})
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_MixedReadInsert)
+    ->Args({100 * 1000, 256, 50, 100})
+    ->Args({100 * 1000, 256, 90, 100})
+    ->Args({100 * 1000, 256, 99, 100})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace mongo
@@ -91,6 +91,7 @@
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/cluster_role.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/commands/auto_compact.h"
 #include "mongo/db/commands/feature_compatibility_version.h"
 #include "mongo/db/commands/feature_compatibility_version_gen.h"
 #include "mongo/db/commands/fsync.h"
@@ -117,6 +118,7 @@
 #include "mongo/db/log_process_details.h"
 #include "mongo/db/logical_session_cache_factory_mongod.h"
 #include "mongo/db/logical_time_validator.h"
+#include "mongo/db/maintenance_thread_pool.h"
 #include "mongo/db/mirror_maestro.h"
 #include "mongo/db/mongod_options.h"
 #include "mongo/db/mongod_options_storage_gen.h"
@@ -1044,6 +1046,8 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
         auto diskMonitor = DiskSpaceMonitor::get(serviceContext);
         diskMonitor->registerAction(
             IndexBuildsCoordinator::get(serviceContext)->makeKillIndexBuildOnLowDiskSpaceAction());
+        diskMonitor->registerAction(makeEnableAutoCompactOnLowDiskSpaceAction());
+        diskMonitor->registerAction(makeKickMaintenanceReclaimTasksOnLowDiskSpaceAction());
     }
 
     startClientCursorMonitor();
@@ -1098,6 +1102,9 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
             startupOpCtx.get(), isStandalone, lastShutdownState);
     }
 
+    // Start the shared maintenance pool before any periodic maintenance tasks register with it.
+    MaintenanceThreadPool::get(serviceContext).start(serviceContext);
+
     // If not in standalone mode, start background tasks to:
     //  * Periodically remove expired pre-images from the 'system.preimages'
     //  * Periodically remove expired documents from change collections
@@ -1737,6 +1744,8 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
 
     DiskSpaceMonitor::stop(serviceContext);
 
+    MaintenanceThreadPool::get(serviceContext).shutdown();
+
     {
         TimeElapsedBuilderScopedTimer scopedTimer(serviceContext->getFastClockSource(),
                                                   "Shut down FLE Crud subsystem",
@@ -30,9 +30,12 @@
 #include "mongo/db/op_observer/find_and_modify_images_op_observer.h"
 
 #include "mongo/db/catalog/document_validation.h"
-#include "mongo/db/curop.h"
-#include "mongo/db/dbhelpers.h"
+#include "mongo/db/exec/update_stage.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/ops/parsed_update.h"
+#include "mongo/db/ops/update_request.h"
+#include "mongo/db/ops/update_result.h"
+#include "mongo/db/query/internal_plans.h"
 #include "mongo/db/repl/image_collection_entry_gen.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/session/logical_session_id_gen.h"
@@ -85,13 +88,33 @@ void writeToImageCollection(OperationContext* opCtx, OpStateAccumulator* opAccum
                                      repl::ReadConcernArgs::get(opCtx),
                                      AcquisitionPrerequisites::kWrite),
         MODE_IX);
-    auto curOp = CurOp::get(opCtx);
-    const auto existingNs = curOp->getNSS();
-    UpdateResult res = Helpers::upsert(opCtx, collection, imageEntry.toBSON());
-    {
-        stdx::lock_guard<Client> clientLock(*opCtx->getClient());
-        curOp->setNS_inlock(existingNs);
-    }
+
+    // This write runs once per retryable findAndModify inside the user operation's storage
+    // transaction, so perform the upsert directly through the _id index rather than paying query
+    // canonicalization and plan selection for an exact _id point write.
+    UpdateRequest request;
+    request.setNamespaceString(NamespaceString::kConfigImagesNamespace);
+    request.setQuery(BSON("_id" << sessionId.toBSON()));
+    request.setUpsert(true);
+    request.setUpdateModification(
+        write_ops::UpdateModification::parseFromClassicUpdate(imageEntry.toBSON()));
+
+    ParsedUpdate parsedUpdate(opCtx, &request, collection.getCollectionPtr());
+    uassertStatusOK(parsedUpdate.parseRequest());
+
+    const auto idIndexDesc =
+        collection.getCollectionPtr()->getIndexCatalog()->findIdIndex(opCtx);
+    invariant(idIndexDesc, "config.image_collection must have an _id index");
+
+    UpdateStageParams updateStageParams(parsedUpdate.getRequest(), parsedUpdate.getDriver(),
+                                        nullptr);
+    auto planExecutor = InternalPlanner::updateWithIdHack(opCtx,
+                                                          collection,
+                                                          updateStageParams,
+                                                          idIndexDesc,
+                                                          BSON("" << sessionId.toBSON()),
+                                                          parsedUpdate.yieldPolicy());
+    UpdateResult res = planExecutor->executeUpdate();
 
     invariant(res.numDocsModified == 1 || !res.upsertedId.isEmpty());
 }
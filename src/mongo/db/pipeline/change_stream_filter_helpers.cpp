@@ -57,6 +57,47 @@
 
 namespace mongo {
 namespace change_stream_filter {
+namespace {
+/**
+ * Appends a predicate on 'fieldName' which matches the namespace(s) that this change stream is
+ * watching. A single-collection stream watches exactly one namespace, so the predicate is a plain
+ * string equality. These predicates gate the per-event branches of the oplog filter and so are
+ * evaluated against every entry scanned, where an equality comparison is considerably cheaper than
+ * executing an anchored regex. All other stream types watch a family of namespaces and must use
+ * the regex.
+ */
+void appendNsMatch(BSONObjBuilder* builder,
+                   StringData fieldName,
+                   const boost::intrusive_ptr<ExpressionContext>& expCtx) {
+    if (DocumentSourceChangeStream::getChangeStreamType(expCtx->ns) ==
+        DocumentSourceChangeStream::ChangeStreamType::kSingleCollection) {
+        builder->append(fieldName,
+                        NamespaceStringUtil::serialize(expCtx->ns, expCtx->serializationCtxt));
+    } else {
+        builder->append(fieldName,
+                        BSONRegEx(DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx)));
+    }
+}
+
+/**
+ * As above, but for the command namespace. Single-collection and single-database streams target
+ * the single '<db>.$cmd' namespace and match it exactly; a whole-cluster stream uses the regex.
+ */
+void appendCmdNsMatch(BSONObjBuilder* builder,
+                      StringData fieldName,
+                      const boost::intrusive_ptr<ExpressionContext>& expCtx) {
+    if (DocumentSourceChangeStream::getChangeStreamType(expCtx->ns) ==
+        DocumentSourceChangeStream::ChangeStreamType::kAllChangesForCluster) {
+        builder->append(
+            fieldName,
+            BSONRegEx(DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx)));
+    } else {
+        builder->append(fieldName,
+                        NamespaceStringUtil::serialize(expCtx->ns.getCommandNS(),
+                                                       SerializationContext::stateDefault()));
+    }
+}
+}  // namespace
 
 std::unique_ptr<MatchExpression> buildTsFilter(
     const boost::intrusive_ptr<ExpressionContext>& expCtx,
@@ -71,14 +112,15 @@ std::unique_ptr<MatchExpression> buildFromMigrateSystemOpFilter(
     const boost::intrusive_ptr<ExpressionContext>& expCtx,
     const MatchExpression* userMatch,
     std::vector<BSONObj>& backingBsonObjs) {
-    auto cmdNsRegex = DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx);
-
     // The filter {fromMigrate:true} allows quickly skip nonrelevant oplog entries
     auto andMigrateEvents = std::make_unique<AndMatchExpression>();
     andMigrateEvents->add(MatchExpressionParser::parseAndNormalize(
         backingBsonObjs.emplace_back(BSON("fromMigrate" << true)), expCtx));
+
+    BSONObjBuilder cmdNsBuilder;
+    appendCmdNsMatch(&cmdNsBuilder, "ns", expCtx);
     andMigrateEvents->add(MatchExpressionParser::parseAndNormalize(
-        backingBsonObjs.emplace_back(BSON("ns" << BSONRegEx(cmdNsRegex))), expCtx));
+        backingBsonObjs.emplace_back(cmdNsBuilder.obj()), expCtx));
 
     auto orMigrateEvents = std::make_unique<OrMatchExpression>();
     auto collRegex = DocumentSourceChangeStream::getCollRegexForChangeStream(expCtx);
@@ -113,9 +155,10 @@ std::unique_ptr<MatchExpression> buildOperationFilter(
     std::vector<BSONObj>& backingBsonObjs) {
 
     // Regexes to match each of the necessary namespace components for the current stream type.
+    // Note that the top-level 'ns' predicates are built by the appendNsMatch helpers, which
+    // substitute an exact string match when the stream targets a single namespace.
     auto nsRegex = DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx);
     auto collRegex = DocumentSourceChangeStream::getCollRegexForChangeStream(expCtx);
-    auto cmdNsRegex = DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx);
 
     auto streamType = DocumentSourceChangeStream::getChangeStreamType(expCtx->ns);
 
@@ -145,16 +188,20 @@ std::unique_ptr<MatchExpression> buildOperationFilter(
     std::unique_ptr<ListOfMatchExpression> operationFilter = std::make_unique<OrMatchExpression>();
 
     // (1) CRUD events on a monitored namespace.
-    auto crudEvents = backingBsonObjs.emplace_back(BSON("ns" << BSONRegEx(nsRegex) << "$nor"
-                                                             << BSON_ARRAY(BSON("op"
-                                                                                << "n")
-                                                                           << BSON("op"
-                                                                                   << "c"))));
+    BSONObjBuilder crudEventsBuilder;
+    appendNsMatch(&crudEventsBuilder, "ns", expCtx);
+    crudEventsBuilder.append("$nor",
+                             BSON_ARRAY(BSON("op"
+                                             << "n")
+                                        << BSON("op"
+                                                << "c")));
+    auto crudEvents = backingBsonObjs.emplace_back(crudEventsBuilder.obj());
 
     // (2.1) The namespace for matching relevant commands.
-    auto cmdNsMatch = backingBsonObjs.emplace_back(BSON("op"
-                                                        << "c"
-                                                        << "ns" << BSONRegEx(cmdNsRegex)));
+    BSONObjBuilder cmdNsBuilder;
+    cmdNsBuilder.append("op", "c");
+    appendCmdNsMatch(&cmdNsBuilder, "ns", expCtx);
+    auto cmdNsMatch = backingBsonObjs.emplace_back(cmdNsBuilder.obj());
 
     // (2.2) Commands that are run on a monitored database and/or collection.
     auto dropEvent = backingBsonObjs.emplace_back(BSON("o.drop" << BSONRegEx(collRegex)));
@@ -275,8 +322,6 @@ std::unique_ptr<MatchExpression> buildTransactionFilter(
     std::vector<BSONObj>& backingBsonObjs) {
     BSONObjBuilder applyOpsBuilder;
 
-    auto nsRegex = DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx);
-
     // "o.applyOps" stores the list of operations, so it must be an array.
     applyOpsBuilder.append("op", "c");
     applyOpsBuilder.append("o.applyOps",
@@ -294,7 +339,9 @@ std::unique_ptr<MatchExpression> buildTransactionFilter(
             auto cmdNsRegex = DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx);
 
             // Match relevant CRUD events on the monitored namespaces.
-            orBuilder.append(BSON("o.applyOps.ns" << BSONRegEx(nsRegex)));
+            BSONObjBuilder applyOpsNsBuilder;
+            appendNsMatch(&applyOpsNsBuilder, "o.applyOps.ns", expCtx);
+            orBuilder.append(applyOpsNsBuilder.obj());
 
             // Match relevant command events on the monitored namespaces.
             orBuilder.append(BSON(
@@ -312,9 +359,10 @@ std::unique_ptr<MatchExpression> buildTransactionFilter(
         }
     }
     auto applyOpsFilter = applyOpsBuilder.obj();
-    auto endOfTransactionFilter = BSON("op"
-                                       << "n"
-                                       << "o2.endOfTransaction" << BSONRegEx(nsRegex));
+    BSONObjBuilder endOfTransactionBuilder;
+    endOfTransactionBuilder.append("op", "n");
+    appendNsMatch(&endOfTransactionBuilder, "o2.endOfTransaction", expCtx);
+    auto endOfTransactionFilter = endOfTransactionBuilder.obj();
     auto commitTransactionFilter = BSON("op"
                                         << "c"
                                         << "o.commitTransaction" << 1);
@@ -372,13 +420,12 @@ std::unique_ptr<MatchExpression> buildInternalOpFilter(
     // Finalize the array of $or filter predicates.
     internalOpTypeOrBuilder.done();
 
-    auto nsRegex = DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx);
+    BSONObjBuilder internalOpBuilder;
+    internalOpBuilder.append("op", "n");
+    appendNsMatch(&internalOpBuilder, "ns", expCtx);
+    internalOpBuilder.append("$or", internalOpTypeOrBuilder.arr());
     return MatchExpressionParser::parseAndNormalize(
-        backingBsonObjs.emplace_back(BSON("op"
-                                          << "n"
-                                          << "ns" << BSONRegEx(nsRegex) << "$or"
-                                          << internalOpTypeOrBuilder.arr())),
-        expCtx);
+        backingBsonObjs.emplace_back(internalOpBuilder.obj()), expCtx);
 }
 
 BSONObj getMatchFilterForClassicOperationTypes() {
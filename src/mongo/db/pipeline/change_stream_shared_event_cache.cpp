@@ -0,0 +1,97 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/pipeline/change_stream_shared_event_cache.h"
+
+#include <mutex>
+
+#include "mongo/db/pipeline/change_stream_shared_event_cache_gen.h"
+
+namespace mongo {
+namespace {
+
+const auto getSharedEventCache =
+    ServiceContext::declareDecoration<ChangeStreamSharedEventCache>();
+
+}  // namespace
+
+ChangeStreamSharedEventCache& ChangeStreamSharedEventCache::get(ServiceContext* serviceContext) {
+    return getSharedEventCache(serviceContext);
+}
+
+bool ChangeStreamSharedEventCache::isEnabled() {
+    return gChangeStreamSharedEventCacheMB.load() > 0;
+}
+
+size_t ChangeStreamSharedEventCache::_partitionByteBudget() {
+    return static_cast<size_t>(gChangeStreamSharedEventCacheMB.load()) * 1024 * 1024 /
+        kNumPartitions;
+}
+
+boost::optional<BSONObj> ChangeStreamSharedEventCache::lookup(const Key& key) {
+    auto& partition = _partitionFor(key);
+    stdx::lock_guard<Latch> lk(partition.mutex);
+    auto it = partition.entries.find(key);
+    if (it == partition.entries.end()) {
+        return boost::none;
+    }
+    partition.lru.splice(partition.lru.begin(), partition.lru, it->second);
+    return it->second->second;
+}
+
+void ChangeStreamSharedEventCache::insert(const Key& key, BSONObj event) {
+    const size_t eventBytes = static_cast<size_t>(event.objsize());
+    const size_t budget = _partitionByteBudget();
+    if (eventBytes > kMaxCachedEventBytes || eventBytes > budget) {
+        return;
+    }
+
+    // The cached copy is shared across threads, so it must own its buffer.
+    event = event.getOwned();
+
+    auto& partition = _partitionFor(key);
+    stdx::lock_guard<Latch> lk(partition.mutex);
+    if (partition.entries.contains(key)) {
+        // Another subscriber already cached this event; theirs is identical to ours.
+        return;
+    }
+
+    while (partition.bytesUsed + eventBytes > budget && !partition.lru.empty()) {
+        auto& victim = partition.lru.back();
+        partition.bytesUsed -= static_cast<size_t>(victim.second.objsize());
+        partition.entries.erase(victim.first);
+        partition.lru.pop_back();
+    }
+
+    partition.lru.emplace_front(key, std::move(event));
+    partition.entries[key] = partition.lru.begin();
+    partition.bytesUsed += eventBytes;
+}
+
+}  // namespace mongo
@@ -0,0 +1,142 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <utility>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+
+namespace mongo {
+
+/**
+ * A process-wide cache of fully materialized change stream events, shared between cursors
+ * watching the same oplog entries.
+ *
+ * When many near-identical change streams are open against one deployment, each cursor's
+ * transform stage independently turns the same oplog entry into the same change event and resume
+ * token. Caching the transformed event (serialized together with its sort-key metadata) lets the
+ * first subscriber pay for the transformation while all others share the immutable result.
+ * Entries are keyed by the oplog timestamp and transaction operation index, which uniquely
+ * identify an operation on this node, plus the spec options that influence the rendered event.
+ *
+ * The cache is disabled unless 'changeStreamSharedEventCacheMB' is set: sharing only pays off in
+ * fan-out deployments, while a lone stream would pay the extra event serialization on every miss.
+ */
+class ChangeStreamSharedEventCache {
+public:
+    struct Key {
+        // Identify the oplog operation the event was rendered from.
+        Timestamp clusterTime;
+        long long txnOpIndex = 0;
+
+        // Spec options that change the shape of the rendered event or its resume token.
+        int tokenVersion = 0;
+        bool showExpandedEvents = false;
+        bool showRawUpdateDescription = false;
+        int fullDocumentMode = 0;
+        int fullDocumentBeforeChangeMode = 0;
+
+        bool operator==(const Key& other) const {
+            return clusterTime == other.clusterTime && txnOpIndex == other.txnOpIndex &&
+                tokenVersion == other.tokenVersion &&
+                showExpandedEvents == other.showExpandedEvents &&
+                showRawUpdateDescription == other.showRawUpdateDescription &&
+                fullDocumentMode == other.fullDocumentMode &&
+                fullDocumentBeforeChangeMode == other.fullDocumentBeforeChangeMode;
+        }
+
+        template <typename H>
+        friend H AbslHashValue(H h, const Key& key) {
+            return H::combine(std::move(h),
+                              key.clusterTime.asULL(),
+                              key.txnOpIndex,
+                              key.tokenVersion,
+                              key.showExpandedEvents,
+                              key.showRawUpdateDescription,
+                              key.fullDocumentMode,
+                              key.fullDocumentBeforeChangeMode);
+        }
+    };
+
+    static ChangeStreamSharedEventCache& get(ServiceContext* serviceContext);
+
+    /**
+     * True when the cache has a non-zero byte budget. May change at runtime through the
+     * 'changeStreamSharedEventCacheMB' server parameter.
+     */
+    static bool isEnabled();
+
+    /**
+     * Returns the cached event for 'key', serialized with its metadata, or boost::none.
+     */
+    boost::optional<BSONObj> lookup(const Key& key);
+
+    /**
+     * Caches 'event' (a change event serialized with its metadata) under 'key'. Oversized events
+     * are not cached; the least recently used entries are evicted to stay within the byte budget.
+     */
+    void insert(const Key& key, BSONObj event);
+
+private:
+    // Events larger than this are not worth displacing many small ones for.
+    static constexpr size_t kMaxCachedEventBytes = 64 * 1024;
+
+    static constexpr size_t kNumPartitions = 8;
+
+    struct Partition {
+        Mutex mutex = MONGO_MAKE_LATCH("ChangeStreamSharedEventCache::Partition::mutex");
+
+        // Most recently used entries at the front.
+        std::list<std::pair<Key, BSONObj>> lru;
+        absl::flat_hash_map<Key, std::list<std::pair<Key, BSONObj>>::iterator, absl::Hash<Key>>
+            entries;
+        size_t bytesUsed = 0;
+    };
+
+    Partition& _partitionFor(const Key& key) {
+        return _partitions[absl::Hash<Key>{}(key) % kNumPartitions];
+    }
+
+    static size_t _partitionByteBudget();
+
+    Partition _partitions[kNumPartitions];
+};
+
+}  // namespace mongo
@@ -0,0 +1,130 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/pipeline/change_stream_shared_event_cache.h"
+
+#include <string>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/bson_test_util.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+ChangeStreamSharedEventCache::Key makeKey(Timestamp clusterTime, long long txnOpIndex = 0) {
+    ChangeStreamSharedEventCache::Key key;
+    key.clusterTime = clusterTime;
+    key.txnOpIndex = txnOpIndex;
+    key.tokenVersion = 2;
+    return key;
+}
+
+TEST(ChangeStreamSharedEventCacheTest, DisabledByDefault) {
+    ASSERT_FALSE(ChangeStreamSharedEventCache::isEnabled());
+}
+
+TEST(ChangeStreamSharedEventCacheTest, InsertAndLookupRoundTrip) {
+    RAIIServerParameterControllerForTest cacheSize("changeStreamSharedEventCacheMB", 1);
+    ASSERT_TRUE(ChangeStreamSharedEventCache::isEnabled());
+
+    ChangeStreamSharedEventCache cache;
+    auto key = makeKey(Timestamp(100, 1));
+    auto event = BSON("operationType"
+                      << "insert");
+
+    ASSERT_FALSE(cache.lookup(key));
+
+    cache.insert(key, event);
+    auto cached = cache.lookup(key);
+    ASSERT_TRUE(cached);
+    ASSERT_BSONOBJ_EQ(*cached, event);
+}
+
+TEST(ChangeStreamSharedEventCacheTest, KeysSeparateSpecProfiles) {
+    RAIIServerParameterControllerForTest cacheSize("changeStreamSharedEventCacheMB", 1);
+
+    ChangeStreamSharedEventCache cache;
+    auto key = makeKey(Timestamp(100, 1));
+    cache.insert(key, BSON("v" << 1));
+
+    // The same operation rendered under a different spec profile is a distinct entry.
+    auto expandedKey = key;
+    expandedKey.showExpandedEvents = true;
+    ASSERT_FALSE(cache.lookup(expandedKey));
+
+    auto txnKey = makeKey(Timestamp(100, 1), 3 /*txnOpIndex*/);
+    ASSERT_FALSE(cache.lookup(txnKey));
+
+    cache.insert(expandedKey, BSON("v" << 2));
+    ASSERT_BSONOBJ_EQ(*cache.lookup(key), BSON("v" << 1));
+    ASSERT_BSONOBJ_EQ(*cache.lookup(expandedKey), BSON("v" << 2));
+}
+
+TEST(ChangeStreamSharedEventCacheTest, EvictsLeastRecentlyUsedWhenOverBudget) {
+    RAIIServerParameterControllerForTest cacheSize("changeStreamSharedEventCacheMB", 1);
+
+    ChangeStreamSharedEventCache cache;
+    // Each event is around 16KB; a 1MB cache split into 8 partitions holds at most 8 of these per
+    // partition, so inserting far more than that must evict the oldest entries.
+    const std::string padding(16 * 1024, 'x');
+    constexpr int kNumEvents = 256;
+    for (int i = 0; i < kNumEvents; ++i) {
+        cache.insert(makeKey(Timestamp(100, i)), BSON("i" << i << "padding" << padding));
+    }
+
+    int cachedEvents = 0;
+    bool earliestEventSurvived = false;
+    for (int i = 0; i < kNumEvents; ++i) {
+        if (cache.lookup(makeKey(Timestamp(100, i)))) {
+            ++cachedEvents;
+            earliestEventSurvived = earliestEventSurvived || i == 0;
+        }
+    }
+    ASSERT_LT(cachedEvents, kNumEvents);
+    ASSERT_GT(cachedEvents, 0);
+    ASSERT_FALSE(earliestEventSurvived);
+}
+
+TEST(ChangeStreamSharedEventCacheTest, DoesNotCacheOversizedEvents) {
+    RAIIServerParameterControllerForTest cacheSize("changeStreamSharedEventCacheMB", 1);
+
+    ChangeStreamSharedEventCache cache;
+    auto key = makeKey(Timestamp(100, 1));
+    cache.insert(key, BSON("padding" << std::string(128 * 1024, 'x')));
+    ASSERT_FALSE(cache.lookup(key));
+}
+
+}  // namespace
+}  // namespace mongo
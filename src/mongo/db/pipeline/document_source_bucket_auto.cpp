@@ -37,6 +37,7 @@
 #include <cmath>
 #include <cstddef>
 #include <deque>
+#include <set>
 #include <string>
 
 #include "mongo/bson/bsonmisc.h"
@@ -47,6 +48,7 @@
 #include "mongo/db/pipeline/accumulator_multi.h"
 #include "mongo/db/pipeline/document_source_bucket_auto.h"
 #include "mongo/db/pipeline/expression_dependencies.h"
+#include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/db/sorter/sorter_stats.h"
@@ -102,6 +104,28 @@ std::string nextFileName() {
         std::to_string(documentSourceBucketAutoFileCounter.fetchAndAdd(1));
 }
 
+/**
+ * Returns the set of top-level field names the accumulator arguments can read, or boost::none if
+ * they may depend on the whole document or on metadata. The 'groupBy' value is extracted before
+ * documents reach the sorter, so these are the only fields the sorted documents need to retain.
+ */
+boost::optional<std::set<std::string>> computeAccumulatorFieldPrefixes(
+    const std::vector<AccumulationStatement>& accumulatedFields) {
+    DepsTracker deps;
+    for (auto&& accumulatedField : accumulatedFields) {
+        expression::addDependencies(accumulatedField.expr.argument.get(), &deps);
+    }
+    if (deps.needWholeDocument || deps.getNeedsAnyMetadata()) {
+        return boost::none;
+    }
+
+    std::set<std::string> prefixes;
+    for (auto&& field : deps.fields) {
+        prefixes.insert(std::string{FieldPath(field).front()});
+    }
+    return prefixes;
+}
+
 }  // namespace
 
 const char* DocumentSourceBucketAuto::getSourceName() const {
@@ -183,6 +207,8 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::populateSorter() {
         };
 
         _sorter.reset(Sorter<Value, Document>::make(opts, comparator));
+
+        _spillFieldPrefixes = computeAccumulatorFieldPrefixes(_accumulatedFields);
     }
 
     long long position = 0;
@@ -191,6 +217,19 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::populateSorter() {
         auto nextDoc = next.releaseDocument();
         auto key = extractKey(nextDoc);
 
+        if (_spillFieldPrefixes) {
+            // The 'groupBy' value has been extracted, so keep only the fields the accumulator
+            // arguments can read instead of buffering (and potentially spilling) the whole
+            // document.
+            MutableDocument trimmed(_spillFieldPrefixes->size());
+            for (auto&& field : *_spillFieldPrefixes) {
+                if (auto value = nextDoc.getField(field); !value.missing()) {
+                    trimmed.addField(field, std::move(value));
+                }
+            }
+            nextDoc = trimmed.freeze();
+        }
+
         auto doc = Document{{AccumulatorN::kFieldNameOutput, Value(std::move(nextDoc))},
                             {AccumulatorN::kFieldNameGeneratedSortKey, Value(position++)}};
         _sorter->add(std::move(key), std::move(doc));
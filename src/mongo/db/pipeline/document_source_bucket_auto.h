@@ -37,6 +37,7 @@
 #include <exception>
 #include <memory>
 #include <set>
+#include <string>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -201,6 +202,13 @@ private:
 
     std::vector<AccumulationStatement> _accumulatedFields;
 
+    // When the accumulator arguments depend on a known set of fields (rather than the whole
+    // document or any metadata), this holds the top-level field names they can read. Documents
+    // added to the sorter are trimmed down to these fields, since the 'groupBy' value has already
+    // been extracted by then; this shrinks the sorter's memory footprint and the amount of data
+    // spilled to disk. Computed when the sorter is created, i.e. once execution has begun.
+    boost::optional<std::set<std::string>> _spillFieldPrefixes;
+
     uint64_t _maxMemoryUsageBytes;
     bool _populated = false;
     boost::intrusive_ptr<Expression> _groupByExpression;
@@ -47,6 +47,7 @@
 #include "mongo/db/exec/document_value/document_metadata_fields.h"
 #include "mongo/db/exec/document_value/document_value_test_util.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
 #include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/document_source_bucket_auto.h"
@@ -319,6 +320,35 @@ TEST_F(BucketAutoTests, EvaluatesAccumulatorsInOutputField) {
     ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 4, max : 6}, avg : 5}")));
 }
 
+TEST_F(BucketAutoTests, EvaluatesAccumulatorsWhenDocumentsCarryUnreferencedFields) {
+    // The stage trims buffered documents down to the fields the accumulators depend on; the
+    // unreferenced 'big' field must not affect the results.
+    auto bucketAutoSpec =
+        fromjson("{$bucketAuto : {groupBy : '$x', buckets : 2, output : {sum : {$sum : '$y'}}}}");
+    auto results = getResults(bucketAutoSpec,
+                              {Document{{"x", 0}, {"y", 1}, {"big", "unused"_sd}},
+                               Document{{"x", 2}, {"y", 2}, {"big", "unused"_sd}},
+                               Document{{"x", 4}, {"y", 3}, {"big", "unused"_sd}},
+                               Document{{"x", 6}, {"y", 4}, {"big", "unused"_sd}}});
+
+    ASSERT_EQUALS(results.size(), 2UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 0, max : 4}, sum : 3}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 4, max : 6}, sum : 7}")));
+}
+
+TEST_F(BucketAutoTests, AccumulatorDependingOnWholeDocumentSeesAllFields) {
+    auto bucketAutoSpec = fromjson(
+        "{$bucketAuto : {groupBy : '$x', buckets : 1, output : {docs : {$push : '$$ROOT'}}}}");
+    auto results =
+        getResults(bucketAutoSpec, {Document{{"x", 0}, {"y", 1}}, Document{{"x", 1}, {"y", 2}}});
+
+    ASSERT_EQUALS(results.size(), 1UL);
+    ASSERT_DOCUMENT_EQ(
+        results[0],
+        Document(fromjson(
+            "{_id : {min : 0, max : 1}, docs : [{x : 0, y : 1}, {x : 1, y : 2}]}")));
+}
+
 TEST_F(BucketAutoTests, EvaluatesNonFieldPathExpressionInGroupByField) {
     auto bucketAutoSpec = fromjson("{$bucketAuto : {groupBy : {$add : ['$x', 1]}, buckets : 2}}");
     auto results = getResults(
@@ -684,9 +714,20 @@ void assertCannotSpillToDisk(const boost::intrusive_ptr<ExpressionContext>& expC
     VariablesParseState vps = expCtx->variablesParseState;
     auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$a", vps);
 
+    // Reference 'largeStr' from an accumulator so the large field is retained in the buffered
+    // documents rather than being trimmed away as an unused field.
+    auto accumulatorSpec = fromjson("{str : {$first : '$largeStr'}}");
+    std::vector<AccumulationStatement> accumulationStatements{
+        AccumulationStatement::parseAccumulationStatement(
+            expCtx.get(), accumulatorSpec.firstElement(), vps)};
+
     const int numBuckets = 2;
-    auto bucketAutoStage = DocumentSourceBucketAuto::create(
-        expCtx, groupByExpression, numBuckets, {}, nullptr, maxMemoryUsageBytes);
+    auto bucketAutoStage = DocumentSourceBucketAuto::create(expCtx,
+                                                            groupByExpression,
+                                                            numBuckets,
+                                                            std::move(accumulationStatements),
+                                                            nullptr,
+                                                            maxMemoryUsageBytes);
 
     string largeStr(maxMemoryUsageBytes, 'x');
     auto mock = DocumentSourceMock::createForTest(
@@ -723,9 +764,20 @@ TEST_F(BucketAutoTests, ShouldCorrectlyTrackMemoryUsageBetweenPauses) {
     VariablesParseState vps = expCtx->variablesParseState;
     auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$a", vps);
 
+    // Reference 'largeStr' from an accumulator so the large field is retained in the buffered
+    // documents rather than being trimmed away as an unused field.
+    auto accumulatorSpec = fromjson("{str : {$first : '$largeStr'}}");
+    std::vector<AccumulationStatement> accumulationStatements{
+        AccumulationStatement::parseAccumulationStatement(
+            expCtx.get(), accumulatorSpec.firstElement(), vps)};
+
     const int numBuckets = 2;
-    auto bucketAutoStage = DocumentSourceBucketAuto::create(
-        expCtx, groupByExpression, numBuckets, {}, nullptr, maxMemoryUsageBytes);
+    auto bucketAutoStage = DocumentSourceBucketAuto::create(expCtx,
+                                                            groupByExpression,
+                                                            numBuckets,
+                                                            std::move(accumulationStatements),
+                                                            nullptr,
+                                                            maxMemoryUsageBytes);
 
     string largeStr(maxMemoryUsageBytes / 5, 'x');
     auto mock =
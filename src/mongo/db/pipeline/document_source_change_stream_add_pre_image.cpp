@@ -106,7 +106,7 @@ DocumentSource::GetNextResult DocumentSourceChangeStreamAddPreImage::doGetNext()
             preImageId.getType() == BSONType::Object);
 
     // Obtain the pre-image document, if available, given the specified preImageId.
-    auto preImageDoc = lookupPreImage(pExpCtx, preImageId.getDocument());
+    auto preImageDoc = lookupPreImage(pExpCtx, preImageId.getDocument(), _preImagesCollectionNss);
     uassert(
         ErrorCodes::NoMatchingDocument,
         str::stream() << "Change stream was configured to require a pre-image for all update, "
@@ -126,13 +126,25 @@ DocumentSource::GetNextResult DocumentSourceChangeStreamAddPreImage::doGetNext()
     return outputDoc.freeze();
 }
 
+NamespaceString DocumentSourceChangeStreamAddPreImage::resolvePreImagesCollectionNss(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx) {
+    const auto tenantId = change_stream_serverless_helpers::resolveTenantId(expCtx->ns.tenantId());
+    return NamespaceString::makePreImageCollectionNSS(tenantId);
+}
+
 boost::optional<Document> DocumentSourceChangeStreamAddPreImage::lookupPreImage(
     boost::intrusive_ptr<ExpressionContext> pExpCtx, const Document& preImageId) {
+    return lookupPreImage(pExpCtx, preImageId, resolvePreImagesCollectionNss(pExpCtx));
+}
+
+boost::optional<Document> DocumentSourceChangeStreamAddPreImage::lookupPreImage(
+    boost::intrusive_ptr<ExpressionContext> pExpCtx,
+    const Document& preImageId,
+    const NamespaceString& preImagesCollectionNss) {
     // Look up the pre-image document on the local node by id.
-    const auto tenantId = change_stream_serverless_helpers::resolveTenantId(pExpCtx->ns.tenantId());
     auto lookedUpDoc = pExpCtx->mongoProcessInterface->lookupSingleDocumentLocally(
         pExpCtx,
-        NamespaceString::makePreImageCollectionNSS(tenantId),
+        preImagesCollectionNss,
         Document{{ChangeStreamPreImage::kIdFieldName, preImageId}});
 
     // Return boost::none to signify that we failed to find the pre-image.
@@ -81,12 +81,21 @@ public:
     static boost::optional<Document> lookupPreImage(boost::intrusive_ptr<ExpressionContext> pExpCtx,
                                                     const Document& preImageId);
 
+    // As above, but reads from the given pre-images collection namespace rather than resolving it
+    // from the stream's tenant. Callers which perform one lookup per event should resolve the
+    // namespace once and use this overload.
+    static boost::optional<Document> lookupPreImage(boost::intrusive_ptr<ExpressionContext> pExpCtx,
+                                                    const Document& preImageId,
+                                                    const NamespaceString& preImagesCollectionNss);
+
     // Removes the internal fields from the event and returns the string representation of it.
     static std::string makePreImageNotFoundErrorMsg(const Document& event);
 
     DocumentSourceChangeStreamAddPreImage(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                           FullDocumentBeforeChangeModeEnum mode)
-        : DocumentSource(kStageName, expCtx), _fullDocumentBeforeChangeMode(mode) {
+        : DocumentSource(kStageName, expCtx),
+          _fullDocumentBeforeChangeMode(mode),
+          _preImagesCollectionNss(resolvePreImagesCollectionNss(expCtx)) {
         // This stage should never be created with FullDocumentBeforeChangeMode::kOff.
         invariant(_fullDocumentBeforeChangeMode != FullDocumentBeforeChangeModeEnum::kOff);
     }
@@ -140,9 +149,18 @@ private:
      */
     GetNextResult doGetNext() final;
 
+    // Resolves the namespace of the pre-images collection for the tenant, if any, associated with
+    // the change stream.
+    static NamespaceString resolvePreImagesCollectionNss(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx);
+
     // Determines whether pre-images are strictly required or may be included only when available.
     FullDocumentBeforeChangeModeEnum _fullDocumentBeforeChangeMode =
         FullDocumentBeforeChangeModeEnum::kOff;
+
+    // The namespace of the pre-images collection to read from, resolved once per stage so that the
+    // per-event lookup does not repeat the tenant resolution and namespace construction.
+    const NamespaceString _preImagesCollectionNss;
 };
 
 }  // namespace mongo
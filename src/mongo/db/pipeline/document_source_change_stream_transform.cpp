@@ -41,9 +41,11 @@
 #include "mongo/db/basic_types.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/change_stream_helpers.h"
+#include "mongo/db/pipeline/change_stream_shared_event_cache.h"
 #include "mongo/db/pipeline/document_source_change_stream.h"
 #include "mongo/db/pipeline/document_source_change_stream_transform.h"
 #include "mongo/db/pipeline/resume_token.h"
+#include "mongo/db/repl/oplog_entry.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/intrusive_counter.h"
@@ -91,6 +93,7 @@ DocumentSourceChangeStreamTransform::DocumentSourceChangeStreamTransform(
 
     // Extract the resume token or high-water-mark from the spec.
     auto tokenData = change_stream::resolveResumeTokenFromSpec(expCtx, _changeStreamSpec);
+    _resumePointClusterTime = tokenData.clusterTime;
 
     // Set the initialPostBatchResumeToken on the expression context.
     expCtx->initialPostBatchResumeToken = ResumeToken(tokenData).toBSON();
@@ -240,7 +243,55 @@ DocumentSource::GetNextResult DocumentSourceChangeStreamTransform::doGetNext() {
         return input;
     }
 
-    return _transformer.applyTransformation(input.releaseDocument());
+    auto inputDoc = input.releaseDocument();
+    auto cacheKey = _makeSharedEventCacheKey(inputDoc);
+    if (!cacheKey) {
+        return _transformer.applyTransformation(inputDoc);
+    }
+
+    auto& cache = ChangeStreamSharedEventCache::get(pExpCtx->opCtx->getServiceContext());
+    if (auto cached = cache.lookup(*cacheKey)) {
+        // Another subscriber has already transformed this oplog entry under an identical spec.
+        // The cached copy includes the sort-key metadata carrying the event's resume token.
+        return Document::fromBsonWithMetaData(*cached);
+    }
+
+    auto event = _transformer.applyTransformation(inputDoc);
+    cache.insert(*cacheKey, event.toBsonWithMetaData());
+    return event;
+}
+
+boost::optional<ChangeStreamSharedEventCache::Key>
+DocumentSourceChangeStreamTransform::_makeSharedEventCacheKey(const Document& input) const {
+    if (!ChangeStreamSharedEventCache::isEnabled()) {
+        return boost::none;
+    }
+
+    Value ts = input[repl::OplogEntry::kTimestampFieldName];
+    if (ts.getType() != BSONType::bsonTimestamp) {
+        return boost::none;
+    }
+
+    // Only share events from strictly after this stream's resume point. For an event at the
+    // resume point itself, the resume token is rendered with the token's original version rather
+    // than the current one, so its materialization is specific to this subscriber.
+    if (ts.getTimestamp() <= _resumePointClusterTime) {
+        return boost::none;
+    }
+
+    ChangeStreamSharedEventCache::Key key;
+    key.clusterTime = ts.getTimestamp();
+    if (Value txnOpIndex = input[DocumentSourceChangeStream::kTxnOpIndexField];
+        !txnOpIndex.missing()) {
+        key.txnOpIndex = txnOpIndex.getLong();
+    }
+    key.tokenVersion = pExpCtx->changeStreamTokenVersion;
+    key.showExpandedEvents = _changeStreamSpec.getShowExpandedEvents();
+    key.showRawUpdateDescription = _changeStreamSpec.getShowRawUpdateDescription();
+    key.fullDocumentMode = static_cast<int>(_changeStreamSpec.getFullDocument());
+    key.fullDocumentBeforeChangeMode =
+        static_cast<int>(_changeStreamSpec.getFullDocumentBeforeChange());
+    return key;
 }
 
 }  // namespace mongo
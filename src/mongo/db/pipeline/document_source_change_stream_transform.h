@@ -38,7 +38,9 @@
 #include "mongo/bson/bsonelement.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/bson/timestamp.h"
 #include "mongo/db/pipeline/change_stream_event_transform.h"
+#include "mongo/db/pipeline/change_stream_shared_event_cache.h"
 #include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_change_stream.h"
@@ -93,10 +95,22 @@ private:
     DocumentSourceChangeStreamTransform(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                         DocumentSourceChangeStreamSpec spec);
 
+    /**
+     * Returns the shared event cache key under which the transformed event for 'input' may be
+     * shared with other change streams, or boost::none when the event must be rendered privately.
+     */
+    boost::optional<ChangeStreamSharedEventCache::Key> _makeSharedEventCacheKey(
+        const Document& input) const;
+
     DocumentSourceChangeStreamSpec _changeStreamSpec;
 
     ChangeStreamEventTransformer _transformer;
 
+    // Cluster time of this stream's resume point. Events at or before this timestamp may need a
+    // resume token rendered with the resume token's own version rather than the current one, so
+    // they are never shared through the event cache.
+    Timestamp _resumePointClusterTime;
+
     // Set to true if this transformation stage can be run on the collectionless namespace.
     bool _isIndependentOfAnyCollection;
 };
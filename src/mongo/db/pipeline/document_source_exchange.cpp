@@ -40,6 +40,7 @@
 #include <utility>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -439,10 +440,15 @@ size_t Exchange::getTargetConsumer(const Document& input) {
     }
 
     key_string::Builder key{key_string::Version::V1, kb.obj(), _ordering};
-    std::string keyStr{key.getBuffer(), key.getSize()};
-
-    // Binary search for the consumer id.
-    auto it = std::upper_bound(_boundaries.begin(), _boundaries.end(), keyStr);
+    StringData keyStr{key.getBuffer(), key.getSize()};
+
+    // Binary search for the consumer id. The boundaries are memcmp-ordered key_string buffers, so
+    // the comparison can read the builder's buffer directly without copying it into a std::string.
+    auto it = std::upper_bound(
+        _boundaries.begin(),
+        _boundaries.end(),
+        keyStr,
+        [](StringData lhs, const std::string& rhs) { return lhs < StringData{rhs}; });
     invariant(it != _boundaries.end());
 
     size_t distance = std::distance(_boundaries.begin(), it) - 1;
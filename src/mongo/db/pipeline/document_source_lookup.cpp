@@ -51,6 +51,7 @@
 #include "mongo/db/database_name.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/exec/document_value/value_comparator.h"
 #include "mongo/db/feature_flag.h"
 #include "mongo/db/field_ref.h"
 #include "mongo/db/matcher/expression.h"
@@ -177,18 +178,33 @@ static BSONObj createMatchStageJoinObj(const Document& input,
     // Add the 'localFieldPath' of 'input' into 'localFieldList'. If 'localFieldPath' references a
     // field with an array in its path, we may need to join on multiple values, so we add each
     // element to 'localFieldList'.
-    BSONArrayBuilder arrBuilder;
+    std::vector<Value> localFieldValues;
     bool containsRegex = false;
     document_path_support::visitAllValuesAtPath(input, localFieldPath, [&](const Value& nextValue) {
-        arrBuilder << nextValue;
+        localFieldValues.push_back(nextValue);
         if (!containsRegex && nextValue.getType() == BSONType::RegEx) {
             containsRegex = true;
         }
     });
 
-    if (arrBuilder.arrSize() == 0) {
+    if (localFieldValues.empty()) {
         // Missing values are treated as null.
-        arrBuilder << BSONNULL;
+        localFieldValues.push_back(Value(BSONNULL));
+    } else if (localFieldValues.size() > 1 && !containsRegex) {
+        // Sort and deduplicate the values so the $in below carries the minimal set of point
+        // predicates through parsing, canonicalization and index bounds building on every foreign
+        // probe. Use simple binary comparison semantics: removing binary-identical duplicates
+        // cannot change what $in matches under any collation.
+        const auto& comparator = ValueComparator::kInstance;
+        std::sort(localFieldValues.begin(), localFieldValues.end(), comparator.getLessThan());
+        localFieldValues.erase(
+            std::unique(localFieldValues.begin(), localFieldValues.end(), comparator.getEqualTo()),
+            localFieldValues.end());
+    }
+
+    BSONArrayBuilder arrBuilder;
+    for (const auto& localFieldValue : localFieldValues) {
+        arrBuilder << localFieldValue;
     }
 
     // We construct a query of one of the following forms, depending on the contents of
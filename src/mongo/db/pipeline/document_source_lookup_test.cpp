@@ -1053,6 +1053,22 @@ TEST(MakeMatchStageFromInput, ArrayValueUsesInQuery) {
     ASSERT_BSONOBJ_EQ(matchStage, fromjson("{$match: {foreign: {$in: [1, 2]}}}"));
 }
 
+TEST(MakeMatchStageFromInput, ArrayValueIsSortedAndDeduplicated) {
+    std::vector<Value> inputArray = {Value(2), Value(1), Value(2), Value(1)};
+    Document input = DOC("local" << Value(inputArray));
+    BSONObj matchStage = DocumentSourceLookUp::makeMatchStageFromInput(
+        input, FieldPath("local"), "foreign", BSONObj());
+    ASSERT_BSONOBJ_EQ(matchStage, fromjson("{$match: {foreign: {$in: [1, 2]}}}"));
+}
+
+TEST(MakeMatchStageFromInput, ArrayValueWithOneDistinctValueUsesEqQuery) {
+    std::vector<Value> inputArray = {Value(1), Value(1)};
+    Document input = DOC("local" << Value(inputArray));
+    BSONObj matchStage = DocumentSourceLookUp::makeMatchStageFromInput(
+        input, FieldPath("local"), "foreign", BSONObj());
+    ASSERT_BSONOBJ_EQ(matchStage, fromjson("{$match: {foreign: {$eq: 1}}}"));
+}
+
 TEST(MakeMatchStageFromInput, ArrayValueWithRegexUsesOrQuery) {
     BSONRegEx regex("^a");
     std::vector<Value> inputArray = {Value(1), Value(regex), Value(2)};
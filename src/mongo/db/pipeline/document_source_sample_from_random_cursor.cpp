@@ -28,15 +28,9 @@
  */
 
 
-#include <boost/exception/exception.hpp>
-#include <boost/math/distributions/beta.hpp>
-#include <boost/math/policies/policy.hpp>
-// IWYU pragma: no_include "boost/math/special_functions/detail/erf_inv.hpp"
-// IWYU pragma: no_include "boost/math/special_functions/detail/lanczos_sse2.hpp"
 #include <algorithm>
-#include <boost/math/tools/precision.hpp>
+#include <cmath>
 #include <cstddef>
-#include <stdexcept>
 #include <utility>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -86,9 +80,12 @@ namespace {
  * being used here.
  */
 double smallestFromSampleOfUniform(PseudoRandom* prng, size_t N) {
-    boost::math::beta_distribution<double> betaDist(1.0, static_cast<double>(N));
+    // The Beta(1, N) CDF has the closed form F(x) = 1 - (1 - x)^N, so the quantile function is
+    // x = 1 - (1 - p)^(1/N). Inverting it directly is exact and far cheaper per document than the
+    // generic incomplete-beta inversion boost::math::quantile performs. Routing the computation
+    // through log1p/expm1 keeps it accurate for large N, where (1 - p)^(1/N) is close to one.
     double p = prng->nextCanonicalDouble();
-    return boost::math::quantile(betaDist, p);
+    return -std::expm1(std::log1p(-p) / static_cast<double>(N));
 }
 }  // namespace
 
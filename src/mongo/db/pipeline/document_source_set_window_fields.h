@@ -115,7 +115,11 @@ public:
           _outputFields(std::move(outputFields)),
           _memoryTracker{expCtx->allowDiskUse, maxMemoryBytes},
           _iterator(expCtx.get(), pSource, &_memoryTracker, std::move(partitionBy), _sortBy),
-          _sbeCompatibility(sbeCompatibility){};
+          _sbeCompatibility(sbeCompatibility) {
+        if (const auto& memoryAggregator = expCtx->getMemoryAggregator()) {
+            _memoryTracker.attachTo(memoryAggregator.get());
+        }
+    };
 
     GetModPathsReturn getModifiedPaths() const final {
         OrderedPathSet outputPaths;
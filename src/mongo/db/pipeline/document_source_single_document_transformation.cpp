@@ -31,9 +31,11 @@
 #include <iterator>
 
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/exec/exclusion_projection_executor.h"
+#include "mongo/db/exec/inclusion_projection_executor.h"
 #include "mongo/db/pipeline/document_source_project.h"
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/document_source_skip.h"
@@ -111,6 +113,39 @@ projection_executor::ExclusionNode& DocumentSourceSingleDocumentTransformation::
     return *ret;
 }
 
+namespace {
+/**
+ * Returns the set of top-level fields included by 'stage' if its transformation is an inclusion
+ * projection consisting only of plain field inclusions: no computed fields, no renames, no
+ * root-replacement expression, and no dotted paths. Returns boost::none otherwise. The "_id"
+ * field is part of the returned set iff the projection includes it.
+ */
+boost::optional<OrderedPathSet> getSimpleInclusionPaths(
+    DocumentSourceSingleDocumentTransformation& stage) {
+    auto& executor =
+        dynamic_cast<projection_executor::InclusionProjectionExecutor&>(stage.getTransformer());
+    if (executor.rootReplacementExpression()) {
+        return boost::none;
+    }
+
+    OrderedPathSet computedPaths;
+    StringMap<std::string> renamedPaths;
+    executor.getRoot()->reportComputedPaths(&computedPaths, &renamedPaths, nullptr);
+    if (!computedPaths.empty() || !renamedPaths.empty()) {
+        return boost::none;
+    }
+
+    OrderedPathSet includedPaths;
+    executor.getRoot()->reportProjectedPaths(&includedPaths);
+    if (std::any_of(includedPaths.begin(), includedPaths.end(), [](const std::string& path) {
+            return path.find('.') != std::string::npos;
+        })) {
+        return boost::none;
+    }
+    return includedPaths;
+}
+}  // namespace
+
 Pipeline::SourceContainer::iterator DocumentSourceSingleDocumentTransformation::maybeCoalesce(
     Pipeline::SourceContainer::iterator itr,
     Pipeline::SourceContainer* container,
@@ -143,6 +178,54 @@ Pipeline::SourceContainer::iterator DocumentSourceSingleDocumentTransformation::
         container->erase(std::next(itr));
         return itr;
     }
+
+    // Adjacent inclusion projections without computed fields can be coalesced by intersecting
+    // their included fields: a field survives the pair iff both stages include it, and _id
+    // survives iff neither stage suppresses it.
+    if (getTransformerType() == TransformerInterface::TransformerType::kInclusionProjection &&
+        nextSingleDocTransform->getTransformerType() ==
+            TransformerInterface::TransformerType::kInclusionProjection) {
+        auto thisIncludedPaths = getSimpleInclusionPaths(*this);
+        auto nextIncludedPaths = getSimpleInclusionPaths(*nextSingleDocTransform);
+        if (!thisIncludedPaths || !nextIncludedPaths) {
+            return std::next(itr);
+        }
+
+        OrderedPathSet intersection;
+        std::set_intersection(thisIncludedPaths->begin(),
+                              thisIncludedPaths->end(),
+                              nextIncludedPaths->begin(),
+                              nextIncludedPaths->end(),
+                              std::inserter(intersection, intersection.begin()),
+                              PathComparator());
+
+        bool includeId = false;
+        if (auto idIt = intersection.find("_id"); idIt != intersection.end()) {
+            includeId = true;
+            intersection.erase(idIt);
+        }
+
+        // An inclusion projection which retains no fields other than possibly _id is not
+        // representable as a $project specification, so leave such pipelines alone.
+        if (intersection.empty()) {
+            return std::next(itr);
+        }
+
+        BSONObjBuilder spec;
+        for (const std::string& field : intersection) {
+            spec.append(field, true);
+        }
+        if (!includeId) {
+            spec.append("_id", false);
+        }
+
+        auto expCtx = getContext();
+        container->erase(std::next(itr));
+        *itr = DocumentSourceProject::create(spec.obj(), expCtx, DocumentSourceProject::kStageName);
+        // NB: Below this point any access to members of 'this' is invalid!
+        return itr == container->begin() ? itr : std::prev(itr);
+    }
+
     return std::next(itr);
 }
 
@@ -44,10 +44,12 @@
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/exec/document_value/value_comparator.h"
 #include "mongo/db/pipeline/accumulation_statement.h"
+#include "mongo/db/pipeline/document_source_group.h"
 #include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/pipeline/monotonic_expression.h"
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
@@ -122,6 +124,39 @@ boost::intrusive_ptr<DocumentSourceStreamingGroup> DocumentSourceStreamingGroup:
     return groupStage;
 }
 
+boost::intrusive_ptr<DocumentSourceStreamingGroup>
+DocumentSourceStreamingGroup::convertFromGroupIfPossible(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    DocumentSourceGroup* groupStage,
+    const FieldPath& sortField) {
+    auto& idFields = groupStage->getMutableIdFields();
+    std::vector<size_t> monotonicIdFields;
+    for (size_t i = 0; i < idFields.size(); ++i) {
+        // To enable streaming, we need an id field expression to be clustered, so that all
+        // documents with the same value of this id field are in a single continuous cluster.
+        // However this property is hard to check for, so we check for monotonicity instead, which
+        // is stronger.
+        idFields[i] = idFields[i]->optimize();  // We optimize here to make use of constant folding.
+        auto monotonicState = idFields[i]->getMonotonicState(sortField);
+
+        // We don't add monotonic::State::Constant id fields, because they are useless when
+        // determining if a group batch is finished.
+        if (monotonicState == monotonic::State::Increasing ||
+            monotonicState == monotonic::State::Decreasing) {
+            monotonicIdFields.push_back(i);
+        }
+    }
+    if (monotonicIdFields.empty()) {
+        return nullptr;
+    }
+
+    return create(expCtx,
+                  groupStage->getIdExpression(),
+                  std::move(monotonicIdFields),
+                  std::move(groupStage->getMutableAccumulationStatements()),
+                  groupStage->getMaxMemoryUsageBytes());
+}
+
 boost::intrusive_ptr<DocumentSource> DocumentSourceStreamingGroup::createFromBson(
     BSONElement elem, const boost::intrusive_ptr<ExpressionContext>& expCtx) {
     return createFromBsonWithMaxMemoryUsage(std::move(elem), expCtx, boost::none);
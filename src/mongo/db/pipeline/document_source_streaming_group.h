@@ -47,10 +47,13 @@
 #include "mongo/db/pipeline/document_source_group_base.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/query/query_shape/serialization_options.h"
 
 namespace mongo {
 
+class DocumentSourceGroup;
+
 /**
  * This class represents streaming group implementation that can only be used when at least one of
  * _id fields is monotonic. It stores and output groups in batches. All groups in the batch has
@@ -90,6 +93,18 @@ public:
         std::vector<AccumulationStatement> accumulationStatements,
         boost::optional<int64_t> maxMemoryUsageBytes = boost::none);
 
+    /**
+     * Builds a $_internalStreamingGroup equivalent to 'groupStage' if at least one of the group's
+     * _id sub-expressions is monotonic in 'sortField', which the group's input must already be
+     * sorted on. Returns nullptr when no _id sub-expression is monotonic. On success the id and
+     * accumulation expressions are moved out of 'groupStage', so the caller must replace it with
+     * the returned stage.
+     */
+    static boost::intrusive_ptr<DocumentSourceStreamingGroup> convertFromGroupIfPossible(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        DocumentSourceGroup* groupStage,
+        const FieldPath& sortField);
+
     /**
      * Parses 'elem' into a $_internalStreamingGroup stage, or throws a AssertionException if 'elem'
      * was an invalid specification.
@@ -29,6 +29,7 @@
 
 
 #include <absl/container/flat_hash_map.h>
+#include <algorithm>
 #include <iterator>
 
 #include <boost/move/utility_core.hpp>
@@ -41,9 +42,11 @@
 #include "mongo/db/auth/resource_pattern.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/pipeline/document_source_documents.h"
+#include "mongo/db/pipeline/document_source_limit.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_queue.h"
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
+#include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/document_source_union_with.h"
 #include "mongo/db/pipeline/document_source_union_with_gen.h"
 #include "mongo/db/pipeline/process_interface/mongo_process_interface.h"
@@ -98,6 +101,22 @@ std::unique_ptr<Pipeline, PipelineDeleter> buildPipelineFromViewDefinition(
         opts);
 }
 
+/**
+ * Returns whether a $sort following the $unionWith can be duplicated across the union and
+ * replaced by a streaming merge. Only an ordinary whole-collection sort qualifies: a coalesced
+ * limit would have to be re-split across the branches, bounded sorts have their own execution
+ * model, and $meta-based patterns may depend on metadata the sub-pipeline cannot produce.
+ */
+bool isEligibleForSortedMerge(DocumentSourceSort& sort) {
+    if (sort.hasLimit() || sort.isBoundedSortStage()) {
+        return false;
+    }
+    const auto& pattern = sort.getSortKeyPattern();
+    return std::all_of(pattern.begin(), pattern.end(), [](const auto& part) {
+        return part.fieldPath && !part.expression;
+    });
+}
+
 }  // namespace
 
 DocumentSourceUnionWith::DocumentSourceUnionWith(
@@ -224,6 +243,7 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceUnionWith::createFromBson(
 
     NamespaceString unionNss;
     std::vector<BSONObj> pipeline;
+    boost::optional<BSONObj> sortedMergeByPattern;
     if (elem.type() == BSONType::String) {
         unionNss = NamespaceStringUtil::deserialize(expCtx->ns.dbName(), elem.valueStringData());
     } else {
@@ -238,9 +258,14 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceUnionWith::createFromBson(
             unionNss = NamespaceString::makeCollectionlessAggregateNSS(expCtx->ns.dbName());
         }
         pipeline = unionWithSpec.getPipeline().value_or(std::vector<BSONObj>{});
+        sortedMergeByPattern = unionWithSpec.getSortedMergeByPattern();
     }
-    return make_intrusive<DocumentSourceUnionWith>(
+    auto unionWith = make_intrusive<DocumentSourceUnionWith>(
         expCtx, std::move(unionNss), std::move(pipeline));
+    if (sortedMergeByPattern) {
+        unionWith->setSortedMergeByPattern(SortPattern(*sortedMergeByPattern, expCtx));
+    }
+    return unionWith;
 }
 
 DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
@@ -249,6 +274,10 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
         return GetNextResult::makeEOF();
     }
 
+    if (_sortedMergePattern) {
+        return doSortedMergeGetNext();
+    }
+
     if (_executionState == ExecutionProgress::kIteratingSource) {
         auto nextInput = pSource->getNext();
         if (!nextInput.isEOF()) {
@@ -260,23 +289,7 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
     }
 
     if (_executionState == ExecutionProgress::kStartingSubPipeline) {
-        auto serializedPipe = _pipeline->serializeToBson();
-        logStartingSubPipeline(serializedPipe);
-        try {
-            // Query settings are looked up after parsing and therefore are not populated in the
-            // context of the unionWith '_pipeline' as part of DocumentSourceUnionWith constructor.
-            // Attach query settings to the '_pipeline->getContext()' by copying them from the
-            // parent query ExpressionContext.
-            _pipeline->getContext()->setQuerySettingsIfNotPresent(pExpCtx->getQuerySettings());
-            _pipeline =
-                pExpCtx->mongoProcessInterface->preparePipelineForExecution(_pipeline.release());
-            _executionState = ExecutionProgress::kIteratingSubPipeline;
-        } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e) {
-            _pipeline = buildPipelineFromViewDefinition(
-                pExpCtx,
-                ExpressionContext::ResolvedNamespace{e->getNamespace(), e->getPipeline()},
-                std::move(serializedPipe));
-            logShardedViewFound(e);
+        if (!prepareSubPipelineForExecution()) {
             return doGetNext();
         }
     }
@@ -297,6 +310,100 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
     return GetNextResult::makeEOF();
 }
 
+bool DocumentSourceUnionWith::prepareSubPipelineForExecution() {
+    auto serializedPipe = _pipeline->serializeToBson();
+    logStartingSubPipeline(serializedPipe);
+    try {
+        // Query settings are looked up after parsing and therefore are not populated in the
+        // context of the unionWith '_pipeline' as part of DocumentSourceUnionWith constructor.
+        // Attach query settings to the '_pipeline->getContext()' by copying them from the
+        // parent query ExpressionContext.
+        _pipeline->getContext()->setQuerySettingsIfNotPresent(pExpCtx->getQuerySettings());
+        _pipeline =
+            pExpCtx->mongoProcessInterface->preparePipelineForExecution(_pipeline.release());
+        _executionState = ExecutionProgress::kIteratingSubPipeline;
+        return true;
+    } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e) {
+        _pipeline = buildPipelineFromViewDefinition(
+            pExpCtx,
+            ExpressionContext::ResolvedNamespace{e->getNamespace(), e->getPipeline()},
+            std::move(serializedPipe));
+        logShardedViewFound(e);
+        return false;
+    }
+}
+
+void DocumentSourceUnionWith::setSortedMergeByPattern(SortPattern pattern) {
+    _sortedMergeKeyGen.emplace(pattern, pExpCtx->getCollator());
+    _sortedMergeComparator.emplace(pattern);
+    _sortedMergePattern = std::move(pattern);
+}
+
+DocumentSource::GetNextResult DocumentSourceUnionWith::doSortedMergeGetNext() {
+    if (_executionState == ExecutionProgress::kIteratingSource) {
+        // The merge draws from both inputs incrementally, so the sub-pipeline must be prepared
+        // before the first result can be returned, rather than once the source is exhausted.
+        _executionState = ExecutionProgress::kStartingSubPipeline;
+    }
+
+    if (_executionState == ExecutionProgress::kStartingSubPipeline) {
+        if (!prepareSubPipelineForExecution()) {
+            return doGetNext();
+        }
+    }
+
+    // See the comment in doGetNext() regarding disposal responsibility.
+    _pipeline.get_deleter().dismissDisposal();
+
+    if (!_sortedMergeSourceDoc && !_sortedMergeSourceExhausted) {
+        auto nextInput = pSource->getNext();
+        if (nextInput.isPaused()) {
+            return nextInput;
+        }
+        if (nextInput.isEOF()) {
+            _sortedMergeSourceExhausted = true;
+        } else {
+            auto doc = nextInput.releaseDocument();
+            auto key = _sortedMergeKeyGen->computeSortKeyFromDocument(doc);
+            _sortedMergeSourceDoc.emplace(std::move(key), std::move(doc));
+        }
+    }
+
+    if (!_sortedMergeSubPipelineDoc && !_sortedMergeSubPipelineExhausted) {
+        if (auto res = _pipeline->getNext()) {
+            auto key = _sortedMergeKeyGen->computeSortKeyFromDocument(*res);
+            _sortedMergeSubPipelineDoc.emplace(std::move(key), std::move(*res));
+        } else {
+            _sortedMergeSubPipelineExhausted = true;
+            // Record the plan summary stats once the sub-pipeline is exhausted.
+            accumulatePipelinePlanSummaryStats(*_pipeline, _stats.planSummaryStats);
+        }
+    }
+
+    auto consume = [](boost::optional<std::pair<Value, Document>>& buffered) {
+        Document doc = std::move(buffered->second);
+        buffered = boost::none;
+        return GetNextResult(std::move(doc));
+    };
+
+    if (_sortedMergeSourceDoc && _sortedMergeSubPipelineDoc) {
+        // Prefer the base collection's document on ties so the merge is deterministic.
+        return (*_sortedMergeComparator)(_sortedMergeSourceDoc->first,
+                                         _sortedMergeSubPipelineDoc->first) <= 0
+            ? consume(_sortedMergeSourceDoc)
+            : consume(_sortedMergeSubPipelineDoc);
+    }
+    if (_sortedMergeSourceDoc) {
+        return consume(_sortedMergeSourceDoc);
+    }
+    if (_sortedMergeSubPipelineDoc) {
+        return consume(_sortedMergeSubPipelineDoc);
+    }
+
+    _executionState = ExecutionProgress::kFinished;
+    return GetNextResult::makeEOF();
+}
+
 // The use of these logging macros is done in separate NOINLINE functions to reduce the stack space
 // used on the hot getNext() path. This is done to avoid stack overflows.
 MONGO_COMPILER_NOINLINE void DocumentSourceUnionWith::logStartingSubPipeline(
@@ -322,9 +429,14 @@ Pipeline::SourceContainer::iterator DocumentSourceUnionWith::doOptimizeAt(
     Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
     auto duplicateAcrossUnion = [&](auto&& nextStage) {
         _pipeline->addFinalSource(nextStage->clone(_pipeline->getContext()));
-        // Apply the same rewrite to the cached pipeline if available.
+        // Apply the same rewrite to the cached pipeline if available. Note that serializeToArray()
+        // must be used here since some stages (e.g. $sort) cannot serialize to a single value.
         if (pExpCtx->explain >= ExplainOptions::Verbosity::kExecStats) {
-            _pushedDownStages.push_back(nextStage->serialize().getDocument().toBson());
+            std::vector<Value> serialized;
+            nextStage->serializeToArray(serialized);
+            for (auto&& stage : serialized) {
+                _pushedDownStages.push_back(stage.getDocument().toBson());
+            }
         }
         auto newStageItr = container->insert(itr, std::move(nextStage));
         container->erase(std::next(itr));
@@ -336,6 +448,20 @@ Pipeline::SourceContainer::iterator DocumentSourceUnionWith::doOptimizeAt(
         else if (auto nextProject = dynamic_cast<DocumentSourceSingleDocumentTransformation*>(
                      (*std::next(itr)).get()))
             return duplicateAcrossUnion(nextProject);
+        else if (auto nextSort = dynamic_cast<DocumentSourceSort*>((*std::next(itr)).get())) {
+            // A $sort after the union can be duplicated across both branches and replaced with a
+            // streaming merge by its pattern: each branch then sorts only its own input (or
+            // avoids the blocking sort entirely when an index provides the order), rather than
+            // paying one blocking sort over the whole union. Hold off while a $limit follows the
+            // $sort: the sort must absorb it first, after which it is no longer eligible and the
+            // union falls back to concatenation followed by the top-k sort.
+            const bool nextStageIsLimit = std::next(itr, 2) != container->end() &&
+                dynamic_cast<DocumentSourceLimit*>((*std::next(itr, 2)).get());
+            if (!_sortedMergePattern && !nextStageIsLimit && isEligibleForSortedMerge(*nextSort)) {
+                setSortedMergeByPattern(nextSort->getSortKeyPattern());
+                return duplicateAcrossUnion(nextSort);
+            }
+        }
     }
     return std::next(itr);
 };
@@ -442,10 +568,21 @@ Value DocumentSourceUnionWith::serialize(const SerializationOptions& opts) const
             return _pipeline->serializeToBson(opts);
         }();
 
-        auto spec = collectionless ? DOC("pipeline" << serializedPipeline)
-                                   : DOC("coll" << opts.serializeIdentifier(_userNss.coll())
-                                                << "pipeline" << serializedPipeline);
-        return Value(DOC(getSourceName() << spec));
+        MutableDocument spec;
+        if (!collectionless) {
+            spec.addField("coll", Value(opts.serializeIdentifier(_userNss.coll())));
+        }
+        spec.addField("pipeline", Value(serializedPipeline));
+        if (_sortedMergePattern && !opts.transformIdentifiers &&
+            opts.literalPolicy == LiteralSerializationPolicy::kUnchanged) {
+            // The sorted-merge rewrite must survive serialization, since the optimized pipeline
+            // may be sent to another node for execution. Query shape serializations reflect the
+            // original pipeline instead, so the internal field is omitted there.
+            spec.addField(UnionWithSpec::kSortedMergeByPatternFieldName,
+                          Value(_sortedMergePattern->serialize(
+                              SortPattern::SortKeySerialization::kForPipelineSerialization)));
+        }
+        return Value(DOC(getSourceName() << spec.freezeToValue()));
     }
 }
 
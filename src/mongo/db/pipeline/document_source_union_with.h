@@ -48,8 +48,11 @@
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/auth/privilege.h"
+#include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/exec/plan_stats.h"
+#include "mongo/db/exec/sort_key_comparator.h"
+#include "mongo/db/index/sort_key_generator.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/dependencies.h"
@@ -62,6 +65,7 @@
 #include "mongo/db/pipeline/variables.h"
 #include "mongo/db/query/explain_options.h"
 #include "mongo/db/query/query_shape/serialization_options.h"
+#include "mongo/db/query/sort_pattern.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
@@ -110,6 +114,9 @@ public:
           _userNss(original._userNss),
           _userPipeline(original._userPipeline) {
         _pipeline->getContext()->inUnionWith = true;
+        if (original._sortedMergePattern) {
+            setSortedMergeByPattern(*original._sortedMergePattern);
+        }
     }
 
     ~DocumentSourceUnionWith() override;
@@ -200,6 +207,18 @@ public:
         return nullptr;
     }
 
+    /**
+     * Switches the stage from concatenating its inputs to performing a streaming merge by
+     * 'pattern'. Both 'pSource' and the sub-pipeline must produce documents already sorted by
+     * 'pattern'; doOptimizeAt() establishes this by duplicating a following $sort across the
+     * union before calling this.
+     */
+    void setSortedMergeByPattern(SortPattern pattern);
+
+    bool isSortedMerge() const {
+        return static_cast<bool>(_sortedMergePattern);
+    }
+
 protected:
     GetNextResult doGetNext() final;
 
@@ -232,6 +251,19 @@ private:
 
     Value serialize(const SerializationOptions& opts = SerializationOptions{}) const final;
 
+    /**
+     * Prepares the sub-pipeline for execution. Returns true on success; returns false if the
+     * pipeline had to be rebuilt from a sharded view definition, in which case the caller should
+     * retry by calling doGetNext() again.
+     */
+    bool prepareSubPipelineForExecution();
+
+    /**
+     * Implements doGetNext() when a sorted merge has been set up: returns the smaller of the two
+     * buffered input documents by the merge sort pattern, refilling the buffers as needed.
+     */
+    GetNextResult doSortedMergeGetNext();
+
     void addViewDefinition(NamespaceString nss, std::vector<BSONObj> viewPipeline);
 
     void logStartingSubPipeline(const std::vector<BSONObj>& serializedPipeline);
@@ -250,6 +282,18 @@ private:
     std::vector<BSONObj> _pushedDownStages;
     ExecutionProgress _executionState = ExecutionProgress::kIteratingSource;
     UnionWithStats _stats;
+
+    // When set, both inputs produce documents already sorted by this pattern and doGetNext()
+    // performs a streaming merge preserving that order instead of concatenating the inputs. The
+    // buffered entries hold the next unconsumed document from each input along with its
+    // precomputed sort key.
+    boost::optional<SortPattern> _sortedMergePattern;
+    boost::optional<SortKeyGenerator> _sortedMergeKeyGen;
+    boost::optional<SortKeyComparator> _sortedMergeComparator;
+    boost::optional<std::pair<Value, Document>> _sortedMergeSourceDoc;
+    boost::optional<std::pair<Value, Document>> _sortedMergeSubPipelineDoc;
+    bool _sortedMergeSourceExhausted = false;
+    bool _sortedMergeSubPipelineExhausted = false;
 };
 
 }  // namespace mongo
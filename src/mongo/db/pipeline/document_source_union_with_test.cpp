@@ -50,9 +50,11 @@
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_add_fields.h"
 #include "mongo/db/pipeline/document_source_facet.h"
+#include "mongo/db/pipeline/document_source_limit.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_mock.h"
 #include "mongo/db/pipeline/document_source_replace_root.h"
+#include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/document_source_union_with.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/pipeline/pipeline.h"
@@ -175,6 +177,66 @@ TEST_F(DocumentSourceUnionWithTest, UnionsWithNonEmptySubPipelines) {
     ASSERT_TRUE(unionWithTwo->getNext().isEOF());
 }
 
+TEST_F(DocumentSourceUnionWithTest, SortedMergeInterleavesSortedInputs) {
+    const auto mock = DocumentSourceMock::createForTest(
+        {Document{{"a", 1}}, Document{{"a", 3}}, Document{{"a", 5}}}, getExpCtx());
+    const auto mockDeque =
+        std::deque<DocumentSource::GetNextResult>{Document{{"a", 2}}, Document{{"a", 4}}};
+    getExpCtx()->mongoProcessInterface = std::make_unique<MockMongoInterface>(mockDeque);
+    auto unionWith =
+        makeUnion(getExpCtx(),
+                  Pipeline::create(std::list<boost::intrusive_ptr<DocumentSource>>{}, getExpCtx()));
+    unionWith->setSortedMergeByPattern(SortPattern(BSON("a" << 1), getExpCtx()));
+    unionWith->setSource(mock.get());
+
+    for (int expected = 1; expected <= 5; ++expected) {
+        auto next = unionWith->getNext();
+        ASSERT_TRUE(next.isAdvanced());
+        ASSERT_VALUE_EQ(next.releaseDocument()["a"], Value(expected));
+    }
+    ASSERT_TRUE(unionWith->getNext().isEOF());
+    ASSERT_TRUE(unionWith->getNext().isEOF());
+}
+
+TEST_F(DocumentSourceUnionWithTest, DuplicatesFollowingSortAcrossUnionDuringOptimization) {
+    auto expCtx = getExpCtx();
+    auto unionWith = make_intrusive<DocumentSourceUnionWith>(
+        expCtx, Pipeline::create(std::list<boost::intrusive_ptr<DocumentSource>>{}, expCtx));
+    auto sort = DocumentSourceSort::create(expCtx, BSON("a" << 1));
+    auto pipeline = Pipeline::create({unionWith, sort}, expCtx);
+    pipeline->optimizePipeline();
+
+    const auto& sources = pipeline->getSources();
+    ASSERT_EQ(sources.size(), 2U);
+    ASSERT(dynamic_cast<DocumentSourceSort*>(sources.front().get()));
+    auto rewrittenUnion = dynamic_cast<DocumentSourceUnionWith*>(sources.back().get());
+    ASSERT(rewrittenUnion);
+    ASSERT_TRUE(rewrittenUnion->isSortedMerge());
+    const auto* subSources = rewrittenUnion->getSubPipeline();
+    ASSERT(subSources);
+    ASSERT_FALSE(subSources->empty());
+    ASSERT(dynamic_cast<DocumentSourceSort*>(subSources->back().get()));
+}
+
+TEST_F(DocumentSourceUnionWithTest, DoesNotMergeSortThatAbsorbsALimit) {
+    auto expCtx = getExpCtx();
+    auto unionWith = make_intrusive<DocumentSourceUnionWith>(
+        expCtx, Pipeline::create(std::list<boost::intrusive_ptr<DocumentSource>>{}, expCtx));
+    auto sort = DocumentSourceSort::create(expCtx, BSON("a" << 1));
+    auto limit = DocumentSourceLimit::create(expCtx, 3);
+    auto pipeline = Pipeline::create({unionWith, sort, limit}, expCtx);
+    pipeline->optimizePipeline();
+
+    // The $sort absorbs the $limit into a top-k sort and must not be duplicated across the union.
+    const auto& sources = pipeline->getSources();
+    auto unchangedUnion = dynamic_cast<DocumentSourceUnionWith*>(sources.front().get());
+    ASSERT(unchangedUnion);
+    ASSERT_FALSE(unchangedUnion->isSortedMerge());
+    auto absorbedSort = dynamic_cast<DocumentSourceSort*>(std::next(sources.begin())->get());
+    ASSERT(absorbedSort);
+    ASSERT_TRUE(absorbedSort->hasLimit());
+}
+
 TEST_F(DocumentSourceUnionWithTest, SerializeAndParseWithPipeline) {
     auto expCtx = getExpCtx();
     NamespaceString nsToUnionWith =
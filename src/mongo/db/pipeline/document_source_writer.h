@@ -269,8 +269,13 @@ DocumentSource::GetNextResult DocumentSourceWriter<B>::doGetNext() {
                 if (!batch.empty() &&
                     (bufferedBytes > maxBatchSizeBytes ||
                      batch.size() >= write_ops::kMaxWriteBatchSize)) {
+                    // Subsequent batches are likely to be about the same size as the one just
+                    // written, so reserve that capacity up front rather than re-growing the
+                    // buffer with every append.
+                    const auto lastBatchSize = batch.size();
                     flush(std::move(batchWrite), std::move(batch));
                     batch.clear();
+                    batch.reserve(lastBatchSize);
                     batchWrite = makeBatchedWriteRequest();
                     bufferedBytes = objSize;
                 }
@@ -4131,11 +4131,16 @@ const char* ExpressionInternalFLEBetween::getOpName() const {
  */
 intrusive_ptr<Expression> ExpressionNary::optimize() {
     uint32_t constOperandCount = 0;
+    bool hasSameTypeAssociativeOperand = false;
 
     for (auto& operand : _children) {
         operand = operand->optimize();
         if (dynamic_cast<ExpressionConstant*>(operand.get())) {
             ++constOperandCount;
+        } else if (auto nary = dynamic_cast<ExpressionNary*>(operand.get());
+                   nary && !strcmp(nary->getOpName(), getOpName()) &&
+                   nary->getAssociativity() == Associativity::kFull) {
+            hasSameTypeAssociativeOperand = true;
         }
     }
     // If all the operands are constant expressions, collapse the expression into one constant
@@ -4149,6 +4154,13 @@ intrusive_ptr<Expression> ExpressionNary::optimize() {
     // operators need to preserve their order-of-operations.
     invariant(!(getAssociativity() == Associativity::kLeft && isCommutative()));
 
+    // Without any constant operands or same-type associative operands to absorb, the rewrite
+    // below would only rebuild _children with identical contents, so skip it. This is the common
+    // case for expressions over field paths.
+    if (constOperandCount == 0 && !hasSameTypeAssociativeOperand) {
+        return this;
+    }
+
     // If the expression is associative, we can collapse all the consecutive constant operands
     // into one by applying the expression to those consecutive constant operands. If the
     // expression is also commutative we can reorganize all the operands so that all of the
@@ -194,7 +194,8 @@ ExpressionContext::ExpressionContext(
       _collator(std::move(collator)),
       _documentComparator(_collator.getCollator()),
       _valueComparator(_collator.getCollator()),
-      _resolvedNamespaces(std::move(resolvedNamespaces)) {
+      _resolvedNamespaces(
+          std::make_shared<const StringMap<ResolvedNamespace>>(std::move(resolvedNamespaces))) {
 
     // Only initialize 'variables' if we are given a runtimeConstants object. We delay initializing
     // variables and expect callers to invoke 'initializeReferencedSystemVariables()' after query
@@ -334,12 +335,16 @@ boost::intrusive_ptr<ExpressionContext> ExpressionContext::copyWith(
                                                     boost::none,  // runtimeConstants
                                                     std::move(collator),
                                                     mongoProcessInterface,
-                                                    _resolvedNamespaces,
+                                                    StringMap<ResolvedNamespace>{},  // shared below
                                                     uuid,
                                                     boost::none /* letParameters */,
                                                     mayDbProfile,
                                                     SerializationContext());
 
+    // The resolved-namespace map is immutable once stored, so the copy shares it with this
+    // context instead of deep-copying it and the view pipelines it holds.
+    expCtx->_resolvedNamespaces = _resolvedNamespaces;
+
     if (_collator.getIgnore()) {
         expCtx->setIgnoreCollator();
     }
@@ -86,6 +86,7 @@
 namespace mongo {
 
 class AggregateCommandRequest;
+class ChunkedMemoryAggregator;
 
 enum struct SbeCompatibility {
     // Not implemented in SBE.
@@ -365,8 +366,8 @@ public:
      * namespace not involved in the pipeline.
      */
     const ResolvedNamespace& getResolvedNamespace(const NamespaceString& nss) const {
-        auto it = _resolvedNamespaces.find(nss.coll());
-        invariant(it != _resolvedNamespaces.end(),
+        auto it = _resolvedNamespaces->find(nss.coll());
+        invariant(it != _resolvedNamespaces->end(),
                   str::stream() << "No resolved namespace provided for "
                                 << nss.toStringForErrorMsg());
         return it->second;
@@ -378,7 +379,7 @@ public:
      * then it will also return false.
      */
     bool noForeignNamespaces() const {
-        return _resolvedNamespaces.empty();
+        return _resolvedNamespaces->empty();
     }
 
     /**
@@ -407,14 +408,21 @@ public:
     }
 
     void setResolvedNamespaces(StringMap<ResolvedNamespace> resolvedNamespaces) {
-        _resolvedNamespaces = std::move(resolvedNamespaces);
+        _resolvedNamespaces =
+            std::make_shared<const StringMap<ResolvedNamespace>>(std::move(resolvedNamespaces));
     }
 
     void addResolvedNamespaces(
         const mongo::stdx::unordered_set<mongo::NamespaceString>& resolvedNamespaces) {
+        // The map is shared copy-on-write between contexts produced by copyWith(), so additions
+        // are made to a copy. They are visible to this context (and its future copies) only, which
+        // matches the behavior when each context owned a map of its own.
+        auto newResolvedNamespaces = *_resolvedNamespaces;
         for (const auto& nss : resolvedNamespaces) {
-            _resolvedNamespaces.try_emplace(nss.coll(), nss, std::vector<BSONObj>{});
+            newResolvedNamespaces.try_emplace(nss.coll(), nss, std::vector<BSONObj>{});
         }
+        _resolvedNamespaces = std::make_shared<const StringMap<ResolvedNamespace>>(
+            std::move(newResolvedNamespaces));
     }
 
     void setIsCappedDelete() {
@@ -721,6 +729,23 @@ public:
         return _collator.getIgnore();
     }
 
+    /**
+     * Sets the memory aggregator that blocking stages in this operation's pipelines attach their
+     * memory usage trackers to, giving the execution layer one approximate, cheaply-maintained
+     * memory usage figure for the whole operation.
+     */
+    void setMemoryAggregator(std::shared_ptr<ChunkedMemoryAggregator> memoryAggregator) {
+        _memoryAggregator = std::move(memoryAggregator);
+    }
+
+    /**
+     * Returns the memory aggregator for this operation, or nullptr if the execution layer did not
+     * provide one, in which case stages track their memory usage standalone.
+     */
+    const std::shared_ptr<ChunkedMemoryAggregator>& getMemoryAggregator() const {
+        return _memoryAggregator;
+    }
+
 protected:
     static const int kInterruptCheckPeriod = 128;
 
@@ -780,8 +805,12 @@ protected:
     DocumentComparator _documentComparator;
     ValueComparator _valueComparator;
 
-    // A map from namespace to the resolved namespace, in case any views are involved.
-    StringMap<ResolvedNamespace> _resolvedNamespaces;
+    // A map from namespace to the resolved namespace, in case any views are involved. Immutable
+    // once stored so that copyWith() can share it with the copy instead of deep-copying it (the
+    // values hold resolved view pipelines, which can be sizable); mutators above replace the whole
+    // map copy-on-write. Never null.
+    std::shared_ptr<const StringMap<ResolvedNamespace>> _resolvedNamespaces =
+        std::make_shared<const StringMap<ResolvedNamespace>>();
 
     int _interruptCounter = kInterruptCheckPeriod;
 
@@ -801,6 +830,10 @@ private:
     std::unique_ptr<ExpressionCounters> _expressionCounters;
     bool _gotTemporarilyUnavailableException = false;
 
+    // Aggregates the approximate memory usage of this operation's blocking stages when provided by
+    // the execution layer. See 'setMemoryAggregator()'.
+    std::shared_ptr<ChunkedMemoryAggregator> _memoryAggregator;
+
     // We use this set to indicate whether or not a system variable was referenced in the query that
     // is being executed (if the variable was referenced, it is an element of this set).
     stdx::unordered_set<Variables::Id> _systemVarsReferencedInQuery;
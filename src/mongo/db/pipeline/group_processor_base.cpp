@@ -42,7 +42,11 @@ GroupProcessorBase::GroupProcessorBase(const boost::intrusive_ptr<ExpressionCont
                                        int64_t maxMemoryUsageBytes)
     : _expCtx(expCtx),
       _memoryTracker{expCtx->allowDiskUse && !expCtx->inMongos, maxMemoryUsageBytes},
-      _groups(expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()) {}
+      _groups(expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()) {
+    if (const auto& memoryAggregator = expCtx->getMemoryAggregator()) {
+        _memoryTracker.attachTo(memoryAggregator.get());
+    }
+}
 
 void GroupProcessorBase::addAccumulationStatement(AccumulationStatement accumulationStatement) {
     tassert(7801002, "Can't mutate accumulated fields after initialization", !_executionStarted);
@@ -524,14 +524,16 @@ private:
 
     /**
      * Helper for public methods that parse pipelines from vectors of different types.
+     * 'getElemFunc' is taken as a template parameter rather than a std::function so the
+     * per-stage calls in the parse loop are not made through a type-erased indirection.
      */
-    template <class T>
+    template <class T, class GetElemFunc>
     static std::unique_ptr<Pipeline, PipelineDeleter> parseCommon(
         const std::vector<T>& rawPipeline,
         const boost::intrusive_ptr<ExpressionContext>& expCtx,
         PipelineValidatorCallback validator,
         bool isFacetPipeline,
-        std::function<BSONObj(T)> getElemFunc);
+        GetElemFunc getElemFunc);
 
     /**
      * Stitch together the source pointers by calling setSource() for each source in '_sources'.
@@ -100,8 +100,10 @@
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/document_source_skip.h"
 #include "mongo/db/pipeline/document_source_sort.h"
+#include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/pipeline/pipeline.h"
 #include "mongo/db/pipeline/search/search_helper.h"
 #include "mongo/db/pipeline/skip_and_limit.h"
@@ -367,6 +369,55 @@ SortAndUnpackInPipeline findUnpackAndSort(const Pipeline::SourceContainer& sourc
     }
     return su;
 }
+
+/**
+ * Replaces the first $group in 'container' with an equivalent $_internalStreamingGroup when the
+ * group's input is already sorted on a field that at least one of the _id sub-expressions is
+ * monotonic in. A streaming group only retains the accumulators for the current group key, so for
+ * ordered rollups it runs in bounded memory instead of building a hash table over every group.
+ * Returns true if the rewrite was performed.
+ */
+bool enableStreamingGroupIfPossible(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                    Pipeline::SourceContainer* container) {
+    DocumentSourceGroup* groupStage = nullptr;
+    boost::optional<FieldPath> sortField;
+    auto itr = container->begin();
+    for (; itr != container->end(); ++itr) {
+        if (auto groupStagePtr = dynamic_cast<DocumentSourceGroup*>(itr->get())) {
+            groupStage = groupStagePtr;
+            break;
+        }
+        if (auto sortStagePtr = dynamic_cast<DocumentSourceSort*>(itr->get())) {
+            // Metadata sort keys have no field path and cannot drive the rewrite.
+            sortField = sortStagePtr->getSortKeyPattern().front().fieldPath;
+        } else if (!itr->get()->constraints().preservesOrderAndMetadata) {
+            // The sort order established so far does not survive this stage.
+            sortField = boost::none;
+        }
+        // Modifying the sort field may change its type or values, making the monotonicity
+        // analysis below unsound, so treat the input as unsorted.
+        if (sortField && itr->get()->getModifiedPaths().canModify(*sortField)) {
+            sortField = boost::none;
+        }
+    }
+
+    if (groupStage == nullptr || !sortField) {
+        return false;
+    }
+
+    auto streamingGroup =
+        DocumentSourceStreamingGroup::convertFromGroupIfPossible(expCtx, groupStage, *sortField);
+    if (!streamingGroup) {
+        return false;
+    }
+    *itr = std::move(streamingGroup);
+
+    // Streaming group isn't supported in SBE yet and we don't want to run the pipeline in hybrid
+    // mode due to potential perf impact.
+    expCtx->sbePipelineCompatibility = SbeCompatibility::notCompatible;
+
+    return true;
+}
 }  // namespace
 
 StatusWith<unique_ptr<PlanExecutor, PlanExecutor::Deleter>> PipelineD::createRandomCursorExecutor(
@@ -1593,6 +1644,10 @@ PipelineD::BuildQueryExecutorResult PipelineD::buildInnerQueryExecutorGeneric(
     Pipeline::SourceContainer& sources = pipeline->_sources;
     auto expCtx = pipeline->getContext();
 
+    // If the pipeline sorts its input on a field that the _id of a later $group is monotonic in,
+    // that group can be evaluated incrementally instead of building a hash table over every group.
+    enableStreamingGroupIfPossible(expCtx, &sources);
+
     // Look for an initial match. This works whether we got an initial query or not. If not, it
     // results in a "{}" query, which will be what we want in that case.
     const BSONObj queryObj = pipeline->getInitialQuery();
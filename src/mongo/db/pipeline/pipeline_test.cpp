@@ -4495,6 +4495,69 @@ TEST(PipelineOptimizationTest, CoalesceAdjacentExclusionProjectionsNestedSecond)
     assertPipelineOptimizesTo(inputPipe, outputPipe);
 }
 
+TEST(PipelineOptimizationTest, CoalesceAdjacentInclusionProjectionsSimple) {
+    const std::string inputPipe =
+        "[{ $project: { a: true, b: true } }"
+        ",{ $project: { b: true } }"
+        "]";
+    const std::string outputPipe =
+        "[{ $project: { _id: true, b: true } }"
+        "]";
+    // Projections are coalesced to the intersection of their included fields.
+    assertPipelineOptimizesTo(inputPipe, outputPipe);
+}
+
+TEST(PipelineOptimizationTest, CoalesceAdjacentInclusionProjectionsTernary) {
+    const std::string inputPipe =
+        "[{ $project: { a: true, b: true, c: true } }"
+        ",{ $project: { b: true, c: true } }"
+        ",{ $project: { b: true } }"
+        "]";
+    const std::string outputPipe =
+        "[{ $project: { _id: true, b: true } }"
+        "]";
+    // Projections are coalesced.
+    assertPipelineOptimizesTo(inputPipe, outputPipe);
+}
+
+TEST(PipelineOptimizationTest, CoalesceAdjacentInclusionProjectionsIdFalse) {
+    const std::string inputPipe =
+        "[{ $project: { a: true, _id: false } }"
+        ",{ $project: { a: true } }"
+        "]";
+    const std::string outputPipe =
+        "[{ $project: { a: true, _id: false } }"
+        "]";
+    // The _id field survives only if neither projection suppresses it.
+    assertPipelineOptimizesTo(inputPipe, outputPipe);
+}
+
+TEST(PipelineOptimizationTest, CoalesceAdjacentInclusionProjectionsNested) {
+    const std::string inputPipe =
+        "[{ $project: { a: { b: true } } }"
+        ",{ $project: { a: true } }"
+        "]";
+    const std::string outputPipe =
+        "[{ $project: { _id: true, a: { b: true } } }"
+        ",{ $project: { _id: true, a: true } }"
+        "]";
+    // Projections with nested fields are not coalesced.
+    assertPipelineOptimizesTo(inputPipe, outputPipe);
+}
+
+TEST(PipelineOptimizationTest, CoalesceAdjacentInclusionProjectionsComputed) {
+    const std::string inputPipe =
+        "[{ $project: { a: '$b' } }"
+        ",{ $project: { a: true } }"
+        "]";
+    const std::string outputPipe =
+        "[{ $project: { _id: true, a: '$b' } }"
+        ",{ $project: { _id: true, a: true } }"
+        "]";
+    // Projections with computed fields are not coalesced.
+    assertPipelineOptimizesTo(inputPipe, outputPipe);
+}
+
 }  // namespace Local
 
 namespace Sharded {
@@ -936,6 +936,31 @@ Document CommonMongodProcessInterface::readRecordFromRecordStore(
     return Document(possibleRecord.toBson());
 }
 
+std::vector<Document> CommonMongodProcessInterface::readRecordsFromRecordStore(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    RecordStore* rs,
+    RecordId firstRecordId,
+    size_t maxRecords,
+    size_t maxBytes) const {
+    std::vector<Document> docs;
+    Lock::GlobalLock lk(expCtx->opCtx, MODE_IS);
+    auto cursor = rs->getCursor(expCtx->opCtx);
+    auto record = cursor->seekExact(firstRecordId);
+    tassert(9512704, str::stream() << "Could not find document id " << firstRecordId, record);
+    size_t bytesRead = 0;
+    while (record) {
+        // The cursor may invalidate its current record's buffer on the next call to next(), so
+        // each document must own its storage.
+        docs.push_back(Document(record->data.toBson().getOwned()));
+        bytesRead += record->data.size();
+        if (docs.size() >= maxRecords || bytesRead >= maxBytes) {
+            break;
+        }
+        record = cursor->next();
+    }
+    return docs;
+}
+
 void CommonMongodProcessInterface::deleteRecordFromRecordStore(
     const boost::intrusive_ptr<ExpressionContext>& expCtx, RecordStore* rs, RecordId rID) const {
     assertIgnorePrepareConflictsBehavior(expCtx);
@@ -165,6 +165,13 @@ public:
                                        RecordStore* rs,
                                        RecordId rID) const final;
 
+    std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId firstRecordId,
+        size_t maxRecords,
+        size_t maxBytes) const final;
+
     void deleteRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                      RecordStore* rs,
                                      RecordId rID) const final;
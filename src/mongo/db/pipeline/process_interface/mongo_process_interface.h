@@ -640,6 +640,19 @@ public:
         RecordStore* rs,
         RecordId rID) const = 0;
 
+    /**
+     * Read a contiguous run of records from 'rs' starting at 'firstRecordId', stopping after
+     * 'maxRecords' records or once at least 'maxBytes' bytes have been read, whichever comes
+     * first. RecordStore must already exist and contain 'firstRecordId'; the run may end early if
+     * the record store has no further records. Asserts that the first record was found.
+     */
+    virtual std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId firstRecordId,
+        size_t maxRecords,
+        size_t maxBytes) const = 0;
+
     /**
      * Deletes the record with RecordId `rID` from `rs`. RecordStore must already exist.
      */
@@ -380,6 +380,15 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId firstRecordId,
+        size_t maxRecords,
+        size_t maxBytes) const override {
+        MONGO_UNREACHABLE;
+    }
+
     void deleteRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                      RecordStore* rs,
                                      RecordId rID) const override {
@@ -81,7 +81,9 @@
 #include "mongo/db/pipeline/document_source_set_variable_from_subpipeline.h"
 #include "mongo/db/pipeline/document_source_skip.h"
 #include "mongo/db/pipeline/document_source_sort.h"
+#include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/document_source_unwind.h"
+#include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/pipeline/lite_parsed_pipeline.h"
 #include "mongo/db/pipeline/process_interface/mongo_process_interface.h"
 #include "mongo/db/pipeline/search/search_helper.h"
@@ -1664,6 +1666,45 @@ void injectMetaCursor(Pipeline* mergePipeline,
     }
 }
 
+/**
+ * When the shard streams are merge-sorted ('shardCursorsSortSpec' is set), the first $group of the
+ * merging pipeline can often run in bounded memory as a $_internalStreamingGroup — the same rewrite
+ * the shards apply when grouping locally on sorted input. This matters most for high-cardinality
+ * rollups whose merging half would otherwise build a hash table over every group on the merging
+ * node.
+ */
+void convertFirstMergeGroupToStreamingIfPossible(Pipeline* mergePipeline,
+                                                 const BSONObj& shardCursorsSortSpec) {
+    // Derive the leading sort field from the merge sort pattern. Metadata sort keys have no field
+    // path and cannot drive the rewrite.
+    auto firstSortElem = shardCursorsSortSpec.firstElement();
+    if (!firstSortElem.isNumber() || firstSortElem.fieldNameStringData().startsWith("$")) {
+        return;
+    }
+    FieldPath sortField{firstSortElem.fieldNameStringData()};
+
+    auto& sources = mergePipeline->getSources();
+    for (auto itr = sources.begin(); itr != sources.end(); ++itr) {
+        if (auto* groupStage = dynamic_cast<DocumentSourceGroup*>(itr->get())) {
+            if (auto streamingGroup = DocumentSourceStreamingGroup::convertFromGroupIfPossible(
+                    mergePipeline->getContext(), groupStage, sortField)) {
+                *itr = std::move(streamingGroup);
+                // Streaming group isn't supported in SBE yet and we don't want to run the pipeline
+                // in hybrid mode due to potential perf impact.
+                mergePipeline->getContext()->sbePipelineCompatibility =
+                    SbeCompatibility::notCompatible;
+            }
+            return;
+        }
+        // The sort order established by the merged cursors must survive every stage between them
+        // and the $group, and no such stage may modify the sort field.
+        if (!itr->get()->constraints().preservesOrderAndMetadata ||
+            itr->get()->getModifiedPaths().canModify(sortField)) {
+            return;
+        }
+    }
+}
+
 /**
  * Adds a mergeCursors stage to the front of the pipeline to handle merging cursors from each
  * shard.
@@ -1689,6 +1730,9 @@ void partitionAndAddMergeCursorsSource(Pipeline* mergePipeline,
                                        boost::optional<BSONObj> shardCursorsSortSpec,
                                        bool requestQueryStatsFromRemotes) {
     auto [resultsCursors, metaCursors] = partitionCursors(std::move(cursors));
+    if (shardCursorsSortSpec) {
+        convertFirstMergeGroupToStreamingIfPossible(mergePipeline, *shardCursorsSortSpec);
+    }
     // Whether or not cursors are typed/untyped, the first is always the results cursor.
     addMergeCursorsSource(mergePipeline,
                           std::move(resultsCursors),
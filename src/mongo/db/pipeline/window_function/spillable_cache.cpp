@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <utility>
 
 
@@ -99,6 +100,8 @@ void SpillableCache::clear() {
         _expCtx->mongoProcessInterface->truncateRecordStore(_expCtx, _diskCache->rs());
     }
     _memCache.clear();
+    _diskReadBuffer.clear();
+    _diskReadBufferStartId = 0;
     _diskWrittenIndex = 0;
     _nextIndex = 0;
     _nextFreedIndex = 0;
@@ -168,8 +171,19 @@ Document SpillableCache::readDocumentFromDiskById(int desired) {
             str::stream() << "Attempted to read id " << desired
                           << "from disk in SpillableCache before writing",
             _diskCache && desired < _diskWrittenIndex);
-    return _expCtx->mongoProcessInterface->readRecordFromRecordStore(
-        _expCtx, _diskCache->rs(), RecordId(desired + 1));
+    // Spilled documents are overwhelmingly read in ascending id order, so fetch a batch of
+    // consecutive records per trip to the storage engine and serve subsequent reads from the
+    // read-ahead buffer. The batch is bounded the same way as the write batches in spillToDisk().
+    int offset = desired - _diskReadBufferStartId;
+    if (offset < 0 || offset >= static_cast<int>(_diskReadBuffer.size())) {
+        size_t maxRecords =
+            std::min(kMaxReadAheadRecords, static_cast<size_t>(_diskWrittenIndex - desired));
+        _diskReadBuffer = _expCtx->mongoProcessInterface->readRecordsFromRecordStore(
+            _expCtx, _diskCache->rs(), RecordId(desired + 1), maxRecords, kMaxWriteSize);
+        _diskReadBufferStartId = desired;
+        offset = 0;
+    }
+    return _diskReadBuffer[offset];
 }
 Document SpillableCache::readDocumentFromMemCacheById(int desired) {
     // If we have only freed documents from disk, the index into '_memCache' is off by the number of
@@ -132,6 +132,10 @@ public:
     void spillToDisk();
 
 private:
+    /**
+     * Returns the document with id 'desired' from the temporary table, reading ahead a batch of
+     * consecutive records so that subsequent sequential reads are served from memory.
+     */
     Document readDocumentFromDiskById(int desired);
     Document readDocumentFromMemCacheById(int desired);
     void verifyInCache(int desired);
@@ -143,6 +147,10 @@ private:
     std::deque<MemoryUsageTokenWith<Document>> _memCache;
 
     std::unique_ptr<TemporaryRecordStore> _diskCache = nullptr;
+    // Documents read ahead from the temporary table. Holds documents with consecutive ids starting
+    // at '_diskReadBufferStartId'.
+    std::vector<Document> _diskReadBuffer;
+    int _diskReadBufferStartId = 0;
     // The number of documents we've written to disk, as well as the recordID of the last document
     // written. Zero is an invalid RecordID, so writing will start with RecordId(1).
     int _diskWrittenIndex = 0;
@@ -154,6 +162,9 @@ private:
 
     // When spilling to disk, only write batches smaller than 16MB.
     static constexpr size_t kMaxWriteSize = 16 * 1024 * 1024;
+    // When reading spilled documents back, read ahead at most this many records (and at most
+    // 'kMaxWriteSize' bytes) per trip to the storage engine.
+    static constexpr size_t kMaxReadAheadRecords = 1000;
 
     // Be able to report that disk was used after the cache has been finalized.
     bool _usedDisk = false;
@@ -102,6 +102,29 @@ public:
         return Document(possibleRecord.toBson());
     }
 
+    std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId firstRecordId,
+        size_t maxRecords,
+        size_t maxBytes) const override {
+        std::vector<Document> docs;
+        AutoGetCollection autoColl(expCtx->opCtx, expCtx->ns, MODE_IX);
+        auto cursor = rs->getCursor(expCtx->opCtx);
+        auto record = cursor->seekExact(firstRecordId);
+        tassert(9512705, str::stream() << "Could not find document id " << firstRecordId, record);
+        size_t bytesRead = 0;
+        while (record) {
+            docs.push_back(Document(record->data.toBson().getOwned()));
+            bytesRead += record->data.size();
+            if (docs.size() >= maxRecords || bytesRead >= maxBytes) {
+                break;
+            }
+            record = cursor->next();
+        }
+        return docs;
+    }
+
     void deleteRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                      RecordStore* rs,
                                      RecordId rID) const override {
@@ -186,6 +209,18 @@ TEST_F(SpillableCacheTest, CanReturnDocumentsFromCacheAndDisk) {
     cache->finalize();
 }
 
+TEST_F(SpillableCacheTest, CanReadSpilledDocumentsInAnyOrder) {
+    _expCtx->allowDiskUse = true;
+    auto cache = createSpillableCache(1);
+    buildAndLoadDocumentSet(5, cache.get());
+    // Read backwards so that every read misses the read-ahead buffer.
+    for (int i = 4; i >= 0; --i) {
+        ASSERT_DOCUMENT_EQ(cache->getDocumentById(i), _docSet[i]);
+    }
+    cache->finalize();
+    _expCtx->allowDiskUse = false;
+}
+
 DEATH_TEST_F(SpillableCacheTest, RemovesDocumentsWhenExpired, "Requested expired document") {
     _expCtx->allowDiskUse = false;
     auto cache = createSpillableCache(1000);
@@ -30,16 +30,20 @@
 
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <absl/container/node_hash_map.h>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/init.h"  // IWYU pragma: keep
 #include "mongo/base/initializer.h"
+#include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/matcher/match_expression_dependencies.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/dependencies.h"
@@ -51,6 +55,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/intrusive_counter.h"
 #include "mongo/util/str.h"
 
@@ -66,6 +71,103 @@ boost::intrusive_ptr<ExpressionContext> makeExpCtx() {
     // Similar to collection validators, it's not safe to share an opCtx in a stored query.
     return make_intrusive<ExpressionContext>(nullptr, nullptr, NamespaceString{});
 }
+
+using CompiledPredicate = std::function<bool(const ProfileFilter::Args&)>;
+
+/**
+ * Attempts to compile a single comparison into a predicate that reads directly off
+ * CurOp/OpDebug, preserving match-language semantics for the cases it accepts. Returns
+ * boost::none for anything it cannot compile exactly.
+ */
+boost::optional<CompiledPredicate> compileLeaf(const MatchExpression* expr) {
+    switch (expr->matchType()) {
+        case MatchExpression::EQ:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+            break;
+        default:
+            return boost::none;
+    }
+    const auto* cmp = static_cast<const ComparisonMatchExpression*>(expr);
+    const auto data = cmp->getData();
+
+    if (cmp->path() == "ns") {
+        if (expr->matchType() != MatchExpression::EQ || data.type() != BSONType::String) {
+            return boost::none;
+        }
+        return CompiledPredicate([ns = data.str()](const ProfileFilter::Args& args) {
+            return args.curop.getNS() == ns;
+        });
+    }
+
+    if (cmp->path() == "millis" || cmp->path() == "durationMillis") {
+        // The rendered value is an integral millisecond count, so comparing as double is exact.
+        // Decimal operands would lose precision in the conversion and NaN operands compare
+        // differently in the match language, so both take the uncompiled path.
+        if (!data.isNumber() || data.type() == BSONType::NumberDecimal) {
+            return boost::none;
+        }
+        const double operand = data.numberDouble();
+        if (std::isnan(operand)) {
+            return boost::none;
+        }
+        auto millis = [](const ProfileFilter::Args& args) {
+            return static_cast<double>(durationCount<Milliseconds>(
+                args.op.additiveMetrics.executionTime.value_or(Microseconds{0})));
+        };
+        switch (expr->matchType()) {
+            case MatchExpression::EQ:
+                return CompiledPredicate(
+                    [=](const ProfileFilter::Args& args) { return millis(args) == operand; });
+            case MatchExpression::GT:
+                return CompiledPredicate(
+                    [=](const ProfileFilter::Args& args) { return millis(args) > operand; });
+            case MatchExpression::GTE:
+                return CompiledPredicate(
+                    [=](const ProfileFilter::Args& args) { return millis(args) >= operand; });
+            case MatchExpression::LT:
+                return CompiledPredicate(
+                    [=](const ProfileFilter::Args& args) { return millis(args) < operand; });
+            case MatchExpression::LTE:
+                return CompiledPredicate(
+                    [=](const ProfileFilter::Args& args) { return millis(args) <= operand; });
+            default:
+                MONGO_UNREACHABLE;
+        }
+    }
+
+    return boost::none;
+}
+
+/**
+ * Attempts to compile the filter expression into a conjunction of direct predicates. Only a
+ * top-level AND (or a single leaf) of compilable comparisons qualifies; an empty filter
+ * compiles to an empty conjunction, which matches everything, like the matcher would.
+ */
+boost::optional<std::vector<CompiledPredicate>> compileMatchExpression(
+    const MatchExpression* root) {
+    std::vector<const MatchExpression*> leaves;
+    if (root->matchType() == MatchExpression::AND) {
+        for (size_t i = 0; i < root->numChildren(); ++i) {
+            leaves.push_back(root->getChild(i));
+        }
+    } else {
+        leaves.push_back(root);
+    }
+
+    std::vector<CompiledPredicate> predicates;
+    predicates.reserve(leaves.size());
+    for (const auto* leaf : leaves) {
+        auto predicate = compileLeaf(leaf);
+        if (!predicate) {
+            return boost::none;
+        }
+        predicates.push_back(std::move(*predicate));
+    }
+    return predicates;
+}
 }  // namespace
 
 ProfileFilterImpl::ProfileFilterImpl(BSONObj expr) : _matcher(expr.getOwned(), makeExpCtx()) {
@@ -83,12 +185,25 @@ ProfileFilterImpl::ProfileFilterImpl(BSONObj expr) : _matcher(expr.getOwned(), m
 
     // Remember a list of functions we'll call whenever we need to build BSON from CurOp.
     _makeBSON = OpDebug::appendStaged(_dependencies, _needWholeDocument);
+
+    // Simple filters compile down to direct predicate checks against CurOp/OpDebug, which lets
+    // matches() skip the per-operation BSON rendering altogether.
+    _compiledPredicates = compileMatchExpression(_matcher.getMatchExpression());
 }
 
 bool ProfileFilterImpl::matches(OperationContext* opCtx,
                                 const OpDebug& op,
                                 const CurOp& curop) const {
     try {
+        if (_compiledPredicates) {
+            const ProfileFilter::Args args(opCtx, op, curop);
+            for (const auto& predicate : *_compiledPredicates) {
+                if (!predicate(args)) {
+                    return false;
+                }
+            }
+            return true;
+        }
         return _matcher.matches(_makeBSON({opCtx, op, curop}));
     } catch (const DBException& e) {
         LOGV2_DEBUG(4910202, 5, "Profile filter threw an exception", "exception"_attr = e);
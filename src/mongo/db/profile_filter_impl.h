@@ -30,8 +30,10 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <absl/container/node_hash_map.h>
+#include <boost/optional/optional.hpp>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
@@ -62,6 +64,14 @@ private:
 
     Matcher _matcher;
     std::function<BSONObj(ProfileFilter::Args)> _makeBSON;
+
+    // When the filter expression consists only of simple comparisons on fields that can be read
+    // directly off CurOp/OpDebug (e.g. {millis: {$gt: N}}, {ns: "db.coll"}), the constructor
+    // compiles it into this conjunction of direct predicates and matches() skips rendering the
+    // op as BSON entirely. Empty means the expression could not be compiled and matches() falls
+    // back to '_matcher' over the staged BSON rendering.
+    boost::optional<std::vector<std::function<bool(const ProfileFilter::Args&)>>>
+        _compiledPredicates;
 };
 
 }  // namespace mongo
@@ -263,6 +263,10 @@ void CanonicalQuery::initCq(boost::intrusive_ptr<ExpressionContext> expCtx,
     if (_findCommand->getReturnKey()) {
         _metadataDeps.set(DocumentMetadataFields::kIndexKey);
     }
+
+    // The tree shape is fixed from here on (setCollator() only mutates leaves in place), so a
+    // single-pass matcher built over it now remains valid for the lifetime of the query.
+    _flatMatcher = FlatBsonMatcher::tryCreate(_primaryMatchExpression.get());
 }
 
 void CanonicalQuery::setCollator(std::unique_ptr<CollatorInterface> collator) {
@@ -296,6 +300,22 @@ void CanonicalQuery::serializeToBson(BSONObjBuilder* out) const {
     }
 }
 
+namespace {
+
+/**
+ * Returns true if 'elt' can serve as the comparison value of a simple _id equality: either a
+ * literal object match (no leading query operator) or a type for which exact index bounds can be
+ * generated. The _id value cannot be something like { $gt : ... }, but it can be BinData.
+ */
+bool isSimpleIdValue(const BSONElement& elt) {
+    if (elt.type() == Object) {
+        return elt.Obj().firstElementFieldName()[0] != '$';
+    }
+    return Indexability::isExactBoundsGenerating(elt);
+}
+
+}  // namespace
+
 // static
 bool CanonicalQuery::isSimpleIdQuery(const BSONObj& query) {
     bool hasID = false;
@@ -307,15 +327,17 @@ bool CanonicalQuery::isSimpleIdQuery(const BSONObj& query) {
             // Verify that the query on _id is a simple equality.
             hasID = true;
 
-            if (elt.type() == Object) {
-                // If the value is an object, it can't have a query operator
-                // (must be a literal object match).
-                if (elt.Obj().firstElementFieldName()[0] == '$') {
+            if (elt.type() == Object && elt.Obj().firstElementFieldName()[0] == '$') {
+                // The only operator allowed is a single $eq, the operator form of a simple
+                // equality: {_id: {$eq: <value>}}. The wrapped value is subject to the same
+                // requirements as the bare form.
+                BSONObj inner = elt.Obj();
+                if (inner.nFields() != 1 ||
+                    inner.firstElementFieldNameStringData() != "$eq"_sd ||
+                    !isSimpleIdValue(inner.firstElement())) {
                     return false;
                 }
-            } else if (!Indexability::isExactBoundsGenerating(elt)) {
-                // The _id fild cannot be something like { _id : { $gt : ...
-                // But it can be BinData.
+            } else if (!isSimpleIdValue(elt)) {
                 return false;
             }
         } else {
@@ -326,6 +348,15 @@ bool CanonicalQuery::isSimpleIdQuery(const BSONObj& query) {
     return hasID;
 }
 
+// static
+BSONElement CanonicalQuery::simpleIdQueryValue(const BSONObj& query) {
+    BSONElement elt = query["_id"];
+    if (elt.type() == Object && elt.Obj().firstElementFieldNameStringData() == "$eq"_sd) {
+        return elt.Obj().firstElement();
+    }
+    return elt;
+}
+
 Status CanonicalQuery::isValidNormalized(const MatchExpression* root) {
     if (auto numGeoNear = QueryPlannerCommon::countNodes(root, MatchExpression::GEO_NEAR);
         numGeoNear > 0) {
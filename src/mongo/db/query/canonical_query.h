@@ -46,6 +46,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/matcher/flat_bson_matcher.h"
 #include "mongo/db/matcher/extensions_callback.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/namespace_string.h"
@@ -115,10 +116,18 @@ public:
         OperationContext* opCtx, const CanonicalQuery& baseQuery, size_t i);
 
     /**
-     * Returns true if "query" describes an exact-match query on _id.
+     * Returns true if "query" describes an exact-match query on _id, either as {_id: <value>} or
+     * in the operator form {_id: {$eq: <value>}}.
      */
     static bool isSimpleIdQuery(const BSONObj& query);
 
+    /**
+     * Returns the _id comparison value of a query accepted by isSimpleIdQuery(), unwrapping the
+     * {_id: {$eq: <value>}} operator form to the bare <value>. The returned element's field name
+     * is not necessarily "_id"; callers building a key or document from it must rewrap it.
+     */
+    static BSONElement simpleIdQueryValue(const BSONObj& query);
+
     /**
      * Perform validation checks on the normalized 'root' which could not be checked before
      * normalization - those should happen in parsed_find_command::isValid().
@@ -136,6 +145,14 @@ public:
     MatchExpression* getPrimaryMatchExpression() const {
         return _primaryMatchExpression.get();
     }
+
+    /**
+     * Returns the single-pass matcher for the primary match expression, engaged only when the
+     * filter is a conjunction of top-level comparisons. See FlatBsonMatcher.
+     */
+    const boost::optional<FlatBsonMatcher>& getFlatMatcher() const {
+        return _flatMatcher;
+    }
     const BSONObj& getQueryObj() const {
         return _findCommand->getFilter();
     }
@@ -423,6 +440,11 @@ private:
     // The match expression at the base of the query tree.
     std::unique_ptr<MatchExpression> _primaryMatchExpression;
 
+    // Single-pass evaluator over raw BSON for flat conjunctions of comparisons; points into
+    // '_primaryMatchExpression' and is rebuilt nowhere since the tree shape is fixed after
+    // initCq().
+    boost::optional<FlatBsonMatcher> _flatMatcher;
+
     boost::optional<projection_ast::Projection> _proj;
 
     boost::optional<SortPattern> _sortPattern;
@@ -556,5 +556,32 @@ TEST(CanonicalQueryTest, DoParameterizeRegularExpressions) {
     auto cq = canonicalize("{a: 1, b: {$lt: 5}}");
     ASSERT_TRUE(cq->isParameterized());
 }
+
+TEST(CanonicalQueryTest, IsSimpleIdQueryAcceptsBareAndOperatorEqualityForms) {
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: 1}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: 'str'}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {a: 1}}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {$eq: 1}}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {$eq: {a: 1}}}")));
+
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{a: 1}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: 1, a: 1}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {$gt: 1}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {$eq: 1, $lt: 5}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {$eq: [1, 2]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: {$eq: {$gt: 1}}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdQuery(fromjson("{_id: [1, 2]}")));
+}
+
+TEST(CanonicalQueryTest, SimpleIdQueryValueUnwrapsOperatorForm) {
+    ASSERT_BSONOBJ_EQ(CanonicalQuery::simpleIdQueryValue(fromjson("{_id: 5}")).wrap("_id"),
+                      fromjson("{_id: 5}"));
+    ASSERT_BSONOBJ_EQ(CanonicalQuery::simpleIdQueryValue(fromjson("{_id: {$eq: 5}}")).wrap("_id"),
+                      fromjson("{_id: 5}"));
+    ASSERT_BSONOBJ_EQ(
+        CanonicalQuery::simpleIdQueryValue(fromjson("{_id: {$eq: {a: 1}}}")).wrap("_id"),
+        fromjson("{_id: {a: 1}}"));
+}
 }  // namespace
 }  // namespace mongo
@@ -99,9 +99,11 @@ public:
 
 class PlanCachePartitioner {
 public:
+    // Determines the partitioning function for use with the 'Partitioned' utility. Distributing
+    // entries by key hash lets concurrent lookups for distinct query shapes proceed on separate
+    // partition mutexes.
     std::size_t operator()(const PlanCacheKey& k, const std::size_t nPartitions) const {
-        tassert(5968000, "classic plan cache should only have one partition", nPartitions == 1);
-        return 0;
+        return PlanCacheKeyHasher{}(k) % nPartitions;
     }
 };
 
@@ -29,6 +29,7 @@
 
 #include "mongo/db/query/collection_query_info.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <string>
@@ -70,6 +71,7 @@
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util_core.h"
+#include "mongo/util/processinfo.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -114,12 +116,27 @@ void recordCollectionIndexUsage(const CollectionPtr& coll,
 
 }  // namespace
 
+namespace {
+
+// Number of partitions for the per-collection classic plan cache. Scales with the host's core
+// count so concurrent lookups for distinct query shapes don't serialize on one mutex, capped so
+// the per-partition entry budget (total size / partitions) stays reasonable for small caches.
+size_t numPlanCachePartitions() {
+    static const size_t numPartitions =
+        std::clamp<size_t>(ProcessInfo::getNumAvailableCores(), 1, 16);
+    return numPartitions;
+}
+
+}  // namespace
+
 CollectionQueryInfo::PlanCacheState::PlanCacheState()
-    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load())} {}
+    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load()),
+                       numPlanCachePartitions()} {}
 
 CollectionQueryInfo::PlanCacheState::PlanCacheState(OperationContext* opCtx,
                                                     const Collection* collection)
-    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load())},
+    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load()),
+                       numPlanCachePartitions()},
       planCacheInvalidator{collection, opCtx->getServiceContext()} {
     std::vector<CoreIndexInfo> indexCores;
 
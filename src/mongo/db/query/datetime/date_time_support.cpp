@@ -1174,6 +1174,20 @@ Date_t dateAdd(Date_t date, TimeUnit unit, long long amount, const TimeZone& tim
                           << serializeTimeUnit(unit),
             isDateAddAmountValid(amount, unit));
 
+    // In UTC and fixed-offset timezones there are no DST transitions, so units of week and smaller
+    // have a fixed length and the addition reduces to millisecond arithmetic. This avoids
+    // materializing a timelib time, which dominates the cost of this function for callers that
+    // step a date forward in a loop, such as $densify. On overflow fall through to the generic
+    // algorithm, which detects and reports it.
+    if ((timezone.isUtcZone() || timezone.isUtcOffsetZone()) && unit != TimeUnit::year &&
+        unit != TimeUnit::quarter && unit != TimeUnit::month) {
+        long long millisToAdd, newMillis;
+        if (!overflow::mul(amount, timeUnitTypicalMilliseconds(unit), &millisToAdd) &&
+            !overflow::add(date.toMillisSinceEpoch(), millisToAdd, &newMillis)) {
+            return Date_t::fromMillisSinceEpoch(newMillis);
+        }
+    }
+
     auto localTime = timezone.getTimelibTime(date);
     auto microSec = durationCount<Microseconds>(Milliseconds(date.toMillisSinceEpoch() % 1000));
     localTime->us = microSec;
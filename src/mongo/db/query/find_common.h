@@ -129,13 +129,15 @@ public:
                               CursorResponseBuilder* builder,
                               ResourceConsumption::DocumentUnitCounter* docUnitsReturned,
                               BSONObj& pbrt,
-                              bool& failedToAppend)
+                              bool& failedToAppend,
+                              const size_t byteBudget = kMaxBytesToReturnToClientAtOnce)
             : _alwaysAcceptFirstDoc{alwaysAcceptFirstDoc},
               _exec{exec},
               _builder{builder},
               _docUnitsReturned{docUnitsReturned},
               _pbrt{pbrt},
-              _failedToAppend{failedToAppend} {}
+              _failedToAppend{failedToAppend},
+              _byteBudget{byteBudget} {}
 
         BSONObjCursorAppender(const BSONObjCursorAppender&) = default;
         ~BSONObjCursorAppender() = default;
@@ -147,7 +149,8 @@ public:
             objSize = obj.objsize();
 
             if (MONGO_unlikely(!(_alwaysAcceptFirstDoc && numAppended == 0) &&
-                               !FindCommon::fitsInBatch(_builder->bytesUsed(), objSize))) {
+                               !FindCommon::fitsInBatch(_builder->bytesUsed(), objSize,
+                                                        _byteBudget))) {
                 // We failed to append to batch; we should stash & early out. We don't want to
                 // update the resume token here.
                 _failedToAppend = true;
@@ -172,12 +175,22 @@ public:
         BSONObj& _pbrt;
         bool& _failedToAppend;
 
+        // The byte budget for this batch; at most kMaxBytesToReturnToClientAtOnce, but may be
+        // smaller for cursors whose getMore batches are adaptively sized.
+        const size_t _byteBudget;
+
         // State within append() calls.
         size_t objSize;
     };
 
     MONGO_COMPILER_ALWAYS_INLINE static bool fitsInBatch(size_t bytesBuffered, size_t objSize) {
-        return (bytesBuffered + objSize) <= kMaxBytesToReturnToClientAtOnce;
+        return fitsInBatch(bytesBuffered, objSize, kMaxBytesToReturnToClientAtOnce);
+    }
+
+    MONGO_COMPILER_ALWAYS_INLINE static bool fitsInBatch(size_t bytesBuffered,
+                                                         size_t objSize,
+                                                         size_t byteBudget) {
+        return (bytesBuffered + objSize) <= byteBudget;
     }
 
     /**
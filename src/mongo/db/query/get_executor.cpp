@@ -1995,12 +1995,10 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorUpda
                         request, driver, opDebug, std::move(documentCounter));
 
                     fastPathQueryCounters.incrementIdHackQueryCounter();
-                    return InternalPlanner::updateWithIdHack(opCtx,
-                                                             coll,
-                                                             updateStageParams,
-                                                             idIndexDesc,
-                                                             unparsedQuery["_id"].wrap(),
-                                                             policy);
+                    BSONObj idQuery =
+                        CanonicalQuery::simpleIdQueryValue(unparsedQuery).wrap("_id");
+                    return InternalPlanner::updateWithIdHack(
+                        opCtx, coll, updateStageParams, idIndexDesc, idQuery, policy);
                 }
             }
         }
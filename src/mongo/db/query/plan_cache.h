@@ -174,7 +174,8 @@ public:
     CachedPlanHolder(const PlanCacheEntryBase<CachedPlanType, DebugInfoType>& entry)
         : cachedPlan(entry.cachedPlan->clone()),
           decisionReadsOrWorks(entry.readsOrWorks),
-          debugInfo(entry.debugInfo) {}
+          debugInfo(entry.debugInfo),
+          executions(entry.executions()) {}
 
     /**
      * Indicates whether or not the cached plan is pinned to cache.
@@ -212,6 +213,12 @@ public:
     // Per-plan cache entry information that is used for debugging purpose. Shared across all plans
     // recovered from the same cached entry.
     const std::shared_ptr<const DebugInfoType> debugInfo;
+
+    // Snapshot of the number of times a plan had been recovered from the shared cache entry at the
+    // moment this holder was constructed, including this recovery. Consumers may compare this
+    // against a hotness threshold when deciding whether the recovered plan is worth promoting to a
+    // cheaper-to-execute representation.
+    const uint64_t executions;
 };
 
 /**
@@ -371,7 +378,26 @@ public:
     // turn own, and so on.
     const uint64_t estimatedEntrySizeBytes;
 
+    /**
+     * Returns the number of times a plan has been recovered from this entry for execution since
+     * the entry was created. Serves as the hotness signal for tiering decisions about the cached
+     * plan, such as deciding when its runtime representation is worth recompiling to a cheaper
+     * form.
+     */
+    uint64_t executions() const {
+        return _executions.loadRelaxed();
+    }
+
+    void incrementExecutions() const {
+        _executions.fetchAndAddRelaxed(1);
+    }
+
 private:
+    // Unlike the clonable pieces of the entry, this counter may be updated through a const entry
+    // without holding the partition lock. Deliberately not preserved by clone(): a cloned entry
+    // represents a state transition (e.g. deactivation) and restarts cold.
+    mutable AtomicWord<uint64_t> _executions{0};
+
     /**
      * All arguments constructor.
      */
@@ -666,6 +692,7 @@ public:
             state = entrySharedPtr->isActive ? CacheEntryState::kPresentActive
                                              : CacheEntryState::kPresentInactive;
         }
+        entrySharedPtr->incrementExecutions();
         // The purpose of cloning 'entry' (in CachedPlanHolder ctor) after we release the lock
         // is to allow multiple threads to clone the same plan cache entry at once. 'entry'
         // cannot be deleted by another thread even if the plan cache is being concurrently
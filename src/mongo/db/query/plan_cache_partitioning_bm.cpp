@@ -0,0 +1,96 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "mongo/db/query/partitioned_cache.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Measures lookup throughput of the partitioned cache underlying the plan caches as a function of
+ * partition count and thread count, so that partition-mutex contention regressions on the cache
+ * hit path are visible.
+ */
+
+struct TrivialBudgetEstimator {
+    size_t operator()(const uint64_t&, const std::shared_ptr<const uint64_t>&) {
+        return 1;
+    }
+};
+
+struct TrivialPartitioner {
+    std::size_t operator()(const uint64_t& k, const std::size_t nPartitions) const {
+        return k % nPartitions;
+    }
+};
+
+using BmCache = PartitionedCache<uint64_t,
+                                 std::shared_ptr<const uint64_t>,
+                                 TrivialBudgetEstimator,
+                                 TrivialPartitioner>;
+
+constexpr size_t kNumEntries = 1024;
+
+// Shared across benchmark threads; (re)built by thread 0 for each partition-count argument.
+std::unique_ptr<BmCache> globalCache;  // NOLINT
+
+void BM_PartitionedCacheLookup(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        globalCache = std::make_unique<BmCache>(kNumEntries, state.range(0));
+        for (uint64_t key = 0; key < kNumEntries; ++key) {
+            globalCache->put(key, std::make_shared<const uint64_t>(key));
+        }
+    }
+
+    // Each thread probes a different key sequence so lookups spread over all partitions.
+    uint64_t key = state.thread_index() * 7919;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(globalCache->lookup(key++ % kNumEntries));
+    }
+
+    if (state.thread_index() == 0) {
+        globalCache.reset();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_PartitionedCacheLookup)
+    ->Args({1})
+    ->Args({8})
+    ->Args({32})
+    ->Args({128})
+    ->ThreadRange(1, 32);
+
+}  // namespace
+}  // namespace mongo
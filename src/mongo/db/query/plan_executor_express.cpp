@@ -523,6 +523,15 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutor(
         shardFilter,
         projection);
 }
+
+/**
+ * The express _id lookup iterators expect a filter of the form {_id: <value>}. Rewrites the
+ * operator form of a simple _id equality, {_id: {$eq: <value>}}, into the bare form; filters
+ * already in the bare form are returned unchanged (rewrapped).
+ */
+BSONObj bareIdQueryFilter(const BSONObj& queryFilter) {
+    return CanonicalQuery::simpleIdQueryValue(queryFilter).wrap("_id");
+}
 }  // namespace
 
 std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindById(
@@ -533,7 +542,7 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
     bool returnOwnedBson) {
     return std::visit(
         [&](auto collectionAlternative) {
-            const BSONObj& queryFilter = cq->getQueryObj();
+            const BSONObj queryFilter = bareIdQueryFilter(cq->getQueryObj());
             return makeExpressExecutor(
                 opCtx,
                 express::IdLookupViaIndex<decltype(collectionAlternative)>(queryFilter),
@@ -554,7 +563,7 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
     bool returnOwnedBson) {
     return std::visit(
         [&](auto collectionAlternative) {
-            const BSONObj& queryFilter = cq->getQueryObj();
+            const BSONObj queryFilter = bareIdQueryFilter(cq->getQueryObj());
             return makeExpressExecutor(
                 opCtx,
                 express::IdLookupOnClusteredCollection<decltype(collectionAlternative)>(
@@ -643,9 +652,10 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForUpdat
             clustered_util::isClusteredOnId(collection.getCollectionPtr()->getClusteredInfo());
         if (isClusteredOnId) {
             return express::IdLookupOnClusteredCollection<CollectionAcquisition>(
-                request->getQuery());
+                bareIdQueryFilter(request->getQuery()));
         } else {
-            return express::IdLookupViaIndex<CollectionAcquisition>(request->getQuery());
+            return express::IdLookupViaIndex<CollectionAcquisition>(
+                bareIdQueryFilter(request->getQuery()));
         }
     }();
 
@@ -696,9 +706,10 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForDelet
             clustered_util::isClusteredOnId(collection.getCollectionPtr()->getClusteredInfo());
         if (isClusteredOnId) {
             return express::IdLookupOnClusteredCollection<CollectionAcquisition>(
-                request->getQuery());
+                bareIdQueryFilter(request->getQuery()));
         } else {
-            return express::IdLookupViaIndex<CollectionAcquisition>(request->getQuery());
+            return express::IdLookupViaIndex<CollectionAcquisition>(
+                bareIdQueryFilter(request->getQuery()));
         }
     }();
 
@@ -28,6 +28,7 @@
  */
 
 
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr.hpp>
@@ -73,6 +74,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/usdt.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/future.h"
@@ -318,6 +320,8 @@ PlanExecutor::ExecState PlanExecutorImpl::_getNextImpl(Snapshotted<Document>* ob
                                                        RecordId* dlOut) {
     checkFailPointPlanExecAlwaysFails();
 
+    MONGO_USDT(plan_executor_get_next, this);
+
     invariant(_currentState == kUsable);
     if (isMarkedAsKilled()) {
         uassertStatusOK(_killStatus);
@@ -357,6 +361,7 @@ PlanExecutor::ExecState PlanExecutorImpl::_getNextImpl(Snapshotted<Document>* ob
 
         WorkingSetID id = WorkingSet::INVALID_ID;
         PlanStage::StageState code = _root->work(&id);
+        MONGO_USDT(plan_executor_work, this, static_cast<int>(code));
 
         if (code != PlanStage::NEED_YIELD) {
             writeConflictsInARow = 0;
@@ -517,7 +522,6 @@ size_t PlanExecutorImpl::getNextBatch(size_t batchSize, AppendBSONObjFn append)
     };
     auto notifier = makeNotifier();
 
-    WorkingSetID id = WorkingSet::INVALID_ID;
     WorkingSetMember* member;
     PlanStage::StageState code;
 
@@ -535,19 +539,30 @@ size_t PlanExecutorImpl::getNextBatch(size_t batchSize, AppendBSONObjFn append)
         _stash.pop_front();
         append(objOut, getPostBatchResumeToken(), numResults);
         numResults++;
+        if (numResults >= batchSize) {
+            return numResults;
+        }
     }
 
+    // Drain the plan in batches to amortize per-document dispatch into the root stage. Cap the
+    // batch so interrupt, kill and yield checks still happen at a reasonable granularity.
+    constexpr size_t kMaxWorkBatch = 64;
+    std::vector<WorkingSetID> batchIds;
+    batchIds.reserve(kMaxWorkBatch);
+    bool stashing = false;
+
     for (;;) {
         _checkIfMustYield(whileYieldingFn);
 
-        code = _root->work(&id);
+        batchIds.clear();
+        code = _root->workBatch(std::min(batchSize - numResults, kMaxWorkBatch), &batchIds);
 
         if (code != PlanStage::NEED_YIELD) {
             writeConflictsInARow = 0;
             tempUnavailErrorsInARow = 0;
         }
 
-        if (code == PlanStage::ADVANCED) {
+        for (WorkingSetID id : batchIds) {
             // Process working set member.
             member = _workingSet->get(id);
             if (MONGO_likely(member->hasObj())) {
@@ -567,32 +582,36 @@ size_t PlanExecutorImpl::getNextBatch(size_t batchSize, AppendBSONObjFn append)
 
             } else {
                 _workingSet->free(id);
-                continue;  // Try to call work() again- we didn't get what we needed.
+                continue;  // We didn't get what we needed from this member.
             }
 
             _workingSet->free(id);
 
-            if (MONGO_unlikely(!append(objOut, getPostBatchResumeToken(), numResults))) {
+            if (MONGO_unlikely(stashing ||
+                               !append(objOut, getPostBatchResumeToken(), numResults))) {
+                // Once the appender declines a result, stash it and everything already produced
+                // in this batch for the next call.
                 stashResult(objOut);
-                break;
+                stashing = true;
+                continue;
             }
             numResults++;
+        }
 
-            // Only check if the query has been killed or if we've filled up the batch once a result
-            // has been produced. Doing these checks every loop can impact the performace of queries
-            // that repeatedly return NEED_TIME.
-            if (MONGO_unlikely(numResults >= batchSize)) {
-                break;
-            }
-
-            _checkIfKilled();
+        if (MONGO_unlikely(stashing || numResults >= batchSize)) {
+            break;
+        }
 
+        if (code == PlanStage::ADVANCED || code == PlanStage::NEED_TIME) {
+            // Only check if the query has been killed once results have been produced. Doing
+            // these checks on every unit of work can impact the performance of queries that
+            // repeatedly return NEED_TIME.
+            if (!batchIds.empty()) {
+                _checkIfKilled();
+            }
         } else if (code == PlanStage::NEED_YIELD) {
             _handleNeedYield(writeConflictsInARow, tempUnavailErrorsInARow);
 
-        } else if (code == PlanStage::NEED_TIME) {
-            // Do nothing except reset counters; need more time.
-
         } else if (_handleEOFAndExit(code, notifier)) {
             break;
         }
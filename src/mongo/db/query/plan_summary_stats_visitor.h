@@ -61,6 +61,9 @@ public:
     void visit(tree_walker::MaybeConstPtr<true, sbe::HashAggStats> stats) final {
         _summary.usedDisk |= stats->spilledRecords > 0;
     }
+    void visit(tree_walker::MaybeConstPtr<true, sbe::HashJoinStats> stats) final {
+        _summary.usedDisk |= stats->usedDisk;
+    }
     void visit(tree_walker::MaybeConstPtr<true, sbe::WindowStats> stats) final {
         _summary.usedDisk |= stats->spilledRecords > 0;
     }
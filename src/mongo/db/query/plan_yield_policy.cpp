@@ -137,6 +137,23 @@ Status PlanYieldPolicy::yieldOrInterrupt(OperationContext* opCtx,
     // again right away. We delay the resetTimer() call so that the clock doesn't start ticking
     // until after we return from the yield.
     ON_BLOCK_EXIT([this]() { resetTimer(); });
+
+    // A yield only benefits other operations if one is queued behind a lock this plan holds or the
+    // storage snapshot has grown old enough to matter. When neither is the case, downgrade the
+    // yield to the interrupt check it would have performed anyway and keep locks, snapshot and
+    // ticket, saving the save/restore cycle. The number of consecutive downgrades is bounded so
+    // that a plan cannot pin its snapshot and ticket indefinitely on an uncontended collection;
+    // waiters that arrive mid-interval are then picked up by the next full yield.
+    if (_policy == YieldPolicy::YIELD_AUTO && !_forceYield) {
+        const auto maxSkips = internalQueryExecYieldMaxSkipsWithoutConflict.load();
+        if (_skippedYieldsWithoutConflict < maxSkips &&
+            !shard_role_details::getLocker(opCtx)->hasConflictingWaiters()) {
+            ++_skippedYieldsWithoutConflict;
+            return opCtx->checkForInterruptNoAssert();
+        }
+    }
+    _skippedYieldsWithoutConflict = 0;
+
     _forceYield = false;
 
     for (int attempt = 1; true; attempt++) {
@@ -350,6 +350,10 @@ private:
     ClockSource* _fastClock;
     int64_t _nextYieldCheckpoint{0};
     bool _forceYield = false;
+
+    // Number of consecutive elapsed yield intervals which were downgraded to plain interrupt
+    // checks because no other operation was waiting on a lock this plan holds.
+    int _skippedYieldsWithoutConflict = 0;
 };
 
 }  // namespace mongo
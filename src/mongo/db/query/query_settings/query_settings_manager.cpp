@@ -144,6 +144,19 @@ boost::optional<QuerySettings> QuerySettingsManager::getQuerySettingsForQuerySha
     return queryShapeConfigurationsIt->second.first;
 }
 
+bool QuerySettingsManager::hasQueryShapeConfigurations(
+    OperationContext* opCtx, const boost::optional<TenantId>& tenantId) const {
+    auto readLock = _mutex.readLock();
+    const auto versionedQueryShapeConfigurationsIt =
+        _tenantIdToVersionedQueryShapeConfigurationsMap.find(tenantId);
+    if (versionedQueryShapeConfigurationsIt ==
+        _tenantIdToVersionedQueryShapeConfigurationsMap.end()) {
+        return false;
+    }
+    return !versionedQueryShapeConfigurationsIt->second.queryShapeHashToQueryShapeConfigurationsMap
+                .empty();
+}
+
 void QuerySettingsManager::setQueryShapeConfigurations(
     OperationContext* opCtx,
     std::vector<QueryShapeConfiguration>&& settingsArray,
@@ -141,6 +141,14 @@ public:
         const query_shape::QueryShapeHash& queryShapeHash,
         const boost::optional<TenantId>& tenantId) const;
 
+    /**
+     * Returns true if there is at least one query shape configuration for the given tenant.
+     * Callers may use this to avoid computing the query shape hash for the lookup when no query
+     * settings are set.
+     */
+    bool hasQueryShapeConfigurations(OperationContext* opCtx,
+                                     const boost::optional<TenantId>& tenantId) const;
+
     /**
      * Returns all query shape configurations and an associated timestamp for the given tenant
      * 'tenantId'.
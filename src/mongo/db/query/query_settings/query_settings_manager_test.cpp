@@ -270,4 +270,27 @@ TEST_F(QuerySettingsManagerTest, QuerySettingsLookup) {
                     configs[1].getSettings());
 }
 
+TEST_F(QuerySettingsManagerTest, HasQueryShapeConfigurations) {
+    RAIIServerParameterControllerForTest multitenanyController("multitenancySupport", true);
+    TenantId tenantId(OID::fromTerm(1)), otherTenantId(OID::fromTerm(2));
+
+    // No query shape configurations are present for any tenant initially.
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), tenantId));
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+
+    // Setting query shape configurations must only be reflected for the given tenant.
+    manager().setQueryShapeConfigurations(
+        opCtx(), getExampleQueryShapeConfigurations(opCtx(), tenantId), LogicalTime(), tenantId);
+    ASSERT_TRUE(manager().hasQueryShapeConfigurations(opCtx(), tenantId));
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+
+    // Installing an empty configurations vector is equivalent to having no configurations.
+    manager().setQueryShapeConfigurations(opCtx(), {}, LogicalTime(), otherTenantId);
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+
+    // Removing all query shape configurations must be reflected in the result.
+    manager().removeAllQueryShapeConfigurations(opCtx(), tenantId);
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), tenantId));
+}
+
 }  // namespace mongo::query_settings
@@ -354,6 +354,14 @@ QuerySettings lookupQuerySettingsForFind(const boost::intrusive_ptr<ExpressionCo
     }
 
     auto* opCtx = expCtx->opCtx;
+
+    // Avoid the expensive query shape hash computation when there are no query settings set: the
+    // lookup could only return an empty result.
+    auto& manager = QuerySettingsManager::get(opCtx);
+    if (!manager.hasQueryShapeConfigurations(opCtx, nss.dbName().tenantId())) {
+        return query_settings::QuerySettings();
+    }
+
     const auto& serializationContext = parsedFind.findCommandRequest->getSerializationContext();
     auto curOp = CurOp::get(opCtx);
     auto& opDebug = curOp->debug();
@@ -375,7 +383,6 @@ QuerySettings lookupQuerySettingsForFind(const boost::intrusive_ptr<ExpressionCo
     setQueryShapeHash(opCtx, hash);
 
     // Return the found query settings or an empty one.
-    auto& manager = QuerySettingsManager::get(opCtx);
     auto settings = manager.getQuerySettingsForQueryShapeHash(opCtx, *hash, nss.dbName().tenantId())
                         .get_value_or({});
 
@@ -415,6 +422,14 @@ QuerySettings lookupQuerySettingsForAgg(
     }
 
     auto* opCtx = expCtx->opCtx;
+
+    // Avoid the expensive query shape hash computation when there are no query settings set: the
+    // lookup could only return an empty result.
+    auto& manager = QuerySettingsManager::get(opCtx);
+    if (!manager.hasQueryShapeConfigurations(opCtx, nss.dbName().tenantId())) {
+        return query_settings::QuerySettings();
+    }
+
     const auto& serializationContext = aggregateCommandRequest.getSerializationContext();
     auto curOp = CurOp::get(opCtx);
     auto& opDebug = curOp->debug();
@@ -436,7 +451,6 @@ QuerySettings lookupQuerySettingsForAgg(
     setQueryShapeHash(opCtx, hash);
 
     // Return the found query settings or an empty one.
-    auto& manager = QuerySettingsManager::get(opCtx);
     auto settings = manager.getQuerySettingsForQueryShapeHash(opCtx, *hash, nss.dbName().tenantId())
                         .get_value_or({});
 
@@ -468,6 +482,14 @@ QuerySettings lookupQuerySettingsForDistinct(const boost::intrusive_ptr<Expressi
     }
 
     auto* opCtx = expCtx->opCtx;
+
+    // Avoid the expensive query shape hash computation when there are no query settings set: the
+    // lookup could only return an empty result.
+    auto& manager = QuerySettingsManager::get(opCtx);
+    if (!manager.hasQueryShapeConfigurations(opCtx, nss.dbName().tenantId())) {
+        return query_settings::QuerySettings();
+    }
+
     const auto& serializationContext =
         parsedDistinct.distinctCommandRequest->getSerializationContext();
     auto curOp = CurOp::get(opCtx);
@@ -491,7 +513,6 @@ QuerySettings lookupQuerySettingsForDistinct(const boost::intrusive_ptr<Expressi
     setQueryShapeHash(opCtx, hash);
 
     // Return the found query settings or an empty one.
-    auto& manager = QuerySettingsManager::get(opCtx);
     auto settings = manager.getQuerySettingsForQueryShapeHash(opCtx, *hash, nss.dbName().tenantId())
                         .get_value_or({});
 
@@ -30,11 +30,9 @@
 #pragma once
 
 #include <cstdint>
-#include <mutex>
 
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/clock_source.h"
-#include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/system_clock_source.h"
 #include "mongo/util/time_support.h"
@@ -90,7 +88,10 @@ public:
 private:
     /*
      * Resets the current window if it has ended. Returns the current time. This must be called in
-     * the beginning of each handleRequest...() method.
+     * the beginning of each handleRequest...() method. When several threads race past the end of a
+     * window, exactly one of them rolls the window over; requests admitted by other threads while
+     * the rollover is in flight may be attributed to either window, which is acceptable given the
+     * approximate bound this class provides.
      */
     Date_t tickWindow();
 
@@ -110,23 +111,21 @@ private:
     const Milliseconds _timePeriod;
 
     /*
-     * Window start.
+     * Window start, in milliseconds since epoch. All window state is maintained with atomics so
+     * that admitting a request costs a few atomic operations rather than a globally contended
+     * mutex; the bound was always documented as approximate, and the races this allows only
+     * misattribute a handful of requests around a window rollover.
      */
-    Date_t _windowStart;
+    AtomicWord<long long> _windowStartMillis;
 
     /*
      * Count of requests handled in the previous window.
      */
-    RequestCount _prevCount;
+    AtomicWord<RequestCount> _prevCount;
 
     /*
      * Count of requests handled in the current window.
      */
-    RequestCount _currentCount;
-
-    /*
-     * Mutex used when reading/writing the window.
-     */
-    SimpleMutex _windowMutex;
+    AtomicWord<RequestCount> _currentCount;
 };
 }  // namespace mongo
@@ -30,6 +30,8 @@
 
 #include "mongo/db/query/sbe_plan_cache.h"
 
+#include <algorithm>
+
 #include <absl/container/node_hash_map.h>
 
 
@@ -94,7 +96,11 @@ ServiceContext::ConstructorActionRegisterer planCacheRegisterer{
                         "cappedSize"_attr = cappedCacheSize);
         }
         auto& globalPlanCache = sbePlanCacheDecoration(serviceCtx);
-        globalPlanCache = std::make_unique<sbe::PlanCache>(cappedCacheSize, 32);
+        // Scale partitions with the host's core count so high-QPS lookup traffic across many
+        // query shapes doesn't serialize on a fixed set of partition mutexes.
+        const size_t numPartitions =
+            std::max<size_t>(32, 2 * ProcessInfo::getNumAvailableCores());
+        globalPlanCache = std::make_unique<sbe::PlanCache>(cappedCacheSize, numPartitions);
     }};
 
 }  // namespace
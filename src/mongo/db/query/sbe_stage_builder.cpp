@@ -3944,6 +3944,7 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
                                                 innerCondSlots,
                                                 innerProjectSlots,
                                                 collatorSlot,
+                                                _cq.getExpCtx()->allowDiskUse,
                                                 _yieldPolicy,
                                                 root->nodeId());
 
@@ -3966,6 +3967,7 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
                                                innerCondSlots,
                                                innerProjectSlots,
                                                collatorSlot,
+                                               _cq.getExpCtx()->allowDiskUse,
                                                _yieldPolicy,
                                                root->nodeId());
     }
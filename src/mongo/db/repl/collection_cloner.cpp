@@ -496,9 +496,9 @@ void CollectionCloner::handleNextBatch(DBClientCursor& cursor) {
 
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
     uassertStatusOK(cbd.status);
+    std::vector<BSONObj> docs;
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        std::vector<BSONObj> docs;
         // Increment 'fetchedBatches' even if no documents were inserted to match the number of
         // 'receivedBatches'.
         ++_stats.fetchedBatches;
@@ -512,17 +512,19 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
         _progressMeter.hit(int(docs.size()));
         invariant(_collLoader);
-
-        CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
-            ? ([](const BSONObj& doc) {
-                  return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
-              })
-            : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
     }
 
+    CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
+        ? ([](const BSONObj& doc) {
+              return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
+          })
+        : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
+    // CollectionBulkLoader is not thread safe, but it is only used by tasks on the db work task
+    // runner while the query is running, and those run serially in the order they are scheduled.
+    // Inserting outside of the mutex lets the network thread stash the next batch into
+    // '_documentsToInsert' while this one is being written to storage.
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
+
     initialSyncHangDuringCollectionClone.executeIf(
         [&](const BSONObj&) {
             LOGV2(21138,
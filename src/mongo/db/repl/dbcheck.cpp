@@ -63,6 +63,9 @@
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/server_feature_flags_gen.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/idl/idl_parser.h"
@@ -344,6 +347,20 @@ DataCorruptionDetectionMode swapDataCorruptionMode(OperationContext* opCtx,
     return prevMode;
 }
 
+bool enableScanPrefetching(OperationContext* opCtx) {
+    // dbCheck batches scan the _id index (or a secondary index for the extra index keys check)
+    // sequentially and are usually cold, so every leaf page boundary is otherwise a synchronous
+    // read stall. Let the storage engine detect the scan and read ahead of the cursor position in
+    // the background. The session configuration is restored when the session returns to the cache.
+    if (gFeatureFlagPrefetch.isEnabled(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot()) &&
+        !opCtx->getServiceContext()->getStorageEngine()->isEphemeral()) {
+        shard_role_details::getRecoveryUnit(opCtx)->setPrefetching(true);
+        return true;
+    }
+    return false;
+}
+
 DbCheckAcquisition::DbCheckAcquisition(OperationContext* opCtx,
                                        const NamespaceString& nss,
                                        ReadSourceWithTimestamp readSource,
@@ -357,6 +374,7 @@ DbCheckAcquisition::DbCheckAcquisition(OperationContext* opCtx,
       // where we throw these errors should already be writing to the health log anyway.
       prevDataCorruptionMode(
           swapDataCorruptionMode(opCtx, DataCorruptionDetectionMode::kLogAndContinue)),
+      prefetchingEnabled(enableScanPrefetching(opCtx)),
       // We don't need to write to the collection, so we use acquireCollectionMaybeLockFree with a
       // read acquisition request.
       coll(acquireCollectionMaybeLockFree(
@@ -650,8 +668,12 @@ Status DbCheckHasher::hashForCollectionCheck(OperationContext* opCtx,
                                              Date_t deadline) {
     BSONObj currentObjId;
     RecordId currentRecordId;
-    RecordData record;
     PlanExecutor::ExecState lastState;
+
+    // Fetch all the documents in the batch through one storage cursor rather than opening a fresh
+    // one for every record. The executor uses an INTERRUPT_ONLY yield policy, so the cursor cannot
+    // be invalidated by a yield in the middle of the batch.
+    auto cursor = collPtr->getRecordStore()->getCursor(opCtx);
     // Iterate through the _id index and obtain the object ID and record ID pair. If the _id index
     // key entry is corrupt, getNext() will throw an exception and we will fail the batch.
     while (PlanExecutor::ADVANCED ==
@@ -664,7 +686,8 @@ Status DbCheckHasher::hashForCollectionCheck(OperationContext* opCtx,
 
         auto rehydratedObjId = key_string::rehydrateKey(BSON("_id" << 1), currentObjId);
 
-        if (!collPtr->getRecordStore()->findRecord(opCtx, currentRecordId, &record)) {
+        auto record = cursor->seekExact(currentRecordId);
+        if (!record) {
             const auto msg = "Error fetching record from record id";
             const auto status = Status(ErrorCodes::KeyNotFound, msg);
             const auto logEntry = dbCheckErrorHealthLogEntry(
@@ -685,8 +708,8 @@ Status DbCheckHasher::hashForCollectionCheck(OperationContext* opCtx,
 
         // We validate the record data before parsing it into a BSONObj, as parsing it into a
         // BSONObj may hide some of the corruption.
-        int currentObjSize = record.size();
-        const char* currentObjData = record.data();
+        int currentObjSize = record->data.size();
+        const char* currentObjData = record->data.data();
 
         if (_secondaryIndexCheckParameters &&
             _secondaryIndexCheckParameters.value().getValidateMode() ==
@@ -729,7 +752,7 @@ Status DbCheckHasher::hashForCollectionCheck(OperationContext* opCtx,
             }
         }
 
-        BSONObj currentObj = record.toBson();
+        BSONObj currentObj = record->data.toBson();
         if (!currentObj.hasField("_id")) {
             return Status(ErrorCodes::NoSuchKey,
                           "Document with record ID " + currentRecordId.toString() + " missing _id");
@@ -771,7 +794,7 @@ Status DbCheckHasher::hashForCollectionCheck(OperationContext* opCtx,
 
         md5_append(&_state, md5Cast(currentObjData), currentObjSize);
 
-        _dataThrottle->awaitIfNeeded(opCtx, record.size());
+        _dataThrottle->awaitIfNeeded(opCtx, record->data.size());
         if (Date_t::now() > deadline) {
             break;
         }
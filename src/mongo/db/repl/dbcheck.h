@@ -165,6 +165,9 @@ public:
     const ReadSourceScope readSourceScope;
     const PrepareConflictBehavior prevPrepareConflictBehavior;
     const DataCorruptionDetectionMode prevDataCorruptionMode;
+    // Whether storage engine read-ahead was requested for this batch's scans. Declared before
+    // 'coll' so that the session is reconfigured before the acquisition opens a storage snapshot.
+    const bool prefetchingEnabled;
     const CollectionAcquisition coll;
 };
 
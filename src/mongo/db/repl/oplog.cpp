@@ -98,14 +98,17 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/op_observer/op_observer.h"
 #include "mongo/db/op_observer/op_observer_util.h"
+#include "mongo/db/exec/update_stage.h"
 #include "mongo/db/ops/delete.h"
 #include "mongo/db/ops/delete_request_gen.h"
+#include "mongo/db/ops/parsed_update.h"
 #include "mongo/db/ops/update.h"
 #include "mongo/db/ops/update_request.h"
 #include "mongo/db/ops/update_result.h"
 #include "mongo/db/ops/write_ops_parsers.h"
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
 #include "mongo/db/query/find_command.h"
+#include "mongo/db/query/internal_plans.h"
 #include "mongo/db/repl/apply_ops.h"
 #include "mongo/db/repl/dbcheck.h"
 #include "mongo/db/repl/image_collection_entry_gen.h"
@@ -416,9 +419,27 @@ void writeToImageCollection(OperationContext* opCtx,
     request.setUpsert(true);
     request.setUpdateModification(
         write_ops::UpdateModification::parseFromClassicUpdate(imageEntry.toBSON()));
-    request.setFromOplogApplication(true);
     // This code path can also be hit by things such as `applyOps` and tenant migrations.
-    ::mongo::update(opCtx, collection, request);
+    request.setFromOplogApplication(true);
+
+    // This runs once per applied retryable findAndModify, so perform the upsert directly through
+    // the _id index rather than paying query canonicalization and plan selection for an exact _id
+    // point write.
+    ParsedUpdate parsedUpdate(opCtx, &request, collection.getCollectionPtr());
+    uassertStatusOK(parsedUpdate.parseRequest());
+
+    const auto idIndexDesc = collection.getCollectionPtr()->getIndexCatalog()->findIdIndex(opCtx);
+    invariant(idIndexDesc, "config.image_collection must have an _id index");
+
+    UpdateStageParams updateStageParams(parsedUpdate.getRequest(), parsedUpdate.getDriver(),
+                                        nullptr);
+    auto planExecutor = InternalPlanner::updateWithIdHack(opCtx,
+                                                          collection,
+                                                          updateStageParams,
+                                                          idIndexDesc,
+                                                          BSON("" << imageEntry.get_id().toBSON()),
+                                                          parsedUpdate.yieldPolicy());
+    [[maybe_unused]] auto updateResult = planExecutor->executeUpdate();
 }
 
 /* we write to local.oplog.rs:
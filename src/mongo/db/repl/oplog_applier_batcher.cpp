@@ -74,30 +74,33 @@ MONGO_FAIL_POINT_DEFINE(skipOplogBatcherWaitForData);
 MONGO_FAIL_POINT_DEFINE(oplogBatcherPauseAfterSuccessfulPeek);
 
 OplogApplierBatcher::OplogApplierBatcher(OplogApplier* oplogApplier, OplogBuffer* oplogBuffer)
-    : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _ops() {}
+    : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer) {}
 OplogApplierBatcher::~OplogApplierBatcher() {
     invariant(!_thread);
 }
 
 OplogApplierBatch OplogApplierBatcher::getNextBatch(Seconds maxWaitTime) {
     stdx::unique_lock<Latch> lk(_mutex);
-    // _ops can indicate the following cases:
+    // A pending batch can indicate the following cases:
     // 1. A new batch is ready to consume.
     // 2. Shutdown.
     // 3. The batch has (or had) exhausted the buffer in draining mode.
-    // 4. Empty batch since the batch has/had exhausted the buffer but not in draining mode,
-    //    so there could be new oplog entries coming.
-    // 5. Empty batch since the batcher is still running.
     //
-    // In case (4) and (5), we wait for up to "maxWaitTime".
-    if (_ops.empty() && !_ops.mustShutdown() && !_ops.termWhenExhausted()) {
+    // If there is no pending batch, either the last batch has/had exhausted the buffer but not
+    // in draining mode, so there could be new oplog entries coming, or the batcher is still
+    // producing. In both cases we wait for up to "maxWaitTime".
+    if (_batches.empty()) {
         // We intentionally don't care about whether this returns due to signaling or timeout
-        // since we do the same thing either way: return whatever is in _ops.
+        // since we do the same thing either way: return whatever is pending, if anything.
         (void)_cv.wait_for(lk, maxWaitTime.toSystemDuration());
     }
 
-    OplogApplierBatch ops = std::move(_ops);
-    _ops = OplogApplierBatch();
+    if (_batches.empty()) {
+        return {};
+    }
+
+    OplogApplierBatch ops = std::move(_batches.front());
+    _batches.pop_front();
     _cv.notify_all();
     return ops;
 }
@@ -145,9 +148,22 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
         batchDeadline =
             opCtx->getServiceContext()->getPreciseClockSource()->now() + waitToFillBatch;
     }
+    // Snapshot the FCV-gated flag once per batch rather than acquiring an FCV snapshot for every
+    // entry in the loop below.
+    const bool checkOplogVersion = !feature_flags::gReduceMajorityWriteLatency.isEnabled(
+        serverGlobalParams.featureCompatibility.acquireFCVSnapshot());
+
     while (_oplogBuffer->peek(opCtx, &op)) {
         oplogBatcherPauseAfterSuccessfulPeek.pauseWhileSet();
-        auto entry = OplogEntry(op);
+        // Reuse the entry parsed by a previous call if it was left in the buffer because it did
+        // not fit that call's batch. The buffer may have been cleared in between, so the cached
+        // entry is only used when it is backed by the very document we just peeked; otherwise we
+        // parse from scratch as before.
+        auto entry = (_unconsumedEntry &&
+                      _unconsumedEntry->getEntry().getRaw().objdata() == op.objdata())
+            ? std::move(*_unconsumedEntry)
+            : OplogEntry(op);
+        _unconsumedEntry = boost::none;
 
         if (entry.shouldLogAsDDLOperation() && !serverGlobalParams.quiet.load()) {
             LOGV2(7360109,
@@ -155,8 +171,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                   "oplogEntry"_attr = entry.toBSONForLogging());
         }
 
-        if (!feature_flags::gReduceMajorityWriteLatency.isEnabled(
-                serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+        if (checkOplogVersion) {
             // Check for oplog version change.
             if (entry.getVersion() != OplogEntry::kOplogVersion) {
                 static constexpr char message[] = "Unexpected oplog version";
@@ -182,6 +197,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                     // reconfigs and shutdown to occur.
                     sleepsecs(1);
                 }
+                _unconsumedEntry = std::move(entry);
                 return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
             }
         }
@@ -192,6 +208,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                 break;
             case BatchAction::kStartNewBatch:
                 if (!ops.empty()) {
+                    _unconsumedEntry = std::move(entry);
                     return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
                 }
                 break;
@@ -209,6 +226,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
         if (batchStats.totalOps > 0) {
             if (batchStats.totalOps + opCount > batchLimits.ops ||
                 batchStats.totalBytes + opBytes > batchLimits.bytes) {
+                _unconsumedEntry = std::move(entry);
                 return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
             }
         }
@@ -217,6 +235,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
         if (batchStats.totalOps > 0 && !batchLimits.forceBatchBoundaryAfter.isNull() &&
             entry.getOpTime().getTimestamp() > batchLimits.forceBatchBoundaryAfter &&
             ops.back().getOpTime().getTimestamp() <= batchLimits.forceBatchBoundaryAfter) {
+            _unconsumedEntry = std::move(entry);
             return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
         }
 
@@ -438,11 +457,19 @@ void OplogApplierBatcher::_run(StorageInterface* storageInterface) {
         }
 
         stdx::unique_lock<Latch> lk(_mutex);
-        // Block until the previous batch has been taken.
-        _cv.wait(lk, [&] { return _ops.empty() && !_ops.termWhenExhausted(); });
-        _ops = std::move(ops);
+        // Block until there is room for this batch, so that up to 'oplogApplierMaxPendingBatches'
+        // produced batches can be pending and the batcher keeps producing the next batch while the
+        // current one is being applied. Never queue past a batch carrying the exhausted signal; it
+        // must be consumed before anything newer is made visible.
+        const auto maxPendingBatches = static_cast<std::size_t>(oplogApplierMaxPendingBatches);
+        _cv.wait(lk, [&] {
+            return _batches.size() < maxPendingBatches &&
+                (_batches.empty() || !_batches.back().termWhenExhausted());
+        });
+        const auto mustShutdown = ops.mustShutdown();
+        _batches.push_back(std::move(ops));
         _cv.notify_all();
-        if (_ops.mustShutdown()) {
+        if (mustShutdown) {
             return;
         }
     }
@@ -32,6 +32,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -94,7 +95,8 @@ public:
     virtual ~OplogApplierBatcher();
 
     /**
-     * Returns the batch of oplog entries and clears _ops so the batcher can store a new batch.
+     * Returns the oldest pending batch of oplog entries, freeing up room for the batcher to
+     * store a new batch.
      */
     OplogApplierBatch getNextBatch(Seconds maxWaitTime);
 
@@ -168,13 +170,23 @@ private:
     OplogApplier* _oplogApplier;
     OplogBuffer* const _oplogBuffer;
 
+    /**
+     * The entry parsed by a previous getNextApplierBatch() call which was left in the buffer
+     * because it did not fit the batch being assembled then. The next call reuses it, as long as
+     * it is backed by the same document it peeks, instead of parsing the document a second time.
+     */
+    boost::optional<OplogEntry> _unconsumedEntry;
+
     Mutex _mutex = MONGO_MAKE_LATCH("OplogApplierBatcher::_mutex");
     stdx::condition_variable _cv;
 
     /**
-     * The latest batch of oplog entries ready for the applier.
+     * Batches of oplog entries ready for the applier, oldest first. Bounded by the
+     * 'oplogApplierMaxPendingBatches' server parameter so that the batcher can keep producing
+     * the next batches while the current batch is being applied, without buffering an unbounded
+     * amount of memory when application falls behind.
      */
-    OplogApplierBatch _ops;
+    std::deque<OplogApplierBatch> _batches;
 
     std::unique_ptr<stdx::thread> _thread;
 };
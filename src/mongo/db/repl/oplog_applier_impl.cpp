@@ -60,6 +60,7 @@
 #include "mongo/db/commands/fsync.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/d_concurrency.h"
+#include "mongo/db/dbhelpers.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/repl/apply_ops_command_info.h"
 #include "mongo/db/repl/initial_syncer.h"
@@ -68,6 +69,7 @@
 #include "mongo/db/repl/oplog_applier_utils.h"
 #include "mongo/db/repl/oplog_entry_gen.h"
 #include "mongo/db/repl/oplog_writer_impl.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_metrics.h"
 #include "mongo/db/repl/split_prepare_session_manager.h"
 #include "mongo/db/repl/transaction_oplog_application.h"
@@ -90,6 +92,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/platform/usdt.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/stdx/unordered_map.h"
@@ -167,6 +170,54 @@ Status finishAndLogApply(OperationContext* opCtx,
     return finalStatus;
 }
 
+/**
+ * Best-effort warming of the storage engine cache with the documents targeted by the updates
+ * and deletes in 'ops', so the appliers fault fewer pages in while holding locks. Reads the
+ * target documents by _id, decrementing 'memoryBudgetBytes' by the size of each document read,
+ * and stops once the budget is exhausted. The budget is shared between the prefetch tasks of
+ * one batch. Failures of any kind are swallowed since prefetching must never interfere with
+ * oplog application.
+ */
+void prefetchOperationTargets(OperationContext* opCtx,
+                              const std::vector<ApplierOperation>& ops,
+                              AtomicWord<long long>* memoryBudgetBytes) {
+    for (const auto& op : ops) {
+        if (memoryBudgetBytes->load() <= 0) {
+            return;
+        }
+
+        // Only updates and deletes target documents that already exist.
+        if (!op->isCrudOpType() ||
+            (op->getOpType() != OpTypeEnum::kUpdate && op->getOpType() != OpTypeEnum::kDelete)) {
+            continue;
+        }
+
+        try {
+            auto idElement = op->getIdElement();
+            if (idElement.eoo()) {
+                continue;
+            }
+
+            AutoGetCollection coll(opCtx, op->getNss(), MODE_IS);
+            if (!*coll) {
+                continue;
+            }
+
+            auto recordId = Helpers::findById(opCtx, *coll, idElement.wrap());
+            if (recordId.isNull()) {
+                continue;
+            }
+
+            Snapshotted<BSONObj> doc;
+            if (coll->findDoc(opCtx, recordId, &doc)) {
+                memoryBudgetBytes->subtractAndFetch(doc.value().objsize());
+            }
+        } catch (const DBException&) {
+            continue;
+        }
+    }
+}
+
 namespace {
 // Tracks writes to the side table config.image_collection.  This collection is implicitly
 // replicated, and to avoid out-of-order writes, we only want to do the last write
@@ -620,6 +671,7 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
                                                       std::vector<OplogEntry> ops) {
     invariant(!ops.empty());
 
+    MONGO_USDT(oplog_applier_batch_start, ops.size());
     LOGV2_DEBUG(21230, 2, "Oplog application batch size", "size"_attr = ops.size());
 
     if (_replCoord->getOplogSyncState() == ReplicationCoordinator::OplogSyncState::Stopped) {
@@ -667,11 +719,39 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
             _workerPool->getStats().options.maxThreads);
         _fillWriterVectors(opCtx, &ops, &writerVectors, &derivedOps);
 
+        // Warm the storage engine cache with the documents targeted by this batch while the
+        // batch's oplog entries are being written. The budget is shared by all prefetch tasks
+        // so a single huge batch cannot evict more cache than configured.
+        const bool prefetchEnabled = oplogApplierPrefetchEnabled.load();
+        AtomicWord<long long> prefetchMemoryBudgetBytes{
+            oplogApplierPrefetchMemoryLimitBytes.load()};
+        if (prefetchEnabled) {
+            for (auto&& writer : writerVectors) {
+                if (writer.empty())
+                    continue;
+
+                _workerPool->schedule(
+                    [&writer, &prefetchMemoryBudgetBytes](auto scheduleStatus) {
+                        invariant(scheduleStatus);
+                        auto opCtx = cc().makeOperationContext();
+                        prefetchOperationTargets(opCtx.get(), writer, &prefetchMemoryBudgetBytes);
+                    });
+            }
+        }
+
         // Wait for oplog writes to finish.
         if (writtenOplog) {
             _oplogWriter->waitForScheduledWrites(opCtx);
         }
 
+        if (prefetchEnabled) {
+            // The prefetch stage must drain before application, which modifies the writer
+            // vectors that the prefetch tasks read.
+            _workerPool->waitForIdle();
+        }
+
+        MONGO_USDT(oplog_applier_batch_written, ops.size());
+
         // Use this fail point to hang after we have written the oplog entries but before we have
         // applied them.
         if (MONGO_unlikely(pauseBatchApplicationAfterWritingOplogEntries.shouldFail())) {
@@ -710,6 +790,7 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
             }
 
             _workerPool->waitForIdle();
+            MONGO_USDT(oplog_applier_batch_applied, ops.size());
 
             // If any of the statuses is not ok, return error.
             for (auto it = statusVector.cbegin(); it != statusVector.cend(); ++it) {
@@ -70,6 +70,7 @@
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/future_impl.h"
+#include "mongo/util/out_of_line_executor.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
@@ -437,7 +438,10 @@ void PrimaryOnlyService::onStepUp(const OpTime& stepUpOpTime) {
                 "stepUpOpTime"_attr = stepUpOpTime);
     WaitForMajorityService::get(_serviceContext)
         .waitUntilMajorityForWrite(stepUpOpTime, _source.token())
-        .thenRunOn(**newScopedExecutor)
+        // Continuations in this chain that become ready in line with one another (e.g. the
+        // early returns when the term has changed) run without paying another scheduling hop
+        // on the executor.
+        .thenRunOn(makeInlineContinuationExecutor(**newScopedExecutor))
         .then([this, newScopedExecutor, newTerm] {
             // Note that checking both the state and the term are optimizations and are
             // not strictly necessary. This is also true in the later continuation.
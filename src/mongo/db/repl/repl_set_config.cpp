@@ -223,6 +223,13 @@ Status ReplSetConfig::_initialize(bool forInitiate,
         }
     }
 
+    // Index the members by host for the per-heartbeat lookups. Initialization runs before
+    // validation, so a (rejected) config may briefly contain duplicate hosts; 'emplace' keeps the
+    // first occurrence, matching the linear scan this index replaces.
+    for (size_t i = 0; i < getMembers().size(); ++i) {
+        _memberIndexByHostAndPort.emplace(getMemberAt(i).getHostAndPort(), static_cast<int>(i));
+    }
+
     return Status::OK();
 }
 
@@ -548,16 +555,8 @@ const MemberConfig* ReplSetConfig::findMemberByID(int id) const {
 }
 
 int ReplSetConfig::findMemberIndexByHostAndPort(const HostAndPort& hap) const {
-    int x = 0;
-    for (std::vector<MemberConfig>::const_iterator it = getMembers().begin();
-         it != getMembers().end();
-         ++it) {
-        if (it->getHostAndPort() == hap) {
-            return x;
-        }
-        ++x;
-    }
-    return -1;
+    auto it = _memberIndexByHostAndPort.find(hap);
+    return it != _memberIndexByHostAndPort.end() ? it->second : -1;
 }
 
 int ReplSetConfig::findMemberIndexByConfigId(int configId) const {
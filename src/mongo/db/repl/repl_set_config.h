@@ -54,6 +54,7 @@
 #include "mongo/db/repl/repl_set_config_gen.h"
 #include "mongo/db/repl/repl_set_tag.h"
 #include "mongo/db/write_concern_options.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
@@ -638,6 +639,9 @@ private:
     ReplSetTagConfig _tagConfig;
     StringMap<ReplSetTagPattern> _customWriteConcernModes;
     ConnectionString _connectionString;
+
+    // Index of members by host, so the per-heartbeat lookups do not scan the member list.
+    stdx::unordered_map<HostAndPort, int> _memberIndexByHostAndPort;
 };
 
 }  // namespace repl
@@ -3602,7 +3602,8 @@ int ReplicationCoordinatorImpl::_getMyId(WithLock lk) const {
 
 StatusWith<BSONObj> ReplicationCoordinatorImpl::prepareReplSetUpdatePositionCommand() const {
     stdx::lock_guard<Latch> lock(_mutex);
-    return _topCoord->prepareReplSetUpdatePositionCommand(_getCurrentCommittedSnapshotOpTime(lock));
+    return _topCoord->prepareReplSetUpdatePositionCommand(_getCurrentCommittedSnapshotOpTime(lock),
+                                                          _replExecutor->now());
 }
 
 Status ReplicationCoordinatorImpl::processReplSetGetStatus(
@@ -100,6 +100,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/rpc/reply_builder_interface.h"
@@ -141,6 +142,71 @@ void appendPrimaryOnlyServiceInfo(ServiceContext* serviceContext, BSONObjBuilder
     registry->reportServiceInfoForServerStatus(result);
 }
 
+/**
+ * Caches the serialized replication section of the hello response so that the handshake hellos of
+ * a client reconnect storm do not each rebuild and reserialize an identical response under the
+ * replication coordinator mutex. Entries are keyed by the connection's SNI name (which determines
+ * the split horizon) and the response format, and are only served while the topology version they
+ * were built under is still current; any topology change, including entering quiesce mode,
+ * increments that version and so invalidates them. A short freshness window bounds how far the
+ * advancing lastWrite optimes in a cached section can lag; streaming hello clients only see those
+ * fields refreshed on topology changes or maxAwaitTimeMS timeouts anyway, so the window does not
+ * introduce a new staleness source.
+ */
+class HelloSectionCache {
+public:
+    boost::optional<BSONObj> lookup(const TopologyVersion& currentTopologyVersion,
+                                    const boost::optional<std::string>& sniName,
+                                    bool useLegacyResponseFields,
+                                    Date_t now) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _entries.find(_makeKey(sniName, useLegacyResponseFields));
+        if (it == _entries.end()) {
+            return boost::none;
+        }
+        auto& entry = it->second;
+        if (entry.topologyVersion.getProcessId() != currentTopologyVersion.getProcessId() ||
+            entry.topologyVersion.getCounter() != currentTopologyVersion.getCounter() ||
+            now >= entry.expiration) {
+            _entries.erase(it);
+            return boost::none;
+        }
+        return entry.section;
+    }
+
+    void store(const TopologyVersion& topologyVersion,
+               const boost::optional<std::string>& sniName,
+               bool useLegacyResponseFields,
+               BSONObj section,
+               Date_t now) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _entries[_makeKey(sniName, useLegacyResponseFields)] =
+            Entry{topologyVersion, std::move(section), now + kMaxEntryAge};
+    }
+
+private:
+    // How long a cached section may be served before the lastWrite optimes in it are considered
+    // too stale.
+    static constexpr Milliseconds kMaxEntryAge{250};
+
+    struct Entry {
+        TopologyVersion topologyVersion;
+        BSONObj section;
+        Date_t expiration;
+    };
+
+    static std::string _makeKey(const boost::optional<std::string>& sniName,
+                                bool useLegacyResponseFields) {
+        return str::stream() << sniName.value_or("") << "|"
+                             << (useLegacyResponseFields ? "legacy" : "current");
+    }
+
+    Mutex _mutex = MONGO_MAKE_LATCH("HelloSectionCache::_mutex");
+    StringMap<Entry> _entries;
+};
+
+HelloSectionCache helloSectionCache;
+
 /**
  * Appends replication-related fields to the hello response. Returns the topology version that
  * was included in the response.
@@ -156,6 +222,37 @@ TopologyVersion appendReplicationInfo(OperationContext* opCtx,
     if (replCoord->getSettings().isReplSet()) {
         const auto& horizonParams = SplitHorizon::getParameters(opCtx->getClient());
 
+        // The cluster-wide write concern default is not covered by the topology version, so shard
+        // server fields are appended fresh on every response, cached or not.
+        auto appendShardServerFields = [&] {
+            // Only shard servers will respond with the isImplicitDefaultMajorityWC field.
+            if (serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
+                result->append(HelloCommandReply::kIsImplicitDefaultMajorityWCFieldName,
+                               replCoord->getConfig().isImplicitDefaultWriteConcernMajority());
+
+                auto cwwc = ReadWriteConcernDefaults::get(opCtx).getCWWC(opCtx);
+                if (cwwc) {
+                    result->append(HelloCommandReply::kCwwcFieldName, cwwc.value().toBSON());
+                }
+            }
+        };
+
+        // Handshake hellos carry no topologyVersion or maxAwaitTimeMS and produce an identical
+        // replication section for every connection on the same horizon, so they can be answered
+        // from the cache without taking the replication coordinator mutex.
+        const bool cacheable =
+            !clientTopologyVersion && !maxAwaitTimeMS && !appendReplicationProcess;
+        auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
+        if (cacheable) {
+            auto currentTopologyVersion = replCoord->getTopologyVersion();
+            if (auto cached = helloSectionCache.lookup(
+                    currentTopologyVersion, horizonParams.sniName, useLegacyResponseFields, now)) {
+                result->appendElements(*cached);
+                appendShardServerFields();
+                return currentTopologyVersion;
+            }
+        }
+
         boost::optional<Date_t> deadline;
         if (maxAwaitTimeMS) {
             deadline = opCtx->getServiceContext()->getPreciseClockSource()->now() +
@@ -163,23 +260,23 @@ TopologyVersion appendReplicationInfo(OperationContext* opCtx,
         }
         auto helloResponse =
             replCoord->awaitHelloResponse(opCtx, horizonParams, clientTopologyVersion, deadline);
-        result->appendElements(helloResponse->toBSON(useLegacyResponseFields));
+        auto responseObj = helloResponse->toBSON(useLegacyResponseFields);
+        result->appendElements(responseObj);
         if (appendReplicationProcess) {
             replCoord->appendSecondaryInfoData(result);
         }
         invariant(helloResponse->getTopologyVersion());
 
-        // Only shard servers will respond with the isImplicitDefaultMajorityWC field.
-        if (serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
-            result->append(HelloCommandReply::kIsImplicitDefaultMajorityWCFieldName,
-                           replCoord->getConfig().isImplicitDefaultWriteConcernMajority());
-
-            auto cwwc = ReadWriteConcernDefaults::get(opCtx).getCWWC(opCtx);
-            if (cwwc) {
-                result->append(HelloCommandReply::kCwwcFieldName, cwwc.value().toBSON());
-            }
+        if (cacheable) {
+            helloSectionCache.store(helloResponse->getTopologyVersion().value(),
+                                    horizonParams.sniName,
+                                    useLegacyResponseFields,
+                                    std::move(responseObj),
+                                    now);
         }
 
+        appendShardServerFields();
+
         return helloResponse->getTopologyVersion().value();
     }
 
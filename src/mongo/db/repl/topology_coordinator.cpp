@@ -39,6 +39,7 @@
 
 #include <absl/container/node_hash_map.h>
 #include <algorithm>
+#include <array>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <cstddef>
@@ -2191,7 +2192,7 @@ void TopologyCoordinator::prepareStatusResponse(const ReplSetStatusArgs& rsStatu
 }
 
 StatusWith<BSONObj> TopologyCoordinator::prepareReplSetUpdatePositionCommand(
-    OpTime currentCommittedSnapshotOpTime) const {
+    OpTime currentCommittedSnapshotOpTime, Date_t now) {
     BSONObjBuilder cmdBuilder;
     invariant(_rsConfig.isInitialized());
     // Do not send updates if we have been removed from the config.
@@ -2199,6 +2200,24 @@ StatusWith<BSONObj> TopologyCoordinator::prepareReplSetUpdatePositionCommand(
         return Status(ErrorCodes::NodeNotFound,
                       "This node is not in the current replset configuration.");
     }
+
+    // When repeatedly reporting to the same sync source, members whose positions have not moved
+    // since the last prepared command may be omitted; the sync source retains the positions we
+    // previously reported and only ever advances them. A complete update is sent whenever the
+    // sync source or config changes, and periodically as a refresh, so a sync source is never
+    // left relying on stale suppression state for long. When there is no sync source (e.g. the
+    // command is being prepared for a test or a to-be-determined target), always send everything.
+    const bool trackLastSent = !_syncSource.empty();
+    bool fullUpdate = !trackLastSent || _lastUpdatePositionSent.target != _syncSource ||
+        _lastUpdatePositionSent.configVersion != _rsConfig.getConfigVersion() ||
+        now - _lastUpdatePositionSent.fullUpdateTime >= _rsConfig.getElectionTimeoutPeriod() / 2;
+    if (fullUpdate && trackLastSent) {
+        _lastUpdatePositionSent.target = _syncSource;
+        _lastUpdatePositionSent.configVersion = _rsConfig.getConfigVersion();
+        _lastUpdatePositionSent.fullUpdateTime = now;
+        _lastUpdatePositionSent.memberOpTimes.clear();
+    }
+
     cmdBuilder.append(UpdatePositionArgs::kCommandFieldName, 1);
     // Create an array containing objects each live member connected to us and for ourself.
     BSONArrayBuilder arrayBuilder(cmdBuilder.subarrayStart("optimes"));
@@ -2212,6 +2231,19 @@ StatusWith<BSONObj> TopologyCoordinator::prepareReplSetUpdatePositionCommand(
             continue;
         }
 
+        if (trackLastSent) {
+            const std::array<OpTime, 3> opTimes{memberData.getLastWrittenOpTime(),
+                                                memberData.getLastAppliedOpTime(),
+                                                memberData.getLastDurableOpTime()};
+            auto& lastSent =
+                _lastUpdatePositionSent.memberOpTimes[memberData.getMemberId().getData()];
+            if (!fullUpdate && lastSent == opTimes) {
+                // The sync source already knows this member's positions.
+                continue;
+            }
+            lastSent = opTimes;
+        }
+
         BSONObjBuilder entry(arrayBuilder.subobjStart());
         memberData.getLastWrittenOpTime().append(UpdatePositionArgs::kWrittenOpTimeFieldName,
                                                  &entry);
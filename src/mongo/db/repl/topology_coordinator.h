@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/optional/optional.hpp>
 #include <functional>
 #include <iosfwd>
@@ -67,6 +68,7 @@
 #include "mongo/db/server_options.h"
 #include "mongo/rpc/metadata/oplog_query_metadata.h"
 #include "mongo/rpc/topology_version_gen.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
@@ -421,9 +423,12 @@ public:
                                BSONObjBuilder* response,
                                Status* result);
 
-    // Produce a replSetUpdatePosition command to be sent to the node's sync source.
-    StatusWith<BSONObj> prepareReplSetUpdatePositionCommand(
-        OpTime currentCommittedSnapshotOpTime) const;
+    // Produce a replSetUpdatePosition command to be sent to the node's sync source. Repeat
+    // commands prepared for the same sync source omit members whose positions have not moved
+    // since the previous command; a complete update is produced whenever the sync source or
+    // config changes, and periodically as a refresh.
+    StatusWith<BSONObj> prepareReplSetUpdatePositionCommand(OpTime currentCommittedSnapshotOpTime,
+                                                            Date_t now);
 
     // Produce a reply to a hello request.  It is only valid to call this if we are a
     // replset.  Drivers interpret the hello fields according to the Server Discovery and
@@ -1155,6 +1160,18 @@ private:
     // the hostandport we are currently syncing from
     // empty if no sync source (we are primary, or we cannot connect to anyone yet)
     HostAndPort _syncSource;
+    // What the last prepared replSetUpdatePosition command reported, so that repeat commands to
+    // the same sync source can omit members whose positions have not moved. Cleared whenever the
+    // sync source or config changes, and aged out periodically so a sync source always receives
+    // a complete update within a keep-alive interval.
+    struct LastUpdatePositionSent {
+        HostAndPort target;
+        long long configVersion = -2;
+        Date_t fullUpdateTime;
+        // Maps member id to the (written, applied, durable) optimes last reported for it.
+        stdx::unordered_map<int, std::array<OpTime, 3>> memberOpTimes;
+    };
+    LastUpdatePositionSent _lastUpdatePositionSent;
     // These members are not chosen as sync sources for a period of time, due to connection
     // issues with them
     std::map<HostAndPort, Date_t> _syncSourceDenylist;
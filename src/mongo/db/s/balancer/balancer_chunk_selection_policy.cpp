@@ -91,6 +91,7 @@
 #include "mongo/s/routing_information_cache.h"
 #include "mongo/s/shard_key_pattern.h"
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
@@ -452,11 +453,16 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
     // of a single request per collection
     std::vector<CollectionType> collBatch;
 
+    // Tracks the collections placed in the first batch from the imbalanced collections cache, so
+    // that the iteration below can skip them without erasing from the middle of the (potentially
+    // very large) `collections` vector.
+    stdx::unordered_set<NamespaceString> collsInFirstBatch;
+
     // The first batch is partially filled by the imbalanced cached collections
     for (auto imbalancedNssIt = imbalancedCollectionsCachePtr->begin();
          imbalancedNssIt != imbalancedCollectionsCachePtr->end();) {
 
-        const auto& [imbalancedColl, collIt] = getCollectionTypeByNss(*imbalancedNssIt);
+        const auto& imbalancedColl = getCollectionTypeByNss(*imbalancedNssIt).first;
 
         if (!imbalancedColl.has_value() ||
             !balancer_policy_utils::canBalanceCollection(imbalancedColl.value())) {
@@ -466,10 +472,8 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
         }
 
         collBatch.push_back(imbalancedColl.value());
+        collsInFirstBatch.insert(*imbalancedNssIt);
         ++imbalancedNssIt;
-
-        // Remove the collection from the whole list of collections to avoid processing it twice
-        collections.erase(collIt);
     }
 
     // Iterate all the remaining collections randomly
@@ -477,7 +481,9 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
     std::shuffle(collections.begin(), collections.end(), client->getPrng().urbg());
     for (const auto& coll : collections) {
 
-        if (balancer_policy_utils::canBalanceCollection(coll)) {
+        // Avoid processing a collection twice if it was already part of the first batch.
+        if (balancer_policy_utils::canBalanceCollection(coll) &&
+            !collsInFirstBatch.contains(coll.getNss())) {
             collBatch.push_back(coll);
         }
 
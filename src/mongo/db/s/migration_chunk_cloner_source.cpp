@@ -736,14 +736,18 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
+    // Accumulate the progress counters locally and publish them once per batch. When the recipient
+    // runs multiple _migrateClone sessions in parallel, per-document updates of the shared counters
+    // make this loop contend on '_mutex' and the global statistics cache lines.
+    long long numRecordsCloned = 0;
+    long long numRecordsPassedOver = 0;
+    long long numBytesCloned = 0;
+
     while (true) {
         int recordsNoLongerExist = 0;
         auto docInFlight = _cloneList.getNextDoc(opCtx, collection, &recordsNoLongerExist);
 
-        if (recordsNoLongerExist) {
-            stdx::lock_guard lk(_mutex);
-            _numRecordsPassedOver += recordsNoLongerExist;
-        }
+        numRecordsPassedOver += recordsNoLongerExist;
 
         const auto& doc = docInFlight->getDoc();
         if (!doc) {
@@ -764,10 +768,7 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
         // the range of the chunk being migrated.
         if (!isDocInRange(
                 doc->value(), _args.getMin().value(), _args.getMax().value(), _shardKeyPattern)) {
-            {
-                stdx::lock_guard lk(_mutex);
-                _numRecordsPassedOver++;
-            }
+            numRecordsPassedOver++;
             continue;
         }
 
@@ -779,15 +780,18 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
             break;
         }
 
-        {
-            stdx::lock_guard lk(_mutex);
-            _numRecordsCloned++;
-        }
-
+        numRecordsCloned++;
+        numBytesCloned += doc->value().objsize();
         arrBuilder->append(doc->value());
-        ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
-        ShardingStatistics::get(opCtx).countBytesClonedOnDonor.addAndFetch(doc->value().objsize());
     }
+
+    if (numRecordsCloned || numRecordsPassedOver) {
+        stdx::lock_guard lk(_mutex);
+        _numRecordsCloned += numRecordsCloned;
+        _numRecordsPassedOver += numRecordsPassedOver;
+    }
+    ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(numRecordsCloned);
+    ShardingStatistics::get(opCtx).countBytesClonedOnDonor.addAndFetch(numBytesCloned);
 }
 
 uint64_t MigrationChunkClonerSource::getCloneBatchBufferAllocationSize() {
@@ -322,6 +322,7 @@ Status deleteRangeInBatches(OperationContext* opCtx,
     suspendRangeDeletion.pauseWhileSet(opCtx);
 
     bool allDocsRemoved = false;
+    bool markedAsProcessing = false;
     // Delete all batches in this range unless a stepdown error occurs. Do not yield the
     // executor to ensure that this range is fully deleted before another range is
     // processed.
@@ -336,7 +337,13 @@ Status deleteRangeInBatches(OperationContext* opCtx,
 
             ensureRangeDeletionTaskStillExists(opCtx, collectionUuid, range);
 
-            markRangeDeletionTaskAsProcessing(opCtx, collectionUuid, range);
+            // The processing flag only needs to transition once per task execution; repeating the
+            // replicated update on every batch would just add a write and its write concern wait
+            // to each batch. Retry it until it goes through once.
+            if (!markedAsProcessing) {
+                markRangeDeletionTaskAsProcessing(opCtx, collectionUuid, range);
+                markedAsProcessing = true;
+            }
 
             int numDeleted = 0;
             const auto nss = [&]() {
@@ -165,6 +165,7 @@ SemiFuture<void> ReshardingOplogApplier::run(
     CancelableOperationContextFactory factory) {
     struct ChainContext {
         std::unique_ptr<ReshardingDonorOplogIteratorInterface> oplogIter;
+        boost::optional<ExecutorFuture<OplogBatch>> nextBatchFuture;
         Timer fetchTimer;
     };
 
@@ -173,7 +174,13 @@ SemiFuture<void> ReshardingOplogApplier::run(
 
     return AsyncTry([this, chainCtx, executor, cancelToken, factory] {
                chainCtx->fetchTimer.reset();
-               return chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory)
+               if (!chainCtx->nextBatchFuture) {
+                   chainCtx->nextBatchFuture =
+                       chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory);
+               }
+               auto batchFuture = std::move(*chainCtx->nextBatchFuture);
+               chainCtx->nextBatchFuture = boost::none;
+               return std::move(batchFuture)
                    .thenRunOn(executor)
                    .then([this, chainCtx, executor, cancelToken, factory](OplogBatch batch) {
                        LOGV2_DEBUG(5391002, 3, "Starting batch", "batchSize"_attr = batch.size());
@@ -182,6 +189,19 @@ SemiFuture<void> ReshardingOplogApplier::run(
                            duration_cast<Milliseconds>(chainCtx->fetchTimer.elapsed()));
 
                        _currentBatchToApply = std::move(batch);
+
+                       // Begin fetching the next batch from the oplog buffer while this one is
+                       // being applied so the applier doesn't go idle waiting on the iterator
+                       // between batches. The iterator reads from the buffer collection only, so
+                       // the fetch cannot conflict with the writes performed by _applyBatch(). Once
+                       // the final oplog entry has been seen the iterator returns an empty batch
+                       // without running the aggregation, making the extra fetch after the last
+                       // real batch free.
+                       if (!_currentBatchToApply.empty()) {
+                           chainCtx->nextBatchFuture =
+                               chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory);
+                       }
+
                        return _applyBatch(executor, cancelToken, factory);
                    })
                    .then([this, executor, cancelToken, factory] {
@@ -221,6 +241,13 @@ SemiFuture<void> ReshardingOplogApplier::run(
         // RecipientStateMachine, along with its ReshardingOplogApplier member, may have already
         // been destructed.
         .onCompletion([chainCtx](Status status) {
+            if (chainCtx->nextBatchFuture) {
+                // If the chain failed or was canceled while a prefetched batch was still in flight,
+                // wait for it to finish before disposing of the iterator it is reading from. The
+                // fetch is canceled through 'cancelToken', so this does not block indefinitely.
+                (void)std::exchange(chainCtx->nextBatchFuture, boost::none)->getNoThrow();
+            }
+
             if (chainCtx->oplogIter) {
                 // Use a separate Client to make a better effort of calling dispose() even when the
                 // CancellationToken has been canceled.
@@ -68,6 +68,7 @@
 #include "mongo/db/s/transaction_coordinator_worker_curop_repository.h"
 #include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/session/logical_session_id_helpers.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/db/write_concern_options.h"
@@ -78,6 +79,7 @@
 #include "mongo/logv2/log_component.h"
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/rpc/reply_interface.h"
 #include "mongo/rpc/unique_message.h"
@@ -86,6 +88,7 @@
 #include "mongo/util/decorable.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/future.h"
 #include "mongo/util/future_impl.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
@@ -146,9 +149,140 @@ bool shouldRetryPersistingCoordinatorState(const StatusWith<T>& responseStatus)
         responseStatus != ErrorCodes::TransactionCoordinatorSteppingDown;
 }
 
+OperationSessionInfo makeSessionInfo(const LogicalSessionId& lsid,
+                                     const TxnNumberAndRetryCounter& txnNumberAndRetryCounter) {
+    OperationSessionInfo sessionInfo;
+    sessionInfo.setSessionId(lsid);
+    sessionInfo.setTxnNumber(txnNumberAndRetryCounter.getTxnNumber());
+    if (auto txnRetryCounter = txnNumberAndRetryCounter.getTxnRetryCounter();
+        txnRetryCounter && !isDefaultTxnRetryCounter(*txnRetryCounter)) {
+        sessionInfo.setTxnRetryCounter(*txnRetryCounter);
+    }
+    return sessionInfo;
+}
+
+/**
+ * Coalesces upserts to config.transaction_coordinators issued by coordinators which reach the same
+ * two-phase commit write step concurrently into a single batched update command, group-commit
+ * style. Each entry keeps its own precondition query, so batching changes neither the documents
+ * written nor their match semantics; it only amortizes the per-command overhead (command dispatch,
+ * write unit of work and storage commit) across transactions committing at the same time.
+ *
+ * The first thread to start a flush becomes the flusher for every entry queued while its flush is
+ * running. A batched reply only reports aggregate counts, so when the batch reports a write error
+ * or fewer matched-or-upserted documents than entries, the outcome cannot be attributed to
+ * individual transactions; submit() then returns boost::none and each caller re-runs its original
+ * single-document write, which surfaces the precise per-transaction error.
+ */
+class CoordinatorDocWriteBatcher {
+public:
+    boost::optional<repl::OpTime> submit(OperationContext* opCtx,
+                                         write_ops::UpdateOpEntry entry) {
+        auto pf = makePromiseFuture<boost::optional<repl::OpTime>>();
+        {
+            stdx::unique_lock<Latch> ul(_mutex);
+            if (_flushInProgress) {
+                _pending.push_back({std::move(entry), std::move(pf.promise)});
+                ul.unlock();
+                return pf.future.get(opCtx);
+            }
+            _flushInProgress = true;
+        }
+
+        std::vector<PendingWrite> batch;
+        batch.push_back({std::move(entry), std::move(pf.promise)});
+        while (true) {
+            _flushBatch(opCtx, batch);
+            batch.clear();
+
+            stdx::lock_guard<Latch> lg(_mutex);
+            if (_pending.empty()) {
+                _flushInProgress = false;
+                break;
+            }
+            batch.swap(_pending);
+        }
+
+        // The flusher's own entry was part of the first batch, so its future is already ready.
+        return pf.future.get(opCtx);
+    }
+
+private:
+    struct PendingWrite {
+        write_ops::UpdateOpEntry entry;
+        Promise<boost::optional<repl::OpTime>> result;
+    };
+
+    void _flushBatch(OperationContext* opCtx, std::vector<PendingWrite>& batch) noexcept {
+        boost::optional<repl::OpTime> batchOpTime;
+        try {
+            write_ops::UpdateCommandRequest updateOp(
+                NamespaceString::kTransactionCoordinatorsNamespace);
+            updateOp.getWriteCommandRequestBase().setOrdered(false);
+            std::vector<write_ops::UpdateOpEntry> entries;
+            entries.reserve(batch.size());
+            for (const auto& pending : batch) {
+                entries.push_back(pending.entry);
+            }
+            updateOp.setUpdates(std::move(entries));
+
+            DBDirectClient client(opCtx);
+            const auto commandResponse = client.runCommand(updateOp.serialize());
+            const auto commandReply = commandResponse->getCommandReply();
+            if (getStatusFromWriteCommandReply(commandReply).isOK() &&
+                commandReply.getIntField("n") == static_cast<int>(batch.size())) {
+                batchOpTime = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+            }
+        } catch (const DBException&) {
+            // Leave 'batchOpTime' unset; every entry re-runs individually on its own thread and
+            // reports its own error.
+        }
+
+        for (auto& pending : batch) {
+            pending.result.emplaceValue(batchOpTime);
+        }
+    }
+
+    Mutex _mutex = MONGO_MAKE_LATCH("CoordinatorDocWriteBatcher::_mutex");
+    bool _flushInProgress = false;
+    std::vector<PendingWrite> _pending;
+};
+
+const auto coordinatorDocWriteBatcherDecoration =
+    ServiceContext::declareDecoration<CoordinatorDocWriteBatcher>();
+
+CoordinatorDocWriteBatcher& coordinatorDocWriteBatcher(OperationContext* opCtx) {
+    return coordinatorDocWriteBatcherDecoration(opCtx->getServiceContext());
+}
+
 }  // namespace
 
 namespace {
+write_ops::UpdateOpEntry buildParticipantListUpdateEntry(
+    const OperationSessionInfo& sessionInfo, const std::vector<ShardId>& participantList) {
+    write_ops::UpdateOpEntry entry;
+
+    // Ensure that the document for the (lsid, txnNumber) either has no participant list or has the
+    // same participant list. The document may have the same participant list if an earlier attempt
+    // to write the participant list failed waiting for writeConcern.
+    BSONObj noParticipantList = BSON(TransactionCoordinatorDocument::kParticipantsFieldName
+                                     << BSON("$exists" << false));
+    BSONObj sameParticipantList =
+        BSON("$and" << buildParticipantListMatchesConditions(participantList));
+    entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                    << sessionInfo.toBSON() << "$or"
+                    << BSON_ARRAY(noParticipantList << sameParticipantList)));
+
+    // Update with participant list.
+    TransactionCoordinatorDocument doc;
+    doc.setId(sessionInfo);
+    doc.setParticipants(participantList);
+    entry.setU(write_ops::UpdateModification::parseFromClassicUpdate(doc.toBSON()));
+
+    entry.setUpsert(true);
+    return entry;
+}
+
 repl::OpTime persistParticipantListBlocking(
     OperationContext* opCtx,
     const LogicalSessionId& lsid,
@@ -165,12 +299,19 @@ repl::OpTime persistParticipantListBlocking(
         hangBeforeWritingParticipantList.pauseWhileSet(opCtx);
     }
 
-    OperationSessionInfo sessionInfo;
-    sessionInfo.setSessionId(lsid);
-    sessionInfo.setTxnNumber(txnNumberAndRetryCounter.getTxnNumber());
-    if (auto txnRetryCounter = txnNumberAndRetryCounter.getTxnRetryCounter();
-        txnRetryCounter && !isDefaultTxnRetryCounter(*txnRetryCounter)) {
-        sessionInfo.setTxnRetryCounter(*txnNumberAndRetryCounter.getTxnRetryCounter());
+    OperationSessionInfo sessionInfo = makeSessionInfo(lsid, txnNumberAndRetryCounter);
+
+    // Coalesce this write with participant-list writes from other transactions committing
+    // concurrently. If the batched attempt cannot be attributed to this transaction, fall through
+    // to the single-document write below, which reproduces the precise per-transaction outcome.
+    if (auto batchedOpTime = coordinatorDocWriteBatcher(opCtx).submit(
+            opCtx, buildParticipantListUpdateEntry(sessionInfo, participantList))) {
+        LOGV2_DEBUG(22465,
+                    3,
+                    "Wrote participant list",
+                    "sessionId"_attr = lsid,
+                    "txnNumberAndRetryCounter"_attr = txnNumberAndRetryCounter);
+        return *batchedOpTime;
     }
 
     DBDirectClient client(opCtx);
@@ -179,29 +320,7 @@ repl::OpTime persistParticipantListBlocking(
     const auto commandResponse = client.runCommand([&] {
         write_ops::UpdateCommandRequest updateOp(
             NamespaceString::kTransactionCoordinatorsNamespace);
-        updateOp.setUpdates({[&] {
-            write_ops::UpdateOpEntry entry;
-
-            // Ensure that the document for the (lsid, txnNumber) either has no participant list or
-            // has the same participant list. The document may have the same participant list if an
-            // earlier attempt to write the participant list failed waiting for writeConcern.
-            BSONObj noParticipantList = BSON(TransactionCoordinatorDocument::kParticipantsFieldName
-                                             << BSON("$exists" << false));
-            BSONObj sameParticipantList =
-                BSON("$and" << buildParticipantListMatchesConditions(participantList));
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON() << "$or"
-                            << BSON_ARRAY(noParticipantList << sameParticipantList)));
-
-            // Update with participant list.
-            TransactionCoordinatorDocument doc;
-            doc.setId(std::move(sessionInfo));
-            doc.setParticipants(participantList);
-            entry.setU(write_ops::UpdateModification::parseFromClassicUpdate(doc.toBSON()));
-
-            entry.setUpsert(true);
-            return entry;
-        }()});
+        updateOp.setUpdates({buildParticipantListUpdateEntry(sessionInfo, participantList)});
         return updateOp.serialize();
     }());
 
@@ -225,7 +344,7 @@ repl::OpTime persistParticipantListBlocking(
     // Throw any other error.
     uassertStatusOK(upsertStatus);
 
-    LOGV2_DEBUG(22465,
+    LOGV2_DEBUG(9987412,
                 3,
                 "Wrote participant list",
                 "sessionId"_attr = lsid,
@@ -373,6 +492,42 @@ Future<PrepareVoteConsensus> sendPrepare(ServiceContext* service,
 }
 
 namespace {
+write_ops::UpdateOpEntry buildDecisionUpdateEntry(const OperationSessionInfo& sessionInfo,
+                                                  const std::vector<ShardId>& participantList,
+                                                  const txn::CoordinatorCommitDecision& decision,
+                                                  std::vector<NamespaceString> affectedNamespaces) {
+    write_ops::UpdateOpEntry entry;
+
+    // Ensure that the document for the (lsid, txnNumber) has the same participant list and either
+    // has no decision or the same decision. The document may have the same decision if an earlier
+    // attempt to write the decision failed waiting for writeConcern.
+    BSONObj noDecision =
+        BSON(TransactionCoordinatorDocument::kDecisionFieldName << BSON("$exists" << false));
+    BSONObj sameDecision =
+        BSON(TransactionCoordinatorDocument::kDecisionFieldName << decision.toBSON());
+
+    entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                    << sessionInfo.toBSON() << "$and"
+                    << buildParticipantListMatchesConditions(participantList) << "$or"
+                    << BSON_ARRAY(noDecision << sameDecision)));
+
+    entry.setUpsert(true);
+    entry.setU(write_ops::UpdateModification::parseFromClassicUpdate([&] {
+        TransactionCoordinatorDocument doc;
+        doc.setId(sessionInfo);
+        doc.setParticipants(participantList);
+        doc.setDecision(decision);
+        if (decision.getDecision() == CommitDecision::kCommit &&
+            feature_flags::gFeatureFlagEndOfTransactionChangeEvent.isEnabled(
+                serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+            doc.setAffectedNamespaces(std::move(affectedNamespaces));
+        }
+        return doc.toBSON();
+    }()));
+
+    return entry;
+}
+
 repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
                                      const LogicalSessionId& lsid,
                                      const TxnNumberAndRetryCounter& txnNumberAndRetryCounter,
@@ -392,12 +547,21 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
         hangBeforeWritingDecision.pauseWhileSet(opCtx);
     }
 
-    OperationSessionInfo sessionInfo;
-    sessionInfo.setSessionId(lsid);
-    sessionInfo.setTxnNumber(txnNumberAndRetryCounter.getTxnNumber());
-    if (auto txnRetryCounter = txnNumberAndRetryCounter.getTxnRetryCounter();
-        txnRetryCounter && !isDefaultTxnRetryCounter(*txnRetryCounter)) {
-        sessionInfo.setTxnRetryCounter(*txnNumberAndRetryCounter.getTxnRetryCounter());
+    OperationSessionInfo sessionInfo = makeSessionInfo(lsid, txnNumberAndRetryCounter);
+
+    // Coalesce this write with decision writes from other transactions committing concurrently. If
+    // the batched attempt cannot be attributed to this transaction, fall through to the
+    // single-document write below, which reproduces the precise per-transaction outcome.
+    if (auto batchedOpTime = coordinatorDocWriteBatcher(opCtx).submit(
+            opCtx,
+            buildDecisionUpdateEntry(sessionInfo, participantList, decision, affectedNamespaces))) {
+        LOGV2_DEBUG(22469,
+                    3,
+                    "Wrote decision",
+                    "sessionId"_attr = lsid,
+                    "txnNumberAndRetryCounter"_attr = txnNumberAndRetryCounter,
+                    "decision"_attr = (isCommit ? "commit" : "abort"));
+        return *batchedOpTime;
     }
 
     DBDirectClient client(opCtx);
@@ -406,38 +570,8 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
     const auto commandResponse = client.runCommand([&] {
         write_ops::UpdateCommandRequest updateOp(
             NamespaceString::kTransactionCoordinatorsNamespace);
-        updateOp.setUpdates({[&] {
-            write_ops::UpdateOpEntry entry;
-
-            // Ensure that the document for the (lsid, txnNumber) has the same participant list and
-            // either has no decision or the same decision. The document may have the same decision
-            // if an earlier attempt to write the decision failed waiting for writeConcern.
-            BSONObj noDecision = BSON(TransactionCoordinatorDocument::kDecisionFieldName
-                                      << BSON("$exists" << false));
-            BSONObj sameDecision =
-                BSON(TransactionCoordinatorDocument::kDecisionFieldName << decision.toBSON());
-
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON() << "$and"
-                            << buildParticipantListMatchesConditions(participantList) << "$or"
-                            << BSON_ARRAY(noDecision << sameDecision)));
-
-            entry.setUpsert(true);
-            entry.setU(write_ops::UpdateModification::parseFromClassicUpdate([&] {
-                TransactionCoordinatorDocument doc;
-                doc.setId(sessionInfo);
-                doc.setParticipants(std::move(participantList));
-                doc.setDecision(decision);
-                if (decision.getDecision() == CommitDecision::kCommit &&
-                    feature_flags::gFeatureFlagEndOfTransactionChangeEvent.isEnabled(
-                        serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
-                    doc.setAffectedNamespaces(std::move(affectedNamespaces));
-                }
-                return doc.toBSON();
-            }()));
-
-            return entry;
-        }()});
+        updateOp.setUpdates({buildDecisionUpdateEntry(
+            sessionInfo, participantList, decision, std::move(affectedNamespaces))});
         return updateOp.serialize();
     }());
 
@@ -463,7 +597,7 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
                                 << doc);
     }
 
-    LOGV2_DEBUG(22469,
+    LOGV2_DEBUG(9987413,
                 3,
                 "Wrote decision",
                 "sessionId"_attr = lsid,
@@ -2200,7 +2200,9 @@ void parseCommand(HandleRequest::ExecutionContext& execContext) try {
     if (msg.operation() == dbQuery) {
         checkAllowedOpQueryCommand(*client, opMsgReq.getCommandName());
     }
-    execContext.setRequest(opMsgReq);
+    // Hand the parsed request over without copying it: its BSONObj views (command body and
+    // document sequences) alias the ref-counted Message buffer until the command completes.
+    execContext.setRequest(std::move(opMsgReq));
 } catch (const DBException& ex) {
     // Need to set request as `makeCommandResponse` expects an empty request on failure.
     execContext.setRequest({});
@@ -51,6 +51,7 @@
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/read_concern_level.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/speculative_majority_read_info.h"
 #include "mongo/db/replica_set_endpoint_util.h"
@@ -66,6 +67,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/logv2/redaction.h"
+#include "mongo/platform/compiler.h"
 #include "mongo/rpc/check_allowed_op_query_cmd.h"
 #include "mongo/rpc/factory.h"
 #include "mongo/rpc/get_status_from_command_result.h"
@@ -120,10 +122,25 @@ void setPrepareConflictBehaviorForReadConcern(OperationContext* opCtx,
 void waitForReadConcern(OperationContext* opCtx,
                         const CommandInvocation* invocation,
                         const OpMsgRequest& request) {
-    Status rcStatus = mongo::waitForReadConcern(opCtx,
-                                                repl::ReadConcernArgs::get(opCtx),
-                                                invocation->ns().dbName(),
-                                                invocation->allowsAfterClusterTime());
+    auto& readConcernArgs = repl::ReadConcernArgs::get(opCtx);
+
+    // When enabled, "majority" reads from commands that support it execute speculatively at a
+    // local snapshot instead of waiting here for the commit point to advance. The wait happens
+    // after the command body has run, in waitForSpeculativeMajorityReadConcern(), and only until
+    // the operation's own read timestamp is majority committed, which is typically well behind
+    // the global commit point.
+    if (MONGO_unlikely(repl::enableSpeculativeMajorityReads.load()) &&
+        readConcernArgs.hasLevel() &&
+        readConcernArgs.getLevel() == repl::ReadConcernLevel::kMajorityReadConcern &&
+        readConcernArgs.getMajorityReadMechanism() ==
+            repl::ReadConcernArgs::MajorityReadMechanism::kMajoritySnapshot &&
+        !opCtx->inMultiDocumentTransaction() && invocation->allowsSpeculativeMajorityReads()) {
+        readConcernArgs.setMajorityReadMechanism(
+            repl::ReadConcernArgs::MajorityReadMechanism::kSpeculative);
+    }
+
+    Status rcStatus = mongo::waitForReadConcern(
+        opCtx, readConcernArgs, invocation->ns().dbName(), invocation->allowsAfterClusterTime());
 
     if (!rcStatus.isOK()) {
         if (ErrorCodes::isExceededTimeLimitError(rcStatus.code())) {
@@ -67,6 +67,11 @@
 #include <utility>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 // IWYU pragma: no_include "boost/container/detail/std_fwd.hpp"
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
@@ -91,6 +96,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/posix_fadvise.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 #include "mongo/util/destructor_guard.h"
@@ -168,7 +174,8 @@ void dassertCompIsSane(const Comparator& comp, const Key& lhs, const Key& rhs) {
 }
 
 /**
- * Returns results from sorted in-memory storage.
+ * Returns results from sorted in-memory storage. Implements the deferred-value protocol so that it
+ * can take part in a MergeIterator alongside iterators over spilled runs.
  */
 template <typename Key, typename Value>
 class InMemIterator : public SortIteratorInterface<Key, Value> {
@@ -200,11 +207,13 @@ public:
     }
 
     Key nextWithDeferredValue() override {
-        MONGO_UNREACHABLE;
+        return std::move(_data[_index].first);
     }
 
     Value getDeferredValue() override {
-        MONGO_UNREACHABLE;
+        Value out = std::move(_data[_index].second);
+        _index++;
+        return out;
     }
 
     const Key& current() override {
@@ -442,6 +451,11 @@ private:
 
     /**
      * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
+     *
+     * Reads are served from a read-ahead buffer refilled with large sequential reads, so the
+     * per-block framing (a 4 byte length header followed by the block) does not turn into two
+     * small file reads per block. This matters most during merges, where many iterators take
+     * turns reading from the same file and small interleaved reads defeat OS readahead.
      */
     void _read(void* out, size_t size) {
         if (_fileCurrentOffset == _fileEndOffset) {
@@ -453,8 +467,48 @@ private:
                   str::stream() << "Current file offset (" << _fileCurrentOffset
                                 << ") greater than end offset (" << _fileEndOffset << ")");
 
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
+        char* dest = static_cast<char*>(out);
+        while (size > 0) {
+            std::size_t avail = _readAheadValid - _readAheadPos;
+            if (avail == 0) {
+                const std::streamoff rangeRemaining = _fileEndOffset - _fileCurrentOffset;
+                if (rangeRemaining == 0) {
+                    // The block claims more data than the range holds. Surface this the same way
+                    // a truncated header read does, so the caller's "file too short?" check fires.
+                    _done = true;
+                    return;
+                }
+
+                // Reads at least as large as the read-ahead buffer would only pass through it, so
+                // they go straight to the file.
+                if (size >= kSortedFileBufferSize) {
+                    const std::size_t toRead =
+                        std::min(static_cast<std::streamoff>(size), rangeRemaining);
+                    _file->read(_fileCurrentOffset, toRead, dest);
+                    _fileCurrentOffset += toRead;
+                    dest += toRead;
+                    size -= toRead;
+                    continue;
+                }
+
+                if (!_readAheadBuffer) {
+                    _readAheadBuffer.reset(new char[kSortedFileBufferSize]);
+                }
+                const std::size_t toRead = std::min(
+                    static_cast<std::streamoff>(kSortedFileBufferSize), rangeRemaining);
+                _file->read(_fileCurrentOffset, toRead, _readAheadBuffer.get());
+                _readAheadValid = toRead;
+                _readAheadPos = 0;
+                avail = toRead;
+            }
+
+            const std::size_t toCopy = std::min(avail, size);
+            memcpy(dest, _readAheadBuffer.get() + _readAheadPos, toCopy);
+            _readAheadPos += toCopy;
+            _fileCurrentOffset += toCopy;
+            dest += toCopy;
+            size -= toCopy;
+        }
     }
 
     const Settings _settings;
@@ -462,6 +516,14 @@ private:
 
     std::unique_ptr<char[]> _buffer;
     std::unique_ptr<BufReader> _bufferReader;
+
+    // Read-ahead buffer for '_read'. Holds 'kSortedFileBufferSize' bytes of raw file data starting
+    // behind '_fileCurrentOffset', of which '_readAheadValid' are filled and '_readAheadPos' have
+    // already been consumed. Allocated lazily on the first buffered read.
+    std::unique_ptr<char[]> _readAheadBuffer;
+    std::size_t _readAheadValid = 0;
+    std::size_t _readAheadPos = 0;
+
     std::shared_ptr<typename Sorter<Key, Value>::File>
         _file;                          // File containing the sorted data range.
     std::streamoff _fileStartOffset;    // File offset at which the sorted data range starts.
@@ -915,6 +977,24 @@ public:
             return new InMemIterator<Key, Value>(_data);
         }
 
+        // If the final in-memory run fits in the memory budget alongside the read buffers of the
+        // on-disk runs, merge it in place rather than spilling it to disk only to immediately read
+        // it back.
+        if (!_data.empty() && this->_iters.size() + 1 < this->fileIteratorsMaxNum &&
+            (this->_iters.size() + 1) * kSortedFileBufferSize + this->_stats.memUsage() <=
+                this->_opts.maxMemoryUsageBytes) {
+            sort();
+            auto iters = this->_iters;
+            // The in-memory run holds the most recently added data, so it must be merged last to
+            // keep the sort stable.
+            if (this->_opts.moveSortedDataIntoIterator) {
+                iters.push_back(std::make_shared<InMemIterator<Key, Value>>(std::move(_data)));
+            } else {
+                iters.push_back(std::make_shared<InMemIterator<Key, Value>>(_data));
+            }
+            return Iterator::merge(iters, this->_opts, this->_comp);
+        }
+
         spill();
         this->_mergeSpills(this->_spillsNumToRespectMemoryLimits);
 
@@ -1443,6 +1523,12 @@ Sorter<Key, Value>::File::File(std::string path, SorterFileStats* stats)
 
 template <typename Key, typename Value>
 Sorter<Key, Value>::File::~File() {
+#if !defined(_WIN32)
+    if (_adviseFd >= 0) {
+        ::close(_adviseFd);
+    }
+#endif
+
     if (_stats && _file.is_open()) {
         _stats->closed.addAndFetch(1);
     }
@@ -1504,6 +1590,10 @@ void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size,
             str::stream() << "Error reading file " << _path.string() << ": "
                           << sorter::myErrnoWithDescription(),
             _file.tellg() >= 0);
+
+    // Merge read-back is a single sequential pass over each range, so the pages just read will
+    // not be needed again and should not stay cached at the expense of hot storage engine data.
+    _adviseDontNeed(offset, size);
 }
 
 template <typename Key, typename Value>
@@ -1516,6 +1606,16 @@ void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
         if (_stats) {
             this->_stats->addSpilledDataSize(size);
         };
+
+        // Periodically release the written data from the page cache so large spills do not evict
+        // hot storage engine data. Only clean pages are dropped; regions still dirty at this
+        // point are released by a later advise, once writeback has caught up with them.
+        constexpr std::streamoff kAdviseChunkBytes = 64 * 1024 * 1024;
+        if ((_bytesWrittenSinceAdvise += size) >= kAdviseChunkBytes) {
+            _file.flush();
+            _bytesWrittenSinceAdvise = 0;
+            _adviseDontNeed(0, 0);
+        }
     } catch (const std::system_error& ex) {
         if (ex.code() == std::errc::no_space_on_device) {
             uasserted(ErrorCodes::OutOfDiskSpace,
@@ -1554,11 +1654,30 @@ void Sorter<Key, Value>::File::_open() {
                           << sorter::myErrnoWithDescription(),
             _file.good());
 
+#if !defined(_WIN32)
+    // Open a second descriptor on the spill file, used only to issue page cache advice. Failing
+    // to open it just loses the advice, so the result is not checked.
+    _adviseFd = ::open(_path.string().c_str(), O_RDONLY);
+#endif
+
     if (_stats) {
         _stats->opened.addAndFetch(1);
     }
 }
 
+template <typename Key, typename Value>
+void Sorter<Key, Value>::File::_adviseDontNeed(std::streamoff offset, std::streamsize size) {
+#if !defined(_WIN32) && defined(POSIX_FADV_DONTNEED)
+    if (_adviseFd < 0) {
+        return;
+    }
+
+    // Failure only loses the page cache hint, so the result is ignored.
+    (void)posix_fadvise(
+        _adviseFd, static_cast<off_t>(offset), static_cast<off_t>(size), POSIX_FADV_DONTNEED);
+#endif
+}
+
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::_ensureOpenForWriting() {
     if (!_file.is_open()) {
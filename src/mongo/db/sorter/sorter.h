@@ -371,9 +371,24 @@ public:
          */
         void _ensureOpenForWriting();
 
+        /**
+         * Advises the kernel that the cached pages for the given region of the file are not
+         * needed again, so that spill I/O does not evict hot storage engine data from the OS
+         * page cache. A 'size' of zero covers the whole file. No-op on platforms without
+         * posix_fadvise.
+         */
+        void _adviseDontNeed(std::streamoff offset, std::streamsize size);
+
         boost::filesystem::path _path;
         std::fstream _file;
 
+        // Descriptor on the spill file used only to issue page cache advice, or -1 when
+        // unavailable.
+        int _adviseFd = -1;
+
+        // Number of bytes written since the last page cache advise.
+        std::streamoff _bytesWrittenSinceAdvise = 0;
+
         // The current offset of the end of the file if there may be unflushed data, or -1 if the
         // file either has not yet been opened or has been flushed.
         std::streamoff _offset = -1;
@@ -1104,6 +1104,36 @@ public:
 
 unittest::OldStyleSuiteInitializer<SorterSuite> extSortTests;
 
+TEST(NoLimitSorterTests, FinalInMemoryRunMergedWithoutSpilling) {
+    unittest::TempDir tempDir("final_in_memory_run_merged_without_spilling");
+    auto opts =
+        SortOptions().ExtSortAllowed().TempDir(tempDir.path()).MaxMemoryUsageBytes(1024 * 1024);
+    auto sorter = std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+
+    // Add enough data to spill at least once, leaving a final run in memory that is small enough
+    // to merge directly with the on-disk runs.
+    constexpr int kNumItems = 150'000;
+    for (int i = kNumItems - 1; i >= 0; i--) {
+        sorter->add(i, -i);
+    }
+    auto numSpills = sorter->stats().spilledRanges();
+    ASSERT_GTE(numSpills, 1);
+
+    auto iter = std::unique_ptr<IWIterator>(sorter->done());
+
+    // done() merged the final in-memory run directly with the spilled runs instead of writing it
+    // to disk first.
+    ASSERT_EQ(sorter->stats().spilledRanges(), numSpills);
+
+    for (int i = 0; i < kNumItems; i++) {
+        ASSERT(iter->more());
+        auto pair = iter->next();
+        ASSERT_EQUALS(i, pair.first);
+        ASSERT_EQUALS(-i, pair.second);
+    }
+    ASSERT_FALSE(iter->more());
+}
+
 /**
  * This suite includes test cases for resumable index builds where the Sorter is reconstructed from
  * state persisted to disk during a previous clean shutdown.
@@ -28,20 +28,14 @@
  */
 
 #include <memory>
-#include <mutex>
-#include <valarray>
-
 
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
-#include "mongo/db/client.h"
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/concurrency/lock_stats.h"
+#include "mongo/db/concurrency/locker.h"
 #include "mongo/db/operation_context.h"
-#include "mongo/db/service_context.h"
-#include "mongo/db/transaction_resources.h"
-#include "mongo/util/assert_util_core.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -60,22 +54,10 @@ public:
 
     BSONObj generateSection(OperationContext* opCtx,
                             const BSONElement& configElement) const override {
-        std::valarray<int> clientStatusCounts(5);
-
-        // This returns the blocked lock states
-        for (ServiceContext::LockedClientsCursor cursor(opCtx->getClient()->getServiceContext());
-             Client* client = cursor.next();) {
-            invariant(client);
-            stdx::unique_lock<Client> uniqueLock(*client);
-
-            const OperationContext* clientOpCtx = client->getOperationContext();
-            auto state = clientOpCtx ? shard_role_details::getLocker(clientOpCtx)->getClientState()
-                                     : Locker::kInactive;
-            invariant(state < clientStatusCounts.size());
-            clientStatusCounts[state]++;
-        }
+        // These are summed from counters that each locker maintains on its own state transitions,
+        // so reporting does not iterate every Client in the process and take its lock.
+        const auto counts = Locker::getGlobalClientStateCounts();
 
-        // Construct the actual return value out of the mutex
         BSONObjBuilder ret;
 
         ret.append("totalTime", (long long)(1000 * (curTimeMillis64() - _started)));
@@ -83,22 +65,18 @@ public:
         {
             BSONObjBuilder currentQueueBuilder(ret.subobjStart("currentQueue"));
 
-            currentQueueBuilder.append("total",
-                                       clientStatusCounts[Locker::kQueuedReader] +
-                                           clientStatusCounts[Locker::kQueuedWriter]);
-            currentQueueBuilder.append("readers", clientStatusCounts[Locker::kQueuedReader]);
-            currentQueueBuilder.append("writers", clientStatusCounts[Locker::kQueuedWriter]);
+            currentQueueBuilder.append("total", counts.queuedReaders + counts.queuedWriters);
+            currentQueueBuilder.append("readers", counts.queuedReaders);
+            currentQueueBuilder.append("writers", counts.queuedWriters);
             currentQueueBuilder.done();
         }
 
         {
             BSONObjBuilder activeClientsBuilder(ret.subobjStart("activeClients"));
 
-            activeClientsBuilder.append("total",
-                                        clientStatusCounts[Locker::kActiveReader] +
-                                            clientStatusCounts[Locker::kActiveWriter]);
-            activeClientsBuilder.append("readers", clientStatusCounts[Locker::kActiveReader]);
-            activeClientsBuilder.append("writers", clientStatusCounts[Locker::kActiveWriter]);
+            activeClientsBuilder.append("total", counts.activeReaders + counts.activeWriters);
+            activeClientsBuilder.append("readers", counts.activeReaders);
+            activeClientsBuilder.append("writers", counts.activeWriters);
             activeClientsBuilder.done();
         }
 
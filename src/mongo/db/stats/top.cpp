@@ -41,6 +41,7 @@
 #include "mongo/db/curop.h"
 #include "mongo/db/service_context.h"
 #include "mongo/util/namespace_string_util.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 namespace {
@@ -145,8 +146,9 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(nssStr);
-    stdx::lock_guard lk(_lockUsage);
-    CollectionData& coll = _usage[hashedNs];
+    auto& partition = _partitionFor(hashedNs);
+    stdx::lock_guard lk(partition.lock);
+    CollectionData& coll = partition.map[hashedNs];
     updateCollectionData(lk, opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -157,32 +159,38 @@ void Top::record(OperationContext* opCtx,
                  long long micros,
                  bool command,
                  Command::ReadWriteType readWriteType) {
-    std::vector<std::string> hashedSet;
+    // Serialize and hash the namespaces before taking any locks, so that the critical sections
+    // below are only the map updates. The hashed keys reference the serialized strings, so the
+    // vector backing them must not reallocate.
+    std::vector<std::string> nssStrs;
+    nssStrs.reserve(nssSet.size());
+    std::vector<StringMapHashedKey> hashedSet;
     hashedSet.reserve(nssSet.size());
     for (auto& nss : nssSet) {
-        const auto nssStr =
-            NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
+        auto nssStr = NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
         if (nssStr[0] != '?') {
-            hashedSet.emplace_back(UsageMap::hasher().hashed_key(nssStr));
+            nssStrs.emplace_back(std::move(nssStr));
+            hashedSet.emplace_back(UsageMap::hasher().hashed_key(nssStrs.back()));
         }
     }
 
-    stdx::lock_guard lk(_lockUsage);
     for (const auto& hashedNs : hashedSet) {
-        CollectionData& coll = _usage[hashedNs];
+        auto& partition = _partitionFor(hashedNs);
+        stdx::lock_guard lk(partition.lock);
+        CollectionData& coll = partition.map[hashedNs];
         updateCollectionData(lk, opCtx, coll, logicalOp, lockType, micros, readWriteType);
     }
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
     const auto nssStr = NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
-    stdx::lock_guard lk(_lockUsage);
-    _usage.erase(nssStr);
+    auto hashedNs = UsageMap::hasher().hashed_key(nssStr);
+    auto& partition = _partitionFor(hashedNs);
+    stdx::lock_guard lk(partition.lock);
+    partition.map.erase(hashedNs);
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard lk(_lockUsage);
-
     auto appendStatsEntry = [&](BSONObjBuilder& b, auto name, const UsageData& data) {
         BSONObjBuilder bb(b.subobjStart(name));
         bb.appendNumber("time", data.time);
@@ -190,21 +198,27 @@ void Top::append(BSONObjBuilder& b) {
         bb.done();
     };
 
-    // pull all the names into a vector so we can sort them for the user
-    std::vector<std::string> names;
-    for (UsageMap::const_iterator i = _usage.begin(); i != _usage.end(); ++i) {
-        names.push_back(i->first);
+    // Copy the entries out of each partition so they can be sorted by name for the user. The
+    // partitions are snapshotted one at a time; this output is diagnostic only and does not need
+    // a consistent cut across collections.
+    std::vector<std::pair<std::string, CollectionData>> entries;
+    for (auto&& partition : _usagePartitions) {
+        stdx::lock_guard lk(partition.lock);
+        for (auto&& [name, coll] : partition.map) {
+            entries.emplace_back(name, coll);
+        }
     }
 
-    std::sort(names.begin(), names.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
 
-    for (size_t i = 0; i < names.size(); i++) {
-        BSONObjBuilder bb(b.subobjStart(names[i]));
+    for (auto&& [name, coll] : entries) {
+        BSONObjBuilder bb(b.subobjStart(name));
 
-        const CollectionData& coll = _usage.find(names[i])->second;
-        auto pos = names[i].find('.');
+        auto pos = name.find('.');
         if (coll.isStatsRecordingAllowed &&
-            !NamespaceString::isFLE2StateCollection(names[i].substr(pos + 1))) {
+            !NamespaceString::isFLE2StateCollection(name.substr(pos + 1))) {
             appendStatsEntry(b, "total", coll.total);
 
             appendStatsEntry(b, "readLock", coll.readLock);
@@ -226,9 +240,11 @@ void Top::appendLatencyStats(const NamespaceString& nss,
                              BSONObjBuilder* builder) {
     const auto nssStr = NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
     auto hashedNs = UsageMap::hasher().hashed_key(nssStr);
-    stdx::lock_guard lk(_lockUsage);
+    auto& partition = _partitionFor(hashedNs);
+    stdx::lock_guard lk(partition.lock);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    partition.map[hashedNs].opLatencyHistogram.append(
+        includeHistograms, false, &latencyStatsBuilder);
     builder->append("ns", nssStr);
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -33,7 +33,9 @@
  * DB usage monitor.
  */
 
+#include <array>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
@@ -161,9 +163,22 @@ private:
     AtomicOperationLatencyHistogram _globalHistogramStats;
     AtomicOperationLatencyHistogram _workingTimeHistogramStats;
 
-    // _lockUsage should always be acquired before using _usage.
-    Mutex _lockUsage = MONGO_MAKE_LATCH("Top::_lockUsage");
-    UsageMap _usage;
+    // Per-collection usage is sharded over independently locked partitions, selected by the
+    // namespace hash, so that operations on different collections do not all serialize on a
+    // single mutex.
+    static constexpr size_t kNumUsagePartitions = 16;
+
+    struct UsagePartition {
+        // 'lock' guards 'map'.
+        Mutex lock = MONGO_MAKE_LATCH("Top::UsagePartition::lock");
+        UsageMap map;
+    };
+
+    UsagePartition& _partitionFor(const StringMapHashedKey& hashedNs) {
+        return _usagePartitions[hashedNs.hash() % kNumUsagePartitions];
+    }
+
+    std::array<UsagePartition, kNumUsagePartitions> _usagePartitions;
 };
 
 }  // namespace mongo
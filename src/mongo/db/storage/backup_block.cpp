@@ -55,11 +55,13 @@ BackupBlock::BackupBlock(OperationContext* opCtx,
                          std::string filePath,
                          std::uint64_t offset,
                          std::uint64_t length,
-                         std::uint64_t fileSize)
+                         std::uint64_t fileSize,
+                         boost::optional<std::uint64_t> checksum)
     : _filePath(filePath),
       _offset(offset),
       _length(length),
       _fileSize(fileSize),
+      _checksum(checksum),
       _nss(nss),
       _uuid(uuid) {}
 
@@ -62,7 +62,8 @@ public:
                          std::string filePath,
                          std::uint64_t offset = 0,
                          std::uint64_t length = 0,
-                         std::uint64_t fileSize = 0);
+                         std::uint64_t fileSize = 0,
+                         boost::optional<std::uint64_t> checksum = boost::none);
 
     ~BackupBlock() = default;
 
@@ -90,6 +91,16 @@ public:
         return _uuid;
     }
 
+    /**
+     * Returns the content hash of this block, if one was computed during enumeration. The storage
+     * engine's incremental change tracking is page-granular and may report blocks whose bytes are
+     * in fact identical to the source backup; consumers can compare this hash against the one
+     * recorded for the previous backup and skip copying unchanged blocks.
+     */
+    boost::optional<std::uint64_t> checksum() const {
+        return _checksum;
+    }
+
     /**
      * Returns whether the file must be copied regardless of choice for selective backups.
      */
@@ -100,6 +111,7 @@ private:
     const std::uint64_t _offset;
     const std::uint64_t _length;
     const std::uint64_t _fileSize;
+    const boost::optional<std::uint64_t> _checksum;
 
     boost::optional<NamespaceString> _nss;
     boost::optional<UUID> _uuid;
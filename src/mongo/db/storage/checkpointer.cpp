@@ -29,6 +29,7 @@
 
 
 // IWYU pragma: no_include "cxxabi.h"
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <mutex>
@@ -42,6 +43,7 @@
 #include "mongo/db/storage/checkpointer.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -62,6 +64,10 @@ namespace {
 
 const auto getCheckpointer = ServiceContext::declareDecoration<std::unique_ptr<Checkpointer>>();
 
+// How often the waiting checkpoint thread samples the dirty cache fill ratio when dirty-driven
+// checkpoints are enabled.
+constexpr Seconds kDirtyDataPollPeriod{1};
+
 MONGO_FAIL_POINT_DEFINE(pauseCheckpointThread);
 
 }  // namespace
@@ -100,15 +106,39 @@ void Checkpointer::run() {
             MONGO_IDLE_THREAD_BLOCK;
 
             // Wait for 'storageGlobalParams.syncdelay' seconds; or until either shutdown is
-            // signaled or a checkpoint is triggered.
+            // signaled or a checkpoint is triggered. The wait is taken in short steps so the
+            // dirty cache fill ratio can be polled and the checkpoint started ahead of the
+            // cadence when dirty data is accumulating quickly.
             LOGV2_DEBUG(7702900,
                         1,
                         "Checkpoint thread sleeping",
                         "duration"_attr = static_cast<std::int64_t>(storageGlobalParams.syncdelay));
-            _sleepCV.wait_for(
-                lock,
-                stdx::chrono::seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay)),
-                [&] { return _shuttingDown || _triggerCheckpoint; });
+            const Date_t deadline =
+                Date_t::now() + Seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay));
+            while (Date_t::now() < deadline && !_shuttingDown && !_triggerCheckpoint) {
+                const Date_t nextWakeup = std::min(deadline, Date_t::now() + kDirtyDataPollPeriod);
+                if (_sleepCV.wait_until(lock, nextWakeup.toSystemTimePoint(), [&] {
+                        return _shuttingDown || _triggerCheckpoint;
+                    })) {
+                    break;
+                }
+
+                const double triggerFraction = gCheckpointDirtyDataTriggerFraction.load();
+                if (triggerFraction > 0) {
+                    const double dirtyFillRatio = opCtx->getServiceContext()
+                                                      ->getStorageEngine()
+                                                      ->getCacheDirtyFillRatio();
+                    if (dirtyFillRatio >= triggerFraction) {
+                        LOGV2_DEBUG(9987407,
+                                    1,
+                                    "Starting checkpoint ahead of the syncdelay cadence because "
+                                    "of dirty data accumulation",
+                                    "dirtyFillRatio"_attr = dirtyFillRatio,
+                                    "triggerFraction"_attr = triggerFraction);
+                        break;
+                    }
+                }
+            }
 
             // If the syncdelay is set to 0, that means we should skip checkpointing. However,
             // syncdelay is adjustable by a runtime server parameter, so we need to wake up to check
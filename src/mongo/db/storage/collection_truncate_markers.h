@@ -57,6 +57,7 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -119,7 +120,13 @@ public:
         : _minBytesPerMarker(minBytesPerMarker),
           _currentRecords(leftoverRecordsCount),
           _currentBytes(leftoverRecordsBytes),
-          _markers(std::move(markers)) {}
+          _markers(std::move(markers)) {
+        int64_t totalBytes = 0;
+        for (const auto& marker : _markers) {
+            totalBytes += marker.bytes;
+        }
+        _totalMarkersBytes.store(totalBytes);
+    }
 
     virtual ~CollectionTruncateMarkers() = default;
 
@@ -257,6 +264,10 @@ public:
 
     void setMinBytesPerMarker(int64_t size);
 
+    int64_t minBytesPerMarker() const {
+        return _minBytesPerMarker.load();
+    }
+
     static constexpr uint64_t kRandomSamplesPerMarker = 10;
 
     //
@@ -294,12 +305,18 @@ private:
     virtual void _notifyNewMarkerCreation(){};
 
     // Minimum number of bytes the marker being filled should contain before it gets added to the
-    // deque of collection markers.
-    int64_t _minBytesPerMarker;
+    // deque of collection markers. Atomic so the insert commit path can read it without taking
+    // _markersMutex.
+    AtomicWord<int64_t> _minBytesPerMarker;
 
     AtomicWord<int64_t> _currentRecords;  // Number of records in the marker being filled.
     AtomicWord<int64_t> _currentBytes;    // Number of bytes in the marker being filled.
 
+    // Sum of the bytes of all whole markers in '_markers'. Kept up to date wherever the deque is
+    // mutated so that implementations of _hasExcessMarkers() can test capacity without walking
+    // the deque under _markersMutex, which would contend with inserts crossing a marker boundary.
+    AtomicWord<int64_t> _totalMarkersBytes;
+
     // Protects against concurrent access to the deque of collection markers.
     mutable Mutex _markersMutex = MONGO_MAKE_LATCH("CollectionTruncateMarkers::_markersMutex");
     std::deque<Marker> _markers;  // front = oldest, back = newest.
@@ -315,6 +332,16 @@ protected:
         static_assert(std::is_invocable_v<F, std::deque<Marker>&>,
                       "Function must be of type T(std::deque<Marker>&)");
         stdx::lock_guard lk(_markersMutex);
+        ON_BLOCK_EXIT([&] {
+            // 'f' may arbitrarily mutate the deque, so recompute the aggregate byte total it
+            // keeps in sync. This path is cold (rollback, truncation) compared to the readers of
+            // _totalMarkersBytes.
+            int64_t totalBytes = 0;
+            for (const auto& marker : _markers) {
+                totalBytes += marker.bytes;
+            }
+            _totalMarkersBytes.store(totalBytes);
+        });
         return f(_markers);
     }
 
@@ -330,6 +357,14 @@ protected:
         return _markers;
     }
 
+    /**
+     * Sum of the bytes of all whole markers. Unlike getMarkers(), safe to call without holding
+     * _markersMutex.
+     */
+    int64_t totalMarkersBytes() const {
+        return _totalMarkersBytes.load();
+    }
+
     /**
      * Returns whether the truncate markers instace has no markers, whether partial or whole. Note
      * that this method can provide a stale result unless the caller can guarantee that no more
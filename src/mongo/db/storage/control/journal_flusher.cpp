@@ -38,6 +38,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/db/admission/execution_admission_context.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/control/journal_flusher.h"
 #include "mongo/db/storage/recovery_unit.h"
@@ -56,6 +57,7 @@
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -69,6 +71,26 @@ const auto getJournalFlusher = ServiceContext::declareDecoration<std::unique_ptr
 MONGO_FAIL_POINT_DEFINE(pauseJournalFlusherBeforeFlush);
 MONGO_FAIL_POINT_DEFINE(pauseJournalFlusherThread);
 
+class JournalFlusherServerStatusSection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        if (auto& journalFlusher = getJournalFlusher(opCtx->getServiceContext())) {
+            journalFlusher->appendStats(&builder);
+        }
+        return builder.obj();
+    }
+};
+auto& journalFlusherServerStatusSection =
+    *ServerStatusSectionBuilder<JournalFlusherServerStatusSection>("journalFlusher").forShard();
+
 }  // namespace
 
 JournalFlusher* JournalFlusher::get(ServiceContext* serviceCtx) {
@@ -129,8 +151,11 @@ void JournalFlusher::run() {
     while (true) {
         pauseJournalFlusherBeforeFlush.pauseWhileSet();
         try {
+            Timer flushTimer;
             shard_role_details::getRecoveryUnit(_uniqueCtx->get())
                 ->waitUntilDurable(_uniqueCtx->get());
+            _flushes.fetchAndAdd(1);
+            _totalFlushTimeMicros.fetchAndAdd(flushTimer.micros());
 
             // Signal the waiters that a round completed.
             _currentSharedPromise->emplaceValue();
@@ -254,6 +279,7 @@ void JournalFlusher::resume() {
 }
 
 void JournalFlusher::waitForJournalFlush(Interruptible* interruptible) {
+    Timer waitTimer;
     auto myFuture = [&]() {
         stdx::lock_guard<Latch> lk(_stateMutex);
         _triggerJournalFlush(lk);
@@ -262,6 +288,7 @@ void JournalFlusher::waitForJournalFlush(Interruptible* interruptible) {
 
     // Throws on error if the flusher thread is shutdown.
     myFuture.get(interruptible);
+    _waitToFlushMicrosHistogram.increment(waitTimer.micros());
 }
 
 void JournalFlusher::triggerJournalFlush() {
@@ -277,6 +304,12 @@ void JournalFlusher::interruptJournalFlusherForReplStateChange() {
     }
 }
 
+void JournalFlusher::appendStats(BSONObjBuilder* bob) const {
+    bob->append("flushes", _flushes.load());
+    bob->append("totalFlushTimeMicros", _totalFlushTimeMicros.load());
+    appendHistogram(*bob, _waitToFlushMicrosHistogram, "waitToFlushMicros");
+}
+
 void JournalFlusher::_triggerJournalFlush(WithLock lk) {
     if (!_flushJournalNow) {
         _flushJournalNow = true;
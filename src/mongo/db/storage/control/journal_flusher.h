@@ -36,11 +36,13 @@
 
 #include "mongo/base/status.h"
 #include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/background.h"
 #include "mongo/util/future.h"
 #include "mongo/util/future_impl.h"
+#include "mongo/util/histogram.h"
 
 namespace mongo {
 
@@ -128,6 +130,13 @@ public:
      */
     void interruptJournalFlusherForReplStateChange();
 
+    /**
+     * Appends the number of flush rounds run, the cumulative time spent flushing, and a histogram
+     * of how long callers of waitForJournalFlush() waited for their flush round to complete.
+     * Reported under the 'journalFlusher' serverStatus section.
+     */
+    void appendStats(BSONObjBuilder* bob) const;
+
 private:
     // Journal flusher internal states.
     enum class States {
@@ -178,6 +187,16 @@ private:
     // data flushes will only be executed upon explicit request, no longer periodically in addition
     // to upon request.
     bool _disablePeriodicFlushes;
+
+    // Number of completed flush rounds and the cumulative time spent in them, used to derive the
+    // average device flush latency.
+    AtomicWord<long long> _flushes{0};
+    AtomicWord<long long> _totalFlushTimeMicros{0};
+
+    // Tracks how long callers of waitForJournalFlush() waited for their flush round to complete,
+    // which includes any in-progress round they had to queue behind.
+    Histogram<int64_t> _waitToFlushMicrosHistogram{
+        {500, 1'000, 2'500, 5'000, 10'000, 25'000, 50'000, 100'000, 250'000}};
 };
 
 }  // namespace mongo
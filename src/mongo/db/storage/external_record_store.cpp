@@ -33,7 +33,10 @@
 
 #include <boost/optional/optional.hpp>
 
+#include <algorithm>
+
 #include "mongo/db/operation_context.h"
+#include "mongo/db/storage/mapped_bson_file_cursor.h"
 #include "mongo/db/storage/multi_bson_stream_cursor.h"
 #include "mongo/db/storage/record_store.h"
 
@@ -46,12 +49,24 @@ ExternalRecordStore::ExternalRecordStore(const NamespaceString& ns,
     : RecordStore(uuid, /*identName=*/"dummy"_sd, /*isCapped=*/false), _vopts(vopts), _ns(ns) {}
 
 /**
- * Returns a MultiBsonStreamCursor for this record store. Reverse scans are not currently supported
- * for this record store type, so if 'forward' is false this asserts.
+ * Returns a cursor for this record store: a MappedBsonFileCursor for data sources of storage type
+ * 'file' and a MultiBsonStreamCursor for those of storage type 'pipe'. Reverse scans are not
+ * currently supported for this record store type, so if 'forward' is false this asserts.
  */
 std::unique_ptr<SeekableRecordCursor> ExternalRecordStore::getCursor(OperationContext* opCtx,
                                                                      bool forward) const {
     if (forward) {
+        const auto& dataSources = getOptions().dataSources;
+        const auto storageType =
+            dataSources.empty() ? StorageTypeEnum::pipe : dataSources.front().storageType;
+        uassert(9512816,
+                "All data sources of a virtual collection must have the same storage type",
+                std::all_of(dataSources.begin(), dataSources.end(), [&](auto&& dataSource) {
+                    return dataSource.storageType == storageType;
+                }));
+        if (storageType == StorageTypeEnum::file) {
+            return std::make_unique<MappedBsonFileCursor>(getOptions());
+        }
         return std::make_unique<MultiBsonStreamCursor>(getOptions());
     }
     tasserted(6968302, "MultiBsonStreamCursor does not support reverse scans");
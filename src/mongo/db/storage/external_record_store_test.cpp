@@ -34,6 +34,7 @@
 // IWYU pragma: no_include "cxxabi.h"
 #include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -49,6 +50,7 @@
 #include "mongo/db/pipeline/external_data_source_option_gen.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/input_stream.h"
+#include "mongo/db/storage/mapped_bson_file_cursor.h"
 #include "mongo/db/storage/multi_bson_stream_cursor.h"
 #include "mongo/db/storage/named_pipe.h"
 #include "mongo/db/storage/record_data.h"
@@ -59,6 +61,7 @@
 #include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
+#include "mongo/unittest/temp_dir.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/scopeguard.h"
 
@@ -585,4 +588,95 @@ TEST_F(ExternalRecordStoreTest, NamedPipeMultiplePipes4) {
     ASSERT_EQ(objsRead, objsWritten)
         << "Expected objsRead == {} but got {}"_format(objsWritten, objsRead);
 }
+
+// Writes 'bsonObjs' round-robin to a regular file at 'filePath' until 'numToWrite' objects have
+// been written.
+static void createBsonFile(const std::string& filePath,
+                           long numToWrite,
+                           const std::vector<BSONObj>& bsonObjs) {
+    std::ofstream fileWriter(filePath, std::ios::binary);
+    ASSERT_TRUE(fileWriter.is_open()) << "Failed to open file {}"_format(filePath);
+
+    const int numObjs = bsonObjs.size();
+    int objIdx = 0;
+    for (long num = 0; num < numToWrite; ++num) {
+        fileWriter.write(bsonObjs[objIdx].objdata(), bsonObjs[objIdx].objsize());
+        objIdx = (objIdx + 1) % numObjs;
+    }
+}
+
+TEST_F(ExternalRecordStoreTest, MappedFileBasicRead) {
+    unittest::TempDir tempDir("ERSTest_MappedFileBasicRead");
+    const auto filePath = tempDir.path() + "/reference.bson";
+    const std::vector<BSONObj> bsonObjs = {BSON("a" << 1), BSON("a" << 2 << "b"
+                                                                    << "foo")};
+    constexpr long numToWrite = 100;
+    createBsonFile(filePath, numToWrite, bsonObjs);
+
+    VirtualCollectionOptions vopts;
+    vopts.dataSources.emplace_back(
+        "file://" + filePath, StorageTypeEnum::file, FileTypeEnum::bson);
+
+    MappedBsonFileCursor cursor{vopts};
+    for (long num = 0; num < numToWrite; ++num) {
+        auto record = cursor.next();
+        ASSERT_TRUE(record) << "Expected a record at index {}"_format(num);
+        ASSERT_EQ(record->id.getLong(), num);
+
+        const auto& srcBsonObj = bsonObjs[num % bsonObjs.size()];
+        ASSERT_EQ(record->data.size(), srcBsonObj.objsize());
+        ASSERT_EQ(std::memcmp(record->data.data(), srcBsonObj.objdata(), srcBsonObj.objsize()), 0)
+            << "Read data is not same as the source data";
+    }
+    ASSERT_FALSE(cursor.next()) << "Expected EOF after reading all records";
+}
+
+TEST_F(ExternalRecordStoreTest, MappedFileMultipleFiles) {
+    unittest::TempDir tempDir("ERSTest_MappedFileMultipleFiles");
+    const std::vector<BSONObj> bsonObjs = {BSON("a" << 1)};
+    constexpr int numFiles = 3;
+    constexpr long numToWritePerFile = 10;
+
+    VirtualCollectionOptions vopts;
+    for (int fileIdx = 0; fileIdx < numFiles; ++fileIdx) {
+        const auto filePath = tempDir.path() + "/reference_{}.bson"_format(fileIdx);
+        createBsonFile(filePath, numToWritePerFile, bsonObjs);
+        vopts.dataSources.emplace_back(
+            "file://" + filePath, StorageTypeEnum::file, FileTypeEnum::bson);
+    }
+
+    MappedBsonFileCursor cursor{vopts};
+    long objsRead = 0;
+    while (auto record = cursor.next()) {
+        ASSERT_EQ(record->id.getLong(), objsRead);
+        ASSERT_EQ(std::memcmp(record->data.data(), bsonObjs[0].objdata(), bsonObjs[0].objsize()),
+                  0)
+            << "Read data is not same as the source data";
+        ++objsRead;
+    }
+    ASSERT_EQ(objsRead, numFiles * numToWritePerFile);
+}
+
+TEST_F(ExternalRecordStoreTest, MappedFileTruncatedObject) {
+    unittest::TempDir tempDir("ERSTest_MappedFileTruncatedObject");
+    const auto filePath = tempDir.path() + "/truncated.bson";
+    auto srcBsonObj = BSON("a" << 1);
+    {
+        std::ofstream fileWriter(filePath, std::ios::binary);
+        // Write one whole object and then only the first half of a second one.
+        fileWriter.write(srcBsonObj.objdata(), srcBsonObj.objsize());
+        fileWriter.write(srcBsonObj.objdata(), srcBsonObj.objsize() / 2);
+    }
+
+    VirtualCollectionOptions vopts;
+    vopts.dataSources.emplace_back(
+        "file://" + filePath, StorageTypeEnum::file, FileTypeEnum::bson);
+
+    MappedBsonFileCursor cursor{vopts};
+    auto record = cursor.next();
+    ASSERT_TRUE(record) << "Expected to read the first, whole object";
+    ASSERT_EQ(std::memcmp(record->data.data(), srcBsonObj.objdata(), srcBsonObj.objsize()), 0)
+        << "Read data is not same as the source data";
+    ASSERT_THROWS_CODE(cursor.next(), DBException, 9512815);
+}
 }  // namespace mongo
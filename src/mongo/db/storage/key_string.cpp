@@ -2795,6 +2795,96 @@ BSONObj toBsonSafe(const char* buffer, size_t len, Ordering ord, const TypeBits&
     return builder.obj();
 }
 
+namespace {
+/**
+ * Advances 'reader' and 'typeBitsReader' past a single key component without materializing it.
+ * Most scalar encodings consume no type bits at all and can be skipped byte-wise; string-like
+ * values consume exactly one type bit up front. Numerics and container types interleave type
+ * bits reads with the encoded value, so those are decoded into 'discard' and thrown away.
+ */
+void skipBsonValue(uint8_t ctype,
+                   BufReader* reader,
+                   TypeBits::ReaderBase* typeBitsReader,
+                   bool inverted,
+                   BSONObjBuilder* discard) {
+    switch (ctype) {
+        case CType::kStringLike:
+            typeBitsReader->readStringLike();
+            [[fallthrough]];
+        case CType::kMinKey:
+        case CType::kMaxKey:
+        case CType::kNullish:
+        case CType::kUndefined:
+        case CType::kBoolTrue:
+        case CType::kBoolFalse:
+        case CType::kDate:
+        case CType::kTimestamp:
+        case CType::kOID:
+        case CType::kCode:
+        case CType::kBinData:
+        case CType::kRegEx:
+        case CType::kDBRef:
+            filterKeyFromKeyString(ctype, reader, inverted, typeBitsReader->version());
+            break;
+        default:
+            toBsonValue(ctype,
+                        reader,
+                        typeBitsReader,
+                        inverted,
+                        typeBitsReader->version(),
+                        &(*discard << ""),
+                        1);
+            discard->resetToEmpty();
+            break;
+    }
+}
+}  // namespace
+
+void toBsonComponentsSafe(const char* buffer,
+                          size_t len,
+                          Ordering ord,
+                          const TypeBits& typeBits,
+                          const std::vector<bool>& includeComponent,
+                          BSONObjBuilder& builder) {
+    size_t lastIncluded = includeComponent.size();
+    for (size_t i = includeComponent.size(); i-- > 0;) {
+        if (includeComponent[i]) {
+            lastIncluded = i;
+            break;
+        }
+    }
+    if (lastIncluded == includeComponent.size())
+        return;
+
+    BufReader reader(buffer, len);
+    TypeBits::Reader typeBitsReader(typeBits);
+    BSONObjBuilder discard;
+    for (size_t i = 0; reader.remaining() && i <= lastIncluded; i++) {
+        const bool invert = (ord.get(static_cast<int>(i)) == -1);
+        uint8_t ctype = readType<uint8_t>(&reader, invert);
+        if (ctype == kLess || ctype == kGreater) {
+            // Discriminators are logically part of the previous field and only occur in query
+            // KeyStrings, which are never decoded this way, but skip them for symmetry with
+            // toBsonSafe().
+            ctype = readType<uint8_t>(&reader, invert);
+        }
+
+        if (ctype == kEnd)
+            break;
+        if (includeComponent[i]) {
+            toBsonValue(ctype,
+                        &reader,
+                        &typeBitsReader,
+                        invert,
+                        typeBitsReader.version(),
+                        &(builder << ""),
+                        1);
+        } else {
+            skipBsonValue(ctype, &reader, &typeBitsReader, invert, &discard);
+        }
+    }
+}
+
 BSONObj toBson(const char* buffer, size_t len, Ordering ord, const TypeBits& typeBits) noexcept {
     return toBsonSafe(buffer, len, ord, typeBits);
 }
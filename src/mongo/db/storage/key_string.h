@@ -772,6 +772,27 @@ public:
                     Ordering ord,
                     Discriminator discriminator = Discriminator::kInclusive);
 
+    /**
+     * Like resetToKey() with a RecordId, but specialized at compile time for an index whose
+     * components are expected to hold the given BSON types, one per component in key-pattern
+     * order. A component whose value matches the expected type dispatches straight to the typed
+     * append, skipping the generic per-element type switch; a mismatched value falls back to
+     * appendBSONElement(), so the resulting encoding is identical to resetToKey() for every
+     * input. Intended to be instantiated per common index shape (e.g. {a: 1} over int64 or
+     * string values, or a two-component compound) and selected once from the index's key
+     * pattern, rather than re-dispatching on value types for every key.
+     */
+    template <BSONType... kExpectedTypes>
+    void resetToKeyForShape(const BSONObj& obj, Ordering ord, const RecordId& recordId) {
+        dassert(obj.nFields() == sizeof...(kExpectedTypes));
+        resetToEmpty(ord);
+        _transition(BuildState::kAppendingBSONElements);
+        BSONObjIterator it(obj);
+        (_appendElementExpecting<kExpectedTypes>(it.next()), ...);
+        appendDiscriminator(Discriminator::kInclusive);
+        appendRecordId(recordId);
+    }
+
     void resetFromBuffer(const void* buffer, size_t size) {
         _buffer().reset();
         memcpy(_buffer().skip(size), buffer, size);
@@ -936,6 +957,35 @@ protected:
         return _ordering.get(_elemCount) == -1;
     }
 
+    /**
+     * Appends one element of a shape-specialized key. See resetToKeyForShape().
+     */
+    template <BSONType kExpected>
+    void _appendElementExpecting(const BSONElement& elem) {
+        MONGO_STATIC_ASSERT_MSG(kExpected == NumberInt || kExpected == NumberLong ||
+                                    kExpected == NumberDouble || kExpected == String ||
+                                    kExpected == Date || kExpected == jstOID,
+                                "unsupported component type for a shape-specialized KeyString "
+                                "encoder");
+        if (MONGO_likely(elem.type() == kExpected)) {
+            if constexpr (kExpected == NumberInt) {
+                appendNumberInt(elem._numberInt());
+            } else if constexpr (kExpected == NumberLong) {
+                appendNumberLong(elem._numberLong());
+            } else if constexpr (kExpected == NumberDouble) {
+                appendNumberDouble(elem._numberDouble());
+            } else if constexpr (kExpected == String) {
+                appendString(elem.valueStringData());
+            } else if constexpr (kExpected == Date) {
+                appendDate(elem.date());
+            } else if constexpr (kExpected == jstOID) {
+                appendOID(elem.__oid());
+            }
+        } else {
+            appendBSONElement(elem);
+        }
+    }
+
     // Appends the TypeBits buffer to the main buffer and returns the offset of where the TypeBits
     // begin
     int32_t _appendTypeBits() {
@@ -1161,6 +1211,20 @@ Discriminator decodeDiscriminator(const char* buffer,
                                   Ordering ord,
                                   const TypeBits& typeBits);
 
+/**
+ * Decodes only the key components selected by 'includeComponent', appending each selected
+ * component to 'builder' with an empty field name, as toBsonSafe() does. Components that are not
+ * selected are skipped over without being materialized where the encoding allows it, and decoding
+ * stops entirely once the last selected component has been appended. Callers that need a single
+ * field of a wide compound key therefore avoid paying for a full-key decode.
+ */
+void toBsonComponentsSafe(const char* buffer,
+                          size_t len,
+                          Ordering ord,
+                          const TypeBits& typeBits,
+                          const std::vector<bool>& includeComponent,
+                          BSONObjBuilder& builder);
+
 template <class T>
 BSONObj toBson(const T& keyString, Ordering ord) noexcept {
     return toBson(keyString.getBuffer(), keyString.getSize(), ord, keyString.getTypeBits());
@@ -75,6 +75,8 @@ enum BsonValueType {
     STRING,
     ARRAY,
     DECIMAL,
+    LONG,
+    LONG_STRING,
 };
 
 BSONObj generateBson(BsonValueType bsonValueType) {
@@ -102,6 +104,11 @@ BSONObj generateBson(BsonValueType bsonValueType) {
                                          Decimal128::kRoundTo34Digits,
                                          Decimal128::kRoundTiesToAway)
                                   .quantize(Decimal128("0.01", Decimal128::kRoundTiesToAway)));
+        case LONG:
+            return BSON("" << static_cast<long long>(expReal(gen)));
+        case LONG_STRING:
+            return BSON("" << static_cast<long long>(expReal(gen)) << ""
+                           << std::string(expDist(gen) * kStrLenMultiplier, 'x'));
     }
     MONGO_UNREACHABLE;
 }
@@ -143,6 +150,55 @@ void BM_BSONToKeyString(benchmark::State& state,
     state.SetItemsProcessed(state.iterations() * kSampleSize);
 }
 
+const RecordId kShapeRecordId(12345);
+
+/**
+ * Baseline for the shape-specialized encoder benchmarks: encodes the same keys through the
+ * generic, per-element type dispatch.
+ */
+void BM_BSONToKeyStringShapeGeneric(benchmark::State& state, BsonValueType bsonType) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings =
+        generateBsonsAndKeyStrings(bsonType, key_string::Version::V1);
+    key_string::Builder ks(key_string::Version::V1);
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (const auto& bson : bsonsAndKeyStrings.bsons) {
+            ks.resetToKey(bson, ALL_ASCENDING, kShapeRecordId);
+            benchmark::DoNotOptimize(ks.getSize());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bsonsAndKeyStrings.bsonSize);
+    state.SetItemsProcessed(state.iterations() * kSampleSize);
+}
+
+template <BSONType... kExpectedTypes>
+void runShapeSpecializedBM(benchmark::State& state, BsonValueType bsonType) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings =
+        generateBsonsAndKeyStrings(bsonType, key_string::Version::V1);
+    key_string::Builder ks(key_string::Version::V1);
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (const auto& bson : bsonsAndKeyStrings.bsons) {
+            ks.resetToKeyForShape<kExpectedTypes...>(bson, ALL_ASCENDING, kShapeRecordId);
+            benchmark::DoNotOptimize(ks.getSize());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bsonsAndKeyStrings.bsonSize);
+    state.SetItemsProcessed(state.iterations() * kSampleSize);
+}
+
+void BM_BSONToKeyStringShapeSpecializedLong(benchmark::State& state) {
+    runShapeSpecializedBM<NumberLong>(state, LONG);
+}
+
+void BM_BSONToKeyStringShapeSpecializedString(benchmark::State& state) {
+    runShapeSpecializedBM<String>(state, STRING);
+}
+
+void BM_BSONToKeyStringShapeSpecializedLongString(benchmark::State& state) {
+    runShapeSpecializedBM<NumberLong, String>(state, LONG_STRING);
+}
+
 void BM_KeyStringToBSON(benchmark::State& state,
                         const key_string::Version version,
                         BsonValueType bsonType) {
@@ -265,6 +321,13 @@ BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_String, key_string::Version::V1, STRING
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V0_Array, key_string::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_Array, key_string::Version::V1, ARRAY);
 
+BENCHMARK_CAPTURE(BM_BSONToKeyStringShapeGeneric, Long, LONG);
+BENCHMARK_CAPTURE(BM_BSONToKeyStringShapeGeneric, String, STRING);
+BENCHMARK_CAPTURE(BM_BSONToKeyStringShapeGeneric, LongString, LONG_STRING);
+BENCHMARK(BM_BSONToKeyStringShapeSpecializedLong);
+BENCHMARK(BM_BSONToKeyStringShapeSpecializedString);
+BENCHMARK(BM_BSONToKeyStringShapeSpecializedLongString);
+
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Int, key_string::Version::V0, INT);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Int, key_string::Version::V1, INT);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Double, key_string::Version::V0, DOUBLE);
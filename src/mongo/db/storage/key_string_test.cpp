@@ -266,6 +266,48 @@ TEST(TypeBitsTest, AppendLotsOfZeroTypeBits) {
     ASSERT(!typeBits.isLongEncoding());
 }
 
+TEST_F(KeyStringBuilderTest, ShapeSpecializedEncodingMatchesGeneric) {
+    const RecordId rid(42);
+    const auto expectEqualToGeneric = [&](const BSONObj& obj, auto&& resetForShape) {
+        key_string::Builder generic(version);
+        generic.resetToKey(obj, ALL_ASCENDING, rid);
+
+        key_string::Builder specialized(version);
+        resetForShape(specialized, obj);
+
+        ASSERT_EQ(StringData(generic.getBuffer(), generic.getSize()),
+                  StringData(specialized.getBuffer(), specialized.getSize()));
+        ASSERT_EQ(
+            StringData(generic.getTypeBits().getBuffer(), generic.getTypeBits().getSize()),
+            StringData(specialized.getTypeBits().getBuffer(), specialized.getTypeBits().getSize()));
+    };
+
+    // Values matching the expected shape take the specialized path.
+    expectEqualToGeneric(BSON("" << 12345LL), [&](key_string::Builder& b, const BSONObj& obj) {
+        b.resetToKeyForShape<NumberLong>(obj, ALL_ASCENDING, rid);
+    });
+    expectEqualToGeneric(BSON(""
+                              << "hello world"),
+                         [&](key_string::Builder& b, const BSONObj& obj) {
+                             b.resetToKeyForShape<String>(obj, ALL_ASCENDING, rid);
+                         });
+    expectEqualToGeneric(BSON("" << 99LL << ""
+                                 << "abc"),
+                         [&](key_string::Builder& b, const BSONObj& obj) {
+                             b.resetToKeyForShape<NumberLong, String>(obj, ALL_ASCENDING, rid);
+                         });
+
+    // Values not matching the expected shape fall back to the generic path and must produce the
+    // same encoding.
+    expectEqualToGeneric(BSON("" << 2.5), [&](key_string::Builder& b, const BSONObj& obj) {
+        b.resetToKeyForShape<NumberLong>(obj, ALL_ASCENDING, rid);
+    });
+    expectEqualToGeneric(BSON("" << BSONNULL << "" << 7),
+                         [&](key_string::Builder& b, const BSONObj& obj) {
+                             b.resetToKeyForShape<NumberLong, String>(obj, ALL_ASCENDING, rid);
+                         });
+}
+
 TEST_F(KeyStringBuilderTest, TooManyElementsInCompoundKey) {
     // Construct a KeyString with more than the limit of 32 elements in a compound index key. Encode
     // 33 kBoolTrue ('o') values.
@@ -338,6 +380,33 @@ TEST_F(KeyStringBuilderTest, ExceededBSONDepth) {
         ErrorCodes::Overflow);
 }
 
+TEST_F(KeyStringBuilderTest, ToBsonComponentsSafe) {
+    const BSONObj obj = BSON(""
+                             << "abc"
+                             << "" << 5 << "" << Date_t::fromMillisSinceEpoch(123) << "" << 2.5);
+    const key_string::Builder ks(version, obj, ALL_ASCENDING);
+
+    // Selecting a subset of components decodes only those, skipping the rest.
+    BSONObjBuilder bob;
+    key_string::toBsonComponentsSafe(ks.getBuffer(),
+                                     ks.getSize(),
+                                     ALL_ASCENDING,
+                                     ks.getTypeBits(),
+                                     {false, true, false, true},
+                                     bob);
+    ASSERT_BSONOBJ_EQ(bob.obj(), BSON("" << 5 << "" << 2.5));
+
+    // Selecting no components produces an empty object.
+    BSONObjBuilder emptyBob;
+    key_string::toBsonComponentsSafe(ks.getBuffer(),
+                                     ks.getSize(),
+                                     ALL_ASCENDING,
+                                     ks.getTypeBits(),
+                                     {false, false, false, false},
+                                     emptyBob);
+    ASSERT_BSONOBJ_EQ(emptyBob.obj(), BSONObj());
+}
+
 TEST_F(KeyStringBuilderTest, Simple1) {
     BSONObj a = BSON("" << 5);
     BSONObj b = BSON("" << 6);
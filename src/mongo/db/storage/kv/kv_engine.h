@@ -283,6 +283,13 @@ public:
 
     virtual void checkpoint() {}
 
+    /**
+     * See StorageEngine::getCacheDirtyFillRatio().
+     */
+    virtual double getCacheDirtyFillRatio() const {
+        return 0;
+    }
+
     virtual StorageEngine::CheckpointIteration getCheckpointIteration() const {
         return StorageEngine::CheckpointIteration{0};
     }
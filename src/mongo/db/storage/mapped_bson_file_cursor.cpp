@@ -0,0 +1,227 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/storage/mapped_bson_file_cursor.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "mongo/base/data_type_endian.h"
+#include "mongo/base/data_view.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/db/storage/io_error_message.h"
+#include "mongo/db/storage/record_data.h"
+#include "mongo/platform/compiler.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+using namespace fmt::literals;
+
+namespace {
+/**
+ * Strips the file protocol part off 'url', yielding a file path, as getInputStream() does for
+ * named pipe urls.
+ */
+std::string filePathFromUrl(const std::string& url) {
+    auto filePathPos = url.find(ExternalDataSourceMetadata::kUrlProtocolFile.toString());
+    tassert(
+        ErrorCodes::BadValue, "Invalid file url: {}"_format(url), filePathPos != std::string::npos);
+
+    return url.substr(filePathPos + ExternalDataSourceMetadata::kUrlProtocolFile.size());
+}
+}  // namespace
+
+MappedBsonFileCursor::MappedBsonFileCursor(const VirtualCollectionOptions& vopts)
+    : _numFiles(vopts.dataSources.size()), _vopts(vopts) {
+    tassert(9512805, "_numFiles {} <= 0"_format(_numFiles), _numFiles > 0);
+    _mapCurrentFile();
+}
+
+MappedBsonFileCursor::~MappedBsonFileCursor() {
+    _unmapCurrentFile();
+}
+
+/**
+ * Maps the file at index '_fileIdx' read-only. An empty file produces no mapping, which the scan
+ * treats the same as an exhausted one.
+ */
+void MappedBsonFileCursor::_mapCurrentFile() {
+    auto filePathStr = filePathFromUrl(_vopts.dataSources[_fileIdx].url);
+    _offset = 0;
+#ifndef _WIN32
+    int fd = ::open(filePathStr.c_str(), O_RDONLY);
+    uassert(9512806,
+            "Failed to open file, error: {}"_format(getErrorMessage("open", filePathStr)),
+            fd >= 0);
+    ScopeGuard closeFd([&] { ::close(fd); });
+
+    struct stat fileStat;
+    uassert(9512807,
+            "Failed to stat file, error: {}"_format(getErrorMessage("stat", filePathStr)),
+            ::fstat(fd, &fileStat) == 0);
+    if (fileStat.st_size == 0) {
+        return;
+    }
+
+    void* addr =
+        ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    uassert(9512808,
+            "Failed to map file, error: {}"_format(getErrorMessage("mmap", filePathStr)),
+            addr != MAP_FAILED);
+    _mapBase = static_cast<const char*>(addr);
+    _mapLength = static_cast<size_t>(fileStat.st_size);
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+    // The scan reads the file front to back exactly once; telling the kernel so enables more
+    // aggressive readahead. Advisory only, so the return value is ignored.
+    (void)::posix_madvise(const_cast<char*>(_mapBase), _mapLength, POSIX_MADV_SEQUENTIAL);
+#endif
+#else
+    HANDLE fileHandle = CreateFileA(filePathStr.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                    nullptr);
+    uassert(9512809,
+            "Failed to open file, error: {}"_format(getErrorMessage("CreateFile", filePathStr)),
+            fileHandle != INVALID_HANDLE_VALUE);
+    ScopeGuard closeFile([&] { CloseHandle(fileHandle); });
+
+    LARGE_INTEGER fileSize;
+    uassert(9512810,
+            "Failed to get file size, error: {}"_format(
+                getErrorMessage("GetFileSizeEx", filePathStr)),
+            GetFileSizeEx(fileHandle, &fileSize));
+    if (fileSize.QuadPart == 0) {
+        return;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    uassert(9512811,
+            "Failed to map file, error: {}"_format(
+                getErrorMessage("CreateFileMapping", filePathStr)),
+            mappingHandle != nullptr);
+    void* addr = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!addr) {
+        CloseHandle(mappingHandle);
+        uasserted(9512812,
+                  "Failed to map file, error: {}"_format(
+                      getErrorMessage("MapViewOfFile", filePathStr)));
+    }
+    _mapBase = static_cast<const char*>(addr);
+    _mapLength = static_cast<size_t>(fileSize.QuadPart);
+    _fileHandle = fileHandle;
+    _mappingHandle = mappingHandle;
+    closeFile.dismiss();
+#endif
+}
+
+void MappedBsonFileCursor::_unmapCurrentFile() {
+    if (_mapBase) {
+#ifndef _WIN32
+        ::munmap(const_cast<char*>(_mapBase), _mapLength);
+#else
+        UnmapViewOfFile(_mapBase);
+#endif
+        _mapBase = nullptr;
+        _mapLength = 0;
+    }
+#ifdef _WIN32
+    if (_mappingHandle) {
+        CloseHandle(_mappingHandle);
+        _mappingHandle = nullptr;
+    }
+    if (_fileHandle) {
+        CloseHandle(_fileHandle);
+        _fileHandle = nullptr;
+    }
+#endif
+    _offset = 0;
+}
+
+/**
+ * Returns the next record from the current mapping or boost::none if it is exhausted. Asserts if
+ * the file does not consist of wholly contained, validly sized BSON objects.
+ */
+boost::optional<Record> MappedBsonFileCursor::_nextFromCurrentFile() {
+    if (_offset >= _mapLength) {
+        return boost::none;
+    }
+
+    uassert(9512813,
+            "Truncated file: {}"_format(_vopts.dataSources[_fileIdx].url),
+            _mapLength - _offset >= kSizeSize);
+    int32_t bsonSize = ConstDataView(_mapBase + _offset).read<LittleEndian<int32_t>>();
+    uassert(9512814,
+            "Malformed BSON size {} in file: {}"_format(bsonSize, _vopts.dataSources[_fileIdx].url),
+            bsonSize > static_cast<int32_t>(kSizeSize) && bsonSize <= BSONObjMaxUserSize);
+    uassert(9512815,
+            "Truncated file: {}"_format(_vopts.dataSources[_fileIdx].url),
+            static_cast<size_t>(bsonSize) <= _mapLength - _offset);
+
+    // 'recordData.data' includes the size in the first four bytes and points directly into the
+    // mapping; nothing is copied.
+    RecordData recordData{(_mapBase + _offset), bsonSize};
+    _offset += bsonSize;
+
+    return {{RecordId{_nextRecordId++}, std::move(recordData)}};
+}
+
+/**
+ * Returns the next record from the vector of files or boost::none if exhausted. The first file,
+ * if there is one, is mapped in the constructor.
+ */
+boost::optional<Record> MappedBsonFileCursor::next() {
+    while (_fileIdx < _numFiles) {
+        auto record = _nextFromCurrentFile();
+        if (MONGO_likely(record)) {
+            return record;
+        }
+        _unmapCurrentFile();
+        ++_fileIdx;
+        if (_fileIdx < _numFiles) {
+            _mapCurrentFile();
+        }
+    }
+    return boost::none;
+}
+}  // namespace mongo
@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/db/catalog/virtual_collection_options.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+/**
+ * Read-only cursor over external data sources of storage type 'file'. Each regular file of
+ * concatenated BSON objects is mapped into memory read-only and records are returned as views
+ * directly into the mapping, so a scan copies no record data and the data never enters the
+ * storage engine cache: the kernel page cache holds the (shared, read-only) pages and reclaims
+ * them under memory pressure. This makes 'file' data sources suitable for large immutable
+ * reference datasets that would otherwise compete with operational data for cache space.
+ *
+ * As with MultiBsonStreamCursor, record data is only valid until the next call to next(), since
+ * advancing past the end of a file unmaps it. Callers that need to hold onto a record must copy
+ * it.
+ */
+class MappedBsonFileCursor : public SeekableRecordCursor {
+public:
+    MappedBsonFileCursor(const VirtualCollectionOptions& vopts);
+    ~MappedBsonFileCursor() override;
+
+    boost::optional<Record> next() override;
+
+    // This block of overrides are all essentially no-ops as they are for lock yielding but the
+    // external data source is read-only.
+    void save() override {}
+    void saveUnpositioned() override {}
+    bool restore(bool tolerateCappedRepositioning) override {
+        return true;
+    }
+    void detachFromOperationContext() override {}
+    void reattachToOperationContext(OperationContext* opCtx) override {}
+    void setSaveStorageCursorOnDetachFromOperationContext(bool) override {}
+
+    // Seeking is not currently supported.
+    boost::optional<Record> seekExact(const RecordId& id) override {
+        tasserted(9512803, "MappedBsonFileCursor::seekExact is not supported");
+        return boost::none;
+    }
+
+    // Seeking is not currently supported.
+    boost::optional<Record> seek(const RecordId& start, BoundInclusion boundInclusion) override {
+        tasserted(9512804, "MappedBsonFileCursor::seek is not supported");
+        return {};
+    }
+
+private:
+    void _mapCurrentFile();
+    void _unmapCurrentFile();
+    boost::optional<Record> _nextFromCurrentFile();
+
+    // The size in bytes of a BSON object's "size" prefix.
+    static constexpr size_t kSizeSize = sizeof(int32_t);
+
+    int64_t _nextRecordId = 0;  // for artificially generating the record IDs
+    int _numFiles;              // number of data sources in '_vopts'
+    int _fileIdx = 0;           // index in '_vopts' of the file currently mapped
+
+    const char* _mapBase = nullptr;  // base address of the current mapping, if any
+    size_t _mapLength = 0;           // length in bytes of the current mapping
+    size_t _offset = 0;              // offset in the current mapping of the next record
+
+#ifdef _WIN32
+    void* _fileHandle = nullptr;     // HANDLE from CreateFile
+    void* _mappingHandle = nullptr;  // HANDLE from CreateFileMapping
+#endif
+
+    const VirtualCollectionOptions& _vopts;  // metadata containing the file URLs
+};
+}  // namespace mongo
@@ -27,14 +27,18 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <mutex>
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 
 #include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/util/clock_source.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -146,34 +150,87 @@ void RecordStore::waitForAllEarlierOplogWritesToBeVisible(OperationContext* opCt
 }
 
 void CappedInsertNotifier::notifyAll() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    ++_version;
-    _notifier.notify_all();
+    // The version must be advanced before the cohort is signalled: a waiter that misses the signal
+    // because it was about to go to sleep holds its cohort's mutex until it blocks, so it either
+    // observes the new version in its predicate or blocks before this thread can acquire the mutex
+    // and is woken by the notify below.
+    _version.fetchAndAdd(1);
+
+    // With few waiters, wake every occupied cohort: the cost is bounded by the waiter count, and
+    // a lone waiter (e.g. a single oplog tail) never waits out a backoff slice for a notification
+    // that went to another cohort.
+    if (_totalWaiters.load() <= kBroadcastWaiterThreshold) {
+        for (auto& cohort : _cohorts) {
+            if (cohort.waiters.load() > 0) {
+                stdx::lock_guard<Latch> lk(cohort.mutex);
+                cohort.notifier.notify_all();
+            }
+        }
+        return;
+    }
+
+    // Otherwise wake a single occupied cohort per insert so the wakeup cost does not grow with
+    // the total number of waiters. The remaining cohorts observe the version change within one
+    // backoff slice.
+    const auto start = _nextNotifyCohort.fetchAndAdd(1);
+    for (size_t i = 0; i < kNumCohorts; ++i) {
+        auto& cohort = _cohorts[(start + i) % kNumCohorts];
+        if (cohort.waiters.load() > 0) {
+            stdx::lock_guard<Latch> lk(cohort.mutex);
+            cohort.notifier.notify_all();
+            return;
+        }
+    }
 }
 
 uint64_t CappedInsertNotifier::getVersion() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _version;
+    return _version.load();
 }
 
 void CappedInsertNotifier::waitUntil(OperationContext* opCtx,
                                      uint64_t prevVersion,
                                      Date_t deadline) const {
-    stdx::unique_lock<Latch> lk(_mutex);
-    opCtx->waitForConditionOrInterruptUntil(_notifier, lk, deadline, [this, prevVersion]() {
-        return _dead || prevVersion != _version;
+    auto pred = [&] {
+        return _dead.load() || prevVersion != _version.load();
+    };
+
+    auto& cohort = _cohorts[_nextWaitCohort.fetchAndAdd(1) % kNumCohorts];
+    auto backoff = kMinWaiterBackoff;
+
+    // Register as a waiter before the first predicate check. An insert either observes this
+    // cohort as occupied and signals it, or this thread observes the advanced version in its
+    // predicate; the sequentially consistent counter and version accesses rule out missing both.
+    cohort.waiters.fetchAndAdd(1);
+    _totalWaiters.fetchAndAdd(1);
+    ScopeGuard deregisterWaiter([&] {
+        cohort.waiters.fetchAndSubtract(1);
+        _totalWaiters.fetchAndSubtract(1);
     });
+
+    stdx::unique_lock<Latch> lk(cohort.mutex);
+    while (!pred()) {
+        auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+        if (now >= deadline) {
+            return;
+        }
+        // Under heavy waiter counts inserts signal only one cohort each, so wait in bounded
+        // slices and recheck the version in case this cohort was not signalled.
+        opCtx->waitForConditionOrInterruptUntil(
+            cohort.notifier, lk, std::min(deadline, now + backoff), pred);
+        backoff = std::min(backoff * 2, kMaxWaiterBackoff);
+    }
 }
 
 void CappedInsertNotifier::kill() {
-    stdx::lock_guard<Latch> lk(_mutex);
-    _dead = true;
-    _notifier.notify_all();
+    _dead.store(true);
+    for (auto& cohort : _cohorts) {
+        stdx::lock_guard<Latch> lk(cohort.mutex);
+        cohort.notifier.notify_all();
+    }
 }
 
 bool CappedInsertNotifier::isDead() {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _dead;
+    return _dead.load();
 }
 
 }  // namespace mongo
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional.hpp>
 #include <boost/optional/optional.hpp>
@@ -55,6 +56,7 @@
 #include "mongo/db/storage/ident.h"
 #include "mongo/db/storage/key_format.h"
 #include "mongo/db/storage/record_data.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
@@ -251,17 +253,29 @@ public:
 /**
  * Queries with the awaitData option use this notifier object to wait for more data to be
  * inserted into the capped collection.
+ *
+ * Waiters are spread over a fixed number of cohorts, each with its own mutex and condition
+ * variable. While the total number of waiters is small each insert wakes every occupied cohort, so
+ * a lone waiter (e.g. a single oplog tail) is always woken immediately. Once there are more
+ * waiters than the broadcast threshold each insert signals a single occupied cohort in round-robin
+ * order instead. This keeps the per-insert wakeup cost bounded when many tailable cursors wait on
+ * the same collection, at the cost of cohorts that were not signalled observing new data with a
+ * small, bounded delay: waiters sleep in backoff-sized slices and recheck the version counter on
+ * each slice.
  */
 class CappedInsertNotifier {
 public:
     /**
-     * Wakes up all threads waiting.
+     * Advances the version and wakes up waiting threads. Wakes every occupied cohort while the
+     * total number of waiters is at most the broadcast threshold; otherwise wakes the next
+     * occupied cohort in round-robin order. Killing the notifier wakes every cohort.
      */
     void notifyAll() const;
 
     /**
-     * Waits until 'deadline', or until notifyAll() is called to indicate that new
-     * data is available in the capped collection.
+     * Waits until 'deadline', or until the version has advanced past 'prevVersion' to indicate
+     * that new data is available in the capped collection. May return up to a backoff slice after
+     * the version advanced if this waiter's cohort was not the one signalled.
      *
      * NOTE: Waiting threads can be signaled by calling kill or notify* methods.
      */
@@ -283,20 +297,49 @@ public:
     bool isDead();
 
 private:
-    // Signalled when a successful insert is made into a capped collection.
-    mutable stdx::condition_variable _notifier;
+    // The number of cohorts that waiters are spread over.
+    static constexpr size_t kNumCohorts = 16;
+
+    // While the total number of waiters is at most this, each insert wakes every occupied cohort
+    // rather than a single one: the broadcast cost is trivially bounded by the waiter count, and
+    // it keeps the single-waiter case from ever paying a backoff slice of wakeup latency.
+    static constexpr int64_t kBroadcastWaiterThreshold = kNumCohorts;
+
+    // Bounds for the waiter-side backoff slice. An unsignalled cohort notices new data within one
+    // slice, so the maximum slice bounds the extra latency introduced by round-robin wakeups.
+    static constexpr Milliseconds kMinWaiterBackoff{8};
+    static constexpr Milliseconds kMaxWaiterBackoff{128};
+
+    struct Cohort {
+        // Signalled when a successful insert is made into the capped collection, or when the
+        // notifier is killed.
+        stdx::condition_variable notifier;
+
+        // Mutex used with 'notifier'.
+        mutable Mutex mutex = MONGO_MAKE_LATCH("CappedInsertNotifier::Cohort::mutex");
+
+        // The number of threads currently waiting in this cohort. Inserts skip cohorts with no
+        // waiters.
+        AtomicWord<int64_t> waiters{0};
+    };
 
-    // Mutex used with '_notifier'. Protects access to '_version'.
-    mutable Mutex _mutex = MONGO_MAKE_LATCH("CappedInsertNotifier::_mutex");
+    mutable std::array<Cohort, kNumCohorts> _cohorts;
 
-    // A counter, incremented on insertion of new data into the capped collection.
-    //
-    // The condition which '_cappedNewDataNotifier' is being notified of is an increment of this
-    // counter. Access to this counter is synchronized with '_mutex'.
-    mutable uint64_t _version = 0;
+    // The total number of threads currently waiting across all cohorts. Used to decide between
+    // broadcasting to every occupied cohort and signalling a single one.
+    mutable AtomicWord<int64_t> _totalWaiters{0};
+
+    // Round-robin cursors for assigning waiters to cohorts and picking the cohort each insert
+    // signals.
+    mutable AtomicWord<uint64_t> _nextWaitCohort{0};
+    mutable AtomicWord<uint64_t> _nextNotifyCohort{0};
+
+    // A counter, incremented on insertion of new data into the capped collection. The condition
+    // which waiters are being notified of is an increment of this counter.
+    mutable AtomicWord<uint64_t> _version{0};
 
     // True once the notifier is dead.
-    bool _dead = false;
+    AtomicWord<bool> _dead{false};
 };
 
 /**
@@ -325,6 +325,9 @@ public:
         bool disableIncrementalBackup = false;
         bool incrementalBackup = false;
         int blockSizeMB = 16;
+        // When set, incremental backup blocks are annotated with a content hash so that backup
+        // consumers can skip copying blocks whose contents are unchanged since the source backup.
+        bool computeBlockChecksums = false;
         boost::optional<std::string> thisBackupName;
         boost::optional<std::string> srcBackupName;
     };
@@ -502,6 +505,14 @@ public:
      */
     virtual void checkpoint() = 0;
 
+    /**
+     * Returns the fraction of the storage engine's cache currently occupied by dirty data, in
+     * the range [0, 1]. Engines that do not track dirty data return 0. The checkpoint thread
+     * polls this to start a checkpoint ahead of the periodic cadence when dirty data is
+     * accumulating quickly.
+     */
+    virtual double getCacheDirtyFillRatio() const = 0;
+
     /**
      * Returns the checkpoint iteration the committed write will be part of.
      *
@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <boost/container/vector.hpp>
 #include <boost/move/utility_core.hpp>
+#include <exception>
 #include <map>
 #include <mutex>
 
@@ -81,12 +82,15 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/logv2/log_severity.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -108,6 +112,11 @@ namespace {
 const std::string kCatalogInfo = DatabaseName::kMdbCatalog.db(omitTenant).toString();
 const NamespaceString kCatalogInfoNamespace = NamespaceString(DatabaseName::kMdbCatalog);
 const auto kCatalogLogLevel = logv2::LogSeverity::Debug(2);
+
+// Each startup collection-loading worker should have enough catalog entries to justify its
+// thread; below one worker's worth the entries are loaded serially on the startup thread.
+constexpr size_t kMinCollectionsPerLoadWorker = 1000;
+constexpr size_t kMaxCollectionLoadWorkers = 16;
 }  // namespace
 
 StorageEngineImpl::StorageEngineImpl(OperationContext* opCtx,
@@ -322,6 +331,15 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
         // Let the CollectionCatalog know that we are maintaining timestamps from minValidTs
         catalog.catalogIdTracker().rollback(minValidTs);
     });
+    // First pass: reconcile each catalog entry serially. These branches mutate the durable
+    // catalog, so they cannot run concurrently. Entries that survive are queued for hydration.
+    struct CollectionToLoad {
+        RecordId catalogId;
+        NamespaceString nss;
+        Timestamp minValidTs;
+    };
+    std::vector<CollectionToLoad> collectionsToLoad;
+    collectionsToLoad.reserve(catalogEntries.size());
     for (DurableCatalog::EntryIdentifier entry : catalogEntries) {
         if (_options.forRestore) {
             // When restoring a subset of user collections from a backup, the collections not
@@ -434,22 +452,93 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             }
         }
 
-        _initCollection(
-            opCtx, entry.catalogId, entry.nss, _options.forRepair, collectionMinValidTs);
-
         if (entry.nss.isOrphanCollection()) {
             LOGV2(22248, "Orphaned collection found", logAttrs(entry.nss));
         }
+
+        collectionsToLoad.push_back({entry.catalogId, entry.nss, collectionMinValidTs});
     }
 
+    // Second pass: hydrate a Collection object for each surviving entry. This is where startup
+    // spends its time on catalogs with many collections (each entry's metadata is parsed and its
+    // table handle opened), and the entries are independent of each other, so spread the work
+    // across a thread pool once there are enough entries to pay for the thread setup. Hydration
+    // only reads from the durable catalog.
+    std::vector<std::shared_ptr<Collection>> collections(collectionsToLoad.size());
+    const size_t numWorkers =
+        std::min({collectionsToLoad.size() / kMinCollectionsPerLoadWorker,
+                  static_cast<size_t>(ProcessInfo::getNumAvailableCores()),
+                  kMaxCollectionLoadWorkers});
+    if (numWorkers < 2) {
+        for (size_t i = 0; i < collectionsToLoad.size(); i++) {
+            collections[i] = _loadCollection(opCtx,
+                                             collectionsToLoad[i].catalogId,
+                                             collectionsToLoad[i].nss,
+                                             _options.forRepair);
+        }
+    } else {
+        LOGV2(9106701,
+              "Loading the collection catalog with multiple workers",
+              "numCollections"_attr = collectionsToLoad.size(),
+              "numWorkers"_attr = numWorkers);
+
+        ThreadPool::Options threadPoolOptions;
+        threadPoolOptions.poolName = "StorageEngineLoadCatalog";
+        threadPoolOptions.maxThreads = numWorkers;
+        threadPoolOptions.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName,
+                               getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+        };
+        ThreadPool pool(threadPoolOptions);
+        pool.startup();
+
+        AtomicWord<size_t> nextEntry{0};
+        std::vector<std::exception_ptr> workerExceptions(numWorkers);
+        for (size_t workerId = 0; workerId < numWorkers; workerId++) {
+            pool.schedule([&, workerId](Status status) {
+                invariant(status);
+                try {
+                    auto workerOpCtx = cc().makeOperationContext();
+                    for (auto i = nextEntry.fetchAndAdd(1); i < collectionsToLoad.size();
+                         i = nextEntry.fetchAndAdd(1)) {
+                        collections[i] = _loadCollection(workerOpCtx.get(),
+                                                         collectionsToLoad[i].catalogId,
+                                                         collectionsToLoad[i].nss,
+                                                         _options.forRepair);
+                    }
+                } catch (...) {
+                    workerExceptions[workerId] = std::current_exception();
+                    // Stop the other workers from claiming further entries.
+                    nextEntry.store(collectionsToLoad.size());
+                }
+            });
+        }
+        pool.shutdown();
+        pool.join();
+
+        for (const auto& workerException : workerExceptions) {
+            if (workerException) {
+                std::rethrow_exception(workerException);
+            }
+        }
+    }
+
+    // Final pass: register all collections with a single catalog write job instead of publishing
+    // a new catalog version once per collection, which would copy the catalog maps every time.
+    CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
+        for (size_t i = 0; i < collectionsToLoad.size(); i++) {
+            catalog.registerCollection(
+                opCtx, std::move(collections[i]), /*commitTime*/ collectionsToLoad[i].minValidTs);
+        }
+    });
+
     shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
 }
 
-void StorageEngineImpl::_initCollection(OperationContext* opCtx,
-                                        RecordId catalogId,
-                                        const NamespaceString& nss,
-                                        bool forRepair,
-                                        Timestamp minValidTs) {
+std::shared_ptr<Collection> StorageEngineImpl::_loadCollection(OperationContext* opCtx,
+                                                               RecordId catalogId,
+                                                               const NamespaceString& nss,
+                                                               bool forRepair) {
     const auto catalogEntry = _catalog->getParsedCatalogEntry(opCtx, catalogId);
     const auto md = catalogEntry->metadata;
     uassert(ErrorCodes::MustDowngrade,
@@ -470,11 +559,7 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
     }
 
     auto collectionFactory = Collection::Factory::get(getGlobalServiceContext());
-    auto collection = collectionFactory->make(opCtx, nss, catalogId, md, std::move(rs));
-
-    CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
-        catalog.registerCollection(opCtx, std::move(collection), /*commitTime*/ minValidTs);
-    });
+    return collectionFactory->make(opCtx, nss, catalogId, md, std::move(rs));
 }
 
 void StorageEngineImpl::closeCatalog(OperationContext* opCtx) {
@@ -559,7 +644,12 @@ bool StorageEngineImpl::_handleInternalIdent(OperationContext* opCtx,
     allInternalIdents->insert(ident);
 
     // When starting up after an unclean shutdown, we do not attempt to recover any state from the
-    // internal idents. Thus, we drop them in this case.
+    // internal idents. Thus, we drop them in this case. In particular, resumable index build
+    // state cannot be trusted after a crash: these tables roll back to the last checkpoint while
+    // the sorter's spilled runs live in external files that do not, and oplog replay during
+    // recovery re-applies writes without the build's side-writes interceptor, so a persisted scan
+    // position would no longer agree with the side-writes table contents. Making index builds
+    // resumable across crashes would require persisting state in coordination with checkpoints.
     if (lastShutdownState == LastShutdownState::kUnclean) {
         internalIdentsToDrop->insert(ident);
         return true;
@@ -1245,6 +1335,10 @@ void StorageEngineImpl::checkpoint() {
     _engine->checkpoint();
 }
 
+double StorageEngineImpl::getCacheDirtyFillRatio() const {
+    return _engine->getCacheDirtyFillRatio();
+}
+
 StorageEngine::CheckpointIteration StorageEngineImpl::getCheckpointIteration() const {
     return _engine->getCheckpointIteration();
 }
@@ -71,6 +71,7 @@
 
 namespace mongo {
 
+class Collection;
 class DurableCatalog;
 class KVEngine;
 
@@ -339,6 +340,8 @@ public:
 
     void checkpoint() override;
 
+    double getCacheDirtyFillRatio() const override;
+
     StorageEngine::CheckpointIteration getCheckpointIteration() const override;
 
     bool hasDataBeenCheckpointed(
@@ -403,11 +406,16 @@ public:
 private:
     using CollIter = std::list<std::string>::iterator;
 
-    void _initCollection(OperationContext* opCtx,
-                         RecordId catalogId,
-                         const NamespaceString& nss,
-                         bool forRepair,
-                         Timestamp minValidTs);
+    /**
+     * Hydrates a Collection object from its durable catalog entry. Only reads; the caller is
+     * responsible for registering the result with the CollectionCatalog. Safe to call from
+     * several threads at once for distinct catalog entries while the catalog is being loaded,
+     * provided each thread uses its own OperationContext.
+     */
+    std::shared_ptr<Collection> _loadCollection(OperationContext* opCtx,
+                                                RecordId catalogId,
+                                                const NamespaceString& nss,
+                                                bool forRepair);
 
     Status _dropCollections(OperationContext* opCtx,
                             const std::vector<UUID>& toDrop,
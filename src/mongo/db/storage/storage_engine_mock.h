@@ -177,6 +177,10 @@ public:
 
     void checkpoint() final {}
 
+    double getCacheDirtyFillRatio() const final {
+        return 0;
+    }
+
     StorageEngine::CheckpointIteration getCheckpointIteration() const final {
         return StorageEngine::CheckpointIteration{0};
     }
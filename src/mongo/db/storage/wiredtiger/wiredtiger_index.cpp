@@ -528,18 +528,13 @@ boost::optional<RecordId> WiredTigerIndex::_keyExists(OperationContext* opCtx,
                                                       WiredTigerSession* session,
                                                       const key_string::Value& keyString,
                                                       size_t sizeWithoutRecordId) {
-    // Given a KeyString KS with RecordId RID appended to the end, set the:
-    // 1. Lower bound (inclusive) to be KS without RID
-    // 2. Upper bound (inclusive) to be
-    //   a. KS with RecordId::maxLong() for KeyFormat::Long
-    //   b. KS with RecordId(FF00) for KeyFormat::String
-    //
-    // For example, KS = "key" and RID = "ABC123". The lower bound is "key" and the upper bound is
-    // "keyFF00".
+    // Given a KeyString KS with RecordId RID appended to the end, set the lower bound (inclusive)
+    // to KS without RID and position on the first key at or past it. Any entry for KS must sort
+    // directly after that bound, so a single prefix comparison on the positioned key decides
+    // existence; no upper bound needs to be built and applied.
     WiredTigerItem prefixKeyItem(keyString.getBuffer(), sizeWithoutRecordId);
     setKey(c, prefixKeyItem.Get());
     invariantWTOK(c->bound(c, lowerInclusiveBoundConfig.getConfig(session)), c->session);
-    _setUpperBoundForKeyExists(c, session, keyString, sizeWithoutRecordId);
     ON_BLOCK_EXIT([c, session] {
         invariantWTOK(c->bound(c, clearBoundConfig.getConfig(session)), c->session);
     });
@@ -556,6 +551,14 @@ boost::optional<RecordId> WiredTigerIndex::_keyExists(OperationContext* opCtx,
 
     WT_ITEM key;
     getKey(c, &key, &metricsCollector);
+    if (key.size < sizeWithoutRecordId ||
+        std::memcmp(key.data, keyString.getBuffer(), sizeWithoutRecordId) != 0) {
+        // The first key at or past the prefix does not start with the prefix, so no entry for
+        // this index key exists. Entries in this index are always the prefix with a RecordId
+        // appended (or, for old-format unique indexes, the bare prefix handled below), so sharing
+        // the prefix bytes is equivalent to the [prefix, prefix + max RecordId] range check.
+        return boost::none;
+    }
     if (key.size == sizeWithoutRecordId) {
         invariant(_rsKeyFormat == KeyFormat::Long);
 
@@ -571,19 +574,6 @@ boost::optional<RecordId> WiredTigerIndex::_keyExists(OperationContext* opCtx,
     return _decodeRecordIdAtEnd(key.data, key.size);
 }
 
-void WiredTigerIndex::_setUpperBoundForKeyExists(WT_CURSOR* c,
-                                                 WiredTigerSession* session,
-                                                 const key_string::Value& keyString,
-                                                 size_t sizeWithoutRecordId) {
-    key_string::Builder builder(keyString.getVersion(), _ordering);
-    builder.resetFromBuffer(keyString.getBuffer(), sizeWithoutRecordId);
-    builder.appendRecordId(record_id_helpers::maxRecordId(_rsKeyFormat));
-
-    WiredTigerItem upperBoundItem(builder.getBuffer(), builder.getSize());
-    setKey(c, upperBoundItem.Get());
-    invariantWTOK(c->bound(c, upperInclusiveBoundConfig.getConfig(session)), c->session);
-}
-
 StatusWith<bool> WiredTigerIndex::_checkDups(OperationContext* opCtx,
                                              WT_CURSOR* c,
                                              WiredTigerSession* session,
@@ -783,10 +773,13 @@ public:
         WiredTigerItem item(keyString.getBuffer(), keyString.getSize());
         setKey(_cursor.get(), item.Get());
 
-        const key_string::TypeBits typeBits = keyString.getTypeBits();
-        WiredTigerItem valueItem = typeBits.isAllZeros()
+        // Use the type bits as stored in the key string rather than parsing them into a TypeBits
+        // object, which copies the buffer. An empty view or a leading zero byte is the all-zeros
+        // encoding, which is omitted from the value.
+        const auto typeBits = keyString.getTypeBitsView();
+        WiredTigerItem valueItem = typeBits.empty() || typeBits[0] == 0
             ? emptyItem
-            : WiredTigerItem(typeBits.getBuffer(), typeBits.getSize());
+            : WiredTigerItem(typeBits.data(), typeBits.size());
 
         _cursor->set_value(_cursor.get(), valueItem.Get());
 
@@ -849,10 +842,12 @@ public:
         WiredTigerItem keyItem(newKeyString.getBuffer(), newKeyString.getSize());
         setKey(_cursor.get(), keyItem.Get());
 
-        const key_string::TypeBits typeBits = newKeyString.getTypeBits();
-        WiredTigerItem valueItem = typeBits.isAllZeros()
+        // As in StandardBulkBuilder::addKey(), store the type bits as they appear in the key
+        // string instead of parsing them, eliding the all-zeros encoding.
+        const auto typeBits = newKeyString.getTypeBitsView();
+        WiredTigerItem valueItem = typeBits.empty() || typeBits[0] == 0
             ? emptyItem
-            : WiredTigerItem(typeBits.getBuffer(), typeBits.getSize());
+            : WiredTigerItem(typeBits.data(), typeBits.size());
 
         _cursor->set_value(_cursor.get(), valueItem.Get());
 
@@ -254,15 +254,6 @@ protected:
                                          const key_string::Value& keyString,
                                          size_t sizeWithoutRecordId);
 
-    /**
-     * Sets the upper bound on the passed in cursor to be the maximum value of the KeyString prefix.
-     * Used when checking if a specific key prefix exists.
-     */
-    void _setUpperBoundForKeyExists(WT_CURSOR* c,
-                                    WiredTigerSession* session,
-                                    const key_string::Value& keyString,
-                                    size_t sizeWithoutRecordId);
-
     /**
      * Returns a DuplicateKey error if the prefix key exists in the index with a different RecordId.
      * Returns true if the prefix key exists in the index with the same RecordId. Returns false if
@@ -84,6 +84,7 @@
 #include <chrono>
 #include <cstddef>
 #include <exception>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <mutex>
@@ -109,6 +110,7 @@
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/storage_repair_observer.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_column_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
@@ -118,6 +120,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_record_store_oplog_truncate_markers.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
@@ -129,6 +132,7 @@
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/debug_util.h"
 #include "mongo/util/log_and_backoff.h"
+#include "mongo/util/murmur3.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/testing_proctor.h"
@@ -624,6 +628,17 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     }
 
     _sizeStorer = std::make_unique<WiredTigerSizeStorer>(_conn, _sizeStorerUri);
+
+    _oplogTruncateMarkersUri = _uri("oplogTruncateMarkers");
+    if (repair && _hasUri(session.getSession(), _oplogTruncateMarkersUri)) {
+        // The persisted markers are derived data; rather than salvaging, drop them and let startup
+        // rebuild the markers from the oplog.
+        LOGV2(8662702, "Dropping persisted oplog truncate markers for repair");
+        invariantWTOK(session.getSession()->drop(
+                          session.getSession(), _oplogTruncateMarkersUri.c_str(), "force=true"),
+                      session.getSession());
+    }
+
     auto param = std::make_unique<WiredTigerEngineRuntimeConfigParameter>(
         "wiredTigerEngineRuntimeConfig", ServerParameterType::kRuntimeOnly);
     param->_data.second = this;
@@ -1091,6 +1106,27 @@ boost::filesystem::path constructFilePath(std::string path, std::string filename
     return filePath;
 }
 
+/**
+ * Hashes the 'length' bytes at 'offset' of 'filePath' so incremental backup consumers can detect
+ * blocks whose contents are unchanged since the source backup. Returns boost::none if the bytes
+ * cannot be read, in which case the block simply carries no checksum and must be copied.
+ */
+boost::optional<std::uint64_t> computeBlockChecksum(const boost::filesystem::path& filePath,
+                                                    std::uint64_t offset,
+                                                    std::uint64_t length) {
+    std::ifstream file(filePath.string(), std::ios::binary);
+    if (!file.is_open()) {
+        return boost::none;
+    }
+    file.seekg(offset);
+    auto buffer = std::make_unique<char[]>(length);
+    file.read(buffer.get(), length);
+    if (file.bad() || static_cast<std::uint64_t>(file.gcount()) != length) {
+        return boost::none;
+    }
+    return static_cast<std::uint64_t>(murmur3<8>(StringData(buffer.get(), length), 0 /* seed */));
+}
+
 std::deque<std::string> getUniqueFiles(const std::vector<std::string>& files,
                                        const std::set<std::string>& referenceFiles) {
     std::deque<std::string> result;
@@ -1266,13 +1302,20 @@ private:
                         "size"_attr = size,
                         "type"_attr = type);
             auto nsAndUUID = _getNsAndUUID(filePath);
+            // WiredTiger's incremental change tracking is page-granular, so a reported block may
+            // be byte-identical to the source backup. Annotating it with a content hash lets the
+            // backup consumer skip copying such blocks.
+            boost::optional<std::uint64_t> checksum = options.computeBlockChecksums && size > 0
+                ? computeBlockChecksum(filePath, offset, size)
+                : boost::none;
             backupBlocks->push_back(BackupBlock(opCtx,
                                                 nsAndUUID.first,
                                                 nsAndUUID.second,
                                                 filePath.string(),
                                                 offset,
                                                 size,
-                                                fileSize));
+                                                fileSize,
+                                                checksum));
         }
 
         // If the file is unchanged, push a BackupBlock with offset=0 and length=0. This allows us
@@ -1456,6 +1499,81 @@ void WiredTigerKVEngine::syncSizeInfo(bool sync) const {
     }
 }
 
+namespace {
+// Key of the single row holding the oplog truncate marker document in its table.
+constexpr auto kOplogTruncateMarkersKey = "oplogTruncateMarkers"_sd;
+}  // namespace
+
+boost::optional<BSONObj> WiredTigerKVEngine::loadPersistedOplogTruncateMarkers() {
+    WiredTigerSession session(_conn);
+    WT_SESSION* s = session.getSession();
+
+    // The table is created lazily by the first persist, so it may legitimately not exist yet.
+    WT_CURSOR* cursor = nullptr;
+    int ret = s->open_cursor(s, _oplogTruncateMarkersUri.c_str(), nullptr, nullptr, &cursor);
+    if (ret == ENOENT) {
+        return boost::none;
+    }
+    invariantWTOK(ret, s);
+    ON_BLOCK_EXIT([&] { cursor->close(cursor); });
+
+    WiredTigerItem key(kOplogTruncateMarkersKey.rawData(), kOplogTruncateMarkersKey.size());
+    cursor->set_key(cursor, key.Get());
+    ret = cursor->search(cursor);
+    if (ret == WT_NOTFOUND) {
+        return boost::none;
+    }
+    invariantWTOK(ret, s);
+
+    WT_ITEM value;
+    invariantWTOK(cursor->get_value(cursor, &value), s);
+    return BSONObj(reinterpret_cast<const char*>(value.data)).getOwned();
+}
+
+void WiredTigerKVEngine::_persistOplogTruncateMarkers() {
+    BSONObj doc;
+    {
+        stdx::lock_guard<Latch> lock(_oplogManagerMutex);
+        if (!_oplogRecordStore) {
+            return;
+        }
+        auto truncateMarkers = _oplogRecordStore->oplogTruncateMarkers();
+        if (!truncateMarkers) {
+            return;
+        }
+        doc = truncateMarkers->serialize();
+    }
+
+    WiredTigerSession session(_conn);
+    WT_SESSION* s = session.getSession();
+    std::string config = WiredTigerCustomizationHooks::get(getGlobalServiceContext())
+                             ->getTableCreateConfig(_oplogTruncateMarkersUri);
+    invariantWTOK(s->create(s, _oplogTruncateMarkersUri.c_str(), config.c_str()), s);
+
+    WT_CURSOR* cursor = session.getNewCursor(_oplogTruncateMarkersUri, "overwrite=true");
+
+    // To avoid deadlocks with cache eviction, allow the transaction to time itself out. Once the
+    // time limit has been exceeded on an operation in this transaction, WiredTiger returns
+    // WT_ROLLBACK for that operation.
+    WiredTigerBeginTxnBlock txnOpen(&session, "operation_timeout_ms=10");
+
+    WiredTigerItem key(kOplogTruncateMarkersKey.rawData(), kOplogTruncateMarkersKey.size());
+    cursor->set_key(cursor, key.Get());
+    WiredTigerItem value(doc.objdata(), doc.objsize());
+    cursor->set_value(cursor, value.Get());
+
+    int ret = cursor->insert(cursor);
+    if (ret == WT_ROLLBACK) {
+        // Best effort: the markers will be persisted again with the next checkpoint, and startup
+        // reconciles whatever document it finds against the actual oplog contents.
+        LOGV2_DEBUG(8662703, 2, "Oplog truncate marker persistence was rolled back");
+        return;
+    }
+    invariantWTOK(ret, s);
+    txnOpen.done();
+    invariantWTOK(s->commit_transaction(s, nullptr), s);
+}
+
 void WiredTigerKVEngine::setOldestActiveTransactionTimestampCallback(
     StorageEngine::OldestActiveTransactionTimestampCallback callback) {
     stdx::lock_guard<Latch> lk(_oldestActiveTransactionTimestampCallbackMutex);
@@ -2061,6 +2179,11 @@ void WiredTigerKVEngine::_checkpoint(WT_SESSION* session) try {
     // more threads checkpoint at the same time.
     stdx::lock_guard lk(_checkpointMutex);
 
+    // Persist the current oplog truncate marker boundaries before taking the checkpoint so that
+    // the write is captured by it. Startup rebuilds the in-memory markers from this document and
+    // only has to read the stretch of oplog written since.
+    _persistOplogTruncateMarkers();
+
     const Timestamp stableTimestamp = getStableTimestamp();
     const Timestamp initialDataTimestamp = getInitialDataTimestamp();
 
@@ -2132,6 +2255,21 @@ void WiredTigerKVEngine::checkpoint() {
     return _checkpoint(s);
 }
 
+double WiredTigerKVEngine::getCacheDirtyFillRatio() const {
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    WT_SESSION* s = session->getSession();
+
+    auto dirtyBytes =
+        WiredTigerUtil::getStatisticsValue(s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    auto maxBytes =
+        WiredTigerUtil::getStatisticsValue(s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_MAX);
+    if (!dirtyBytes.isOK() || !maxBytes.isOK() || maxBytes.getValue() <= 0) {
+        return 0;
+    }
+
+    return static_cast<double>(dirtyBytes.getValue()) / maxBytes.getValue();
+}
+
 void WiredTigerKVEngine::forceCheckpoint(bool useStableTimestamp) {
     UniqueWiredTigerSession session = _sessionCache->getSession();
     WT_SESSION* s = session->getSession();
@@ -2180,7 +2318,7 @@ std::vector<std::string> WiredTigerKVEngine::getAllIdents(OperationContext* opCt
             continue;
 
         StringData ident = key.substr(idx + 1);
-        if (ident == "sizeStorer")
+        if (ident == "sizeStorer" || ident == "oplogTruncateMarkers")
             continue;
 
         all.push_back(ident.toString());
@@ -2372,16 +2510,16 @@ Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp
         invariant(minSnapshotHistoryWindowInSeconds.load() == 0);
     }
 
-    if (stableTimestamp.getSecs() <
-        static_cast<unsigned>(minSnapshotHistoryWindowInSeconds.load())) {
+    const int historyWindowSecs = _getEffectiveSnapshotWindowInSeconds();
+
+    if (stableTimestamp.getSecs() < static_cast<unsigned>(historyWindowSecs)) {
         // The history window is larger than the timestamp history thus far. We must wait for
         // the history to reach the window size before moving oldest_timestamp forward. This should
         // only happen in unit tests.
         return Timestamp();
     }
 
-    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() -
-                                            minSnapshotHistoryWindowInSeconds.load(),
+    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() - historyWindowSecs,
                                         stableTimestamp.getInc());
 
     if (calculatedOldestTimestamp.asULL() <= _oldestTimestamp.load()) {
@@ -2398,6 +2536,49 @@ Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp
     return calculatedOldestTimestamp;
 }
 
+int WiredTigerKVEngine::_getEffectiveSnapshotWindowInSeconds() {
+    const int configuredWindowSecs = minSnapshotHistoryWindowInSeconds.load();
+    const double pressureThreshold = gSnapshotHistoryCachePressureThreshold.load();
+    if (pressureThreshold <= 0 || configuredWindowSecs == 0) {
+        return configuredWindowSecs;
+    }
+
+    // Sample the cache statistics at most once per second; between samples all callers use the
+    // last computed reduction. Losing the compare-and-swap means another caller is sampling.
+    const auto nowMillis = _clockSource->now().toMillisSinceEpoch();
+    auto lastMillis = _lastSnapshotWindowAdjustmentMillis.load();
+    if (nowMillis - lastMillis >= 1000 &&
+        _lastSnapshotWindowAdjustmentMillis.compareAndSwap(&lastMillis, nowMillis)) {
+        const double dirtyFillRatio = getCacheDirtyFillRatio();
+        const int stepSecs = std::max(configuredWindowSecs / 10, 1);
+        const int oldReductionSecs = _snapshotWindowReductionSecs.load();
+        int newReductionSecs = oldReductionSecs;
+        if (dirtyFillRatio >= pressureThreshold) {
+            // Shrink the window so that WiredTiger can discard history sooner and relieve the
+            // cache. Reducing the window all the way to zero is acceptable: readers that must
+            // not lose their snapshots hold oldest timestamp pins, which are honored regardless
+            // of the window.
+            newReductionSecs = std::min(oldReductionSecs + stepSecs, configuredWindowSecs);
+        } else if (dirtyFillRatio < pressureThreshold / 2) {
+            // Grow the window back towards the configured value now that there is headroom. The
+            // half-threshold hysteresis avoids oscillating around the trigger point.
+            newReductionSecs = std::max(oldReductionSecs - stepSecs, 0);
+        }
+        if (newReductionSecs != oldReductionSecs) {
+            _snapshotWindowReductionSecs.store(newReductionSecs);
+            LOGV2_DEBUG(9987420,
+                        1,
+                        "Adjusted snapshot history window in response to cache pressure",
+                        "windowSecs"_attr = configuredWindowSecs - newReductionSecs,
+                        "configuredWindowSecs"_attr = configuredWindowSecs,
+                        "dirtyFillRatio"_attr = dirtyFillRatio);
+        }
+    }
+
+    // The configured window may have been lowered at runtime below the current reduction.
+    return std::max(configuredWindowSecs - _snapshotWindowReductionSecs.load(), 0);
+}
+
 void WiredTigerKVEngine::setInitialDataTimestamp(Timestamp initialDataTimestamp) {
     LOGV2_DEBUG(22344,
                 2,
@@ -233,6 +233,8 @@ public:
 
     void checkpoint() override;
 
+    double getCacheDirtyFillRatio() const override;
+
     // Force a WT checkpoint, this will not update internal timestamps.
     void forceCheckpoint(bool useStableTimestamp);
 
@@ -424,6 +426,13 @@ public:
 
     void syncSizeInfo(bool sync) const;
 
+    /**
+     * Returns the oplog truncate marker document persisted with a previous checkpoint, or
+     * boost::none if none is available. Used on startup to rebuild the in-memory oplog truncate
+     * markers without reading the whole oplog.
+     */
+    boost::optional<BSONObj> loadPersistedOplogTruncateMarkers();
+
     /*
      * The oplog manager is always accessible, but this method will start the background thread to
      * control oplog entry visibility for reads.
@@ -604,6 +613,14 @@ private:
 
     void _checkpoint(WT_SESSION* session, bool useTimestamp);
 
+    /**
+     * Persists the oplog truncate marker boundaries so that the next startup can rebuild its
+     * in-memory markers from them instead of reading the whole oplog. Called before taking a
+     * checkpoint; best effort, as startup reconciles the persisted boundaries against the actual
+     * oplog contents.
+     */
+    void _persistOplogTruncateMarkers();
+
     /**
      * Opens a connection on the WiredTiger database 'path' with the configuration 'wtOpenConfig'.
      * Only returns when successful. Intializes both '_conn' and '_fileVersion'.
@@ -639,6 +656,16 @@ private:
      */
     Timestamp _calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp);
 
+    /**
+     * Returns the snapshot history window to maintain behind the stable timestamp, in seconds.
+     * This is 'minSnapshotHistoryWindowInSeconds' unless
+     * 'snapshotHistoryCachePressureThreshold' is set, in which case the window is gradually
+     * reduced while the cache dirty fill ratio stays above the threshold and grown back towards
+     * the configured value once the pressure subsides. The cache statistics are sampled at most
+     * once per second; concurrent callers use the last computed reduction.
+     */
+    int _getEffectiveSnapshotWindowInSeconds();
+
     /**
      * Checks whether rollback to a timestamp can occur, enforcing a contract of use between the
      * storage engine and replication.
@@ -676,6 +703,7 @@ private:
 
     std::unique_ptr<WiredTigerSizeStorer> _sizeStorer;
     std::string _sizeStorerUri;
+    std::string _oplogTruncateMarkersUri;
     mutable ElapsedTracker _sizeStorerSyncTracker;
     mutable Mutex _sizeStorerSyncTrackerMutex =
         MONGO_MAKE_LATCH("WiredTigerKVEngine::_sizeStorerSyncTrackerMutex");
@@ -704,6 +732,13 @@ private:
     // timestamp. Provided by replication layer because WT does not persist timestamps.
     AtomicWord<std::uint64_t> _initialDataTimestamp;
 
+    // Seconds by which the snapshot history window is currently reduced below
+    // 'minSnapshotHistoryWindowInSeconds' in response to cache pressure, and the last time the
+    // cache statistics were sampled to adjust it. Maintained by
+    // _getEffectiveSnapshotWindowInSeconds().
+    AtomicWord<int> _snapshotWindowReductionSecs;
+    AtomicWord<long long> _lastSnapshotWindowAdjustmentMillis;
+
     AtomicWord<std::uint64_t> _oplogNeededForCrashRecovery;
 
     mutable Mutex _oldestTimestampPinRequestsMutex =
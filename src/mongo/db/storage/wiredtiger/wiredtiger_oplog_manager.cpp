@@ -174,10 +174,12 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     stdx::unique_lock<Latch> lk(_oplogVisibilityStateMutex);
 
     // Prevent any scheduled oplog visibility updates from being delayed for batching and blocking
-    // this wait excessively.
+    // this wait excessively. Notify the visibility thread so that a delay already in progress is
+    // preempted immediately rather than at its next periodic wake-up.
     ++_opsWaitingForOplogVisibilityUpdate;
     invariant(_opsWaitingForOplogVisibilityUpdate > 0);
     ScopeGuard exitGuard([&] { --_opsWaitingForOplogVisibilityUpdate; });
+    _oplogVisibilityThreadCV.notify_one();
 
     // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
     // prompt the OplogVisibilityThread to run and update the oplog visibility. We simply need to
@@ -84,7 +84,7 @@ int wiredTigerPrepareConflictRetrySlow(OperationContext* opCtx, std::function<in
         // choose to abort our transaction and retry instead of blocking. It's possible that we can
         // be blocking on a prepared update that requires replication to make progress, creating a
         // stall in the MDB cluster.
-        throwWriteConflictException("Holding a resource (oplog slot).");
+        throwWriteConflictException([] { return "Holding a resource (oplog slot)."; });
     }
 
     auto recoveryUnit = WiredTigerRecoveryUnit::get(opCtx);
@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <cstring>
 #include <deque>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
@@ -219,6 +220,115 @@ MONGO_FAIL_POINT_DEFINE(WTRecordStoreUassertOutOfOrder);
 MONGO_FAIL_POINT_DEFINE(WTWriteConflictException);
 MONGO_FAIL_POINT_DEFINE(WTWriteConflictExceptionForReads);
 
+namespace {
+
+// Format of the oplog truncate marker document persisted alongside checkpoints. Bump the version
+// whenever the layout changes; a mismatch makes startup fall back to rebuilding the markers from
+// the oplog itself.
+constexpr int kOplogMarkersFormatVersion = 1;
+constexpr auto kOplogMarkersVersionFieldName = "version"_sd;
+constexpr auto kOplogMarkersMinBytesFieldName = "minBytesPerMarker"_sd;
+constexpr auto kOplogMarkersSampledFieldName = "processedBySampling"_sd;
+constexpr auto kOplogMarkersMarkersFieldName = "markers"_sd;
+constexpr auto kOplogMarkerRecordsFieldName = "records"_sd;
+constexpr auto kOplogMarkerBytesFieldName = "bytes"_sd;
+constexpr auto kOplogMarkerLastRecordFieldName = "lastRecord"_sd;
+constexpr auto kOplogMarkerWallTimeFieldName = "wallTime"_sd;
+
+/**
+ * Attempts to rebuild the in-memory oplog truncate markers from the marker boundaries persisted
+ * with a previous checkpoint. Boundaries for oplog ranges that no longer exist (reclaimed from the
+ * front by the truncation thread, or removed from the back by rollback to stable) are discarded,
+ * and the stretch of oplog above the newest surviving boundary is scanned to recreate the partial
+ * marker and any markers filled since the document was persisted. Returns nullptr if the document
+ * is malformed, from a different format version or marker size, or if no persisted boundary
+ * survives reconciliation; the caller then falls back to a full scan or sample.
+ */
+std::shared_ptr<WiredTigerRecordStore::OplogTruncateMarkers> rehydrateOplogTruncateMarkers(
+    OperationContext* opCtx,
+    WiredTigerRecordStore* rs,
+    const BSONObj& persisted,
+    int64_t minBytesPerMarker,
+    const std::function<CollectionTruncateMarkers::RecordIdAndWallTime(const Record&)>&
+        getRecordIdAndWallTime) try {
+    if (persisted[kOplogMarkersVersionFieldName].safeNumberInt() != kOplogMarkersFormatVersion ||
+        persisted[kOplogMarkersMinBytesFieldName].safeNumberLong() != minBytesPerMarker) {
+        return nullptr;
+    }
+
+    Timer timer;
+
+    RecordId firstRecordId, lastRecordId;
+    {
+        auto firstRecord = rs->getCursor(opCtx, /*forward=*/true)->next();
+        auto lastRecord = rs->getCursor(opCtx, /*forward=*/false)->next();
+        if (!firstRecord || !lastRecord) {
+            return nullptr;
+        }
+        firstRecordId = firstRecord->id;
+        lastRecordId = lastRecord->id;
+    }
+
+    std::deque<CollectionTruncateMarkers::Marker> markers;
+    for (const auto& element : persisted[kOplogMarkersMarkersFieldName].Obj()) {
+        const auto markerObj = element.Obj();
+        RecordId lastRecord{markerObj[kOplogMarkerLastRecordFieldName].safeNumberLong()};
+        if (lastRecord < firstRecordId || lastRecord > lastRecordId) {
+            // The range this marker covers has been truncated away since the document was
+            // persisted.
+            continue;
+        }
+        markers.emplace_back(markerObj[kOplogMarkerRecordsFieldName].safeNumberLong(),
+                             markerObj[kOplogMarkerBytesFieldName].safeNumberLong(),
+                             std::move(lastRecord),
+                             markerObj[kOplogMarkerWallTimeFieldName].Date());
+    }
+    if (markers.empty()) {
+        return nullptr;
+    }
+
+    // Scan the oplog above the newest surviving boundary to recreate the markers filled since the
+    // document was persisted. This is the only part of the oplog that has to be read.
+    int64_t currentRecords = 0;
+    int64_t currentBytes = 0;
+    auto cursor = rs->getCursor(opCtx, /*forward=*/true);
+    auto record =
+        cursor->seek(markers.back().lastRecord, SeekableRecordCursor::BoundInclusion::kExclude);
+    while (record) {
+        currentRecords++;
+        currentBytes += record->data.size();
+        if (currentBytes >= minBytesPerMarker) {
+            const auto [id, wallTime] = getRecordIdAndWallTime(*record);
+            markers.emplace_back(
+                std::exchange(currentRecords, 0), std::exchange(currentBytes, 0), id, wallTime);
+        }
+        record = cursor->next();
+    }
+
+    LOGV2(8662700,
+          "WiredTiger record store rebuilt oplog truncate markers from the last checkpoint",
+          "numMarkers"_attr = markers.size(),
+          "duration"_attr = duration_cast<Milliseconds>(Microseconds{timer.micros()}));
+    return std::make_shared<WiredTigerRecordStore::OplogTruncateMarkers>(
+        std::move(markers),
+        currentRecords,
+        currentBytes,
+        minBytesPerMarker,
+        Microseconds{timer.micros()},
+        persisted[kOplogMarkersSampledFieldName].trueValue()
+            ? CollectionTruncateMarkers::MarkersCreationMethod::Sampling
+            : CollectionTruncateMarkers::MarkersCreationMethod::Scanning,
+        rs);
+} catch (const DBException& ex) {
+    LOGV2_WARNING(8662701,
+                  "Failed to rebuild oplog truncate markers from the persisted document, falling "
+                  "back to reading the oplog",
+                  "error"_attr = redact(ex));
+    return nullptr;
+}
+
+}  // namespace
+
 std::shared_ptr<WiredTigerRecordStore::OplogTruncateMarkers>
 WiredTigerRecordStore::OplogTruncateMarkers::createOplogTruncateMarkers(OperationContext* opCtx,
                                                                         WiredTigerRecordStore* rs,
@@ -250,20 +360,34 @@ WiredTigerRecordStore::OplogTruncateMarkers::createOplogTruncateMarkers(Operatio
     // We need to read the whole oplog, override the recoveryUnit's oplogVisibleTimestamp.
     ScopedOplogVisibleTimestamp scopedOplogVisibleTimestamp(
         shard_role_details::getRecoveryUnit(opCtx), boost::none);
+
+    auto getRecordIdAndWallTime = [](const Record& record) {
+        BSONObj obj = record.data.toBson();
+        auto wallTime = obj.hasField(repl::DurableOplogEntry::kWallClockTimeFieldName)
+            ? obj[repl::DurableOplogEntry::kWallClockTimeFieldName].Date()
+            : obj[repl::DurableOplogEntry::kTimestampFieldName].timestampTime();
+        return RecordIdAndWallTime(record.id, wallTime);
+    };
+
+    // Marker boundaries persisted with a previous checkpoint let us skip reading the bulk of the
+    // oplog: only the stretch written since the document was persisted has to be reconciled.
+    if (rs->_kvEngine) {
+        if (auto persisted = rs->_kvEngine->loadPersistedOplogTruncateMarkers()) {
+            if (auto truncateMarkers = rehydrateOplogTruncateMarkers(
+                    opCtx, rs, *persisted, minBytesPerTruncateMarker, getRecordIdAndWallTime)) {
+                return truncateMarkers;
+            }
+        }
+    }
+
     UnyieldableCollectionIterator iterator(opCtx, rs);
-    auto initialSetOfMarkers = CollectionTruncateMarkers::createFromCollectionIterator(
-        opCtx,
-        iterator,
-        ns,
-        minBytesPerTruncateMarker,
-        [](const Record& record) {
-            BSONObj obj = record.data.toBson();
-            auto wallTime = obj.hasField(repl::DurableOplogEntry::kWallClockTimeFieldName)
-                ? obj[repl::DurableOplogEntry::kWallClockTimeFieldName].Date()
-                : obj[repl::DurableOplogEntry::kTimestampFieldName].timestampTime();
-            return RecordIdAndWallTime(record.id, wallTime);
-        },
-        numTruncateMarkersToKeep);
+    auto initialSetOfMarkers =
+        CollectionTruncateMarkers::createFromCollectionIterator(opCtx,
+                                                                iterator,
+                                                                ns,
+                                                                minBytesPerTruncateMarker,
+                                                                getRecordIdAndWallTime,
+                                                                numTruncateMarkersToKeep);
     LOGV2(22382,
           "WiredTiger record store oplog processing finished",
           "duration"_attr = duration_cast<Milliseconds>(initialSetOfMarkers.timeTaken));
@@ -292,6 +416,28 @@ WiredTigerRecordStore::OplogTruncateMarkers::OplogTruncateMarkers(
       _processBySampling(creationMethod ==
                          CollectionTruncateMarkers::MarkersCreationMethod::Sampling) {}
 
+BSONObj WiredTigerRecordStore::OplogTruncateMarkers::serialize() const {
+    BSONObjBuilder builder;
+    builder.append(kOplogMarkersVersionFieldName, kOplogMarkersFormatVersion);
+    builder.appendNumber(kOplogMarkersMinBytesFieldName,
+                         static_cast<long long>(minBytesPerMarker()));
+    builder.append(kOplogMarkersSampledFieldName, _processBySampling);
+    checkMarkersWith([&](const std::deque<CollectionTruncateMarkers::Marker>& markers) {
+        BSONArrayBuilder markersBuilder(builder.subarrayStart(kOplogMarkersMarkersFieldName));
+        for (const auto& marker : markers) {
+            BSONObjBuilder markerBuilder(markersBuilder.subobjStart());
+            markerBuilder.appendNumber(kOplogMarkerRecordsFieldName,
+                                       static_cast<long long>(marker.records));
+            markerBuilder.appendNumber(kOplogMarkerBytesFieldName,
+                                       static_cast<long long>(marker.bytes));
+            markerBuilder.appendNumber(kOplogMarkerLastRecordFieldName,
+                                       static_cast<long long>(marker.lastRecord.getLong()));
+            markerBuilder.appendDate(kOplogMarkerWallTimeFieldName, marker.wallTime);
+        }
+    });
+    return builder.obj();
+}
+
 bool WiredTigerRecordStore::OplogTruncateMarkers::isDead() {
     stdx::lock_guard<Latch> lk(_reclaimMutex);
     return _isDead;
@@ -387,13 +533,8 @@ bool WiredTigerRecordStore::OplogTruncateMarkers::awaitHasExcessMarkersOrDead(
 }
 
 bool WiredTigerRecordStore::OplogTruncateMarkers::_hasExcessMarkers(OperationContext* opCtx) const {
-    int64_t totalBytes = 0;
-    for (const auto& marker : getMarkers()) {
-        totalBytes += marker.bytes;
-    }
-
     // check that oplog truncate markers is at capacity
-    if (totalBytes <= _rs->_oplogMaxSize.load()) {
+    if (totalMarkersBytes() <= _rs->_oplogMaxSize.load()) {
         return false;
     }
 
@@ -790,8 +931,8 @@ void WiredTigerRecordStore::checkSize(OperationContext* opCtx) {
                            "ident"_attr = getIdent());
         sizeRecoveryState(getGlobalServiceContext())
             .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
-        _sizeInfo->dataSize.store(0);
-        _sizeInfo->numRecords.store(0);
+        _sizeInfo->setDataSize(0);
+        _sizeInfo->setNumRecords(0);
     }
 
     if (_sizeStorer)
@@ -830,12 +971,12 @@ KeyFormat WiredTigerRecordStore::keyFormat() const {
 }
 
 long long WiredTigerRecordStore::dataSize(OperationContext* opCtx) const {
-    auto dataSize = _sizeInfo->dataSize.load();
+    auto dataSize = _sizeInfo->dataSize();
     return dataSize > 0 ? dataSize : 0;
 }
 
 long long WiredTigerRecordStore::numRecords(OperationContext* opCtx) const {
-    auto numRecords = _sizeInfo->numRecords.load();
+    auto numRecords = _sizeInfo->numRecords();
     return numRecords > 0 ? numRecords : 0;
 }
 
@@ -1044,8 +1185,8 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx) {
     LOGV2(22402,
           "WiredTiger record store oplog truncation finished",
           "pinnedOplogTimestamp"_attr = mayTruncateUpTo,
-          "numRecords"_attr = _sizeInfo->numRecords.load(),
-          "dataSize"_attr = _sizeInfo->dataSize.load(),
+          "numRecords"_attr = _sizeInfo->numRecords(),
+          "dataSize"_attr = _sizeInfo->dataSize(),
           "duration"_attr = Milliseconds(elapsedMillis));
 }
 
@@ -1769,8 +1910,8 @@ void WiredTigerRecordStore::updateStatsAfterRepair(OperationContext* opCtx,
     sizeRecoveryState(getGlobalServiceContext())
         .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
 
-    _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
-    _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
+    _sizeInfo->setNumRecords(std::max(numRecords, 0ll));
+    _sizeInfo->setDataSize(std::max(dataSize, 0ll));
 
     // If we have a WiredTigerSizeStorer, but our size info is not currently cached, add it.
     if (_sizeStorer)
@@ -1897,8 +2038,7 @@ void WiredTigerRecordStore::_changeNumRecordsAndDataSize(OperationContext* opCtx
     }
 
     const auto updateAndStoreSizeInfo = [this](int64_t numRecordDiff, int64_t dataSizeDiff) {
-        _sizeInfo->numRecords.addAndFetch(numRecordDiff);
-        _sizeInfo->dataSize.addAndFetch(dataSizeDiff);
+        _sizeInfo->add(numRecordDiff, dataSizeDiff);
 
         if (_sizeStorer)
             _sizeStorer->store(_uri, _sizeInfo);
@@ -1917,7 +2057,7 @@ void WiredTigerRecordStore::_changeNumRecordsAndDataSize(OperationContext* opCtx
 }
 
 void WiredTigerRecordStore::setNumRecords(long long numRecords) {
-    _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
+    _sizeInfo->setNumRecords(std::max(numRecords, 0ll));
 
     if (!_sizeStorer) {
         return;
@@ -1930,7 +2070,7 @@ void WiredTigerRecordStore::setNumRecords(long long numRecords) {
 }
 
 void WiredTigerRecordStore::setDataSize(long long dataSize) {
-    _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
+    _sizeInfo->setDataSize(std::max(dataSize, 0ll));
 
     if (!_sizeStorer) {
         return;
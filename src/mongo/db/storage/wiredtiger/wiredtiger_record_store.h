@@ -283,8 +283,7 @@ public:
 
     class OplogTruncateMarkers;
 
-    // Exposed only for testing.
-    OplogTruncateMarkers* oplogTruncateMarkers() {
+    OplogTruncateMarkers* oplogTruncateMarkers() const {
         return _oplogTruncateMarkers.get();
     };
 
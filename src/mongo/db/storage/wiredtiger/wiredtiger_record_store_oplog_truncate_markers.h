@@ -84,6 +84,14 @@ public:
 
     void getOplogTruncateMarkersStats(BSONObjBuilder& builder) const;
 
+    /**
+     * Serializes the current marker boundaries into a document that the KV engine persists
+     * alongside checkpoints. On startup, createOplogTruncateMarkers() reconstructs the in-memory
+     * markers from this document by scanning only the oplog written since it was persisted,
+     * instead of scanning or sampling the whole oplog.
+     */
+    BSONObj serialize() const;
+
     // Resize oplog size
     void adjust(OperationContext* opCtx, int64_t maxSize);
 
@@ -62,6 +62,7 @@
 #include "mongo/logv2/log_severity.h"
 #include "mongo/logv2/log_truncation.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/usdt.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/hex.h"
@@ -320,7 +321,7 @@ void WiredTigerRecoveryUnit::_txnClose(bool commit) {
             LOGV2_ERROR(5703401,
                         "Found a violation of multi-timestamp constraint. Retrying operation to "
                         "collect extra debugging context for the involved writes.");
-            throwWriteConflictException("Violation of multi-timestamp constraint.");
+            throwWriteConflictException([] { return "Violation of multi-timestamp constraint."; });
         }
         if (commit) {
             LOGV2_FATAL(
@@ -366,6 +367,7 @@ void WiredTigerRecoveryUnit::_txnClose(bool commit) {
 
         wtRet = s->commit_transaction(s, nullptr);
 
+        MONGO_USDT(wt_txn_commit, this, getSnapshotId().toNumber());
         LOGV2_DEBUG(
             22412, 3, "WT commit_transaction", "snapshotId"_attr = getSnapshotId().toNumber());
     } else {
@@ -380,6 +382,7 @@ void WiredTigerRecoveryUnit::_txnClose(bool commit) {
 
         wtRet = s->rollback_transaction(s, config);
 
+        MONGO_USDT(wt_txn_abort, this, getSnapshotId().toNumber());
         LOGV2_DEBUG(
             22413, 3, "WT rollback_transaction", "snapshotId"_attr = getSnapshotId().toNumber());
     }
@@ -574,6 +577,8 @@ void WiredTigerRecoveryUnit::_txnOpen() {
         }
     }
 
+    MONGO_USDT(
+        wt_txn_open, this, getSnapshotId().toNumber(), static_cast<int>(_timestampReadSource));
     LOGV2_DEBUG(22414,
                 3,
                 "WT begin_transaction",
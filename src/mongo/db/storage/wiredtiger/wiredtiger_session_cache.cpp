@@ -30,8 +30,10 @@
 
 #include <cerrno>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
@@ -50,6 +52,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/str.h"
@@ -124,6 +127,12 @@ void _openCursor(WT_SESSION* session,
 }
 }  // namespace
 
+namespace {
+// Number of cursor cache hits after which a table is considered hot enough to have its cursors
+// re-pinned rather than closed by the generation-based eviction in releaseCursor().
+constexpr uint32_t kHotTableCursorCacheHits = 16;
+}  // namespace
+
 WT_CURSOR* WiredTigerSession::getCachedCursor(uint64_t id, const std::string& config) {
     // Find the most recently used cursor
     for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
@@ -134,6 +143,10 @@ WT_CURSOR* WiredTigerSession::getCachedCursor(uint64_t id, const std::string& co
             WT_CURSOR* c = i->_cursor;
             _cursors.erase(i);
             _cursorsOut++;
+            auto& hits = _cursorCacheHits[id];
+            if (hits < kHotTableCursorCacheHits) {
+                ++hits;
+            }
             return c;
         }
     }
@@ -169,9 +182,22 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor, std::strin
     // A negative value for wiredTigercursorCacheSize means to use hybrid caching.
     std::uint32_t cacheSize = abs(gWiredTigerCursorCacheSize.load());
 
-    while (!_cursors.empty() && _cursorGen - _cursors.back()._gen > cacheSize) {
-        cursor = _cursors.back()._cursor;
+    // Bound the eviction scan by the current cache size so that re-pinning hot cursors at the
+    // front cannot make this loop revisit them.
+    size_t evictionScansLeft = _cursors.size();
+    while (!_cursors.empty() && _cursorGen - _cursors.back()._gen > cacheSize &&
+           evictionScansLeft--) {
+        WiredTigerCachedCursor stale = std::move(_cursors.back());
         _cursors.pop_back();
+        auto hitsIt = _cursorCacheHits.find(stale._id);
+        if (hitsIt != _cursorCacheHits.end() && hitsIt->second >= kHotTableCursorCacheHits) {
+            // This table's cursors are hit often enough that reopening them would show up in
+            // point-read latency; keep the cursor warm by re-pinning it with a fresh generation.
+            stale._gen = _cursorGen++;
+            _cursors.push_front(std::move(stale));
+            continue;
+        }
+        cursor = stale._cursor;
         invariantWTOK(cursor->close(cursor), _session);
     }
 }
@@ -388,15 +414,21 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        for (auto session : partition->sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        count += partition->sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -408,14 +440,14 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = partition->sessions.begin(); it != partition->sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = partition->sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -431,13 +463,16 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. Sessions released
+    // with the old epoch after this point are deleted by releaseSession() rather than cached, so
+    // sweeping the partitions one lock at a time cannot leak an old-epoch session.
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    SessionCache swap;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        swap.insert(swap.end(), partition->sessions.begin(), partition->sessions.end());
+        partition->sessions.clear();
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -449,22 +484,43 @@ bool WiredTigerSessionCache::isEphemeral() {
     return _engine && _engine->isEphemeral();
 }
 
+WiredTigerSessionCache::SessionCachePartition& WiredTigerSessionCache::_getHomePartition() {
+    return *_partitions[std::hash<std::thread::id>{}(stdx::this_thread::get_id()) %
+                        kSessionCachePartitions];
+}
+
 UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // We should never be able to get here after _shuttingDown is set, because no new
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            // Reset the idle time
-            cachedSession->setIdleExpireTime(Date_t::min());
-            return UniqueWiredTigerSession(cachedSession);
+    auto popFrom = [](SessionCachePartition& partition) -> WiredTigerSession* {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        if (partition.sessions.empty()) {
+            return nullptr;
         }
+        // Get the most recently used session so that if we discard sessions, we're
+        // discarding older ones
+        WiredTigerSession* cachedSession = partition.sessions.back();
+        partition.sessions.pop_back();
+        return cachedSession;
+    };
+
+    // Try the home partition first: sessions this thread released there still have warm cursors
+    // for the tables it touches. Steal from the other partitions only if the home one is empty,
+    // which also rebalances sessions away from partitions that accumulate more releases.
+    auto& home = _getHomePartition();
+    WiredTigerSession* cachedSession = popFrom(home);
+    for (size_t i = 0; !cachedSession && i < kSessionCachePartitions; i++) {
+        auto& partition = *_partitions[i];
+        if (&partition != &home) {
+            cachedSession = popFrom(partition);
+        }
+    }
+    if (cachedSession) {
+        // Reset the idle time
+        cachedSession->setIdleExpireTime(Date_t::min());
+        return UniqueWiredTigerSession(cachedSession);
     }
 
     // Outside of the cache partition lock, but on release will be put back on the cache
@@ -515,10 +571,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& partition = _getHomePartition();
+        stdx::lock_guard<Latch> lock(partition.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            partition.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
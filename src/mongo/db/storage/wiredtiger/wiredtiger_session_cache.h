@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <list>
@@ -44,6 +45,8 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/time_support.h"
 #include "mongo/util/timer.h"
@@ -221,6 +224,14 @@ private:
     uint64_t _cursorGen;
     int _cursorsOut;
 
+    // Number of cursor cache hits per table id over the lifetime of this session. Tables with
+    // enough hits are considered hot and their cursors are re-pinned at the front of the cache
+    // instead of being closed when the generation-based eviction in releaseCursor() reaches
+    // them, so the hottest tables keep warm cursors even when many other tables cycle through
+    // the cache. The map stays small since a session only ever touches a handful of tables, and
+    // it is discarded with the session when it idles out of the session cache.
+    stdx::unordered_map<uint64_t, uint32_t> _cursorCacheHits;
+
     WiredTigerSessionCache* _cache;                  // not owned
     CompiledConfigurationsPerConnection* _compiled;  // not owned
 
@@ -432,9 +443,24 @@ private:
     AtomicWord<unsigned> _shuttingDown{0};
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The session free list is split into independently locked partitions so that concurrent
+    // getSession()/releaseSession() calls do not serialize on a single cache mutex. Each
+    // partition is cache-line exclusive to avoid false sharing between the locks.
+    struct SessionCachePartition {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCachePartition::lock");
+        SessionCache sessions;
+    };
+
+    // A thread releases sessions into — and pops from — its home partition, chosen by hashing
+    // its thread id, and only steals from the other partitions when its own is empty. Releasing
+    // and reacquiring on the same thread therefore tends to hand back the same session, keeping
+    // that session's cached WT cursors warm for the tables the thread repeatedly touches.
+    static constexpr size_t kSessionCachePartitions = 16;
+    std::array<CacheExclusive<SessionCachePartition>, kSessionCachePartitions> _partitions;
+
+    SessionCachePartition& _getHomePartition();
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
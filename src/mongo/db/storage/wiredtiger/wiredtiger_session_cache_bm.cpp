@@ -0,0 +1,124 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <wiredtiger.h>
+
+#include "mongo/base/string_data.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/assert_util_core.h"
+#include "mongo/util/clock_source_mock.h"
+
+namespace mongo {
+namespace {
+
+const int kMaxPerfThreads = 16;  // max number of threads to use for session cache perf
+
+class WiredTigerConnection {
+public:
+    WiredTigerConnection(StringData dbpath, StringData extraStrings) : _conn(nullptr) {
+        std::stringstream ss;
+        ss << "create,";
+        ss << extraStrings;
+        std::string config = ss.str();
+        int ret = wiredtiger_open(dbpath.toString().c_str(), nullptr, config.c_str(), &_conn);
+        invariant(wtRCToStatus(ret, nullptr).isOK());
+    }
+    ~WiredTigerConnection() {
+        _conn->close(_conn, nullptr);
+    }
+    WT_CONNECTION* getConnection() const {
+        return _conn;
+    }
+
+private:
+    WT_CONNECTION* _conn;
+};
+
+class WiredTigerSessionCacheTest : public benchmark::Fixture {
+protected:
+    void SetUp(benchmark::State& state) override {
+        stdx::unique_lock<Latch> ul(_mutex);
+        if (state.thread_index == 0) {
+            _dbpath = std::make_unique<unittest::TempDir>("wt_session_cache_bm");
+            _connection = std::make_unique<WiredTigerConnection>(_dbpath->path(), "");
+            _sessionCache = std::make_unique<WiredTigerSessionCache>(_connection->getConnection(),
+                                                                     &_clockSource);
+            _cv.notify_all();
+        } else {
+            _cv.wait(ul, [&] { return !!_sessionCache; });
+        }
+    }
+
+    void TearDown(benchmark::State& state) override {
+        stdx::unique_lock<Latch> ul(_mutex);
+        if (state.thread_index == 0) {
+            _sessionCache.reset();
+            _connection.reset();
+            _dbpath.reset();
+            _cv.notify_all();
+        } else {
+            _cv.wait(ul, [&] { return !_sessionCache; });
+        }
+    }
+
+    WiredTigerSessionCache* cache() {
+        return _sessionCache.get();
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerSessionCacheTest::_mutex");
+    stdx::condition_variable _cv;
+
+    ClockSourceMock _clockSource;
+    std::unique_ptr<unittest::TempDir> _dbpath;
+    std::unique_ptr<WiredTigerConnection> _connection;
+    std::unique_ptr<WiredTigerSessionCache> _sessionCache;
+};
+
+BENCHMARK_DEFINE_F(WiredTigerSessionCacheTest, BM_GetReleaseSession)(benchmark::State& state) {
+    for (auto _ : state) {
+        auto session = cache()->getSession();
+        benchmark::DoNotOptimize(session.get());
+    }
+}
+
+BENCHMARK_REGISTER_F(WiredTigerSessionCacheTest, BM_GetReleaseSession)
+    ->ThreadRange(1, kMaxPerfThreads);
+
+}  // namespace
+}  // namespace mongo
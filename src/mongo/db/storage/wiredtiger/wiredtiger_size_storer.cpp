@@ -89,8 +89,8 @@ void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeI
                 2,
                 "WiredTigerSizeStorer::store",
                 "uri"_attr = uri,
-                "numRecords"_attr = sizeInfo->numRecords.load(),
-                "dataSize"_attr = sizeInfo->dataSize.load(),
+                "numRecords"_attr = sizeInfo->numRecords(),
+                "dataSize"_attr = sizeInfo->dataSize(),
                 "entryUseCount"_attr = entry.use_count());
 }
 
@@ -193,8 +193,8 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
                 // is dirty and it returns true, the current values of numRecords and dataSize must
                 // still be written back. So, the required order is to clear the dirty flag first.
                 sizeInfo->_dirty.store(false);
-                auto data = BSON("numRecords" << sizeInfo->numRecords.load() << "dataSize"
-                                              << sizeInfo->dataSize.load());
+                auto data = BSON("numRecords" << sizeInfo->numRecords() << "dataSize"
+                                              << sizeInfo->dataSize());
 
                 LOGV2_DEBUG(22425,
                             2,
@@ -213,7 +213,8 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
                 // except write conflicts. If WiredTiger returns WT_ROLLBACK during the flush, we
                 // return an exception here and let the caller decide whether to ignore it or retry
                 // flushing.
-                throwWriteConflictException("Size storer flush received a rollback.");
+                throwWriteConflictException(
+                    [] { return "Size storer flush received a rollback."; });
             }
             invariantWTOK(ret, cursor->session);
         }
@@ -29,15 +29,21 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 #include <wiredtiger.h>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/string_map.h"
 
@@ -62,19 +68,73 @@ public:
      * ownership. The SizeInfo may still be updated after it is stored in the SizeStorer.
      * The 'dirty' field is used by the size storer to cheaply merge duplicate stores of the same
      * SizeInfo.
+     *
+     * The counters are striped across cache lines: every document insert and delete adjusts them,
+     * so on write-heavy collections a single pair of atomics becomes a point of cache-line
+     * contention between writer threads. Writers pick a stripe by thread identity and readers sum
+     * all stripes.
      */
     struct SizeInfo {
         SizeInfo() = default;
-        SizeInfo(long long records, long long size) : numRecords(records), dataSize(size) {}
+        SizeInfo(long long records, long long size) {
+            setNumRecords(records);
+            setDataSize(size);
+        }
 
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicWord<long long> numRecords;
-        AtomicWord<long long> dataSize;
+
+        long long numRecords() const {
+            long long total = 0;
+            for (auto&& stripe : _stripes)
+                total += stripe->numRecords.load();
+            return total;
+        }
+
+        long long dataSize() const {
+            long long total = 0;
+            for (auto&& stripe : _stripes)
+                total += stripe->dataSize.load();
+            return total;
+        }
+
+        void add(int64_t numRecordsDiff, int64_t dataSizeDiff) {
+            auto& stripe =
+                *_stripes[std::hash<std::thread::id>{}(stdx::this_thread::get_id()) % kNumStripes];
+            stripe.numRecords.addAndFetch(numRecordsDiff);
+            stripe.dataSize.addAndFetch(dataSizeDiff);
+        }
+
+        /**
+         * Overwrites the record count. Adjustments made concurrently with a set may be lost, which
+         * is no worse than the single-counter behavior this replaces; counts are only set when the
+         * caller has an authoritative value, e.g. during startup, validate or rollback.
+         */
+        void setNumRecords(long long records) {
+            _stripes[0]->numRecords.store(records);
+            for (size_t i = 1; i < kNumStripes; ++i)
+                _stripes[i]->numRecords.store(0);
+        }
+
+        void setDataSize(long long size) {
+            _stripes[0]->dataSize.store(size);
+            for (size_t i = 1; i < kNumStripes; ++i)
+                _stripes[i]->dataSize.store(0);
+        }
 
     private:
         friend WiredTigerSizeStorer;
+
+        static constexpr size_t kNumStripes = 8;
+
+        struct Stripe {
+            AtomicWord<long long> numRecords;
+            AtomicWord<long long> dataSize;
+        };
+
+        std::array<CacheExclusive<Stripe>, kNumStripes> _stripes;
+
         AtomicWord<bool> _dirty;
     };
 
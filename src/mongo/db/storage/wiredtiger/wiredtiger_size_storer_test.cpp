@@ -27,9 +27,11 @@
  *    it in the license file.
  */
 
+#include <vector>
 #include <wiredtiger.h>
 
 #include "mongo/db/service_context_test_fixture.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
 #include "mongo/unittest/assert.h"
@@ -65,28 +67,28 @@ TEST_F(WiredTigerSizeStorerTest, Store) {
     auto loaded = sizeStorer1.load(uri);
     ASSERT(loaded);
     ASSERT_EQ(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     loaded = sizeStorer2.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer1.flush(false);
 
     loaded = sizeStorer1.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     loaded = sizeStorer2.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 }
 
 TEST_F(WiredTigerSizeStorerTest, RemoveBeforeFlush) {
@@ -99,24 +101,24 @@ TEST_F(WiredTigerSizeStorerTest, RemoveBeforeFlush) {
     auto loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_EQ(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     sizeStorer.remove(uri);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer.flush(false);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 }
 
 TEST_F(WiredTigerSizeStorerTest, RemoveAfterFlush) {
@@ -130,24 +132,24 @@ TEST_F(WiredTigerSizeStorerTest, RemoveAfterFlush) {
     auto loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     sizeStorer.remove(uri);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer.flush(false);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 }
 
 TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
@@ -160,24 +162,53 @@ TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
     auto loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer.store(uri, sizeInfo);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_EQ(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     sizeStorer.flush(false);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
+}
+
+TEST_F(WiredTigerSizeStorerTest, StripedCountersSumAcrossThreads) {
+    WiredTigerSizeStorer::SizeInfo sizeInfo;
+
+    constexpr int kThreads = 4;
+    constexpr int kAddsPerThread = 1000;
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kAddsPerThread; ++j)
+                sizeInfo.add(1, 10);
+        });
+    }
+    for (auto&& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(sizeInfo.numRecords(), kThreads * kAddsPerThread);
+    ASSERT_EQ(sizeInfo.dataSize(), kThreads * kAddsPerThread * 10);
+
+    // Setting an authoritative count discards the striped adjustments.
+    sizeInfo.setNumRecords(42);
+    sizeInfo.setDataSize(420);
+    ASSERT_EQ(sizeInfo.numRecords(), 42);
+    ASSERT_EQ(sizeInfo.dataSize(), 420);
+
+    sizeInfo.add(-2, -20);
+    ASSERT_EQ(sizeInfo.numRecords(), 40);
+    ASSERT_EQ(sizeInfo.dataSize(), 400);
 }
 
 }  // namespace
@@ -110,7 +110,7 @@ TEST(WiredTigerRecordStoreTest, SizeStorer1) {
 
     {
         auto& info = *ss.load(uri);
-        ASSERT_EQUALS(N, info.numRecords.load());
+        ASSERT_EQUALS(N, info.numRecords());
     }
 
     {
@@ -161,7 +161,7 @@ TEST(WiredTigerRecordStoreTest, SizeStorer1) {
     {
         WiredTigerSizeStorer ss2(harnessHelper->conn(), indexUri);
         auto info = ss2.load(uri);
-        ASSERT_EQUALS(N, info->numRecords.load());
+        ASSERT_EQUALS(N, info->numRecords());
     }
 
     rs.reset(nullptr);  // this has to be deleted before ss
@@ -188,11 +188,11 @@ private:
 
 protected:
     long long getNumRecords() const {
-        return sizeStorer->load(uri)->numRecords.load();
+        return sizeStorer->load(uri)->numRecords();
     }
 
     long long getDataSize() const {
-        return sizeStorer->load(uri)->dataSize.load();
+        return sizeStorer->load(uri)->dataSize();
     }
 
     std::unique_ptr<WiredTigerHarnessHelper> harnessHelper;
@@ -50,6 +50,14 @@ class OperationContext;
  * with the RecoveryUnit and executes them on commit/abort without opening any unit of work on the
  * RecoveryUnit. This can be used to unify code that performs in-memory writes using the callback
  * functionality of the RecoveryUnit.
+ *
+ * A unit of work always belongs to exactly one OperationContext; there is no mechanism for
+ * coalescing writes from different operations into a shared storage transaction. The storage
+ * transaction is owned by the operation's RecoveryUnit, its oplog slots and commit timestamp are
+ * scoped to that transaction, and an abort must roll back only that operation's writes. Commit
+ * overhead is instead amortized elsewhere: the journal flusher groups durability waits from many
+ * committed transactions into one journal flush, and a single operation applying many writes may
+ * group them into one unit of work (see OplogEntryGroupType).
  */
 class WriteUnitOfWork {
     WriteUnitOfWork(const WriteUnitOfWork&) = delete;
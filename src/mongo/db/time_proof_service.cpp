@@ -28,12 +28,11 @@
  */
 
 #include <array>
-#include <boost/none.hpp>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 
 #include <boost/move/utility_core.hpp>
-#include <boost/optional/optional.hpp>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
@@ -59,20 +58,30 @@ TimeProofService::Key TimeProofService::generateRandomKey() {
 }
 
 TimeProofService::TimeProof TimeProofService::getProof(LogicalTime time, const Key& key) {
-    stdx::lock_guard<Latch> lk(_cacheMutex);
     auto timeCeil = LogicalTime(Timestamp(time.asTimestamp().asULL() | kRangeMask));
+
+    // The vast majority of calls are satisfied by the cached proof, so read it lock-free.
+    if (auto cache = std::atomic_load(&_cache);  // NOLINT
+        cache && cache->hasProof(timeCeil, key)) {
+        return cache->_proof;
+    }
+
+    // Compute the HMAC inside the mutex to prevent multiple threads computing it for the same
+    // cluster time.
+    stdx::lock_guard<Latch> lk(_cacheMutex);
     if (_cache && _cache->hasProof(timeCeil, key)) {
         return _cache->_proof;
     }
 
     auto unsignedTimeArray = timeCeil.toUnsignedArray();
     // update cache
-    _cache =
-        CacheEntry(SHA1Block::computeHmac(
-                       key.data(), key.size(), unsignedTimeArray.data(), unsignedTimeArray.size()),
-                   timeCeil,
-                   key);
-    return _cache->_proof;
+    auto newCache = std::make_shared<const CacheEntry>(
+        SHA1Block::computeHmac(
+            key.data(), key.size(), unsignedTimeArray.data(), unsignedTimeArray.size()),
+        timeCeil,
+        key);
+    std::atomic_store(&_cache, std::shared_ptr<const CacheEntry>(newCache));  // NOLINT
+    return newCache->_proof;
 }
 
 Status TimeProofService::checkProof(LogicalTime time, const TimeProof& proof, const Key& key) {
@@ -85,9 +94,7 @@ Status TimeProofService::checkProof(LogicalTime time, const TimeProof& proof, co
 
 void TimeProofService::resetCache() {
     stdx::lock_guard<Latch> lk(_cacheMutex);
-    if (_cache) {
-        _cache = boost::none;
-    }
+    std::atomic_store(&_cache, std::shared_ptr<const CacheEntry>());  // NOLINT
 }
 
 }  // namespace mongo
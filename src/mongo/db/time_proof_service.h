@@ -30,7 +30,7 @@
 #pragma once
 
 #include <boost/move/utility_core.hpp>
-#include <boost/optional/optional.hpp>
+#include <memory>
 #include <utility>
 
 #include "mongo/base/status.h"
@@ -94,11 +94,11 @@ private:
         Key _key;
     };
 
-    // protects _cache
+    // Serializes writers of '_cache' so concurrent misses compute the HMAC only once.
     Mutex _cacheMutex = MONGO_MAKE_LATCH("TimeProofService::_cacheMutex");
 
-    // one-entry cache
-    boost::optional<CacheEntry> _cache;
+    // One-entry cache, read lock-free via the std::atomic_load/std::atomic_store free functions.
+    std::shared_ptr<const CacheEntry> _cache;
 };
 
 }  // namespace mongo
@@ -71,6 +71,7 @@
 #include "mongo/db/views/view.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/platform/rwmutex.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/hierarchical_acquisition.h"
@@ -214,8 +215,10 @@ public:
 
     // Per-namespace execution stats. This map is protected by 'mutex'. Once you complete your
     // lookup, you can keep the shared_ptr to an individual namespace's stats object and release the
-    // lock. The object itself is thread-safe (using atomics).
-    mutable Mutex mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "BucketCatalog::mutex");
+    // lock. The object itself is thread-safe (using atomics). The map only gains an entry the
+    // first time a collection is written to, so lookups on the insert hot path take the shared
+    // mode of this read-optimized mutex and do not serialize against each other.
+    mutable WriteRarelyRWMutex mutex;
     tracked_unordered_map<UUID, shared_tracked_ptr<ExecutionStats>> executionStats;
 
     // Global execution stats used to report aggregated metrics in server status.
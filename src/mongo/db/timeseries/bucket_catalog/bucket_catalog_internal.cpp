@@ -52,7 +52,6 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsontypes.h"
-#include "mongo/bson/util/bsoncolumn.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/concurrency/exception_util.h"
@@ -482,8 +481,14 @@ StatusWith<unique_tracked_ptr<Bucket>> rehydrateBucket(OperationContext* opCtx,
     const BSONElement timeColumnElem = dataObj.getField(options.getTimeField());
 
     if (isCompressed && timeColumnElem.type() == BSONType::BinData) {
-        BSONColumn storage{timeColumnElem};
-        numMeasurements = storage.size();
+        // Compressed buckets store the measurement count in the control block, so we don't need to
+        // decompress the time column just to count its elements.
+        auto countElem = controlField.getField(kBucketControlCountFieldName);
+        if (!countElem.isNumber()) {
+            return {ErrorCodes::BadValue,
+                    "Bucket control field is malformed (missing a valid count)"};
+        }
+        numMeasurements = static_cast<uint32_t>(countElem.numberLong());
     } else if (timeColumnElem.isABSONObj()) {
         numMeasurements = timeColumnElem.Obj().nFields();
     } else {
@@ -1330,7 +1335,18 @@ std::pair<RolloverAction, RolloverReason> determineRolloverAction(
 
 ExecutionStatsController getOrInitializeExecutionStats(BucketCatalog& catalog,
                                                        const UUID& collectionUUID) {
-    stdx::lock_guard catalogLock{catalog.mutex};
+    // The stats for a collection are created at most once, so the common case only needs the
+    // shared lock.
+    {
+        auto catalogLock = catalog.mutex.readLock();
+        auto it = catalog.executionStats.find(collectionUUID);
+        if (it != catalog.executionStats.end()) {
+            return {it->second, catalog.globalExecutionStats};
+        }
+    }
+
+    auto catalogLock = catalog.mutex.writeLock();
+    // Another thread may have initialized the stats while the lock was released.
     auto it = catalog.executionStats.find(collectionUUID);
     if (it != catalog.executionStats.end()) {
         return {it->second, catalog.globalExecutionStats};
@@ -1347,7 +1363,7 @@ shared_tracked_ptr<ExecutionStats> getExecutionStats(const BucketCatalog& catalo
                                                      const UUID& collectionUUID) {
     static const auto kEmptyStats{std::make_shared<ExecutionStats>()};
 
-    stdx::lock_guard catalogLock{catalog.mutex};
+    auto catalogLock = catalog.mutex.readLock();
 
     auto it = catalog.executionStats.find(collectionUUID);
     if (it != catalog.executionStats.end()) {
@@ -1358,7 +1374,7 @@ shared_tracked_ptr<ExecutionStats> getExecutionStats(const BucketCatalog& catalo
 
 std::pair<UUID, shared_tracked_ptr<ExecutionStats>> getSideBucketCatalogCollectionStats(
     BucketCatalog& sideBucketCatalog) {
-    stdx::lock_guard catalogLock{sideBucketCatalog.mutex};
+    auto catalogLock = sideBucketCatalog.mutex.readLock();
     invariant(sideBucketCatalog.executionStats.size() == 1);
     return *sideBucketCatalog.executionStats.begin();
 }
@@ -81,7 +81,7 @@ public:
     BSONObj generateSection(OperationContext* opCtx, const BSONElement&) const override {
         const auto& bucketCatalog = BucketCatalog::get(opCtx);
         {
-            stdx::lock_guard catalogLock{bucketCatalog.mutex};
+            auto catalogLock = bucketCatalog.mutex.readLock();
             if (bucketCatalog.executionStats.empty()) {
                 return {};
             }
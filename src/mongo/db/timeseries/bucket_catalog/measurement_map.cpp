@@ -113,7 +113,14 @@ void MeasurementMap::_insertNewKey(StringData key,
                           std::move(builder));
 }
 
-void MeasurementMap::_fillSkipsInMissingFields(const std::set<StringData>& fieldsSeen) {
+void MeasurementMap::_fillSkipsInMissingFields(const StringDataSet& fieldsSeen) {
+    // Every field seen in this measurement has a builder, so if the counts match there is no
+    // missing field to fill in. This is the common case for metrics workloads where all
+    // measurements carry the same fields.
+    if (fieldsSeen.size() == _builders.size()) {
+        return;
+    }
+
     // Fill in skips for any fields that existed in prior measurements in this bucket, but
     // weren't in this measurement.
     for (auto& entry : _builders) {
@@ -125,7 +132,7 @@ void MeasurementMap::_fillSkipsInMissingFields(const std::set<StringData>& field
 }
 
 void MeasurementMap::insertOne(const std::vector<BSONElement>& oneMeasurementDataFields) {
-    std::set<StringData> fieldsSeen;
+    StringDataSet fieldsSeen;
 
     for (const auto& elem : oneMeasurementDataFields) {
         StringData key = elem.fieldNameStringData();
@@ -35,6 +35,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/util/bsoncolumnbuilder.h"
+#include "mongo/util/string_map.h"
 #include "mongo/util/tracked_types.h"
 #include "mongo/util/tracking_context.h"
 
@@ -87,7 +88,7 @@ private:
      * Inserts skips where needed to all builders. Must be called after inserting one measurement.
      * Cannot call this after multiple measurements have been inserted.
      */
-    void _fillSkipsInMissingFields(const std::set<StringData>& fieldsSeen);
+    void _fillSkipsInMissingFields(const StringDataSet& fieldsSeen);
 
     void _insertNewKey(StringData key,
                        const BSONElement& elem,
@@ -535,6 +535,14 @@ void updateSessionEntry(OperationContext* opCtx,
 
     auto originalDoc = originalRecordData.releaseToBson();
 
+    if (doc.binaryEqual(originalDoc)) {
+        // The update would round-trip the record to its current state, which can happen when
+        // session history is re-written during a retried migration or resharding step. There is
+        // nothing to persist, so skip the record store write entirely.
+        wuow.commit();
+        return;
+    }
+
     const auto parentLsidFieldName = SessionTxnRecord::kParentSessionIdFieldName;
     uassert(
         5875700,
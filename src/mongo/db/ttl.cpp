@@ -773,6 +773,14 @@ bool TTLMonitor::_deleteExpiredWithIndex(OperationContext* opCtx,
     // BatchedDeleteStageStats from a non-batched delete.
     const bool batchingEnabled = isBatchingEnabled(collection.getCollectionPtr());
 
+    auto batchedDeleteParams = getBatchedDeleteStageParams(batchingEnabled);
+    if (batchedDeleteParams) {
+        // The index scan produces documents in TTL-key order, which is uncorrelated with their
+        // location in the record store. Applying each batch in RecordId order improves cache
+        // locality. The clustered collection path scans in RecordId order already.
+        batchedDeleteParams->sortStagedDocsByRecordId = true;
+    }
+
     Timer timer;
     auto exec = InternalPlanner::deleteWithIndexScan(opCtx,
                                                      collection,
@@ -783,7 +791,7 @@ bool TTLMonitor::_deleteExpiredWithIndex(OperationContext* opCtx,
                                                      BoundInclusion::kIncludeBothStartAndEndKeys,
                                                      PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
                                                      direction,
-                                                     getBatchedDeleteStageParams(batchingEnabled));
+                                                     std::move(batchedDeleteParams));
 
     try {
         const auto numDeleted = exec->executeDelete();
@@ -29,6 +29,7 @@
 
 #include "mongo/db/update/update_util.h"
 
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <cstddef>
 #include <map>
@@ -128,7 +129,11 @@ void produceDocumentForUpsert(OperationContext* opCtx,
             *cq->getPrimaryMatchExpression(), immutablePaths, doc));
     } else {
         fassert(17354, CanonicalQuery::isSimpleIdQuery(request->getQuery()));
-        fassert(17352, doc.root().appendElement(request->getQuery()[idFieldName]));
+        // Rewrap the equality value so that the {_id: {$eq: <value>}} operator form of a simple
+        // _id query contributes {_id: <value>} rather than its $eq wrapper.
+        BSONObj idValue =
+            CanonicalQuery::simpleIdQueryValue(request->getQuery()).wrap(idFieldName);
+        fassert(17352, doc.root().appendElement(idValue.firstElement()));
     }
 
     // Second: run the appropriate document generation strategy over the document to generate the
@@ -171,6 +176,49 @@ void ensureIdFieldIsFirst(mutablebson::Document* doc, bool generateOIDIfMissing)
     }
 }
 
+boost::optional<doc_diff::DamagesOutput> computeDamagesForUpdate(
+    const CollectionPtr& collection,
+    const BSONObj& preImage,
+    const BSONObj& diff,
+    int postImageSize,
+    bool mustCheckExistenceForInsertOperations) {
+    // Each damage event carries fixed per-entry overhead in the storage engine (a WT_MODIFY entry
+    // in WiredTiger), so updates that shred the document into many small ranges are written as
+    // full documents instead.
+    constexpr size_t kMaxDamageEvents = 64;
+
+    if (!collection->updateWithDamagesSupported()) {
+        return boost::none;
+    }
+
+    // Capped collections reject size-changing updates, and collections with encrypted fields
+    // validate safe content against the full post-image; both take the full-document path. Note
+    // that the same-size in-place path predates these concerns: it cannot change the document's
+    // size or its _id.
+    if (collection->isCapped() || collection->getCollectionOptions().encryptedFieldConfig) {
+        return boost::none;
+    }
+
+    auto damagesOutput =
+        doc_diff::computeDamages(preImage, diff, mustCheckExistenceForInsertOperations);
+    if (damagesOutput.damages.empty() || damagesOutput.damages.size() > kMaxDamageEvents) {
+        return boost::none;
+    }
+
+    // A partial write only pays off while the changed ranges are a small fraction of the
+    // document; past that point a plain full-document write journals less than the modify
+    // structures would.
+    size_t damageBytes = 0;
+    for (const auto& event : damagesOutput.damages) {
+        damageBytes += std::max(event.sourceSize, event.targetSize);
+    }
+    if (damageBytes >= static_cast<size_t>(postImageSize) / 2) {
+        return boost::none;
+    }
+
+    return damagesOutput;
+}
+
 void makeUpdateRequest(OperationContext* opCtx,
                        const write_ops::FindAndModifyCommandRequest& request,
                        boost::optional<ExplainOptions::Verbosity> explain,
@@ -30,12 +30,14 @@
 #include <boost/optional/optional.hpp>
 
 #include "mongo/bson/mutable/document.h"
+#include "mongo/db/catalog/collection.h"
 #include "mongo/db/field_ref_set.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/ops/update_request.h"
 #include "mongo/db/ops/write_ops_gen.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/explain_options.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/update_driver.h"
 #include "mongo/util/safe_num.h"
 
@@ -71,6 +73,20 @@ void produceDocumentForUpsert(OperationContext* opCtx,
 void ensureIdFieldIsFirst(mutablebson::Document* doc, bool generateOIDIfMissing);
 void assertPathsNotArray(const mutablebson::Document& document, const FieldRefSet& paths);
 
+/**
+ * Computes the byte-range damages equivalent to applying 'diff' to 'preImage' when writing them
+ * through the storage engine's partial-update API is expected to be cheaper than rewriting the
+ * whole document. Returns boost::none when the collection cannot accept partial updates (no
+ * storage support, capped, or encrypted fields) or when the changed ranges are too large or too
+ * fragmented for a partial write to pay off; the caller then performs a full-document update.
+ */
+boost::optional<doc_diff::DamagesOutput> computeDamagesForUpdate(
+    const CollectionPtr& collection,
+    const BSONObj& preImage,
+    const BSONObj& diff,
+    int postImageSize,
+    bool mustCheckExistenceForInsertOperations);
+
 /**
  * Parse FindAndModify update command request into an updateRequest.
  */
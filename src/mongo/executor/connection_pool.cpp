@@ -189,12 +189,33 @@ public:
         const auto minConns = getPool()->_options.minConnections;
         const auto maxConns = getPool()->_options.maxConnections;
 
-        data.target = stats.requests + stats.active + stats.leased;
-        if (data.target < minConns) {
-            data.target = minConns;
-        } else if (data.target > maxConns) {
-            data.target = maxConns;
+        size_t target = stats.requests + stats.active + stats.leased;
+        if (const auto decayPeriod = getPool()->_options.demandDecayPeriod;
+            decayPeriod > Milliseconds{0}) {
+            // Hold the target at a learned peak of recent demand that decays with a time constant
+            // of roughly 'demandDecayPeriod', so the pool stays warm after a burst and shrinks
+            // smoothly rather than releasing its connections all at once.
+            const auto now = getPool()->_factory->now();
+            const auto elapsed = std::max(Milliseconds{0}, now - data.peakTime);
+            const auto remaining = 1.0 -
+                durationCount<Milliseconds>(elapsed) /
+                    static_cast<double>(durationCount<Milliseconds>(decayPeriod));
+            const auto decayedPeak = data.peakDemand * std::max(0.0, remaining);
+            data.peakTime = now;
+            if (target >= decayedPeak) {
+                data.peakDemand = target;
+            } else {
+                data.peakDemand = decayedPeak;
+                target = static_cast<size_t>(decayedPeak);
+            }
+        }
+
+        if (target < minConns) {
+            target = minConns;
+        } else if (target > maxConns) {
+            target = maxConns;
         }
+        data.target = target;
 
         return {{data.host}, stats.health.isExpired};
     }
@@ -233,6 +254,11 @@ protected:
     struct PoolData {
         HostAndPort host;
         size_t target = 0;
+
+        // Learned peak of recent demand and when it was last updated; only used when the pool's
+        // 'demandDecayPeriod' option is non-zero.
+        double peakDemand = 0;
+        Date_t peakTime;
     };
 
     Mutex _mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "LimitController::_mutex");
@@ -157,6 +157,15 @@ public:
          */
         Milliseconds hostTimeout = kDefaultHostTimeout;
 
+        /**
+         * Amount of time over which the learned peak of a host's connection demand decays back
+         * to zero. While non-zero, the controller holds the connection target at the decayed
+         * peak rather than at instantaneous demand, so a pool stays warm after a burst and
+         * shrinks smoothly instead of dropping connections all at once. Zero (the default)
+         * preserves pure demand-driven sizing.
+         */
+        Milliseconds demandDecayPeriod{0};
+
         /**
          * An egress tag closer manager which will provide global access to this connection pool.
          * The manager set's tags and potentially drops connections that don't match those tags.
@@ -414,6 +414,63 @@ TEST_F(ConnectionPoolTest, ConnectionsNotUsedRecentlyArePurged) {
     ASSERT_EQ(pool->getNumConnectionsPerHost(HostAndPort()), kSize / 4);
 }
 
+/**
+ * Verify that a non-zero demandDecayPeriod holds connections above instantaneous demand after a
+ * burst, instead of letting all but minConnections lapse at the first refresh deadline.
+ */
+TEST_F(ConnectionPoolTest, DemandDecayKeepsPoolWarmAfterBurst) {
+    ConnectionPool::Options options;
+    options.minConnections = 1;
+    options.refreshRequirement = Milliseconds(1000);
+    options.refreshTimeout = Milliseconds(5000);
+    options.hostTimeout = Minutes(1);
+    options.demandDecayPeriod = Seconds(4);
+    auto pool = makePool(options);
+
+    auto now = Date_t::now();
+    PoolImpl::setNow(now);
+
+    // Check out a burst of connections, then return them all.
+    constexpr size_t kBurst = 4;
+    std::vector<ConnectionPool::ConnectionHandle> connections;
+    std::vector<unittest::ThreadAssertionMonitor> monitors(kBurst);
+    for (size_t i = 0; i != kBurst; ++i) {
+        ConnectionImpl::pushSetup(Status::OK());
+        pool->get_forTest(HostAndPort(),
+                          Milliseconds(5000),
+                          [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                              monitors[i].exec([&]() {
+                                  ASSERT(swConn.isOK());
+                                  connections.push_back(std::move(swConn.getValue()));
+                                  monitors[i].notifyDone();
+                              });
+                          });
+    }
+    for (auto& monitor : monitors) {
+        monitor.wait();
+    }
+    ASSERT_EQ(pool->getNumConnectionsPerHost(HostAndPort()), kBurst);
+
+    while (!connections.empty()) {
+        ConnectionPool::ConnectionHandle conn = std::move(connections.back());
+        connections.pop_back();
+        doneWith(conn);
+    }
+
+    // Allow any connections the controller decides to keep to complete their refreshes.
+    for (size_t i = 0; i != kBurst; ++i) {
+        ConnectionImpl::pushRefresh(Status::OK());
+    }
+
+    // At the first refresh deadline the decayed demand peak is still most of the burst, so the
+    // pool must hold connections above minConnections. Without the decay hold, every connection
+    // would lapse here since demand is zero.
+    PoolImpl::setNow(now + Milliseconds(1000));
+    auto held = pool->getNumConnectionsPerHost(HostAndPort());
+    ASSERT_GT(held, options.minConnections);
+    ASSERT_LTE(held, kBurst);
+}
+
 /**
  * Verify that a failed connection isn't returned to the pool
  */
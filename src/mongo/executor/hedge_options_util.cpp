@@ -102,6 +102,7 @@ HedgeOptions getHedgeOptions(StringData command, const ReadPreferenceSetting& re
     bool shouldHedge = commandShouldHedge(command, readPref);
     size_t hedgeCount = shouldHedge ? 1 : 0;
     int maxTimeMSForHedgedReads = shouldHedge ? gMaxTimeMSForHedgedReads.load() : 0;
-    return {shouldHedge, hedgeCount, maxTimeMSForHedgedReads};
+    int hedgingDelayMS = shouldHedge ? gHedgingDelayMS.load() : 0;
+    return {shouldHedge, hedgeCount, maxTimeMSForHedgedReads, hedgingDelayMS};
 }
 }  // namespace mongo
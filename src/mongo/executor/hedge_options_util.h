@@ -50,12 +50,15 @@ extern FailPoint hedgedReadsSendRequestsToTargetHostsInAlphabeticalOrder;
  *      (2) How many hedged operations should be sent, in *addition* to the non-hedged/authoriative
  *          request (`hedgeCount`)
  *      (3) The maxTimeMS each hedge should be executed with (`maxTimeMSForHedgedReads`)
+ *      (4) How long to wait before dispatching each hedge, so a fast authoritative response
+ *          suppresses the hedge entirely (`hedgingDelayMS`)
  *      clang-format on
  */
 struct HedgeOptions {
     bool isHedgeEnabled = false;
     size_t hedgeCount = 0;
     int maxTimeMSForHedgedReads = 0;
+    int hedgingDelayMS = 0;
 };
 
 /**
@@ -78,7 +78,8 @@ protected:
                            const BSONObj& cmdObj,
                            const BSONObj& rspObj,
                            const bool hedge,
-                           const int maxTimeMSForHedgedReads = kMaxTimeMSForHedgedReadsDefault) {
+                           const int maxTimeMSForHedgedReads = kMaxTimeMSForHedgedReadsDefault,
+                           const int hedgingDelayMS = kHedgingDelayMSDefault) {
         setParameters(serverParameters);
 
         auto readPref = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(rspObj));
@@ -87,6 +88,7 @@ protected:
         ASSERT_EQ(hedge, options.isHedgeEnabled);
         if (hedge) {
             ASSERT_EQ(options.maxTimeMSForHedgedReads, maxTimeMSForHedgedReads);
+            ASSERT_EQ(options.hedgingDelayMS, hedgingDelayMS);
         }
     }
 
@@ -97,10 +99,13 @@ protected:
     static inline const std::string kReadHedgingModeFieldName = "readHedgingMode";
     static inline const std::string kMaxTimeMSForHedgedReadsFieldName = "maxTimeMSForHedgedReads";
     static inline const int kMaxTimeMSForHedgedReadsDefault = 10;
+    static inline const std::string kHedgingDelayMSFieldName = "hedgingDelayMS";
+    static inline const int kHedgingDelayMSDefault = 0;
 
     static inline const BSONObj kDefaultParameters =
         BSON(kReadHedgingModeFieldName << "on" << kMaxTimeMSForHedgedReadsFieldName
-                                       << kMaxTimeMSForHedgedReadsDefault);
+                                       << kMaxTimeMSForHedgedReadsDefault << kHedgingDelayMSFieldName
+                                       << kHedgingDelayMSDefault);
 
 private:
     ServiceContext::UniqueServiceContext _serviceCtx = ServiceContext::make();
@@ -196,6 +201,17 @@ TEST_F(HedgeOptionsUtilTestFixture, MaxTimeMSForHedgedReads) {
     checkHedgeOptions(parameters, cmdObj, rspObj, true, 100);
 }
 
+TEST_F(HedgeOptionsUtilTestFixture, HedgingDelayMS) {
+    const auto parameters =
+        BSON(kReadHedgingModeFieldName << "on" << kHedgingDelayMSFieldName << 25);
+    const auto cmdObj = BSON("find" << kCollName);
+    const auto rspObj = BSON("mode"
+                             << "nearest"
+                             << "hedge" << BSONObj());
+
+    checkHedgeOptions(parameters, cmdObj, rspObj, true, kMaxTimeMSForHedgedReadsDefault, 25);
+}
+
 TEST(HedgeOptionsUtilTest, HostAndPortSorting) {
     struct Spec {
         HostAndPort a;
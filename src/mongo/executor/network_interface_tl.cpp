@@ -690,6 +690,35 @@ Status NetworkInterfaceTL::startCommand(const TaskExecutor::CallbackHandle& cbHa
 
     // Attempt to get a connection to every target host
     for (size_t idx = 0; idx < request.target.size(); ++idx) {
+        // Give the authoritative request a head start over the hedges by deferring connection
+        // acquisition for the remaining targets, so a fast authoritative response suppresses the
+        // hedged requests entirely. The failpoint bypasses the delay since tests that force the
+        // target order rely on every request being dispatched.
+        if (idx > 0 && request.options.hedgeOptions.hedgingDelayMS > 0 &&
+            !targetHostsInAlphabeticalOrder) {
+            invariant(request.options.hedgeOptions.isHedgeEnabled);
+            auto timer = _reactor->makeTimer();
+            auto deadline = now() + Milliseconds(request.options.hedgeOptions.hedgingDelayMS);
+            timer->waitUntil(deadline, baton)
+                .getAsync([this, cmdState = cmdState, idx, timer = std::move(timer)](Status) {
+                    // The timer status is intentionally ignored: even if the wait was cut short,
+                    // the hedged request must still be resolved so the accounting in trySend() can
+                    // fulfill the promise once every connection attempt has finished.
+                    if (cmdState->promiseFulfilling.load()) {
+                        // The authoritative response arrived within the hedging delay, so this
+                        // hedged request never needs to be sent.
+                        return;
+                    }
+                    const auto& requestOnAny = cmdState->requestOnAny;
+                    _pool->get(requestOnAny.target[idx], requestOnAny.sslMode, requestOnAny.timeout)
+                        .thenRunOn(_reactor)
+                        .getAsync([cmdState, idx](auto swConn) {
+                            cmdState->requestManager->trySend(std::move(swConn), idx);
+                        });
+                });
+            continue;
+        }
+
         auto connFuture = _pool->get(request.target[idx], request.sslMode, request.timeout);
 
         // If connection future is ready or requests should be sent in order, send the request
@@ -135,14 +135,6 @@ std::vector<std::shared_ptr<ChunkInfo>> flatten(const std::vector<ChunkType>& ch
 
 }  // namespace
 
-size_t ChunkMap::size() const {
-    size_t totalChunks{0};
-    for (const auto& mapIt : _chunkVectorMap) {
-        totalChunks += mapIt.second->size();
-    }
-    return totalChunks;
-}
-
 std::shared_ptr<ChunkInfo> ChunkMap::findIntersectingChunk(const BSONObj& shardKey) const {
     const auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
 
@@ -183,6 +175,8 @@ void ChunkMap::_commitUpdatedChunkVector(std::shared_ptr<ChunkVector>&& chunkVec
 
     invariant(!chunkVectorPtr->empty());
 
+    _size += chunkVectorPtr->size();
+
     const auto& vectorMaxKeyString = chunkVectorPtr->back()->getMaxKeyString();
     const auto nextMapIt = _chunkVectorMap.lower_bound(vectorMaxKeyString);
 
@@ -461,6 +455,7 @@ ChunkMap ChunkMap::_makeUpdated(ChunkVector&& updateChunks) const {
             } else {
                 // drained all chunks from old vector in use,
                 // remove old vector from the new map since we are going to replace it.
+                newMap._size -= mapIt->second->size();
                 auto followingMapIt = newMap._chunkVectorMap.erase(mapIt);
 
                 // Advance the map iterator to the next old vector to update
@@ -92,6 +92,12 @@ using ShardPlacementVersionMap =
  * This class serves as a Facade around how the mapping of ranges to chunks is represented. It also
  * provides a simpler, high-level interface for domain specific operations without exposing the
  * underlying implementation.
+ *
+ * Chunks are stored in vectors of at most '_maxChunkVectorSize' elements, ordered by max key and
+ * indexed by an ordered map keyed on the max key of the last chunk of each vector. The vectors are
+ * immutable once published and shared between ChunkMap instances, so an incremental refresh of K
+ * changed chunks only rebuilds the vectors the changes intersect and shares the rest with the
+ * previous routing table by pointer, rather than rebuilding the whole map.
  */
 class ChunkMap {
 public:
@@ -103,7 +109,9 @@ public:
         : _collectionPlacementVersion({epoch, timestamp}, {0, 0}),
           _maxChunkVectorSize(chunkVectorSize) {}
 
-    size_t size() const;
+    size_t size() const {
+        return _size;
+    }
 
     // Max version across all chunks
     ChunkVersion getVersion() const {
@@ -247,6 +255,10 @@ private:
 
     ChunkVectorMap _chunkVectorMap;
 
+    // Total number of chunks across all vectors of _chunkVectorMap, cached so size() does not need
+    // to walk every vector.
+    size_t _size{0};
+
     // Max version across all chunks
     ChunkVersion _collectionPlacementVersion;
 
@@ -245,6 +245,14 @@ ShardRegistry::Cache::LookupResult ShardRegistry::_lookup(OperationContext* opCt
                 "Finished ShardRegistry::_lookup",
                 "returnData"_attr = returnData.toBSON(),
                 "returnTime"_attr = returnTime);
+
+    // Publish the new data for the lock-free getShard() fast path. Readers validate the snapshot
+    // time themselves, so it is harmless that this happens before the cache installs the value.
+    std::atomic_store(  // NOLINT
+        &_latestSnapshot,
+        std::make_shared<const Snapshot>(std::make_shared<const ShardRegistryData>(returnData),
+                                         returnTime));
+
     return Cache::LookupResult{returnData, returnTime};
 }
 
@@ -264,8 +272,12 @@ void ShardRegistry::startupPeriodicReloader(OperationContext* opCtx) {
     _executor->startup();
 
     AsyncTry([this] {
-        LOGV2_DEBUG(22726, 1, "Reloading shardRegistry");
-        return _reloadAsync();
+        LOGV2_DEBUG(22726, 1, "Refreshing shardRegistry");
+        // Advance the cache to the gossiped topology time and refresh only if it is stale. The
+        // topology time is incremented on every topology change and gossiped on every cluster
+        // response, so when it has not moved the cached registry is known to be current and no
+        // config server round trip is needed. Explicit reload() callers still force a lookup.
+        return _getDataAsync();
     })
         .until([](auto&& sw) {
             if (!sw.isOK()) {
@@ -320,8 +332,34 @@ std::shared_ptr<Shard> ShardRegistry::getConfigShard() const {
     return std::make_shared<ConfigShardWrapper>(configShard);
 }
 
+std::shared_ptr<Shard> ShardRegistry::_fastFindShard(const ShardId& shardId) const {
+    const auto snapshot = std::atomic_load(&_latestSnapshot);  // NOLINT
+    if (!snapshot) {
+        return nullptr;
+    }
+
+    // The snapshot is usable only if the cache would consider it current, ie. if no refresh
+    // criterion has advanced past its time. This is the same staleness predicate that
+    // advanceTimeInStore() applies to the cached value.
+    const auto now = VectorClock::get(_service)->getTime();
+    const Time requiredTime(now.topologyTime().asTimestamp(),
+                            _rsmIncrement.load(),
+                            _forceReloadIncrement.load());
+    if (requiredTime > snapshot->time) {
+        return nullptr;
+    }
+
+    return snapshot->data->findShard(shardId);
+}
+
 StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opCtx,
                                                            const ShardId& shardId) {
+    // Fast path: resolve against the latest published snapshot if it is already at the gossiped
+    // topology time, costing an atomic load and a map lookup rather than a cache acquisition.
+    if (auto shard = _fastFindShard(shardId)) {
+        return shard;
+    }
+
     // First check if this is a non config shard lookup
     // This call will may be blocking if there is an ongoing or a need of a cache rebuild
     if (auto shard = _getData(opCtx)->findShard(shardId)) {
@@ -347,6 +385,10 @@ StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opC
 
 SemiFuture<std::shared_ptr<Shard>> ShardRegistry::getShard(ExecutorPtr executor,
                                                            const ShardId& shardId) noexcept {
+    // Fast path, as in the synchronous getShard() above.
+    if (auto shard = _fastFindShard(shardId)) {
+        return SemiFuture<std::shared_ptr<Shard>>::makeReady(std::move(shard));
+    }
 
     // Fetch the shard registry data associated to the latest known topology time
     return _getDataAsync()
@@ -459,6 +459,18 @@ private:
 
     using Cache = ReadThroughCache<Singleton, ShardRegistryData, Time>;
 
+    /**
+     * Immutable (data, time) pair published by _lookup() and read lock-free by the getShard()
+     * fast path.
+     */
+    struct Snapshot {
+        Snapshot(std::shared_ptr<const ShardRegistryData> data, Time time)
+            : data(std::move(data)), time(std::move(time)) {}
+
+        std::shared_ptr<const ShardRegistryData> data;
+        Time time;
+    };
+
     Cache::LookupResult _lookup(OperationContext* opCtx,
                                 const Singleton& key,
                                 const Cache::ValueHandle& cachedData,
@@ -488,6 +500,14 @@ private:
      */
     Cache::ValueHandle _getCachedData() const;
 
+    /**
+     * Resolves a shard against the latest published snapshot without taking any locks. Returns
+     * nullptr if no snapshot has been published yet, if the snapshot is stale with respect to the
+     * gossiped topology time, or if the shard is simply not in it; the caller then falls back to
+     * the cache, which refreshes as needed.
+     */
+    std::shared_ptr<Shard> _fastFindShard(const ShardId& shardId) const;
+
     using LatestConnStrings = stdx::unordered_map<ShardId, ConnectionString, ShardId::Hasher>;
 
     std::pair<std::vector<LatestConnStrings::value_type>, Increment> _getLatestConnStrings() const;
@@ -528,6 +548,10 @@ private:
     mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("ShardRegistry::_cacheMutex");
     std::unique_ptr<Cache> _cache;
 
+    // Latest data produced by _lookup(), published for the lock-free read path. Accessed only via
+    // the std::atomic_load/std::atomic_store free functions.
+    std::shared_ptr<const Snapshot> _latestSnapshot;  // NOLINT
+
     // Counters for incrementing the rsmIncrement and forceReloadIncrement fields of the Time used
     // by the _cache.  See the comments for these fields in the Time class above for an explanation
     // of their purpose.
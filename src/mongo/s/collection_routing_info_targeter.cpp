@@ -78,6 +78,7 @@
 #include "mongo/s/shard_version.h"
 #include "mongo/s/sharding_feature_flags_gen.h"
 #include "mongo/s/sharding_index_catalog_cache.h"
+#include "mongo/s/timeseries_routing_cache.h"
 #include "mongo/s/type_collection_common_types_gen.h"
 #include "mongo/s/write_ops/batched_command_request.h"
 #include "mongo/util/assert_util.h"
@@ -427,38 +428,80 @@ ShardEndpoint CollectionRoutingInfoTargeter::targetInsert(OperationContext* opCt
     }
 
     // Collection is sharded
-    const BSONObj shardKey = [&]() {
-        const auto& shardKeyPattern = _cri.cm.getShardKeyPattern();
-        BSONObj shardKey;
-        if (shardKeyPattern.hasId()) {
-            uassert(ErrorCodes::InvalidIdField,
-                    "Document is missing _id field, which is part of the shard key pattern",
-                    doc.hasField("_id"));
-        }
-        if (_isRequestOnTimeseriesViewNamespace) {
-            auto tsFields = _cri.cm.getTimeseriesFields();
-            tassert(5743701, "Missing timeseriesFields on buckets collection", tsFields);
-            shardKey = extractBucketsShardKeyFromTimeseriesDoc(
-                doc, shardKeyPattern, tsFields->getTimeseriesOptions());
-        } else {
-            shardKey = shardKeyPattern.extractShardKeyFromDoc(doc);
-        }
+    const auto& shardKeyPattern = _cri.cm.getShardKeyPattern();
+    if (shardKeyPattern.hasId()) {
+        uassert(ErrorCodes::InvalidIdField,
+                "Document is missing _id field, which is part of the shard key pattern",
+                doc.hasField("_id"));
+    }
 
-        // The shard key would only be empty after extraction if we encountered an error case, such
-        // as the shard key possessing an array value or array descendants. If the shard key
-        // presented to the targeter was empty, we would emplace the missing fields, and the
-        // extracted key here would *not* be empty.
-        uassert(ErrorCodes::ShardKeyNotFound,
-                "Shard key cannot contain array values or array descendants.",
-                !shardKey.isEmpty());
-        return shardKey;
-    }();
+    if (_isRequestOnTimeseriesViewNamespace) {
+        auto tsFields = _cri.cm.getTimeseriesFields();
+        tassert(5743701, "Missing timeseriesFields on buckets collection", tsFields);
+        return _targetTimeseriesInsert(opCtx, doc, tsFields->getTimeseriesOptions(), chunkRanges);
+    }
+
+    BSONObj shardKey = shardKeyPattern.extractShardKeyFromDoc(doc);
 
+    // The shard key would only be empty after extraction if we encountered an error case, such
+    // as the shard key possessing an array value or array descendants. If the shard key
+    // presented to the targeter was empty, we would emplace the missing fields, and the
+    // extracted key here would *not* be empty.
+    uassert(ErrorCodes::ShardKeyNotFound,
+            "Shard key cannot contain array values or array descendants.",
+            !shardKey.isEmpty());
 
     // Target the shard key
     return uassertStatusOK(_targetShardKey(shardKey, CollationSpec::kSimpleSpec, chunkRanges));
 }
 
+ShardEndpoint CollectionRoutingInfoTargeter::_targetTimeseriesInsert(
+    OperationContext* opCtx,
+    const BSONObj& doc,
+    const TimeseriesOptions& timeseriesOptions,
+    std::set<ChunkRange>* chunkRanges) const {
+    const auto placementVersion = _cri.cm.getVersion();
+    auto& cache = TimeseriesRoutingCache::get(opCtx->getServiceContext());
+
+    // Probe the series-to-shard affinity cache. Two measurements with byte-identical metaField
+    // values and equal rounded timestamps extract the same buckets shard key, so under the same
+    // placement version the previous routing decision for the series can be reused as is. An
+    // invalid time field falls through to the extraction path, which reports the proper error.
+    boost::optional<TimeseriesRoutingCache::Key> cacheKey;
+    if (auto timeElement = doc.getField(timeseriesOptions.getTimeField());
+        !timeElement.eoo() && timeElement.type() == BSONType::Date) {
+        auto roundedTime =
+            timeseries::roundTimestampToGranularity(timeElement.date(), timeseriesOptions);
+        BSONElement metaElement;
+        if (auto metaField = timeseriesOptions.getMetaField()) {
+            metaElement = doc.getField(*metaField);
+        }
+        cacheKey = TimeseriesRoutingCache::makeKey(_nss, metaElement, roundedTime);
+        if (auto entry = cache.lookup(*cacheKey, placementVersion)) {
+            if (chunkRanges) {
+                chunkRanges->insert(entry->range);
+            }
+            return ShardEndpoint(
+                entry->shardId, _cri.getShardVersion(entry->shardId), boost::none);
+        }
+    }
+
+    auto shardKey = extractBucketsShardKeyFromTimeseriesDoc(
+        doc, _cri.cm.getShardKeyPattern(), timeseriesOptions);
+    uassert(ErrorCodes::ShardKeyNotFound,
+            "Shard key cannot contain array values or array descendants.",
+            !shardKey.isEmpty());
+
+    auto chunk = _cri.cm.findIntersectingChunkWithSimpleCollation(shardKey);
+    if (cacheKey) {
+        cache.insert(*cacheKey, {placementVersion, chunk.getShardId(), chunk.getRange()});
+    }
+    if (chunkRanges) {
+        chunkRanges->insert(chunk.getRange());
+    }
+    return ShardEndpoint(chunk.getShardId(), _cri.getShardVersion(chunk.getShardId()), boost::none);
+}
+
 bool CollectionRoutingInfoTargeter::isUpdateOneWithIdWithoutShardKeyEnabled() const {
     return _isUpdateOneWithIdWithoutShardKeyEnabled;
 }
@@ -261,6 +261,16 @@ private:
                                               const BSONObj& collation,
                                               std::set<ChunkRange>* chunkRanges) const;
 
+    /**
+     * Targets an insert translated from a time-series view namespace to the buckets collection.
+     * Consults the process-wide TimeseriesRoutingCache so repeat measurements for a hot series
+     * can skip shard key extraction and the chunk map lookup.
+     */
+    ShardEndpoint _targetTimeseriesInsert(OperationContext* opCtx,
+                                          const BSONObj& doc,
+                                          const TimeseriesOptions& timeseriesOptions,
+                                          std::set<ChunkRange>* chunkRanges) const;
+
     // Full namespace of the collection for this targeter
     NamespaceString _nss;
 
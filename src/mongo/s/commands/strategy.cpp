@@ -1210,7 +1210,9 @@ void ClientCommand::_parseMessage() try {
     if (msg.operation() == dbQuery) {
         checkAllowedOpQueryCommand(*(_rec->getOpCtx()->getClient()), opMsgReq.getCommandName());
     }
-    _rec->setRequest(opMsgReq);
+    // Hand the parsed request over without copying it: its BSONObj views (command body and
+    // document sequences) alias the ref-counted Message buffer until the command completes.
+    _rec->setRequest(std::move(opMsgReq));
 } catch (const DBException& ex) {
     // If this error needs to fail the connection, propagate it out.
     if (ErrorCodes::isConnectionFatalMessageParseError(ex.code()))
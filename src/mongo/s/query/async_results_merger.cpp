@@ -48,6 +48,7 @@
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/kill_cursors_gen.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/executor/remote_command_request.h"
@@ -370,6 +371,13 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
 }
 
 bool AsyncResultsMerger::_readyUnsorted(WithLock) {
+    // This method runs once per returned document. Results are streamed out of the remotes'
+    // buffers round-robin starting from '_gettingFromRemote', so while that remote still has
+    // buffered results we can declare readiness without scanning every remote.
+    if (_gettingFromRemote < _remotes.size() && _remotes[_gettingFromRemote].hasNext()) {
+        return true;
+    }
+
     bool allExhausted = true;
     for (const auto& remote : _remotes) {
         if (!remote.exhausted()) {
@@ -387,6 +395,18 @@ bool AsyncResultsMerger::_readyUnsorted(WithLock) {
 StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
     stdx::lock_guard<Latch> lk(_mutex);
     dassert(_ready(lk));
+    return _nextReady(lk);
+}
+
+boost::optional<StatusWith<ClusterQueryResult>> AsyncResultsMerger::tryNextReady() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (!_ready(lk)) {
+        return boost::none;
+    }
+    return _nextReady(lk);
+}
+
+StatusWith<ClusterQueryResult> AsyncResultsMerger::_nextReady(WithLock lk) {
     if (_lifecycleState != kAlive) {
         return Status(ErrorCodes::IllegalOperation, "AsyncResultsMerger killed");
     }
@@ -408,6 +428,12 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
 }
 
 void AsyncResultsMerger::_processAdditionalTransactionParticipants(OperationContext* opCtx) {
+    if (_remoteResponses.empty()) {
+        // This is the common case: this method runs once per returned document, so avoid acquiring
+        // an FCV snapshot when there are no queued responses to process.
+        return;
+    }
+
     const auto fcvSnapshot = serverGlobalParams.featureCompatibility.acquireFCVSnapshot();
     while (!_remoteResponses.empty()) {
         const auto& response = _remoteResponses.front();
@@ -898,6 +924,23 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                            const CursorResponse& response) {
     auto& remote = _remotes[remoteIndex];
     _updateRemoteMetadata(lk, remoteIndex, response);
+
+    // The documents in the batch are views sharing ownership of the shard's entire response
+    // buffer, so buffering them as-is pins that buffer until the last of them has been merged away
+    // and returned. For large batches we instead buffer individually owned copies: the response
+    // buffer is then freed as soon as the batch has been buffered, and each document's memory is
+    // released incrementally as it is consumed, rather than a whole batch at a time. Small batches
+    // keep the zero-copy views, where pinning the response buffer costs little.
+    const auto ownedCopyThreshold = internalQueryRemoteBatchOwnedCopyThresholdBytes.load();
+    std::size_t batchBytes = 0;
+    if (ownedCopyThreshold > 0) {
+        for (const auto& obj : response.getBatch()) {
+            batchBytes += obj.objsize();
+        }
+    }
+    const bool bufferOwnedCopies =
+        ownedCopyThreshold > 0 && batchBytes >= static_cast<std::size_t>(ownedCopyThreshold);
+
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
         if (_params.getSort()) {
@@ -917,7 +960,7 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             }
         }
 
-        ClusterQueryResult result(obj, remote.shardId);
+        ClusterQueryResult result(bufferOwnedCopies ? obj.getOwned() : obj, remote.shardId);
         remote.docBuffer.push(result);
         ++remote.fetchedCount;
     }
@@ -184,6 +184,15 @@ public:
      */
     StatusWith<ClusterQueryResult> nextReady();
 
+    /**
+     * Returns the next result if one is immediately available, or boost::none if retrieving the
+     * next result requires scheduling remote work. Equivalent to calling nextReady() when ready()
+     * returns true, but acquires the merger's mutex only once. This runs once per returned
+     * document, so the saved mutex round-trip matters on the getMore hot path, particularly for
+     * single-shard targeted queries where the merge layer adds no other value.
+     */
+    boost::optional<StatusWith<ClusterQueryResult>> tryNextReady();
+
     /**
      * Schedules remote work as required in order to make further results available. If there is an
      * error in scheduling this work, returns a non-ok status. On success, returns an event handle.
@@ -434,6 +443,7 @@ private:
     // Helpers for nextReady().
     //
 
+    StatusWith<ClusterQueryResult> _nextReady(WithLock);
     ClusterQueryResult _nextReadySorted(WithLock);
     ClusterQueryResult _nextReadyUnsorted(WithLock);
 
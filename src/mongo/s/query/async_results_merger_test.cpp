@@ -143,6 +143,37 @@ TEST_F(AsyncResultsMergerTest, SingleShardUnsorted) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, SingleShardTryNextReady) {
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    // Before any requests are scheduled, tryNextReady() reports that remote work is needed.
+    ASSERT_FALSE(arm->tryNextReady());
+
+    // Schedule requests. Until a response is delivered, there is still no buffered result.
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+    ASSERT_FALSE(arm->tryNextReady());
+
+    // Shard responds; the handleBatchResponse callbacks are run and ARM's remotes get updated.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch = {fromjson("{_id: 1}"), fromjson("{_id: 2}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    // tryNextReady() drains the buffered batch without separate ready() calls.
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1}"),
+                      *unittest::assertGet(*arm->tryNextReady()).getResult());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 2}"),
+                      *unittest::assertGet(*arm->tryNextReady()).getResult());
+
+    // After returning all the buffered results, the exhausted cursor yields EOF rather than
+    // boost::none.
+    ASSERT_TRUE(unittest::assertGet(*arm->tryNextReady()).isEOF());
+}
+
 TEST_F(AsyncResultsMergerTest, SingleShardSorted) {
     BSONObj findCmd = fromjson("{find: 'testcoll', sort: {_id: 1}}");
     std::vector<RemoteCursor> cursors;
@@ -122,11 +122,21 @@ StatusWith<ClusterQueryResult> BlockingResultsMerger::awaitNextWithTimeout(
     // We reach this point either if the ARM is ready, or if the ARM is !ready and we are in
     // kInitialFind or kGetMoreWithAtLeastOneResultInBatch ExecContext. In the latter case, we
     // return EOF immediately rather than blocking for further results.
-    return _arm.ready() ? _arm.nextReady() : ClusterQueryResult{};
+    if (auto result = _arm.tryNextReady()) {
+        return std::move(*result);
+    }
+    return ClusterQueryResult{};
 }
 
 StatusWith<ClusterQueryResult> BlockingResultsMerger::blockUntilNext(OperationContext* opCtx) {
-    while (!_arm.ready()) {
+    // This runs once per returned document, and in the common case the next result is already
+    // buffered, so check for it with a single pass over the merger's state rather than separate
+    // ready() and nextReady() calls.
+    while (true) {
+        if (auto result = _arm.tryNextReady()) {
+            return std::move(*result);
+        }
+
         auto nextEventStatus = _arm.nextEvent();
         if (!nextEventStatus.isOK()) {
             return nextEventStatus.getStatus();
@@ -145,8 +155,6 @@ StatusWith<ClusterQueryResult> BlockingResultsMerger::blockUntilNext(OperationCo
         // expect to have timed out.
         invariant(status.getValue() == stdx::cv_status::no_timeout);
     }
-
-    return _arm.nextReady();
 }
 StatusWith<ClusterQueryResult> BlockingResultsMerger::next(OperationContext* opCtx) {
     CurOp::get(opCtx)->ensureRecordRemoteOpWait();
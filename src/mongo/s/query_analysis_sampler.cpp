@@ -208,13 +208,13 @@ void QueryAnalysisSampler::onShutdown() {
 
 void QueryAnalysisSampler::QueryStats::gotCommand(StringData cmdName) {
     if (cmdName == "findAndModify" || cmdName == "findandmodify") {
-        _lastFindAndModifyQueriesCount++;
+        _lastFindAndModifyQueriesCount.fetchAndAddRelaxed(1);
     } else if (cmdName == "aggregate") {
-        _lastAggregateQueriesCount++;
+        _lastAggregateQueriesCount.fetchAndAddRelaxed(1);
     } else if (cmdName == "count") {
-        _lastCountQueriesCount++;
+        _lastCountQueriesCount.fetchAndAddRelaxed(1);
     } else if (cmdName == "distinct") {
-        _lastDistinctQueriesCount++;
+        _lastDistinctQueriesCount.fetchAndAddRelaxed(1);
     }
 }
 
@@ -229,8 +229,9 @@ void QueryAnalysisSampler::QueryStats::refreshTotalCount() {
         if (serverGlobalParams.clusterRole.hasExclusively(ClusterRole::RouterServer) ||
             serverGlobalParams.clusterRole.has(ClusterRole::None)) {
             return globalOpCounters.getUpdate()->load() + globalOpCounters.getDelete()->load() +
-                _lastFindAndModifyQueriesCount + globalOpCounters.getQuery()->load() +
-                _lastAggregateQueriesCount + _lastCountQueriesCount + _lastDistinctQueriesCount;
+                _lastFindAndModifyQueriesCount.loadRelaxed() +
+                globalOpCounters.getQuery()->load() + _lastAggregateQueriesCount.loadRelaxed() +
+                _lastCountQueriesCount.loadRelaxed() + _lastDistinctQueriesCount.loadRelaxed();
         } else if (serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
             return globalOpCounters.getNestedAggregate()->load();
         }
@@ -288,16 +289,29 @@ void QueryAnalysisSampler::SampleRateLimiter::_refill(double numTokensPerSecond,
 }
 
 bool QueryAnalysisSampler::SampleRateLimiter::tryConsume() {
+    // Common case: consume one of the whole tokens previously carved out of the bucket with a
+    // single relaxed atomic decrement, avoiding the tick source read and floating point math in
+    // _refill().
+    if (_prefetchedTokens.loadRelaxed() > 0 && _prefetchedTokens.subtractAndFetch(1) >= 0) {
+        return true;
+    }
+
     _refill(_numTokensPerSecond, _getBurstCapacity(_numTokensPerSecond));
 
     if (_lastNumTokens >= 1) {
         _lastNumTokens -= 1;
+        // Move the remaining whole tokens into the prefetched pool so that subsequent consumes
+        // take the fast path above. The fractional remainder stays in the bucket.
+        auto prefetched = static_cast<long long>(_lastNumTokens);
+        _lastNumTokens -= prefetched;
+        _prefetchedTokens.store(prefetched);
         LOGV2_DEBUG(7372304,
                     3,
                     "Successfully consumed one token",
                     logAttrs(_nss),
                     "collectionUUID"_attr = _collUuid,
-                    "lastNumTokens"_attr = _lastNumTokens);
+                    "lastNumTokens"_attr = _lastNumTokens,
+                    "prefetchedTokens"_attr = prefetched);
         return true;
     } else if (isApproximatelyEqual(_lastNumTokens, 1, kEpsilon)) {
         // To avoid skipping queries that could have been sampled, allow one token to be consumed
@@ -321,6 +335,9 @@ bool QueryAnalysisSampler::SampleRateLimiter::tryConsume() {
 }
 
 void QueryAnalysisSampler::SampleRateLimiter::refreshSamplesPerSecond(double numTokensPerSecond) {
+    // Return any unconsumed prefetched tokens to the bucket so that the refill below caps them at
+    // the new burst capacity.
+    _lastNumTokens += std::max(0LL, _prefetchedTokens.swap(0));
     // Fill the bucket with tokens created by the previous rate before setting a new rate.
     _refill(_numTokensPerSecond, _getBurstCapacity(numTokensPerSecond));
     _numTokensPerSecond = numTokensPerSecond;
@@ -78,8 +78,17 @@ public:
     struct QueryStats {
         QueryStats() = default;
 
+        QueryStats(const QueryStats& other)
+            : _lastFindAndModifyQueriesCount(other._lastFindAndModifyQueriesCount.loadRelaxed()),
+              _lastAggregateQueriesCount(other._lastAggregateQueriesCount.loadRelaxed()),
+              _lastCountQueriesCount(other._lastCountQueriesCount.loadRelaxed()),
+              _lastDistinctQueriesCount(other._lastDistinctQueriesCount.loadRelaxed()),
+              _lastTotalCount(other._lastTotalCount),
+              _lastAvgCount(other._lastAvgCount) {}
+
         /**
-         * If the command is an aggregate, count or distinct command, increment its count.
+         * If the command is an aggregate, count or distinct command, increment its count. Uses
+         * relaxed atomic increments so callers do not need to hold any mutex.
          */
         void gotCommand(StringData cmdName);
 
@@ -100,11 +109,13 @@ public:
     private:
         double _calculateExponentialMovingAverage(double prevAvg, long long newVal) const;
 
-        // The counts for update, delete and find are already tracked by the OpCounters.
-        long long _lastFindAndModifyQueriesCount = 0;
-        long long _lastAggregateQueriesCount = 0;
-        long long _lastCountQueriesCount = 0;
-        long long _lastDistinctQueriesCount = 0;
+        // The counts for update, delete and find are already tracked by the OpCounters. These are
+        // atomics so that the per-command path can increment them without taking a mutex; they are
+        // only read by the periodic query stats refresher.
+        AtomicWord<long long> _lastFindAndModifyQueriesCount{0};
+        AtomicWord<long long> _lastAggregateQueriesCount{0};
+        AtomicWord<long long> _lastCountQueriesCount{0};
+        AtomicWord<long long> _lastDistinctQueriesCount{0};
 
         long long _lastTotalCount = 0;
         boost::optional<double> _lastAvgCount;
@@ -130,6 +141,15 @@ public:
             _lastRefillTimeTicks = _serviceContext->getTickSource()->getTicks();
         };
 
+        SampleRateLimiter(const SampleRateLimiter& other)
+            : _serviceContext(other._serviceContext),
+              _nss(other._nss),
+              _collUuid(other._collUuid),
+              _numTokensPerSecond(other._numTokensPerSecond),
+              _lastRefillTimeTicks(other._lastRefillTimeTicks),
+              _lastNumTokens(other._lastNumTokens),
+              _prefetchedTokens(other._prefetchedTokens.loadRelaxed()) {}
+
         const NamespaceString& getNss() const {
             return _nss;
         }
@@ -182,9 +202,14 @@ public:
         const UUID _collUuid;
         double _numTokensPerSecond;
 
-        // The bucket is only refilled when there is a consume request or a rate refresh.
+        // The bucket is only refilled when the prefetched tokens run out or there is a rate
+        // refresh.
         TickSource::Tick _lastRefillTimeTicks;
         double _lastNumTokens = 0;
+
+        // Whole tokens carved out of the bucket ahead of time so that the common consume case is
+        // a single relaxed atomic decrement, with no tick source read or floating point math.
+        AtomicWord<long long> _prefetchedTokens{0};
     };
 
     QueryAnalysisSampler() = default;
@@ -207,7 +232,7 @@ public:
     void onShutdown();
 
     void gotCommand(StringData cmdName) {
-        stdx::lock_guard<Latch> lk(_queryStatsMutex);
+        // The query stats counters are atomics, so this does not need '_queryStatsMutex'.
         _queryStats.gotCommand(cmdName);
     }
 
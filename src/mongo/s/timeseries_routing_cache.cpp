@@ -0,0 +1,81 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/s/timeseries_routing_cache.h"
+
+#include <mutex>
+#include <utility>
+
+namespace mongo {
+namespace {
+
+const auto getTimeseriesRoutingCache = ServiceContext::declareDecoration<TimeseriesRoutingCache>();
+
+}  // namespace
+
+TimeseriesRoutingCache& TimeseriesRoutingCache::get(ServiceContext* serviceContext) {
+    return getTimeseriesRoutingCache(serviceContext);
+}
+
+TimeseriesRoutingCache::Key TimeseriesRoutingCache::makeKey(const NamespaceString& nss,
+                                                            BSONElement metaValue,
+                                                            Date_t roundedTime) {
+    std::string metaValueBytes;
+    if (!metaValue.eoo()) {
+        metaValueBytes.reserve(1 + metaValue.valuesize());
+        metaValueBytes.push_back(static_cast<char>(metaValue.type()));
+        metaValueBytes.append(metaValue.value(), metaValue.valuesize());
+    }
+    return Key{nss, std::move(metaValueBytes), roundedTime};
+}
+
+boost::optional<TimeseriesRoutingCache::Entry> TimeseriesRoutingCache::lookup(
+    const Key& key, const ChunkVersion& placementVersion) {
+    auto& partition = _partitionFor(key);
+    stdx::lock_guard lk(partition.mutex);
+    auto it = partition.cache.find(key);
+    if (it == partition.cache.end()) {
+        return boost::none;
+    }
+    if (it->second.placementVersion != placementVersion) {
+        // The routing table has moved past this entry; evict it so it cannot shadow a fresh
+        // decision inserted under an older in-flight routing table snapshot.
+        partition.cache.erase(key);
+        return boost::none;
+    }
+    return it->second;
+}
+
+void TimeseriesRoutingCache::insert(const Key& key, Entry entry) {
+    auto& partition = _partitionFor(key);
+    stdx::lock_guard lk(partition.mutex);
+    partition.cache.add(key, std::move(entry));
+}
+
+}  // namespace mongo
@@ -0,0 +1,134 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include <absl/hash/hash.h>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/shard_id.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/chunk_version.h"
+#include "mongo/util/lru_cache.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * A process-wide cache of recent time-series insert routing decisions, keyed by the series
+ * identity of a measurement: the buckets namespace, the raw bytes of the metaField value and the
+ * measurement's time rounded to the collection's bucketing granularity.
+ *
+ * Time-series shard keys are restricted to the metaField (or subfields of it) and the timeField,
+ * so two measurements with byte-identical metaField values and equal rounded timestamps extract
+ * the same buckets shard key and, under the same routing table, land on the same chunk. Metrics
+ * workloads insert long runs of measurements for the same series, which lets repeat measurements
+ * skip metadata normalization, shard key extraction and the chunk map binary search entirely.
+ *
+ * Entries record the collection placement version they were computed under and are treated as
+ * misses (and lazily evicted) once the caller's routing table has moved past it, so a stale entry
+ * can never route a write; at worst a refresh costs one regular targeting pass per series.
+ */
+class TimeseriesRoutingCache {
+public:
+    struct Key {
+        NamespaceString nss;
+
+        // Type byte plus value bytes of the metaField element, empty when the measurement has no
+        // metaField value. Byte identity is conservative: semantically equal but differently
+        // encoded values simply miss the cache.
+        std::string metaValueBytes;
+
+        Date_t roundedTime;
+
+        bool operator==(const Key& other) const {
+            return nss == other.nss && roundedTime == other.roundedTime &&
+                metaValueBytes == other.metaValueBytes;
+        }
+
+        template <typename H>
+        friend H AbslHashValue(H h, const Key& key) {
+            return H::combine(
+                std::move(h), key.nss, key.metaValueBytes, key.roundedTime.toMillisSinceEpoch());
+        }
+    };
+
+    struct Entry {
+        // The placement version of the routing table the routing decision was computed under.
+        ChunkVersion placementVersion;
+        ShardId shardId;
+        ChunkRange range;
+    };
+
+    static TimeseriesRoutingCache& get(ServiceContext* serviceContext);
+
+    /**
+     * Builds the cache key for a measurement: 'metaValue' is the metaField element of the
+     * measurement document (eoo if absent) and 'roundedTime' its timeField value rounded to the
+     * collection's bucketing granularity.
+     */
+    static Key makeKey(const NamespaceString& nss, BSONElement metaValue, Date_t roundedTime);
+
+    /**
+     * Returns the cached routing decision for 'key' if one exists and was computed under
+     * 'placementVersion', and boost::none otherwise.
+     */
+    boost::optional<Entry> lookup(const Key& key, const ChunkVersion& placementVersion);
+
+    void insert(const Key& key, Entry entry);
+
+private:
+    // Sized for roughly a mongos's worth of concurrently hot series: 16 partitions of 2048
+    // series-to-chunk entries. Entries are small (a key plus a chunk range), so the worst-case
+    // footprint is a few megabytes, and partitioning keeps the mutexes uncontended at
+    // ingest-workload lookup rates.
+    static constexpr size_t kNumPartitions = 16;
+    static constexpr size_t kEntriesPerPartition = 2048;
+
+    struct Partition {
+        Mutex mutex = MONGO_MAKE_LATCH("TimeseriesRoutingCache::Partition::mutex");
+        LRUCache<Key, Entry, absl::Hash<Key>> cache{kEntriesPerPartition};
+    };
+
+    Partition& _partitionFor(const Key& key) {
+        return _partitions[absl::Hash<Key>{}(key) % kNumPartitions];
+    }
+
+    std::array<Partition, kNumPartitions> _partitions;
+};
+
+}  // namespace mongo
@@ -0,0 +1,115 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/s/timeseries_routing_cache.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss = NamespaceString::createNamespaceString_forTest(
+    "test.system.buckets.tracked_ts");
+
+class TimeseriesRoutingCacheTest : public unittest::Test {
+protected:
+    TimeseriesRoutingCache::Key makeKey(const BSONObj& metaWrapper, Date_t roundedTime) {
+        return TimeseriesRoutingCache::makeKey(kNss, metaWrapper.firstElement(), roundedTime);
+    }
+
+    TimeseriesRoutingCache::Entry makeEntry(const ChunkVersion& placementVersion,
+                                            StringData shardName) {
+        return {placementVersion,
+                ShardId(std::string{shardName}),
+                ChunkRange(BSON("meta" << 0), BSON("meta" << 100))};
+    }
+
+    const ChunkVersion _version{{OID::gen(), Timestamp(100, 0)}, {1, 0}};
+    TimeseriesRoutingCache _cache;
+};
+
+TEST_F(TimeseriesRoutingCacheTest, LookupReturnsInsertedEntry) {
+    auto key = makeKey(BSON("" << BSON("host" << "a")), Date_t::fromMillisSinceEpoch(60000));
+    ASSERT_FALSE(_cache.lookup(key, _version));
+
+    _cache.insert(key, makeEntry(_version, "shard0"));
+    auto entry = _cache.lookup(key, _version);
+    ASSERT_TRUE(entry);
+    ASSERT_EQ(entry->shardId, ShardId("shard0"));
+}
+
+TEST_F(TimeseriesRoutingCacheTest, DistinctSeriesAndTimeWindowsAreDistinctKeys) {
+    auto key = makeKey(BSON("" << BSON("host" << "a")), Date_t::fromMillisSinceEpoch(60000));
+    _cache.insert(key, makeEntry(_version, "shard0"));
+
+    auto otherMeta = makeKey(BSON("" << BSON("host" << "b")), Date_t::fromMillisSinceEpoch(60000));
+    ASSERT_FALSE(_cache.lookup(otherMeta, _version));
+
+    auto otherWindow =
+        makeKey(BSON("" << BSON("host" << "a")), Date_t::fromMillisSinceEpoch(120000));
+    ASSERT_FALSE(_cache.lookup(otherWindow, _version));
+
+    // The same series in the same window hits regardless of which BSONObj carried the value.
+    auto sameSeries = makeKey(BSON("" << BSON("host" << "a")), Date_t::fromMillisSinceEpoch(60000));
+    ASSERT_TRUE(_cache.lookup(sameSeries, _version));
+}
+
+TEST_F(TimeseriesRoutingCacheTest, PlacementVersionBumpInvalidatesEntry) {
+    auto key = makeKey(BSON("" << BSON("host" << "a")), Date_t::fromMillisSinceEpoch(60000));
+    _cache.insert(key, makeEntry(_version, "shard0"));
+
+    auto bumpedVersion = _version;
+    bumpedVersion.incMajor();
+    ASSERT_FALSE(_cache.lookup(key, bumpedVersion));
+
+    // The stale entry was evicted, so it cannot shadow the old version either.
+    ASSERT_FALSE(_cache.lookup(key, _version));
+
+    _cache.insert(key, makeEntry(bumpedVersion, "shard1"));
+    auto entry = _cache.lookup(key, bumpedVersion);
+    ASSERT_TRUE(entry);
+    ASSERT_EQ(entry->shardId, ShardId("shard1"));
+}
+
+TEST_F(TimeseriesRoutingCacheTest, MissingMetaValueIsItsOwnKey) {
+    auto noMeta = TimeseriesRoutingCache::makeKey(
+        kNss, BSONElement(), Date_t::fromMillisSinceEpoch(60000));
+    _cache.insert(noMeta, makeEntry(_version, "shard0"));
+
+    ASSERT_TRUE(_cache.lookup(noMeta, _version));
+    ASSERT_FALSE(
+        _cache.lookup(makeKey(BSON("" << BSONNULL), Date_t::fromMillisSinceEpoch(60000)),
+                      _version));
+}
+
+}  // namespace
+}  // namespace mongo
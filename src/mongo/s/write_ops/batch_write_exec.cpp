@@ -207,7 +207,10 @@ std::vector<AsyncRequestsSender::Request> constructARSRequestsToSend(
             const auto shardBatchRequest(batchOp.buildBatchRequest(
                 *nextBatch, targeter, allowShardKeyUpdatesWithoutFullShardKeyInQuery));
 
-            BSONObjBuilder requestBuilder;
+            // Pre-size the buffer using the batch's conservative size estimate. Child batches for
+            // large bulk loads run to tens of megabytes, and growing the buffer by doubling would
+            // re-copy the serialized documents several times over.
+            BSONObjBuilder requestBuilder(nextBatch->getEstimatedSizeBytes());
             shardBatchRequest.serialize(&requestBuilder);
             if (wcForChildBatch) {
                 requestBuilder.append(WriteConcernOptions::kWriteConcernField,
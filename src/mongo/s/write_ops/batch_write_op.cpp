@@ -614,6 +614,7 @@ BatchedCommandRequest BatchWriteOp::buildBatchRequest(
     boost::optional<std::vector<int32_t>> stmtIdsForOp;
     if (_isRetryableWrite) {
         stmtIdsForOp.emplace();
+        stmtIdsForOp->reserve(targetedBatch.getWrites().size());
     }
 
     boost::optional<std::vector<BSONObj>> insertDocs;
@@ -625,14 +626,18 @@ BatchedCommandRequest BatchWriteOp::buildBatchRequest(
 
         switch (batchType) {
             case BatchedCommandRequest::BatchType_Insert:
-                if (!insertDocs)
+                if (!insertDocs) {
                     insertDocs.emplace();
+                    insertDocs->reserve(targetedBatch.getWrites().size());
+                }
                 insertDocs->emplace_back(
                     _clientRequest.getInsertRequest().getDocuments().at(writeOpRef.first));
                 break;
             case BatchedCommandRequest::BatchType_Update:
-                if (!updates)
+                if (!updates) {
                     updates.emplace();
+                    updates->reserve(targetedBatch.getWrites().size());
+                }
                 updates->emplace_back(
                     _clientRequest.getUpdateRequest().getUpdates().at(writeOpRef.first));
                 updates->back().setSampleId(targetedWrite->sampleId);
@@ -650,8 +655,10 @@ BatchedCommandRequest BatchWriteOp::buildBatchRequest(
                 }
                 break;
             case BatchedCommandRequest::BatchType_Delete:
-                if (!deletes)
+                if (!deletes) {
                     deletes.emplace();
+                    deletes->reserve(targetedBatch.getWrites().size());
+                }
                 deletes->emplace_back(
                     _clientRequest.getDeleteRequest().getDeletes().at(writeOpRef.first));
                 deletes->back().setSampleId(targetedWrite->sampleId);
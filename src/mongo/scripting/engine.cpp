@@ -426,7 +426,8 @@ public:
             if (it->poolName == poolName) {
                 std::shared_ptr<Scope> scope = it->scope;
                 _pools.erase(it);
-                scope->reset();
+                // The scope was already reset by release() before it was stored, so it only needs
+                // to be associated with the new operation here.
                 scope->registerOperation(opCtx);
                 return scope;
             }
@@ -33,7 +33,6 @@
 #include <boost/optional/optional.hpp>
 #include <cstdint>
 #include <functional>
-#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -51,12 +50,16 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/decimal128.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/string_map.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
 typedef unsigned long long ScriptingFunction;
 typedef BSONObj (*NativeFunction)(const BSONObj& args, void* data);
-typedef std::map<std::string, ScriptingFunction> FunctionCacheMap;
+// Memoizes compiled functions by source text. Looked up once per invocation, so use a hash map
+// with heterogeneous StringData lookup rather than paying a std::string construction and ordered
+// string comparisons for every call.
+typedef StringMap<ScriptingFunction> FunctionCacheMap;
 
 class DBClientBase;
 class OperationContext;
@@ -469,16 +469,18 @@ ExecutorFuture<void> CommonAsioSession::parseProxyProtocolHeader(const ReactorHa
 Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
     static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
-    auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
-    auto ptr = headerBuffer.get();
+    if (!_headerBuffer) {
+        _headerBuffer = SharedBuffer::allocate(kHeaderSize);
+    }
+    auto ptr = _headerBuffer.get();
     _asyncOpState.start();
     return read(asio::buffer(ptr, kHeaderSize), baton)
-        .then([headerBuffer = std::move(headerBuffer), this, baton]() mutable {
-            if (checkForHTTPRequest(asio::buffer(headerBuffer.get(), kHeaderSize))) {
+        .then([this, baton]() mutable {
+            if (checkForHTTPRequest(asio::buffer(_headerBuffer.get(), kHeaderSize))) {
                 return sendHTTPResponse(baton);
             }
 
-            const auto msgLen = size_t(MSGHEADER::View(headerBuffer.get()).getMessageLength());
+            const auto msgLen = size_t(MSGHEADER::View(_headerBuffer.get()).getMessageLength());
             if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
                 StringBuilder sb;
                 sb << "recv(): message msgLen " << msgLen << " is invalid. "
@@ -498,11 +500,13 @@ Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
                 if (_isIngressSession) {
                     networkCounter.hitPhysicalIn(msgLen);
                 }
-                return Future<Message>::makeReady(Message(std::move(headerBuffer)));
+                auto headerOnly = SharedBuffer::allocate(kHeaderSize);
+                memcpy(headerOnly.get(), _headerBuffer.get(), kHeaderSize);
+                return Future<Message>::makeReady(Message(std::move(headerOnly)));
             }
 
             auto buffer = SharedBuffer::allocate(msgLen);
-            memcpy(buffer.get(), headerBuffer.get(), kHeaderSize);
+            memcpy(buffer.get(), _headerBuffer.get(), kHeaderSize);
 
             MsgData::View msgView(buffer.get());
             return read(asio::buffer(msgView.data(), msgView.dataLen()), baton)
@@ -36,6 +36,7 @@
 #include "mongo/transport/asio/asio_session.h"
 #include "mongo/transport/asio/asio_transport_layer.h"
 #include "mongo/transport/baton.h"
+#include "mongo/util/shared_buffer.h"
 
 #ifdef MONGO_CONFIG_SSL
 #include "mongo/util/net/ssl.hpp"
@@ -294,6 +295,14 @@ protected:
 
     AsyncOperationState _asyncOpState;
 
+    /**
+     * Receives the header of each inbound message, so sourceMessageImpl() does not pay a heap
+     * allocation per message just to learn the body length. Allocated on first use and reused for
+     * the lifetime of the session; '_asyncOpState' ensures only one source operation touches it at
+     * a time.
+     */
+    SharedBuffer _headerBuffer;
+
     /**
      * Strictly orders the start and cancellation of asynchronous operations:
      * - Holding the mutex while starting asynchronous operations (e.g., adding the session to the
@@ -29,6 +29,7 @@
 
 #include "mongo/transport/grpc/client.h"
 
+#include <grpc/grpc.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
@@ -272,6 +273,12 @@ public:
                 channel_args.SetMaxSendMessageSize(MaxMessageSizeBytes);
                 channel_args.SetCompressionAlgorithm(
                     ::grpc_compression_algorithm::GRPC_COMPRESS_NONE);
+                // Pooled channels are shared by many sessions, so probe them with keepalive
+                // pings to detect a dead peer promptly rather than discovering it one stream
+                // at a time. The interval stays above the server's enforced minimum receive
+                // interval so the pings are not counted as strikes.
+                channel_args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, 2 * 60 * 1000);
+                channel_args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 20 * 1000);
                 return ::grpc::CreateCustomChannel(uri, credentials, channel_args);
             },
             [](std::shared_ptr<::grpc::Channel>& channel, Milliseconds connectTimeout) {
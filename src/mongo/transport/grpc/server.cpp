@@ -30,6 +30,7 @@
 #include "mongo/transport/grpc/server.h"
 
 #include <grpc/compression.h>
+#include <grpc/grpc.h>
 #include <grpc/grpc_security_constants.h>
 #include <grpcpp/resource_quota.h>
 #include <grpcpp/security/credentials.h>
@@ -229,6 +230,21 @@ void Server::start() {
     builder.SetMaxReceiveMessageSize(MaxMessageSizeBytes);
     builder.SetMaxSendMessageSize(MaxMessageSizeBytes);
     builder.SetDefaultCompressionAlgorithm(::grpc_compression_algorithm::GRPC_COMPRESS_NONE);
+    // Each logical session is a long-lived stream multiplexed onto its connection, and each active
+    // stream is serviced by a dedicated handler thread. Cap the streams a single connection may
+    // open at the handler thread budget so that one connection cannot queue an unbounded number of
+    // streams, each of which pins HTTP/2 stream state and flow control window memory while it
+    // waits for a thread.
+    builder.AddChannelArgument(GRPC_ARG_MAX_CONCURRENT_STREAMS,
+                               static_cast<int>(_options.maxThreads));
+    // Probe connections with HTTP/2 keepalive pings so that peers that disappear without cleanly
+    // ending their streams have their connection and stream state reclaimed, rather than holding
+    // it until the next write fails. Clients multiplexing many sessions over one connection send
+    // their own pings while their streams are idle, so permit those at a shorter interval than
+    // gRPC's default without counting them as ping strikes.
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIME_MS, 2 * 60 * 1000);
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 20 * 1000);
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS, 10 * 1000);
     ::grpc::ResourceQuota quota;
     quota.SetMaxThreads(_options.maxThreads);
     builder.SetResourceQuota(quota);
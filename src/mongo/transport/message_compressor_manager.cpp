@@ -89,6 +89,11 @@ struct CompressionHeader {
 
 const transport::Session::Decoration<MessageCompressorManager> getForSession =
     transport::Session::declareDecoration<MessageCompressorManager>();
+
+// Decompression buffers up to this size are retained for reuse between messages. Larger messages
+// fall back to a per-message allocation so that one outsized message does not pin a large buffer
+// on the session for its lifetime.
+constexpr size_t kMaxReusableDecompressionBufferSize = 1 << 20;
 }  // namespace
 
 MessageCompressorManager::MessageCompressorManager()
@@ -185,7 +190,21 @@ StatusWith<Message> MessageCompressorManager::decompressMessage(const Message& m
                 "Decompressed message would be larger than maximum message size"};
     }
 
-    auto outputMessageBuffer = SharedBuffer::allocate(bufferSize);
+    // Reuse the previous decompression buffer if its consumer has released it and it is large
+    // enough; otherwise allocate afresh and, when the size is reasonable, keep a reference so the
+    // next message can reuse it. The message consumer owning the buffer keeps it shared, which
+    // makes the reuse check safe.
+    SharedBuffer outputMessageBuffer;
+    if (bufferSize <= kMaxReusableDecompressionBufferSize) {
+        if (!_decompressionBuffer.isShared() && _decompressionBuffer.capacity() >= bufferSize) {
+            outputMessageBuffer = _decompressionBuffer;
+        } else {
+            outputMessageBuffer = SharedBuffer::allocate(bufferSize);
+            _decompressionBuffer = outputMessageBuffer;
+        }
+    } else {
+        outputMessageBuffer = SharedBuffer::allocate(bufferSize);
+    }
     MsgData::View outMessage(outputMessageBuffer.get());
     outMessage.setId(inputHeader.getId());
     outMessage.setResponseToMsgId(inputHeader.getResponseToMsgId());
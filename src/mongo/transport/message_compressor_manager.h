@@ -40,6 +40,7 @@
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_base.h"
 #include "mongo/transport/session.h"
+#include "mongo/util/shared_buffer.h"
 
 namespace mongo {
 
@@ -135,6 +136,13 @@ public:
 private:
     std::vector<MessageCompressorBase*> _negotiated;
     MessageCompressorRegistry* _registry;
+
+    /**
+     * The buffer backing the most recently decompressed message. Once the consumer of that
+     * message releases it, the buffer is reused for the next decompressMessage() call that fits,
+     * so steady-state compressed traffic does not pay an allocation per message.
+     */
+    SharedBuffer _decompressionBuffer;
 };
 
 }  // namespace mongo
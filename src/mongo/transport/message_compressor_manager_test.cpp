@@ -244,6 +244,33 @@ boost::optional<std::vector<StringData>> parseBSON(BSONObj input) {
     return ret;
 }
 
+TEST(MessageCompressorManager, DecompressionBufferReuse) {
+    auto registry = buildRegistry();
+    MessageCompressorManager manager(&registry);
+
+    BSONObjBuilder negotiatorOut;
+    std::vector<StringData> negotiator({"noop"_sd});
+    manager.serverNegotiate(negotiator, &negotiatorOut);
+    checkNegotiationResult(negotiatorOut.done(), {"noop"});
+
+    auto compressed = assertOk(manager.compressMessage(buildMessage(), nullptr));
+
+    const char* retainedBuf;
+    {
+        auto decompressed = assertOk(manager.decompressMessage(compressed, nullptr));
+
+        // While the first decompressed message is still alive, its buffer must not be reused.
+        auto concurrent = assertOk(manager.decompressMessage(compressed, nullptr));
+        ASSERT_NE(concurrent.buf(), decompressed.buf());
+        retainedBuf = concurrent.buf();
+    }
+
+    // Both previous messages have been released, so the next decompression reuses the buffer the
+    // manager retained instead of allocating a new one.
+    auto reused = assertOk(manager.decompressMessage(compressed, nullptr));
+    ASSERT_EQ(reused.buf(), retainedBuf);
+}
+
 TEST(MessageCompressorManager, FullNormalCompression) {
     auto registry = buildRegistry();
     MessageCompressorManager clientManager(&registry);
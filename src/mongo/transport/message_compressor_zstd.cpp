@@ -42,6 +42,26 @@
 #include "mongo/util/str.h"
 
 namespace mongo {
+namespace {
+
+// The one-shot ZSTD_compress/ZSTD_decompress entry points allocate and tear down a full
+// compression context on every call, which dominates the cost of compressing the small command
+// messages that make up most wire traffic. Each thread reuses one long-lived context of either
+// kind instead; ZSTD_compressCCtx and ZSTD_decompressDCtx fully reset the context at the start of
+// every call, so no state leaks between messages.
+ZSTD_CCtx* getThreadCompressionContext() {
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx{ZSTD_createCCtx(),
+                                                                           &ZSTD_freeCCtx};
+    return cctx.get();
+}
+
+ZSTD_DCtx* getThreadDecompressionContext() {
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx{ZSTD_createDCtx(),
+                                                                           &ZSTD_freeDCtx};
+    return dctx.get();
+}
+
+}  // namespace
 
 ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
 
@@ -51,11 +71,12 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    size_t ret = ZSTD_compressCCtx(getThreadCompressionContext(),
+                                   const_cast<char*>(output.data()),
+                                   output.length(),
+                                   input.data(),
+                                   input.length(),
+                                   ZSTD_CLEVEL_DEFAULT);
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -67,8 +88,11 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    size_t ret = ZSTD_decompressDCtx(getThreadDecompressionContext(),
+                                     const_cast<char*>(output.data()),
+                                     output.length(),
+                                     input.data(),
+                                     input.length());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -33,6 +33,7 @@
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/db/service_context.h"
@@ -175,6 +176,29 @@ BENCHMARK_DEFINE_F(ServiceExecutorSynchronousBm, ChainedSchedule)(benchmark::Sta
     }
 }
 
+/**
+ * Simulates session churn: each iteration runs a wave of short independent task chains, as if a
+ * burst of connections arrived, ran a command, and disconnected. Measures how well worker threads
+ * are reused across sessions rather than created and torn down per session.
+ */
+BENCHMARK_DEFINE_F(ServiceExecutorSynchronousBm, SessionChurn)(benchmark::State& state) {
+    int sessions = state.range(0);
+    for (auto _ : state) {
+        std::vector<std::unique_ptr<ServiceExecutor::TaskRunner>> runners;
+        std::vector<std::unique_ptr<Notification>> done;
+        for (int i = 0; i != sessions; ++i) {
+            runners.push_back(executor()->makeTaskRunner());
+            done.push_back(std::make_unique<Notification>());
+        }
+        for (int i = 0; i != sessions; ++i)
+            runOnExec(&*runners[i], [&, i](Status) {
+                runOnExec(&*runners[i], [&, i](Status) { done[i]->set(); });
+            });
+        for (int i = 0; i != sessions; ++i)
+            done[i]->get();
+    }
+}
+
 BENCHMARK_DEFINE_F(ServiceExecutorSynchronousBm, DummyBenchmark)(benchmark::State& state) {
     for (auto _ : state) {
     }
@@ -186,6 +210,7 @@ BENCHMARK_REGISTER_F(ServiceExecutorSynchronousBm, ScheduleAndWait)->ThreadRange
 BENCHMARK_REGISTER_F(ServiceExecutorSynchronousBm, ChainedSchedule)
     ->Range(1, kMaxChainSize)
     ->ThreadRange(1, kMaxThreads);
+BENCHMARK_REGISTER_F(ServiceExecutorSynchronousBm, SessionChurn)->Range(1, kMaxChainSize);
 #else
 BENCHMARK_REGISTER_F(ServiceExecutorSynchronousBm, DummyBenchmark);
 #endif
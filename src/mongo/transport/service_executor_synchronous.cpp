@@ -51,6 +51,16 @@
 namespace mongo::transport {
 
 namespace service_executor_synchronous_detail {
+namespace {
+
+/**
+ * How long a worker thread lingers after its task chain completes, waiting to be handed the task
+ * chain of a new session before tearing itself down. Bursts of new connections reuse these warm
+ * threads instead of paying thread creation and teardown per session.
+ */
+constexpr auto kWorkerIdleTimeout = Seconds{1};
+
+}  // namespace
 
 class ServiceExecutorSyncImpl::SharedState : public std::enable_shared_from_this<SharedState> {
 private:
@@ -62,6 +72,10 @@ private:
             return _p->_threads;
         }
 
+        size_t idleThreads() const {
+            return _p->_idleThreads;
+        }
+
         bool waitForDrain(Milliseconds dur) {
             return _p->_cv.wait_for(_lk, dur.toSystemDuration(), [&] { return !_p->_threads; });
         }
@@ -93,6 +107,12 @@ public:
         _isRunning.store(b);
     }
 
+    /**
+     * Fails the queued tasks of any task chains that are still awaiting pickup by an idle worker
+     * thread, and wakes those workers so they can observe the shutdown and exit.
+     */
+    void failPendingWorkers();
+
     LockRef lock() {
         return LockRef{this};
     }
@@ -100,11 +120,20 @@ public:
 private:
     class WorkerThreadInfo;
 
+    /**
+     * Parks the calling worker thread for up to 'kWorkerIdleTimeout', returning the next task
+     * chain to run on it, or nullptr if none arrived in time or the executor is shutting down.
+     */
+    std::unique_ptr<WorkerThreadInfo> waitForNextWorker();
+
     const RunTaskInline _runTaskInline;
     mutable stdx::mutex _mutex;  // NOLINT
     stdx::condition_variable _cv;
+    stdx::condition_variable _workCv;
     AtomicWord<bool> _isRunning;
     size_t _threads = 0;
+    size_t _idleThreads = 0;
+    std::deque<std::unique_ptr<WorkerThreadInfo>> _pendingWorkers;
 };
 
 class ServiceExecutorSyncImpl::SharedState::WorkerThreadInfo {
@@ -123,6 +152,38 @@ public:
     std::deque<Task> queue;
 };
 
+auto ServiceExecutorSyncImpl::SharedState::waitForNextWorker()
+    -> std::unique_ptr<WorkerThreadInfo> {
+    stdx::unique_lock<stdx::mutex> lk(_mutex);  // NOLINT
+    ++_idleThreads;
+    ScopeGuard idleGuard = [&] {
+        --_idleThreads;
+    };
+    if (!_workCv.wait_for(lk, kWorkerIdleTimeout.toSystemDuration(), [&] {
+            return !isRunning() || !_pendingWorkers.empty();
+        })) {
+        return nullptr;
+    }
+    if (!isRunning() || _pendingWorkers.empty()) {
+        return nullptr;
+    }
+    auto w = std::move(_pendingWorkers.front());
+    _pendingWorkers.pop_front();
+    return w;
+}
+
+void ServiceExecutorSyncImpl::SharedState::failPendingWorkers() {
+    decltype(_pendingWorkers) pending;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+        pending.swap(_pendingWorkers);
+        _workCv.notify_all();
+    }
+    for (auto&& w : pending)
+        for (auto&& task : w->queue)
+            task(Status(ErrorCodes::ShutdownInProgress, "Executor is shutting down"));
+}
+
 void ServiceExecutorSyncImpl::SharedState::schedule(Task task, StringData name) {
     using namespace fmt::literals;
     if (!isRunning()) {
@@ -140,29 +201,59 @@ void ServiceExecutorSyncImpl::SharedState::schedule(Task task, StringData name)
     auto workerInfo = std::make_unique<WorkerThreadInfo>(shared_from_this());
     workerInfo->queue.push_back(std::move(task));
 
-    auto runTask = [w = std::move(workerInfo)] {
-        w->sharedState->lock().onStartThread();
+    if (_runTaskInline == RunTaskInline{true}) {
+        workerInfo->sharedState->lock().onStartThread();
+        ScopeGuard onEndThreadGuard = [&] {
+            workerInfo->sharedState->lock().onEndThread();
+        };
+
+        workerThreadInfoTls = &*workerInfo;
+        ScopeGuard resetTlsGuard = [&] {
+            workerThreadInfoTls = nullptr;
+        };
+
+        workerInfo->run();
+        return;
+    }
+
+    // Hand the new task chain to an idle worker thread if one is lingering, avoiding the cost of
+    // creating a thread. The size comparison accounts for chains already enqueued but not yet
+    // picked up, so each enqueued chain is covered by a distinct waiting worker.
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+        if (_idleThreads > _pendingWorkers.size()) {
+            _pendingWorkers.push_back(std::move(workerInfo));
+            _workCv.notify_one();
+            return;
+        }
+    }
+
+    auto runTask = [w = std::move(workerInfo)]() mutable {
+        auto sharedState = w->sharedState;
+        sharedState->lock().onStartThread();
         ScopeGuard onEndThreadGuard = [&] {
-            w->sharedState->lock().onEndThread();
+            sharedState->lock().onEndThread();
         };
 
-        workerThreadInfoTls = &*w;
         ScopeGuard resetTlsGuard = [&] {
             workerThreadInfoTls = nullptr;
         };
 
-        w->run();
+        while (w) {
+            workerThreadInfoTls = &*w;
+            w->run();
+            workerThreadInfoTls = nullptr;
+            // Rather than tearing the thread down, linger briefly in case a new session's task
+            // chain arrives to run on it.
+            w = sharedState->waitForNextWorker();
+        }
     };
 
-    if (_runTaskInline == RunTaskInline{true}) {
-        runTask();
-    } else {
-        // The usual way to fail to schedule is to invoke the task,
-        // but in this case we will not have the task anymore.
-        // We will have given it away while attempting to launch the thread.
-        LOGV2_DEBUG(22983, 3, "Starting ServiceExecutorSynchronous worker thread");
-        iassert(launchServiceWorkerThread(std::move(runTask)));
-    }
+    // The usual way to fail to schedule is to invoke the task,
+    // but in this case we will not have the task anymore.
+    // We will have given it away while attempting to launch the thread.
+    LOGV2_DEBUG(22983, 3, "Starting ServiceExecutorSynchronous worker thread");
+    iassert(launchServiceWorkerThread(std::move(runTask)));
 }
 
 ServiceExecutorSyncImpl::ServiceExecutorSyncImpl(RunTaskInline runTaskInline,
@@ -178,8 +269,9 @@ void ServiceExecutorSyncImpl::start() {
 
 Status ServiceExecutorSyncImpl::shutdown(Milliseconds timeout) {
     LOGV2_DEBUG(22982, 3, "Shutting down passthrough executor");
-    auto stopLock = _sharedState->lock();
     _sharedState->setIsRunning(false);
+    _sharedState->failPendingWorkers();
+    auto stopLock = _sharedState->lock();
     if (!stopLock.waitForDrain(timeout))
         return Status(ErrorCodes::Error::ExceededTimeLimit,
                       "passthrough executor couldn't shutdown "
@@ -192,12 +284,15 @@ size_t ServiceExecutorSyncImpl::getRunningThreads() const {
 }
 
 void ServiceExecutorSyncImpl::appendStats(BSONObjBuilder* bob) const {
-    // Has one client per thread and waits synchronously on that thread.
-    int threads = getRunningThreads();
+    // Has one client per active thread and waits synchronously on that thread. Idle threads are
+    // lingering for the next session and have no client.
+    auto lk = _sharedState->lock();
+    int threads = lk.threads();
+    int clients = threads - lk.idleThreads();
     BSONObjBuilder{bob->subobjStart(_statsFieldName)}
         .append("threadsRunning", threads)
-        .append("clientsInTotal", threads)
-        .append("clientsRunning", threads)
+        .append("clientsInTotal", clients)
+        .append("clientsRunning", clients)
         .append("clientsWaitingForData", 0);
 }
 
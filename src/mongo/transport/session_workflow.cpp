@@ -67,6 +67,7 @@
 #include "mongo/logv2/log_severity.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/usdt.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/transport/ingress_handshake_metrics.h"
@@ -776,6 +777,7 @@ Future<void> SessionWorkflow::Impl::_doOneIteration() {
     return _getNextWork()
         .then([&](auto work) {
             _iterationFrame->metrics.received();
+            MONGO_USDT(session_workflow_received, session()->id());
             invariant(!_work);
             _work = std::move(work);
             return _dispatchWork();
@@ -783,8 +785,10 @@ Future<void> SessionWorkflow::Impl::_doOneIteration() {
         .then([&](auto rsp) {
             _acceptResponse(std::move(rsp));
             _iterationFrame->metrics.processed();
+            MONGO_USDT(session_workflow_processed, session()->id());
             _sendResponse();
             _iterationFrame->metrics.sent(*session());
+            MONGO_USDT(session_workflow_sent, session()->id());
             _yieldPointReached();
             _iterationFrame->metrics.yieldedAfterSend();
             _iterationFrame.reset();
@@ -46,6 +46,16 @@ namespace transport {
  * lifecycle of each user request. It is the glue between ServiceEntryPoint and TransportLayer
  * that ties network and database logic together for a user.
  *
+ * Requests on a session are deliberately processed one at a time: each iteration
+ * sources a message, runs it to completion, and sinks the response before the next
+ * message is read. Intra-session pipelining (sourcing or running the next request
+ * while the current one executes) is not supported, and would require substantial
+ * rework: a session owns exactly one `Client`, a `Client` supports one active
+ * `OperationContext`, all iteration work runs under a `ClientStrand`, and the
+ * available service executors are all dedicated-thread. Clients that want
+ * concurrency use multiple connections; streaming workloads use the exhaust
+ * protocol, which avoids re-sourcing within this loop.
+ *
  * A `SessionWorkflow` must be managed by a `shared_ptr`, so we force all instances
  * to be created by the static `make` function.
  */
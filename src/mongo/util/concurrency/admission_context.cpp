@@ -44,13 +44,15 @@ AdmissionContext::AdmissionContext(const AdmissionContext& other)
     : _admissions(other._admissions.load()),
       _priority(other._priority.load()),
       _totalTimeQueuedMicros(other._totalTimeQueuedMicros.load()),
-      _startQueueingTime(other._startQueueingTime.load()) {}
+      _startQueueingTime(other._startQueueingTime.load()),
+      _operationDeadline(other._operationDeadline.load()) {}
 
 AdmissionContext& AdmissionContext::operator=(const AdmissionContext& other) {
     _admissions.store(other._admissions.load());
     _priority.store(other._priority.load());
     _totalTimeQueuedMicros.store(other._totalTimeQueuedMicros.load());
     _startQueueingTime.store(other._startQueueingTime.load());
+    _operationDeadline.store(other._operationDeadline.load());
     return *this;
 }
 
@@ -71,6 +73,10 @@ int AdmissionContext::getAdmissions() const {
     return _admissions.loadRelaxed();
 }
 
+Date_t AdmissionContext::getOperationDeadline() const {
+    return _operationDeadline.loadRelaxed();
+}
+
 AdmissionContext::Priority AdmissionContext::getPriority() const {
     return _priority.loadRelaxed();
 }
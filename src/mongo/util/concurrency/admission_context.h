@@ -33,6 +33,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/tick_source.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -86,6 +87,13 @@ public:
      */
     int getAdmissions() const;
 
+    /**
+     * Returns the deadline of the operation this context belongs to, or Date_t::max() if the
+     * operation has no deadline. The deadline is stamped by the TicketHolder before the operation
+     * queues, and is consumed by deadline-aware queueing policies.
+     */
+    Date_t getOperationDeadline() const;
+
     Priority getPriority() const;
 
 protected:
@@ -103,6 +111,7 @@ protected:
     Atomic<Priority> _priority{Priority::kNormal};
     Atomic<int64_t> _totalTimeQueuedMicros;
     Atomic<TickSource::Tick> _startQueueingTime{kNotQueueing};
+    Atomic<Date_t> _operationDeadline{Date_t::max()};
 };
 
 /**
@@ -111,6 +120,10 @@ protected:
 class MockAdmissionContext : public AdmissionContext {
 public:
     MockAdmissionContext() = default;
+
+    void setOperationDeadline(Date_t deadline) {
+        _operationDeadline.store(deadline);
+    }
 };
 
 /**
@@ -0,0 +1,129 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/concurrency/deadline_ticketholder.h"
+
+#include <algorithm>
+#include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
+
+namespace mongo {
+
+DeadlineTicketHolder::DeadlineTicketHolder(ServiceContext* serviceContext,
+                                           int32_t numTickets,
+                                           int32_t fifoBypassThreshold,
+                                           bool trackPeakUsed)
+    : TicketHolder(serviceContext, numTickets, trackPeakUsed),
+      _pool(numTickets, fifoBypassThreshold) {}
+
+int32_t DeadlineTicketHolder::available() const {
+    return _pool.available();
+}
+
+int64_t DeadlineTicketHolder::queued() const {
+    return _pool.queued();
+}
+
+int64_t DeadlineTicketHolder::numFinishedProcessing() const {
+    return _stats.totalFinishedProcessing.load();
+}
+
+int64_t DeadlineTicketHolder::fifoAdmissions() const {
+    return _pool.getQueue().fifoAdmissions();
+}
+
+void DeadlineTicketHolder::updateFifoBypassThreshold(int32_t newFifoBypassThreshold) {
+    _pool.getQueue().updateFifoBypassThreshold(newFifoBypassThreshold);
+}
+
+boost::optional<Ticket> DeadlineTicketHolder::_tryAcquireImpl(AdmissionContext* admCtx) {
+    invariant(admCtx);
+
+    if (_pool.tryAcquire()) {
+        return _makeTicket(admCtx);
+    }
+
+    return boost::none;
+}
+
+boost::optional<Ticket> DeadlineTicketHolder::_waitForTicketUntilImpl(OperationContext* opCtx,
+                                                                      AdmissionContext* admCtx,
+                                                                      Date_t until,
+                                                                      bool interruptible) {
+    invariant(admCtx);
+
+    while (true) {
+        // To support interruptibility of ticket acquisition, we attempt to acquire a ticket for a
+        // maximum period of time. This may or may not succeed, in which case we will retry until
+        // timing out or getting interrupted.
+        auto maxUntil = std::min(until, Date_t::now() + Milliseconds(500));
+        auto acquired = _pool.acquire(admCtx, maxUntil);
+        ScopeGuard rereleaseIfTimedOutOrInterrupted([&] {
+            // We may have gotten a ticket that we can't use, release it back to the ticket pool.
+            if (acquired) {
+                _pool.release();
+            }
+        });
+
+        if (interruptible) {
+            opCtx->checkForInterrupt();
+        }
+
+        if (acquired) {
+            rereleaseIfTimedOutOrInterrupted.dismiss();
+            return _makeTicket(admCtx);
+        } else if (maxUntil == until) {
+            // We hit the end of our deadline, so return nothing.
+            return boost::none;
+        }
+        // We hit the periodic deadline, but are still within the caller's deadline, so retry.
+    }
+
+    return boost::none;
+}
+
+void DeadlineTicketHolder::_releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept {
+    _pool.release();
+}
+
+void DeadlineTicketHolder::_appendImplStats(BSONObjBuilder& b) const {
+    BSONObjBuilder bb(b.subobjStart("normalPriority"));
+    _appendCommonQueueImplStats(bb, _stats);
+    bb.append("fifoAdmissions", fifoAdmissions());
+    bb.done();
+}
+
+}  // namespace mongo
@@ -0,0 +1,94 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstdint>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/concurrency/ticket_pool.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class Ticket;
+
+/**
+ * A DeadlineTicketHolder queues operations waiting for a ticket in earliest-deadline-first order,
+ * so operations with little time left before their deadline (e.g. interactive queries with a short
+ * maxTimeMS) are admitted ahead of operations which can afford to keep waiting. Operations without
+ * a deadline are admitted last, in arrival order. To bound starvation of far-deadline operations,
+ * every fifoBypassThreshold-th admission goes to the longest-waiting operation instead.
+ */
+class DeadlineTicketHolder : public TicketHolder {
+public:
+    explicit DeadlineTicketHolder(ServiceContext* serviceContext,
+                                  int32_t numTickets,
+                                  int32_t fifoBypassThreshold,
+                                  bool trackPeakUsed);
+    ~DeadlineTicketHolder() override{};
+
+    int32_t available() const final;
+
+    int64_t queued() const final;
+
+    int64_t numFinishedProcessing() const final;
+
+    /**
+     * Number of times the longest-waiting operation was admitted ahead of one with an earlier
+     * deadline in order to bound starvation.
+     */
+    std::int64_t fifoAdmissions() const;
+
+    void updateFifoBypassThreshold(int32_t newFifoBypassThreshold);
+
+private:
+    boost::optional<Ticket> _tryAcquireImpl(AdmissionContext* admCtx) final;
+
+    boost::optional<Ticket> _waitForTicketUntilImpl(OperationContext* opCtx,
+                                                    AdmissionContext* admCtx,
+                                                    Date_t until,
+                                                    bool interruptible) final;
+
+    void _releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept final;
+
+    QueueStats& _getQueueStatsToUse(AdmissionContext::Priority priority) noexcept final {
+        return _stats;
+    }
+
+    void _appendImplStats(BSONObjBuilder& b) const final;
+
+    QueueStats _stats;
+    TicketPool<EarliestDeadlineTicketQueue> _pool;
+};
+}  // namespace mongo
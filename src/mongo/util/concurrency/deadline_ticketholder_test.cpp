@@ -0,0 +1,91 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/concurrency/deadline_ticketholder.h"
+
+#include <memory>
+
+#include "mongo/unittest/framework.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/concurrency/ticketholder_test_fixture.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/tick_source_mock.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
+
+namespace {
+using namespace mongo;
+
+// By default, tests will create a DeadlineTicketHolder which always admits in
+// earliest-deadline-first order, with the longest-waiting operation never admitted out of order.
+static constexpr int kDefaultFifoBypassThreshold = 0;
+
+class DeadlineTicketHolderTest : public TicketHolderTestFixture {
+public:
+    void setUp() override {
+        TicketHolderTestFixture::setUp();
+
+        auto tickSource = std::make_unique<TickSourceMock<Microseconds>>();
+        _tickSource = tickSource.get();
+        getServiceContext()->setTickSource(std::move(tickSource));
+    }
+
+    TickSourceMock<Microseconds>* getTickSource() {
+        return _tickSource;
+    }
+
+private:
+    TickSourceMock<Microseconds>* _tickSource;
+};
+
+TEST_F(DeadlineTicketHolderTest, BasicTimeoutDeadline) {
+    basicTimeout(_opCtx.get(),
+                 std::make_unique<DeadlineTicketHolder>(getServiceContext(),
+                                                        1,
+                                                        kDefaultFifoBypassThreshold,
+                                                        false /* trackPeakUsed */));
+}
+
+TEST_F(DeadlineTicketHolderTest, ResizeStatsDeadline) {
+    resizeTest(_opCtx.get(),
+               std::make_unique<DeadlineTicketHolder>(getServiceContext(),
+                                                      1,
+                                                      kDefaultFifoBypassThreshold,
+                                                      false /* trackPeakUsed */),
+               getTickSource());
+}
+
+TEST_F(DeadlineTicketHolderTest, Interruption) {
+    interruptTest(_opCtx.get(),
+                  std::make_unique<DeadlineTicketHolder>(getServiceContext(),
+                                                         1,
+                                                         kDefaultFifoBypassThreshold,
+                                                         false /* trackPeakUsed */));
+}
+}  // namespace
@@ -182,6 +182,7 @@ TEST_F(PriorityTicketHolderTest, PriorityTwoQueuedOperations) {
     ASSERT_EQ(lowPriorityStats.getIntField("addedToQueue"), 1);
     ASSERT_EQ(lowPriorityStats.getIntField("removedFromQueue"), 1);
     ASSERT_EQ(lowPriorityStats.getIntField("queueLength"), 0);
+    ASSERT_EQ(lowPriorityStats.getIntField("peakQueueLength"), 1);
     ASSERT_EQ(lowPriorityStats.getIntField("startedProcessing"), 2);
     ASSERT_EQ(lowPriorityStats.getIntField("processing"), 0);
     ASSERT_EQ(lowPriorityStats.getIntField("finishedProcessing"), 2);
@@ -192,6 +193,7 @@ TEST_F(PriorityTicketHolderTest, PriorityTwoQueuedOperations) {
     ASSERT_EQ(normalPriorityStats.getIntField("addedToQueue"), 1);
     ASSERT_EQ(normalPriorityStats.getIntField("removedFromQueue"), 1);
     ASSERT_EQ(normalPriorityStats.getIntField("queueLength"), 0);
+    ASSERT_EQ(normalPriorityStats.getIntField("peakQueueLength"), 1);
     ASSERT_EQ(normalPriorityStats.getIntField("startedProcessing"), 1);
     ASSERT_EQ(normalPriorityStats.getIntField("processing"), 0);
     ASSERT_EQ(normalPriorityStats.getIntField("finishedProcessing"), 1);
@@ -207,5 +207,6 @@ void TicketPool<Queue>::release() {
 
 template class TicketPool<FifoTicketQueue>;
 template class TicketPool<SimplePriorityTicketQueue>;
+template class TicketPool<EarliestDeadlineTicketQueue>;
 
 }  // namespace mongo
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <queue>
 #include <utility>
@@ -183,6 +184,86 @@ private:
     std::queue<std::shared_ptr<TicketWaiter>> _low;
 };
 
+/**
+ * The EarliestDeadlineTicketQueue dequeues the waiter whose operation deadline expires soonest, so
+ * operations with little time left to run are admitted ahead of operations that can afford to keep
+ * waiting. Ties, and waiters without a deadline (whose deadline is Date_t::max()), are dequeued in
+ * arrival order. To bound how long a far-deadline waiter can be overtaken by later arrivals, every
+ * fifoBypassThreshold-th admission dequeues the longest-waiting operation instead of the one with
+ * the earliest deadline. A threshold of zero disables the bypass.
+ */
+class EarliestDeadlineTicketQueue : public TicketQueue {
+public:
+    EarliestDeadlineTicketQueue(int32_t fifoBypassThreshold)
+        : _fifoBypassThreshold(fifoBypassThreshold) {}
+
+    void push(std::shared_ptr<TicketWaiter> val) final {
+        // The operation deadline must be captured here, where the queue lock is held and the
+        // waiter is still in the Waiting state. By the time this waiter is popped it may have
+        // timed out, at which point its context may no longer be dereferenced.
+        auto deadline = val->context->getOperationDeadline();
+        auto arrival = _nextArrival++;
+        auto it = _byDeadline.emplace(DeadlineKey{deadline, arrival}, std::move(val)).first;
+        _byArrival.emplace(arrival, it);
+    }
+
+    std::shared_ptr<TicketWaiter> pop() final {
+        if (_byDeadline.empty()) {
+            return nullptr;
+        }
+        auto it = _byDeadline.begin();
+        if (_fifoBypassThreshold.load() > 0 &&
+            _fifoBypassCount.fetchAndAdd(1) % _fifoBypassThreshold.load() == 0) {
+            auto oldest = _byArrival.begin()->second;
+            if (oldest != it) {
+                _fifoAdmissions.addAndFetch(1);
+                it = oldest;
+            }
+        }
+        auto waiter = std::move(it->second);
+        _byArrival.erase(it->first.second);
+        _byDeadline.erase(it);
+        return waiter;
+    }
+
+    /**
+     * Returns the number of times the longest-waiting operation was admitted ahead of one with an
+     * earlier deadline in order to bound starvation.
+     */
+    std::int64_t fifoAdmissions() const {
+        return _fifoAdmissions.loadRelaxed();
+    }
+
+    void updateFifoBypassThreshold(int32_t newFifoBypassThreshold) {
+        _fifoBypassThreshold.store(newFifoBypassThreshold);
+    }
+
+private:
+    // Orders waiters by operation deadline, with the arrival number breaking ties FIFO.
+    using DeadlineKey = std::pair<Date_t, uint64_t>;
+
+    /**
+     * Limits the number of times waiters are dequeued in deadline order before the
+     * longest-waiting operation is admitted instead.
+     */
+    AtomicWord<std::int32_t> _fifoBypassThreshold;
+
+    /**
+     * Number of times ticket admission went to the longest-waiting operation rather than the one
+     * with the earliest deadline.
+     */
+    AtomicWord<std::int64_t> _fifoAdmissions{0};
+
+    /**
+     * Counts dequeues so that every _fifoBypassThreshold-th one is served in arrival order. We
+     * explicitly use an unsigned type here because rollover is desired.
+     */
+    AtomicWord<std::uint64_t> _fifoBypassCount{0};
+
+    uint64_t _nextArrival = 0;
+    std::map<DeadlineKey, std::shared_ptr<TicketWaiter>> _byDeadline;
+    std::map<uint64_t, std::map<DeadlineKey, std::shared_ptr<TicketWaiter>>::iterator> _byArrival;
+};
 
 /**
  * A TicketPool holds tickets and queues waiters in the provided TicketQueue. The TicketPool
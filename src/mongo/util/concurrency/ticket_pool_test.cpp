@@ -144,4 +144,59 @@ TEST(TicketPoolTest, HandOverWorks) {
         }
     }
 }
+
+std::shared_ptr<TicketWaiter> makeWaiter(AdmissionContext* ctx) {
+    auto waiter = std::make_shared<TicketWaiter>();
+    waiter->context = ctx;
+    return waiter;
+}
+
+TEST(TicketPoolTest, EarliestDeadlineOrdering) {
+    EarliestDeadlineTicketQueue queue(0 /* fifoBypassThreshold */);
+
+    auto now = Date_t::now();
+    MockAdmissionContext farDeadline, nearDeadline, nearDeadlineTie, noDeadline;
+    farDeadline.setOperationDeadline(now + Seconds{30});
+    nearDeadline.setOperationDeadline(now + Seconds{10});
+    nearDeadlineTie.setOperationDeadline(now + Seconds{10});
+
+    auto farWaiter = makeWaiter(&farDeadline);
+    auto nearWaiter = makeWaiter(&nearDeadline);
+    auto nearTieWaiter = makeWaiter(&nearDeadlineTie);
+    auto noDeadlineWaiter = makeWaiter(&noDeadline);
+
+    queue.push(farWaiter);
+    queue.push(noDeadlineWaiter);
+    queue.push(nearWaiter);
+    queue.push(nearTieWaiter);
+
+    ASSERT_EQ(queue.pop().get(), nearWaiter.get());
+    // Equal deadlines are dequeued in arrival order.
+    ASSERT_EQ(queue.pop().get(), nearTieWaiter.get());
+    ASSERT_EQ(queue.pop().get(), farWaiter.get());
+    // Waiters without a deadline sort last.
+    ASSERT_EQ(queue.pop().get(), noDeadlineWaiter.get());
+    ASSERT_FALSE(queue.pop());
+    ASSERT_EQ(queue.fifoAdmissions(), 0);
+}
+
+TEST(TicketPoolTest, EarliestDeadlineFifoBypass) {
+    // With a threshold of 2, every other admission goes to the longest-waiting waiter rather than
+    // the one with the earliest deadline.
+    EarliestDeadlineTicketQueue queue(2 /* fifoBypassThreshold */);
+
+    MockAdmissionContext waitingLongest, nearDeadline;
+    nearDeadline.setOperationDeadline(Date_t::now() + Seconds{1});
+
+    auto longestWaiter = makeWaiter(&waitingLongest);
+    auto nearWaiter = makeWaiter(&nearDeadline);
+
+    queue.push(longestWaiter);
+    queue.push(nearWaiter);
+
+    ASSERT_EQ(queue.pop().get(), longestWaiter.get());
+    ASSERT_EQ(queue.fifoAdmissions(), 1);
+    ASSERT_EQ(queue.pop().get(), nearWaiter.get());
+    ASSERT_EQ(queue.fifoAdmissions(), 1);
+}
 }  // namespace
@@ -30,6 +30,7 @@
 #include "mongo/util/concurrency/ticketholder.h"
 
 #include "mongo/db/operation_context.h"
+#include "mongo/platform/usdt.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/tick_source.h"
@@ -117,6 +118,7 @@ void TicketHolder::_releaseToTicketPool(Ticket& ticket) noexcept {
     auto& queueStats = _getQueueStatsToUse(ticket._priority);
     _updateQueueStatsOnRelease(queueStats, ticket);
     _releaseToTicketPoolImpl(ticket._admissionContext);
+    MONGO_USDT(ticket_released, this, ticket._admissionContext);
 }
 
 Ticket TicketHolder::waitForTicket(OperationContext* opCtx, AdmissionContext* admCtx) {
@@ -136,6 +138,7 @@ boost::optional<Ticket> TicketHolder::tryAcquire(AdmissionContext* admCtx) {
         auto& queueStats = _getQueueStatsToUse(admCtx->getPriority());
         _updateQueueStatsOnTicketAcquisition(admCtx, queueStats);
         _updatePeakUsed();
+        MONGO_USDT(ticket_acquired, this, admCtx);
     }
 
     return ticket;
@@ -150,9 +153,17 @@ boost::optional<Ticket> TicketHolder::_waitForTicketUntil(OperationContext* opCt
         return ticket;
     }
 
+    // Stamp the operation's own deadline (typically derived from maxTimeMS at the service entry
+    // point) before queueing, so deadline-aware queueing policies can admit the soonest-expiring
+    // waiter first.
+    admCtx->_operationDeadline.store(opCtx->getDeadline());
+
+    MONGO_USDT(ticket_queued, this, admCtx);
+
     auto& queueStats = _getQueueStatsToUse(admCtx->getPriority());
     auto tickSource = _serviceContext->getTickSource();
     queueStats.totalAddedQueue.fetchAndAddRelaxed(1);
+    _updatePeakQueueLength(queueStats);
     ON_BLOCK_EXIT([&, startWaitTime = tickSource->getTicks()] {
         auto waitDelta = tickSource->ticksTo<Microseconds>(tickSource->getTicks() - startWaitTime);
         queueStats.totalTimeQueuedMicros.fetchAndAddRelaxed(waitDelta.count());
@@ -171,6 +182,7 @@ boost::optional<Ticket> TicketHolder::_waitForTicketUntil(OperationContext* opCt
         cancelWait.dismiss();
         _updateQueueStatsOnTicketAcquisition(admCtx, queueStats);
         _updatePeakUsed();
+        MONGO_USDT(ticket_acquired, this, admCtx);
         return ticket;
     } else {
         return boost::none;
@@ -205,6 +217,17 @@ void TicketHolder::_updatePeakUsed() {
     }
 }
 
+void TicketHolder::_updatePeakQueueLength(QueueStats& queueStats) {
+    auto currentQueued = std::max(
+        queueStats.totalAddedQueue.loadRelaxed() - queueStats.totalRemovedQueue.loadRelaxed(),
+        (int64_t)0);
+    auto peakQueued = queueStats.peakQueueLength.load();
+
+    while (currentQueued > peakQueued &&
+           !queueStats.peakQueueLength.compareAndSwap(&peakQueued, currentQueued)) {
+    }
+}
+
 void TicketHolder::_appendCommonQueueImplStats(BSONObjBuilder& b, const QueueStats& stats) const {
     auto removed = stats.totalRemovedQueue.loadRelaxed();
     auto added = stats.totalAddedQueue.loadRelaxed();
@@ -212,6 +235,7 @@ void TicketHolder::_appendCommonQueueImplStats(BSONObjBuilder& b, const QueueSta
     b.append("addedToQueue", added);
     b.append("removedFromQueue", removed);
     b.append("queueLength", std::max(added - removed, (int64_t)0));
+    b.append("peakQueueLength", stats.peakQueueLength.loadRelaxed());
 
     auto finished = stats.totalFinishedProcessing.loadRelaxed();
     auto started = stats.totalStartedProcessing.loadRelaxed();
@@ -154,6 +154,9 @@ public:
         AtomicWord<std::int64_t> totalStartedProcessing{0};
         AtomicWord<std::int64_t> totalCanceled{0};
         AtomicWord<std::int64_t> totalTimeQueuedMicros{0};
+        // Most operations concurrently waiting in this queue at any point since startup. Tracked
+        // per queue so a deep batch/low-priority backlog is distinguishable from interactive load.
+        AtomicWord<std::int64_t> peakQueueLength{0};
     };
 
     /**
@@ -196,6 +199,8 @@ private:
 
     void _updatePeakUsed();
 
+    void _updatePeakQueueLength(QueueStats& queueStats);
+
     const bool _trackPeakUsed;
 
     void _updateQueueStatsOnRelease(TicketHolder::QueueStats& queueStats, const Ticket& ticket);
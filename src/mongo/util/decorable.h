@@ -66,11 +66,13 @@
 #include <fmt/format.h>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <numeric>
 #include <sstream>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include "mongo/util/assert_util.h"
@@ -78,6 +80,98 @@
 
 namespace mongo {
 
+/**
+ * A decoration payload that defers construction of its `T` until first access.
+ *
+ * Decorable construction runs the constructor of every registered decoration, so types that are
+ * expensive to construct penalize every instance of the decorated type, even instances that never
+ * touch them (e.g. short-lived internal OperationContexts). Declaring the decoration as
+ * `LazyInit<T>` instead makes construction free: the all-zero decoration buffer already represents
+ * the "not yet constructed" state, so the constructor is skipped entirely (see
+ * `decorable_detail::pretendTrivialInit` below), and `T` is default-constructed on the first call
+ * to `get()`.
+ *
+ * First-touch construction is not synchronized. This matches the thread-safety contract of
+ * decorations generally (callers synchronize access to a shared decorable), but it does mean a
+ * decoration that is first touched concurrently from multiple threads must not use `LazyInit`.
+ */
+template <typename T>
+class LazyInit {
+public:
+    LazyInit() = default;
+
+    LazyInit(const LazyInit& other) {
+        if (other._constructed)
+            _construct(other.get());
+    }
+
+    LazyInit& operator=(const LazyInit& other) {
+        if (this == &other)
+            return *this;
+        if (!other._constructed) {
+            reset();
+        } else if (_constructed) {
+            get() = other.get();
+        } else {
+            _construct(other.get());
+        }
+        return *this;
+    }
+
+    ~LazyInit() {
+        reset();
+    }
+
+    /**
+     * Returns the contained `T`, default-constructing it on first access. Deep const semantics
+     * apply to the returned reference, but note that even the const overload may construct.
+     */
+    const T& get() const {
+        if (!_constructed)
+            _construct();
+        return *reinterpret_cast<const T*>(&_storage);
+    }
+    T& get() {
+        return const_cast<T&>(std::as_const(*this).get());
+    }
+
+    const T& operator*() const {
+        return get();
+    }
+    T& operator*() {
+        return get();
+    }
+    const T* operator->() const {
+        return &get();
+    }
+    T* operator->() {
+        return &get();
+    }
+
+    /** True if the contained `T` has been constructed. */
+    bool isInitialized() const {
+        return _constructed;
+    }
+
+    /** Destroys the contained `T`, if any, returning to the unconstructed state. */
+    void reset() noexcept {
+        if (_constructed) {
+            reinterpret_cast<T*>(&_storage)->~T();
+            _constructed = false;
+        }
+    }
+
+private:
+    template <typename... A>
+    void _construct(A&&... args) const {
+        new (&_storage) T(std::forward<A>(args)...);
+        _constructed = true;
+    }
+
+    mutable std::aligned_storage_t<sizeof(T), alignof(T)> _storage;
+    mutable bool _constructed = false;
+};
+
 namespace decorable_detail {
 
 template <typename T>
@@ -88,6 +182,10 @@ template <typename T>
 constexpr inline bool pretendTrivialInit<std::shared_ptr<T>> = true;
 template <typename T>
 constexpr inline bool pretendTrivialInit<boost::optional<T>> = true;
+// A default-constructed LazyInit is all zero bytes (unconstructed storage plus a false flag), so
+// the zeroed decoration buffer is already a valid representation of it.
+template <typename T>
+constexpr inline bool pretendTrivialInit<LazyInit<T>> = true;
 
 struct LifecycleOperations {
     using CtorFn = void(void*);
@@ -254,6 +254,46 @@ TEST_F(DecorableTest, CopyableDecorable) {
     ASSERT_EQ(x1[d2], x3[d2]);
 }
 
+TEST_F(DecorableTest, LazyInitDecoration) {
+    struct X : Decorable<X> {};
+    static auto d = X::declareDecoration<LazyInit<A>>();
+
+    {
+        X x;
+        ASSERT_EQ(stats.constructed, 0);
+        ASSERT_FALSE(x[d].isInitialized());
+
+        // First touch constructs; later touches return the same object.
+        ASSERT_EQ(x[d].get().value, 0);
+        ASSERT_EQ(stats.constructed, 1);
+        ASSERT_TRUE(x[d].isInitialized());
+        x[d]->value = 123;
+        ASSERT_EQ((*x[d]).value, 123);
+        ASSERT_EQ(stats.constructed, 1);
+    }
+    ASSERT_EQ(stats.destructed, 1);
+
+    // An untouched lazy decoration is never constructed, so there's nothing to destroy.
+    { X x; }
+    ASSERT_EQ(stats.constructed, 1);
+    ASSERT_EQ(stats.destructed, 1);
+}
+
+TEST_F(DecorableTest, LazyInitDecorationCopy) {
+    struct X : Decorable<X> {};
+    static auto d = X::declareDecoration<LazyInit<A>>();
+
+    X x1;
+    X x2(x1);
+    ASSERT_EQ(stats.copyConstructed, 0) << "copying an untouched lazy payload constructs nothing";
+    ASSERT_FALSE(x2[d].isInitialized());
+
+    x1[d]->value = 123;
+    X x3(x1);
+    ASSERT_EQ(stats.copyConstructed, 1);
+    ASSERT_EQ(x3[d]->value, 123);
+}
+
 #if 0
 TEST_F(DecorableTest, Inline) {
     class Inline : public Decorable<Inline> {
@@ -370,6 +410,10 @@ TEST_F(DecorableZeroInitTest, BufferNoChangeStdSharedPtr) {
     doBufferNoChangeTest<std::shared_ptr<A>>();
 }
 
+TEST_F(DecorableZeroInitTest, BufferNoChangeLazyInit) {
+    doBufferNoChangeTest<LazyInit<A>>();
+}
+
 TEST_F(DecorableZeroInitTest, ZeroInitBoostOptionalDecoration) {
     doZeroInitTest<boost::optional<A>>();
 }
@@ -382,5 +426,9 @@ TEST_F(DecorableZeroInitTest, ZeroInitStdSharedPtrDecoration) {
     doZeroInitTest<std::shared_ptr<A>>();
 }
 
+TEST_F(DecorableZeroInitTest, ZeroInitLazyInitDecoration) {
+    doZeroInitTest<LazyInit<A>>();
+}
+
 }  // namespace
 }  // namespace mongo
@@ -83,8 +83,7 @@ public:
     ~MonotonicBufferResource() {
         while (_chunks) {
             auto ch = std::exchange(_chunks, _chunks->next);
-            _upstream.deallocate(ch->buf, ch->sz, alignof(std::max_align_t));
-            _upstream.deallocate(ch, sizeof(Chunk), alignof(Chunk));
+            _upstream.deallocate(ch, kChunkHeaderSize + ch->sz, alignof(std::max_align_t));
         }
     }
 
@@ -118,16 +117,18 @@ private:
         size_t sz;
     };
 
+    /** Size of the chunk header, padded so that the buffer behind it stays maximally aligned. */
+    static constexpr size_t kChunkHeaderSize =
+        (sizeof(Chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
     MONGO_COMPILER_NOINLINE MONGO_COMPILER_COLD_FUNCTION void _newChunk(size_t sz, size_t al) {
-        auto newChunk = static_cast<Chunk*>(_upstream.allocate(sizeof(Chunk), alignof(Chunk)));
-        try {
-            auto chunkSize = std::max(_nextBufSize, sz);
-            newChunk->buf = _upstream.allocate(chunkSize, alignof(std::max_align_t));
-            newChunk->sz = chunkSize;
-        } catch (...) {
-            _upstream.deallocate(newChunk, sizeof(Chunk), alignof(Chunk));
-            throw;
-        }
+        // The chunk header lives at the front of the chunk's own buffer, so that each chunk
+        // costs a single upstream allocation.
+        auto chunkSize = std::max(_nextBufSize, sz);
+        auto base = _upstream.allocate(kChunkHeaderSize + chunkSize, alignof(std::max_align_t));
+        auto newChunk = new (base) Chunk;
+        newChunk->buf = static_cast<std::byte*>(base) + kChunkHeaderSize;
+        newChunk->sz = chunkSize;
         newChunk->next = std::exchange(_chunks, newChunk);
         _free = newChunk->buf;
         _freeSize = newChunk->sz;
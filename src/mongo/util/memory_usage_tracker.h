@@ -46,6 +46,11 @@
 
 namespace mongo {
 
+class ChunkedMemoryAggregator;
+
+template <typename Tracker>
+class MemoryUsageHandleImpl;
+
 /**
  * This is a utility class for tracking memory usage across multiple arbitrary operators or
  * functions, which are identified by their string names. Tracks both current and highest
@@ -85,6 +90,8 @@ public:
             }
             if (_base) {
                 _base->add(diff);
+            } else if (_upstreamHandle) {
+                _addUpstream(diff);
             }
         }
 
@@ -109,8 +116,18 @@ public:
         }
 
     private:
+        friend class MemoryUsageTracker;
+
+        // Forwards 'diff' to '_upstreamHandle'. Defined out of line because forwarding requires
+        // the complete 'ChunkedMemoryAggregator' type, whose header includes this one.
+        void _addUpstream(int64_t diff);
+
         Impl* _base = nullptr;
 
+        // Set only on the base tracker of a 'MemoryUsageTracker' that has been attached to a
+        // 'ChunkedMemoryAggregator' via 'attachTo()'.
+        MemoryUsageHandleImpl<ChunkedMemoryAggregator>* _upstreamHandle = nullptr;
+
         // Maximum memory consumption thus far observed for this function.
         int64_t _maxMemoryBytes = 0;
         // Tracks the current memory footprint.
@@ -122,6 +139,18 @@ public:
     MemoryUsageTracker(bool allowDiskUse = false, int64_t maxMemoryUsageBytes = 0)
         : _allowDiskUse(allowDiskUse), _baseTracker(nullptr, maxMemoryUsageBytes) {}
 
+    // Out of line because destroying '_upstreamHandle' requires the complete
+    // 'ChunkedMemoryAggregator' type.
+    ~MemoryUsageTracker();
+
+    /**
+     * Attaches this tracker to 'aggregator' so that every subsequent change to the total memory
+     * usage is also reported upstream as a delta, without affecting the per-tracker accounting or
+     * limit enforcement. Memory that is already tracked is reported immediately. The aggregator
+     * must outlive this tracker. May be called at most once.
+     */
+    void attachTo(ChunkedMemoryAggregator* aggregator);
+
     /**
      * Sets the new total for 'name', and updates the current total memory usage.
      */
@@ -217,6 +246,8 @@ private:
     Impl _baseTracker;
     // Tracks memory consumption per function using the output field name as a key.
     stdx::unordered_map<std::string, Impl> _functionMemoryTracker;
+    // When attached, propagates all updates of the base tracker to a 'ChunkedMemoryAggregator'.
+    std::unique_ptr<MemoryUsageHandleImpl<ChunkedMemoryAggregator>> _upstreamHandle;
 };
 
 // Lightweight version of memory usage tracker for use cases where we don't need historical maximum
@@ -32,6 +32,7 @@
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/framework.h"
+#include "mongo/util/concurrent_memory_aggregator.h"
 
 namespace mongo {
 namespace {
@@ -239,5 +240,35 @@ TEST_F(MemoryUsageTrackerTest, MemoryUsageTokenWith) {
     }
 }
 
+TEST_F(MemoryUsageTrackerTest, AttachToMemoryAggregatorPropagatesUpdates) {
+    ConcurrentMemoryAggregator parentAggregator;
+    auto aggregator =
+        parentAggregator.createChunkedMemoryAggregator(ChunkedMemoryAggregator::Options{});
+
+    {
+        MemoryUsageTracker tracker(false /** allowDiskUse */, kDefaultMax);
+        tracker.add(50LL);
+
+        // Memory that is already tracked when attaching is reported immediately.
+        tracker.attachTo(aggregator.get());
+        ASSERT_EQ(aggregator->getCurrentMemoryUsageBytes(), 50LL);
+
+        // Updates to both the base tracker and per-function trackers propagate upstream.
+        tracker.add(25LL);
+        tracker.add("funcTracker", 30LL);
+        ASSERT_EQ(tracker.currentMemoryBytes(), 105LL);
+        ASSERT_EQ(aggregator->getCurrentMemoryUsageBytes(), 105LL);
+
+        // Decreases propagate as well, and the per-tracker accounting is unaffected.
+        tracker.add("funcTracker", -30LL);
+        ASSERT_EQ(tracker.currentMemoryBytes(), 75LL);
+        ASSERT_EQ(tracker.maxMemoryBytes(), 105LL);
+        ASSERT_EQ(aggregator->getCurrentMemoryUsageBytes(), 75LL);
+    }
+
+    // Destroying the tracker releases its remaining usage from the aggregator.
+    ASSERT_EQ(aggregator->getCurrentMemoryUsageBytes(), 0LL);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -248,5 +248,74 @@ TEST(ExecutorTest, GuaranteedExecutor_MainAccepts_FallbackAccepts) {
     ASSERT_EQ(countExecB->tasksRun.load(), 0);
 }
 
+TEST(ExecutorTest, InlineContinuationExecutor_PassesThroughFromOutsideContext) {
+    // Tasks scheduled from outside one of the wrapper's own tasks go to the underlying executor.
+    const auto countExec = InlineRecursiveCountingExecutor::make();
+    const auto inlineExec = makeInlineContinuationExecutor(countExec);
+
+    static constexpr size_t kCount = 1000;
+    for (size_t i = 0; i < kCount; ++i) {
+        inlineExec->schedule([&](Status status) { ASSERT_OK(status); });
+    }
+
+    ASSERT_EQ(countExec->tasksRun.load(), kCount);
+}
+
+TEST(ExecutorTest, InlineContinuationExecutor_InlinesFromWithinTask) {
+    // A task scheduled from within one of the wrapper's tasks runs inline, without a trip through
+    // the underlying executor.
+    const auto countExec = InlineRecursiveCountingExecutor::make();
+    const auto inlineExec = makeInlineContinuationExecutor(countExec);
+
+    bool outerRan = false;
+    bool innerRan = false;
+    inlineExec->schedule([&](Status status) {
+        ASSERT_OK(status);
+        outerRan = true;
+        inlineExec->schedule([&](Status innerStatus) {
+            ASSERT_OK(innerStatus);
+            innerRan = true;
+        });
+        // The inner task must have completed before the outer task finishes.
+        ASSERT(innerRan);
+    });
+
+    ASSERT(outerRan);
+    ASSERT(innerRan);
+    ASSERT_EQ(countExec->tasksRun.load(), 1);
+}
+
+TEST(ExecutorTest, InlineContinuationExecutor_SharedContextAcrossWrappers) {
+    // Wrappers of the same underlying executor share one inlining context, while a wrapper of a
+    // different executor still reschedules.
+    const auto countExecA = InlineRecursiveCountingExecutor::make();
+    const auto countExecB = InlineRecursiveCountingExecutor::make();
+    const auto inlineExecA1 = makeInlineContinuationExecutor(countExecA);
+    const auto inlineExecA2 = makeInlineContinuationExecutor(countExecA);
+    const auto inlineExecB = makeInlineContinuationExecutor(countExecB);
+
+    inlineExecA1->schedule([&](Status status) {
+        ASSERT_OK(status);
+        inlineExecA2->schedule([&](Status s) { ASSERT_OK(s); });
+        inlineExecB->schedule([&](Status s) { ASSERT_OK(s); });
+    });
+
+    ASSERT_EQ(countExecA->tasksRun.load(), 1);
+    ASSERT_EQ(countExecB->tasksRun.load(), 1);
+}
+
+TEST(ExecutorTest, InlineContinuationExecutor_PropagatesRejection) {
+    // A rejection from the underlying executor reaches the task unchanged.
+    const auto rejectExec = RejectingExecutor::make();
+    const auto inlineExec = makeInlineContinuationExecutor(rejectExec);
+
+    bool ran = false;
+    inlineExec->schedule([&](Status status) {
+        ASSERT_NOT_OK(status);
+        ran = true;
+    });
+    ASSERT(ran);
+}
+
 }  // namespace
 }  // namespace mongo
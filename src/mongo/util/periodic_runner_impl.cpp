@@ -52,6 +52,29 @@
 
 namespace mongo {
 
+namespace {
+
+// Jobs with intervals at or above the threshold have their wakeup deadlines rounded up to the next
+// quantum boundary. Long-interval housekeeping jobs then wake in batches on shared boundaries
+// instead of each sleeping thread taking its own timer interrupt, which cuts idle wakeups when
+// dozens of such jobs are registered. Short-interval jobs keep exact deadlines so the rounding
+// never costs a meaningful fraction of the period.
+constexpr Milliseconds kWakeupCoalescingThreshold{1000};
+constexpr Milliseconds kWakeupCoalescingQuantum{100};
+
+Date_t coalesceDeadline(Date_t deadline, Milliseconds interval) {
+    if (interval < kWakeupCoalescingThreshold) {
+        return deadline;
+    }
+    auto remainder = deadline.toMillisSinceEpoch() % kWakeupCoalescingQuantum.count();
+    if (remainder > 0) {
+        deadline += kWakeupCoalescingQuantum - Milliseconds(remainder);
+    }
+    return deadline;
+}
+
+}  // namespace
+
 PeriodicRunnerImpl::PeriodicRunnerImpl(ServiceContext* svc, ClockSource* clockSource)
     : _svc(svc), _clockSource(clockSource) {}
 
@@ -118,8 +141,19 @@ void PeriodicRunnerImpl::PeriodicJobImpl::_run() {
                 _job.job(client.get());
                 lk.lock();
 
+                if (auto elapsed = _clockSource->now() - start; elapsed > _job.interval) {
+                    _numOverruns++;
+                    LOGV2_DEBUG(9106703,
+                                2,
+                                "Periodic job ran longer than its interval",
+                                "name"_attr = _job.name,
+                                "elapsed"_attr = elapsed,
+                                "interval"_attr = _job.interval,
+                                "numOverruns"_attr = _numOverruns);
+                }
+
                 auto getDeadlineFromInterval = [&] {
-                    return start + _job.interval;
+                    return coalesceDeadline(start + _job.interval, _job.interval);
                 };
 
                 do {
@@ -93,6 +93,11 @@ private:
          * The current execution status of the job.
          */
         ExecutionStatus _execStatus{ExecutionStatus::NOT_SCHEDULED};
+
+        /**
+         * The number of executions that ran longer than the job's interval. Guarded by '_mutex'.
+         */
+        int64_t _numOverruns = 0;
     };
 
     std::shared_ptr<PeriodicRunnerImpl::PeriodicJobImpl> createAndAddJob(PeriodicJob job);
@@ -70,6 +70,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/util/assert_util_core.h"
+#include "mongo/util/ctype.h"
 #include "mongo/util/errno_util.h"
 #include "mongo/util/pcre.h"
 #include "mongo/util/str.h"
@@ -843,6 +844,48 @@ std::vector<std::string> findPhysicalDisks(StringData sysBlockPath) {
     return files;
 }
 
+std::vector<std::string> findNumaNodes(StringData sysNodePath) {
+    boost::system::error_code ec;
+    auto sysNodePathStr = sysNodePath.toString();
+
+    auto statusSysNode = boost::filesystem::status(sysNodePathStr, ec);
+    if (ec || !boost::filesystem::exists(statusSysNode) ||
+        !boost::filesystem::is_directory(statusSysNode)) {
+        // Kernels without NUMA support do not populate this directory; that is not worth a
+        // warning.
+        return {};
+    }
+
+    boost::filesystem::directory_iterator di(sysNodePathStr, ec);
+    if (ec) {
+        LOGV2_WARNING(9987400,
+                      "Error getting directory iterator",
+                      "path"_attr = sysNodePathStr,
+                      "error"_attr = ec.message());
+        return {};
+    }
+
+    std::vector<std::string> nodes;
+
+    // The directory contains one "node<N>" directory per NUMA node alongside other entries such
+    // as "possible", "online" and "has_cpu".
+    for (; di != boost::filesystem::directory_iterator(); di++) {
+        auto filename = (*di).path().filename().generic_string();
+
+        constexpr auto prefix = "node"_sd;
+        if (filename.size() > prefix.size() && StringData(filename).startsWith(prefix) &&
+            std::all_of(filename.begin() + prefix.size(), filename.end(), ctype::isDigit)) {
+            nodes.push_back(std::move(filename));
+        }
+    }
+
+    std::sort(nodes.begin(), nodes.end(), [](const std::string& a, const std::string& b) {
+        return str::LexNumCmp::cmp(a, b, false) < 0;
+    });
+
+    return nodes;
+}
+
 // Here is an example of the type of string it supports:
 // Note: output has been trimmed
 //
@@ -204,6 +204,14 @@ Status parseProcSelfMountStatsFile(StringData filename, BSONObjBuilder* builder)
  */
 std::vector<std::string> findPhysicalDisks(StringData directory);
 
+/**
+ * Get a sorted vector of NUMA node directory names (e.g. "node0", "node1") by enumerating the
+ * specified directory, typically /sys/devices/system/node.
+ *
+ * If the directory does not exist, or otherwise permission is denied, returns an empty vector.
+ */
+std::vector<std::string> findNumaNodes(StringData directory);
+
 /**
  * Read a string matching /proc/vmstat format, and write the specified list of keys in builder.
  *
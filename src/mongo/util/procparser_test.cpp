@@ -591,6 +591,34 @@ TEST_F(FTDCProcDiskStats, TestFindPathNoPermission) {
     ASSERT_EQUALS(0UL, disks.size());
 }
 
+class FTDCProcNumaStat : public BaseProcTest {
+public:
+    std::vector<StringData> keys{
+        "numa_hit"_sd, "numa_miss"_sd, "numa_foreign"_sd, "local_node"_sd, "other_node"_sd};
+};
+
+TEST_F(FTDCProcNumaStat, TestFindNonExistentPath) {
+    auto nodes = procparser::findNumaNodes("/proc/does_not_exist");
+    ASSERT_EQUALS(0UL, nodes.size());
+}
+
+// Test we can enumerate the NUMA nodes on this machine and parse each node's numastat file. Not
+// every test environment exposes the NUMA topology, so an empty enumeration is acceptable.
+TEST_F(FTDCProcNumaStat, TestLocalNumaStat) {
+    auto nodes = procparser::findNumaNodes("/sys/devices/system/node");
+
+    for (const auto& node : nodes) {
+        LOGV2(9987401, "NODE:{node}", "node"_attr = node);
+
+        BSONObjBuilder builder;
+        ASSERT_OK(procparser::parseProcVMStatFile(
+            "/sys/devices/system/node/" + node + "/numastat", keys, &builder));
+
+        uint64Map = toStringMap(builder.done());
+        ASSERT_TRUE(contains(uint64Map, "numa_hit"));
+    }
+}
+
 // Test we can parse the /proc/diskstats on this machine. Also assert we have the expected fields
 // This tests is designed to exercise our parsing code on various Linuxes and fail
 // Normally when run in the FTDC loop we return a non-fatal error so we may not notice the failure
@@ -81,6 +81,14 @@ public:
         return _buffer.capacity();
     }
 
+    /**
+     * Returns a handle to the underlying ref-counted buffer, allowing ownership of the fragment to
+     * be shared with another structure (such as a BSONObj aliasing this fragment).
+     */
+    ConstSharedBuffer ownershipBuffer() const {
+        return _buffer;
+    }
+
 private:
     SharedBuffer _buffer;
     ptrdiff_t _offset;
@@ -39,13 +39,50 @@
 #include <fmt/format.h>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MONGO_STR_ESCAPE_USE_SSE 1
+#endif
+
 namespace mongo::str {
 namespace {
 constexpr char kHexChar[] = "0123456789abcdef";
 
+// Character class table for one escaper: 'true' marks a single-byte character that the escaper
+// passes through unmodified. Runs of such characters are bulk-skipped by the scan loop in
+// 'escape' and appended to the output in one piece rather than being dispatched byte-at-a-time.
+using PassthroughTable = std::array<bool, 256>;
+
+// Builds the passthrough table given the set of printable ASCII characters the escaper rewrites.
+// Control characters and DEL are never passed through, and bytes with the high bit set always
+// take the UTF-8 validation path.
+constexpr PassthroughTable makePassthroughTable(StringData escapedPrintables) {
+    PassthroughTable table{};
+    for (int c = 0x20; c < 0x7f; ++c) {
+        table[c] = true;
+    }
+    for (char c : escapedPrintables) {
+        table[static_cast<uint8_t>(c)] = false;
+    }
+    return table;
+}
+
+constexpr PassthroughTable kTextPassthrough = makePassthroughTable("\\"_sd);
+constexpr PassthroughTable kJSONPassthrough = makePassthroughTable("\\\""_sd);
+
+// validUTF8() never rewrites anything, so every ASCII byte is passed through.
+constexpr PassthroughTable kAllAsciiPassthrough = [] {
+    PassthroughTable table{};
+    for (int c = 0; c < 0x80; ++c) {
+        table[c] = true;
+    }
+    return table;
+}();
+
 struct NoopBuffer {
     void append(const char* begin, const char* end) {}
 };
@@ -76,6 +113,7 @@ template <typename Buffer,
           typename TwoByteEscaper>
 void escape(Buffer& buffer,
             StringData str,
+            const PassthroughTable& passthrough,
             SingleByteHandler singleHandler,
             InvalidByteHandler invalidByteHandler,
             TwoByteEscaper twoEscaper,
@@ -153,6 +191,39 @@ void escape(Buffer& buffer,
 
 
     while (it != inLast) {
+        // Bulk-skip runs of bytes that are passed through unmodified. They stay in the pending
+        // range [inFirst, it) and are appended to the output in one piece by the next flush. This
+        // is by far the hottest path: nearly all bytes in typical strings are unescaped ASCII.
+        for (;;) {
+#if defined(MONGO_STR_ESCAPE_USE_SSE)
+            // Scan a vector register at a time for bytes that any escaper may rewrite: control
+            // characters and bytes with the high bit set (both test true in the signed compare
+            // against 0x20), the quote, the backslash, and DEL. Candidates the table passes
+            // through are skipped by the scalar check below. Only full in-bounds loads are issued;
+            // the scalar loop handles the tail.
+            while (inLast - it >= 16) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+                __m128i stop = _mm_cmplt_epi8(chunk, _mm_set1_epi8(0x20));
+                stop = _mm_or_si128(stop, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')));
+                stop = _mm_or_si128(stop, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+                stop = _mm_or_si128(stop, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x7f)));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(stop));
+                if (mask) {
+                    it += countTrailingZerosNonZero32(mask);
+                    break;
+                }
+                it += 16;
+            }
+#endif
+            if (it == inLast || !passthrough[static_cast<uint8_t>(*it)]) {
+                break;
+            }
+            ++it;
+        }
+        if (it == inLast) {
+            break;
+        }
+
         uint8_t c = *it;
         bool bit7 = (c >> 7) & 1;
         if (MONGO_likely(!bit7)) {
@@ -344,6 +415,7 @@ void escapeForTextCommon(Buffer& buffer, StringData str, size_t maxLength, size_
     };
     return escape(buffer,
                   str,
+                  kTextPassthrough,
                   std::move(singleByteHandler),
                   std::move(invalidByteHandler),
                   std::move(twoByteEscaper),
@@ -494,6 +566,7 @@ void escapeForJSONCommon(Buffer& buffer, StringData str, size_t maxLength, size_
     };
     return escape(buffer,
                   str,
+                  kJSONPassthrough,
                   std::move(singleByteHandler),
                   std::move(invalidByteHandler),
                   std::move(twoByteEscaper),
@@ -530,6 +603,7 @@ bool validUTF8(StringData str) {
     try {
         escape(buffer,
                str,
+               kAllAsciiPassthrough,
                std::move(singleByteHandler),
                std::move(invalidByteHandler),
                std::move(twoByteEscaper),
@@ -35,6 +35,7 @@
 // IWYU pragma: no_include "bits/types/struct_tm.h"
 #include <cstdio>
 #include <cstring>
+#include <limits>
 #include <string>
 
 #include "mongo/base/error_codes.h"
@@ -183,28 +184,63 @@ std::string terseCurrentTimeForFilename(bool appendZed) {
     return buf;
 }
 
+namespace {
+// Caches the most recently formatted ISO 8601 timestamp, split around the milliseconds. The
+// calendar breakdown and 'strftime' rendering dominate the cost of formatting a timestamp, but
+// they only depend on the date down to whole seconds. Callers such as the log formatters render
+// timestamps in wall-clock order, so consecutive calls usually land in the same second and can
+// reuse the previous rendering, patching in only the milliseconds.
+struct Iso8601SecondCache {
+    static constexpr time_t kInvalid = std::numeric_limits<time_t>::min();
+
+    time_t timeT = kInvalid;
+    bool local = false;
+    size_t prefixLen = 0;
+    size_t suffixLen = 0;
+    char prefix[32];  // "%Y-%m-%dT%H:%M:%S"
+    char suffix[8];   // "Z" or "(+|-)hh:mm"
+};
+thread_local Iso8601SecondCache iso8601SecondCache;
+}  // namespace
+
 DateStringBuffer& DateStringBuffer::iso8601(Date_t date, bool local) {
     invariant(date.isFormattable());
 
-    struct tm t;
-    time_t_to_Struct(date.toTimeT(), &t, local);
-
     char* cur = _data.data();
     char* end = _data.data() + _data.size();
 
+    const auto millis = date.asInt64() % 1000;
+    const time_t timeT = date.toTimeT();
+
+    auto& cache = iso8601SecondCache;
+    if (timeT == cache.timeT && local == cache.local && millis >= 0) {
+        memcpy(cur, cache.prefix, cache.prefixLen);
+        cur += cache.prefixLen;
+        cur = fmt::format_to_n(cur, end - cur, FMT_COMPILE(".{:03}"), millis).out;
+        memcpy(cur, cache.suffix, cache.suffixLen);
+        cur += cache.suffixLen;
+        _size = cur - _data.data();
+        return *this;
+    }
+
+    struct tm t;
+    time_t_to_Struct(timeT, &t, local);
+
+    size_t prefixLen;
     {
         static constexpr char kIsoDateFmtNoTz[] = "%Y-%m-%dT%H:%M:%S";
-        size_t n = strftime(cur, end - cur, kIsoDateFmtNoTz, &t);
-        dassert(n > 0);
-        cur += n;
+        prefixLen = strftime(cur, end - cur, kIsoDateFmtNoTz, &t);
+        dassert(prefixLen > 0);
+        cur += prefixLen;
     }
 
     {
-        auto res = fmt::format_to_n(cur, end - cur, FMT_COMPILE(".{:03}"), date.asInt64() % 1000);
+        auto res = fmt::format_to_n(cur, end - cur, FMT_COMPILE(".{:03}"), millis);
         cur = res.out;
         dassert(cur < end && res.size > 0);
     }
 
+    char* suffixBegin = cur;
     if (local) {
         static const size_t localTzSubstrLen = 6;
         dassert(static_cast<size_t>(end - cur) >= localTzSubstrLen + 1);
@@ -249,6 +285,18 @@ DateStringBuffer& DateStringBuffer::iso8601(Date_t date, bool local) {
 
     dassert(cur <= end);
     _size = cur - _data.data();
+
+    // Dates before the epoch format their milliseconds with a sign, which the fast path above does
+    // not reproduce, so only such dates are excluded from the cache.
+    if (millis >= 0 && prefixLen <= sizeof(cache.prefix) &&
+        static_cast<size_t>(cur - suffixBegin) <= sizeof(cache.suffix)) {
+        cache.timeT = timeT;
+        cache.local = local;
+        cache.prefixLen = prefixLen;
+        memcpy(cache.prefix, _data.data(), prefixLen);
+        cache.suffixLen = cur - suffixBegin;
+        memcpy(cache.suffix, suffixBegin, cache.suffixLen);
+    }
     return *this;
 }
 
@@ -41,8 +41,6 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/ctype.h"
 #include "mongo/util/hex.h"
-#include "mongo/util/static_immortal.h"
-#include "mongo/util/synchronized_value.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
@@ -51,9 +49,12 @@ namespace {
 
 using namespace fmt::literals;
 
-synchronized_value<SecureRandom>& uuidGen() {
-    static StaticImmortal<synchronized_value<SecureRandom>> uuidGen;
-    return uuidGen.value();
+SecureRandom& uuidGen() {
+    // Each thread gets its own generator. SecureRandom buffers entropy internally and refills
+    // from the system source in bulk, so drawing a UUID is lock-free and rarely enters the
+    // kernel, where a process-wide generator would serialize all threads on a mutex.
+    thread_local SecureRandom uuidGen;
+    return uuidGen;
 }
 
 }  // namespace
@@ -107,7 +108,7 @@ bool UUID::isRFC4122v4() const {
 
 UUID UUID::gen() {
     UUIDStorage randomBytes;
-    uuidGen()->fill(&randomBytes, sizeof(randomBytes));
+    uuidGen().fill(&randomBytes, sizeof(randomBytes));
 
     // Set version in high 4 bits of byte 6 and variant in high 2 bits of byte 8, see RFC 4122,
     // section 4.1.1, 4.1.2 and 4.1.3.